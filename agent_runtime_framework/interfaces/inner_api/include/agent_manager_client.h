@@ -42,6 +42,10 @@ public:
     void OnLoadSystemAbilityFail();
 
     int32_t GetAllAgentCards(std::vector<AgentCard> &cards);
+    /**
+     * @brief Gets the generation of the stored agent cards, it changes whenever a card is stored or removed.
+     */
+    int32_t GetAgentCardsGeneration(uint64_t &generation);
     int32_t GetAgentCardsByBundleName(const std::string &bundleName, std::vector<AgentCard> &cards);
     int32_t GetAgentCardByAgentId(const std::string &bundleName, const std::string &agentId, AgentCard &card);
     int32_t GetCallerAgentCardByAgentId(const std::string &agentId, AgentCard &card);
@@ -51,6 +51,21 @@ int32_t AgentManagerClient::GetAllAgentCards(std::vector<AgentCard> &cards)
     return AgentCardsRawData::ToAgentCardVec(rawData, cards);
 }
 
+int32_t AgentManagerClient::GetAgentCardsGeneration(uint64_t &generation)
+{
+    HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
+    auto agentMgr = GetAgentMgrProxy();
+    if (agentMgr == nullptr) {
+        TAG_LOGE(AAFwkTag::SER_ROUTER, "null agentmgr");
+        return ERR_NULL_AGENT_MGR_PROXY;
+    }
+    auto ret = agentMgr->GetAgentCardsGeneration(generation);
+    if (ret != ERR_OK) {
+        TAG_LOGE(AAFwkTag::SER_ROUTER, "get generation failed: %{public}d", ret);
+    }
+    return ret;
+}
+
 int32_t AgentManagerClient::GetAgentCardsByBundleName(const std::string &bundleName, std::vector<AgentCard> &cards)
 {
     HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
@@ -16,6 +16,8 @@
 #ifndef OHOS_AGENT_RUNTIME_AGENT_CARD_MGR_H
 #define OHOS_AGENT_RUNTIME_AGENT_CARD_MGR_H
 
+#include <map>
+#include <memory>
 #include <mutex>
 #include <vector>
 
@@ -28,6 +30,8 @@ namespace AppExecFwk {
 struct BundleInfo;
 } // namespace AppExecFwk
 namespace AgentRuntime {
+struct StoredAgentCardEntry;
+
 class AgentCardMgr {
 public:
     static AgentCardMgr &GetInstance();
@@ -58,14 +62,38 @@ public:
 
     int32_t DeleteAgentCard(const std::string &bundleName, const std::string &agentId);
 
+    // Changes whenever stored cards change, pollers may skip card queries while it stays the same.
+    uint64_t GetCardsGeneration() const;
+
 private:
+    // Parsed cards of one bundle of one user, as stored in the db.
+    struct CachedBundleCards;
+    using CardCacheKey = std::pair<int32_t, std::string>;
+
+
     // Merge + persist core; caller supplies the BundleInfo so the pre-install backfill can reuse
     // the already-fetched (EXCLUDE_CLONE) list instead of re-fetching per bundle by name.
     int32_t HandleBundleInstall(const std::string &bundleName, const AppExecFwk::BundleInfo &bundleInfo,
         int32_t userId);
 
+    // Cached cards of the bundle, loaded from the db on miss. Callers hold cardDataMutex_.
+    std::shared_ptr<const CachedBundleCards> GetBundleCardsLocked(const std::string &bundleName, int32_t userId,
+        int32_t &ret);
+    int32_t QueryBundleEntriesLocked(const std::string &bundleName, int32_t userId,
+        std::vector<StoredAgentCardEntry> &entries);
+    int32_t SaveBundleEntriesLocked(const std::string &bundleName, int32_t userId,
+        const std::vector<StoredAgentCardEntry> &entries);
+    int32_t DeleteBundleEntriesLocked(const std::string &bundleName, int32_t userId);
+
     OHOS::AppExecFwk::BundleMgrClient bundleMgrClient_;
     mutable std::mutex cardDataMutex_;
+    // write-through cache of the db, every write goes through cardDataMutex_
+    std::map<CardCacheKey, std::shared_ptr<const CachedBundleCards>> cardCache_;
+    // serialized cards of all bundles, valid while allCardsGeneration_ equals generation_
+    std::shared_ptr<const std::string> allCardsRawData_;
+    uint64_t allCardsGeneration_ = 0;
+    // bumped by every card write, guarded by cardDataMutex_
+    uint64_t generation_ = 1;
     AgentCardMgr();
     ~AgentCardMgr();
 };
@@ -55,6 +55,8 @@ public:
 
     int32_t GetAllAgentCards(AgentCardsRawData &cards) override;
 
+    int32_t GetAgentCardsGeneration(uint64_t &generation) override;
+
     int32_t GetAgentCardsByBundleName(const std::string &bundleName, AgentCardsRawData &cards) override;
 
     int32_t GetAgentCardByAgentId(const std::string &bundleName, const std::string &agentId, AgentCard &card) override;
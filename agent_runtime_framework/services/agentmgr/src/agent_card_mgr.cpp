@@ -76,6 +76,18 @@ std::vector<ExtensionAbilityInfo> CollectExtensionInfos(const BundleInfo &bundle
 }
 } // namespace
 
+struct AgentCardMgr::CachedBundleCards {
+    explicit CachedBundleCards(const std::vector<StoredAgentCardEntry> &storedEntries) : entries(storedEntries)
+    {
+        for (size_t i = 0; i < entries.size(); ++i) {
+            agentIndex.emplace(entries[i].card.agentId, i);
+        }
+    }
+
+    std::vector<StoredAgentCardEntry> entries;
+    std::unordered_map<std::string, size_t> agentIndex;
+};
+
 AgentCardMgr &AgentCardMgr::GetInstance()
 {
     static AgentCardMgr instance;
@@ -167,7 +179,7 @@ int32_t AgentCardMgr::HandleBundleInstall(const std::string &bundleName, const B
 
     std::vector<StoredAgentCardEntry> storedEntries;
     std::lock_guard<std::mutex> lock(cardDataMutex_);
-    int32_t ret = AgentCardDbMgr::GetInstance().QueryData(bundleName, userId, storedEntries);
+    int32_t ret = QueryBundleEntriesLocked(bundleName, userId, storedEntries);
     if (ret != ERR_OK && ret != ERR_NAME_NOT_FOUND) {
         TAG_LOGE(AAFwkTag::SER_ROUTER, "query stored cards failed: %{public}d", ret);
         return ret;
@@ -193,7 +205,7 @@ int32_t AgentCardMgr::HandleBundleInstall(const std::string &bundleName, const B
         storedEntry.card = entry.second;
         storedEntry.updateSource = AgentCardUpdateSource::BUNDLE;
     }
-    return AgentCardDbMgr::GetInstance().InsertData(bundleName, userId, finalEntries);
+    return SaveBundleEntriesLocked(bundleName, userId, finalEntries);
 }
 
 int32_t AgentCardMgr::HandleBundleUpdate(const std::string &bundleName, int32_t userId)
@@ -208,7 +220,7 @@ int32_t AgentCardMgr::HandleBundleRemove(const std::string &bundleName, int32_t
         return AAFwk::INVALID_PARAMETERS_ERR;
     }
     std::lock_guard<std::mutex> lock(cardDataMutex_);
-    return AgentCardDbMgr::GetInstance().DeleteData(bundleName, userId);
+    return DeleteBundleEntriesLocked(bundleName, userId);
 }
 
 void AgentCardMgr::BackfillPreInstallCards()
@@ -254,44 +266,55 @@ int32_t AgentCardMgr::HandlePreInstallBackfill(int32_t userId)
 
 int32_t AgentCardMgr::GetAllAgentCards(AgentCardsRawData &cards)
 {
-    std::vector<StoredAgentCardEntry> entries;
-    int32_t resultCode = AgentCardDbMgr::GetInstance().QueryAllData(entries);
-    AgentCardsRawData::FromAgentCardVec(ExtractCards(entries), cards);
-    return resultCode;
+    std::shared_ptr<const std::string> rawData;
+    {
+        std::lock_guard<std::mutex> lock(cardDataMutex_);
+        if (allCardsRawData_ == nullptr || allCardsGeneration_ != generation_) {
+            std::vector<StoredAgentCardEntry> entries;
+            int32_t resultCode = AgentCardDbMgr::GetInstance().QueryAllData(entries);
+            AgentCardsRawData::FromAgentCardVec(ExtractCards(entries), cards);
+            if (resultCode == ERR_OK) {
+                allCardsRawData_ = std::make_shared<const std::string>(cards.ownedData);
+                allCardsGeneration_ = generation_;
+            }
+            return resultCode;
+        }
+        rawData = allCardsRawData_;
+    }
+    cards.ownedData = *rawData;
+    cards.data = cards.ownedData.data();
+    cards.size = cards.ownedData.size();
+    return ERR_OK;
 }
 
 int32_t AgentCardMgr::GetAgentCardsByBundleName(const std::string &bundleName, std::vector<AgentCard> &cards)
 {
     int32_t userId = IPCSkeleton::GetCallingUid() / BASE_USER_RANGE;
-    std::vector<StoredAgentCardEntry> entries;
     std::lock_guard<std::mutex> lock(cardDataMutex_);
-    int32_t ret = AgentCardDbMgr::GetInstance().QueryData(bundleName, userId, entries);
-    if (ret == ERR_OK) {
-        cards = ExtractCards(entries);
+    int32_t ret = ERR_OK;
+    auto bundleCards = GetBundleCardsLocked(bundleName, userId, ret);
+    if (bundleCards != nullptr) {
+        cards = ExtractCards(bundleCards->entries);
     }
     return ret;
 }
 
 int32_t AgentCardMgr::GetAgentCardByAgentId(const std::string &bundleName, const std::string &agentId, AgentCard &card)
 {
-    std::vector<AgentCard> cards;
-    int32_t resultCode = GetAgentCardsByBundleName(bundleName, cards);
-    if (resultCode != ERR_OK) {
+    int32_t userId = IPCSkeleton::GetCallingUid() / BASE_USER_RANGE;
+    std::lock_guard<std::mutex> lock(cardDataMutex_);
+    int32_t resultCode = ERR_OK;
+    auto bundleCards = GetBundleCardsLocked(bundleName, userId, resultCode);
+    if (bundleCards == nullptr) {
         TAG_LOGE(AAFwkTag::SER_ROUTER, "failed: %{public}d", resultCode);
         return resultCode;
     }
-    bool found = false;
-    for (const AgentCard &agentCard : cards) {
-        if (agentCard.agentId == agentId) {
-            card = agentCard;
-            found = true;
-            break;
-        }
-    }
-    if (!found) {
+    auto iter = bundleCards->agentIndex.find(agentId);
+    if (iter == bundleCards->agentIndex.end()) {
         TAG_LOGE(AAFwkTag::SER_ROUTER, "not found");
         return ERR_NAME_NOT_FOUND;
     }
+    card = bundleCards->entries[iter->second].card;
     return resultCode;
 }
 
@@ -328,7 +351,7 @@ int32_t AgentCardMgr::RegisterAgentCard(const AgentCard &card)
 
     std::vector<StoredAgentCardEntry> entries;
     std::lock_guard<std::mutex> lock(cardDataMutex_);
-    int32_t ret = AgentCardDbMgr::GetInstance().QueryData(registerCard.appInfo->bundleName, userId, entries);
+    int32_t ret = QueryBundleEntriesLocked(registerCard.appInfo->bundleName, userId, entries);
     if (ret != ERR_OK && ret != ERR_NAME_NOT_FOUND) {
         TAG_LOGE(AAFwkTag::SER_ROUTER, "query data failed: %{public}d", ret);
         return ret;
@@ -347,7 +370,7 @@ int32_t AgentCardMgr::RegisterAgentCard(const AgentCard &card)
     }
 
     entries.push_back({registerCard, AgentCardUpdateSource::API});
-    return AgentCardDbMgr::GetInstance().InsertData(registerCard.appInfo->bundleName, userId, entries);
+    return SaveBundleEntriesLocked(registerCard.appInfo->bundleName, userId, entries);
 }
 
 int32_t AgentCardMgr::UpdateAgentCard(const AgentCard &card)
@@ -374,7 +397,7 @@ int32_t AgentCardMgr::UpdateAgentCard(const AgentCard &card)
 
     std::vector<StoredAgentCardEntry> entries;
     std::lock_guard<std::mutex> lock(cardDataMutex_);
-    int32_t ret = AgentCardDbMgr::GetInstance().QueryData(card.appInfo->bundleName, userId, entries);
+    int32_t ret = QueryBundleEntriesLocked(card.appInfo->bundleName, userId, entries);
     if (ret == ERR_NAME_NOT_FOUND) {
         TAG_LOGE(AAFwkTag::SER_ROUTER, "bundle cards not found");
         return AAFwk::ERR_INVALID_AGENT_CARD_ID;
@@ -415,7 +438,7 @@ int32_t AgentCardMgr::UpdateAgentCard(const AgentCard &card)
 
     it->card = card;
     it->updateSource = AgentCardUpdateSource::API;
-    return AgentCardDbMgr::GetInstance().InsertData(card.appInfo->bundleName, userId, entries);
+    return SaveBundleEntriesLocked(card.appInfo->bundleName, userId, entries);
 }
 
 int32_t AgentCardMgr::DeleteAgentCard(const std::string &bundleName, const std::string &agentId)
@@ -428,7 +451,7 @@ int32_t AgentCardMgr::DeleteAgentCard(const std::string &bundleName, const std::
     int32_t userId = IPCSkeleton::GetCallingUid() / BASE_USER_RANGE;
     std::vector<StoredAgentCardEntry> bundleCards;
     std::lock_guard<std::mutex> lock(cardDataMutex_);
-    int32_t ret = AgentCardDbMgr::GetInstance().QueryData(bundleName, userId, bundleCards);
+    int32_t ret = QueryBundleEntriesLocked(bundleName, userId, bundleCards);
     if (ret == ERR_NAME_NOT_FOUND) {
         TAG_LOGE(AAFwkTag::SER_ROUTER, "bundle cards not found");
         return AAFwk::ERR_INVALID_AGENT_CARD_ID;
@@ -447,9 +470,65 @@ int32_t AgentCardMgr::DeleteAgentCard(const std::string &bundleName, const std::
     bundleCards.erase(bundleIt, bundleCards.end());
 
     if (bundleCards.empty()) {
-        return AgentCardDbMgr::GetInstance().DeleteData(bundleName, userId);
+        return DeleteBundleEntriesLocked(bundleName, userId);
     }
-    return AgentCardDbMgr::GetInstance().InsertData(bundleName, userId, bundleCards);
+    return SaveBundleEntriesLocked(bundleName, userId, bundleCards);
+}
+
+uint64_t AgentCardMgr::GetCardsGeneration() const
+{
+    std::lock_guard<std::mutex> lock(cardDataMutex_);
+    return generation_;
+}
+
+std::shared_ptr<const AgentCardMgr::CachedBundleCards> AgentCardMgr::GetBundleCardsLocked(
+    const std::string &bundleName, int32_t userId, int32_t &ret)
+{
+    auto iter = cardCache_.find({ userId, bundleName });
+    if (iter != cardCache_.end()) {
+        ret = ERR_OK;
+        return iter->second;
+    }
+    std::vector<StoredAgentCardEntry> entries;
+    ret = AgentCardDbMgr::GetInstance().QueryData(bundleName, userId, entries);
+    if (ret != ERR_OK) {
+        return nullptr;
+    }
+    auto bundleCards = std::make_shared<const CachedBundleCards>(entries);
+    cardCache_.emplace(CardCacheKey(userId, bundleName), bundleCards);
+    return bundleCards;
+}
+
+int32_t AgentCardMgr::QueryBundleEntriesLocked(const std::string &bundleName, int32_t userId,
+    std::vector<StoredAgentCardEntry> &entries)
+{
+    int32_t ret = ERR_OK;
+    auto bundleCards = GetBundleCardsLocked(bundleName, userId, ret);
+    if (bundleCards != nullptr) {
+        entries = bundleCards->entries;
+    }
+    return ret;
+}
+
+int32_t AgentCardMgr::SaveBundleEntriesLocked(const std::string &bundleName, int32_t userId,
+    const std::vector<StoredAgentCardEntry> &entries)
+{
+    int32_t ret = AgentCardDbMgr::GetInstance().InsertData(bundleName, userId, entries);
+    if (ret == ERR_OK) {
+        cardCache_[{ userId, bundleName }] = std::make_shared<const CachedBundleCards>(entries);
+    } else {
+        // the db may hold either version now, read it again next time
+        cardCache_.erase({ userId, bundleName });
+    }
+    generation_++;
+    return ret;
+}
+
+int32_t AgentCardMgr::DeleteBundleEntriesLocked(const std::string &bundleName, int32_t userId)
+{
+    cardCache_.erase({ userId, bundleName });
+    generation_++;
+    return AgentCardDbMgr::GetInstance().DeleteData(bundleName, userId);
 }
 } // namespace AgentRuntime
 } // namespace OHOS
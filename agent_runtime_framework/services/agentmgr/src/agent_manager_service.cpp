@@ -167,6 +167,21 @@ int32_t AgentManagerService::GetAllAgentCards(AgentCardsRawData &cards)
     return AgentCardMgr::GetInstance().GetAllAgentCards(cards);
 }
 
+int32_t AgentManagerService::GetAgentCardsGeneration(uint64_t &generation)
+{
+    if (!AAFwk::PermissionVerification::GetInstance()->JudgeCallerIsAllowedToUseSystemAPI()) {
+        TAG_LOGE(AAFwkTag::SER_ROUTER, "caller no system-app, can not use system-api");
+        return AAFwk::ERR_NOT_SYSTEM_APP;
+    }
+    if (!AAFwk::PermissionVerification::GetInstance()->VerifyCallingPermission(
+        AAFwk::PermissionConstants::PERMISSION_GET_AGENT_CARD)) {
+        TAG_LOGE(AAFwkTag::SER_ROUTER, "Permission verification failed");
+        return ERR_PERMISSION_DENIED;
+    }
+    generation = AgentCardMgr::GetInstance().GetCardsGeneration();
+    return ERR_OK;
+}
+
 int32_t AgentManagerService::GetAgentCardsByBundleName(const std::string &bundleName, AgentCardsRawData &cards)
 {
     if (!AAFwk::PermissionVerification::GetInstance()->JudgeCallerIsAllowedToUseSystemAPI()) {
@@ -16,6 +16,8 @@
 #ifndef OHOS_ABILITY_RUNTIME_CLI_TOOL_DATA_MANAGER_H
 #define OHOS_ABILITY_RUNTIME_CLI_TOOL_DATA_MANAGER_H
 
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -27,6 +29,24 @@
 namespace OHOS {
 namespace CliTool {
 
+/**
+ * @brief Parsed tools of the KVStore, never changed once published
+ */
+struct CliToolCatalog {
+    uint64_t revision = 0;
+    std::vector<ToolInfo> tools;         // sorted by name, names are unique
+    std::vector<ToolSummary> summaries;  // same order as tools
+    std::vector<std::string> entries;    // same order as tools, each tool as serialized in rawData
+    std::string rawData;                 // tools serialized by ToolsRawData::FromToolInfoVec
+
+    /**
+     * @brief Find a tool by name
+     * @param name Tool name
+     * @return const ToolInfo* The tool, nullptr if not in the catalog
+     */
+    const ToolInfo *FindTool(const std::string &name) const;
+};
+
 class CliToolDataManager {
 public:
     /**
@@ -78,6 +98,19 @@ public:
      */
     int32_t EnsureToolsLoaded();
 
+    /**
+     * @brief Get the parsed tools, loaded from KVStore on first use
+     * @param catalog Output catalog, safe to read without any lock
+     * @return int32_t ERR_OK on success, error code otherwise
+     */
+    int32_t GetToolCatalog(std::shared_ptr<const CliToolCatalog> &catalog);
+
+    /**
+     * @brief Get the revision of the tools, increased on every change of them
+     * @return uint64_t Revision, equal to CliToolCatalog::revision of an up-to-date catalog
+     */
+    uint64_t GetToolsRevision() const;
+
 private:
     CliToolDataManager();
     ~CliToolDataManager();
@@ -131,10 +164,25 @@ private:
      */
     int32_t SyncToolNames(const std::vector<std::string> &currentToolNames);
 
+    /**
+     * @brief Publish a catalog with the tool added or replaced (caller must hold lock)
+     * @param tool ToolInfo stored in KVStore
+     */
+    void UpdateCatalogTool(const ToolInfo &tool);
+
+    /**
+     * @brief Publish a catalog without the tool (caller must hold lock)
+     * @param name Name of the tool deleted from KVStore
+     */
+    void RemoveCatalogTool(const std::string &name);
+
     DistributedKv::DistributedKvDataManager dataManager_;
     std::shared_ptr<DistributedKv::SingleKvStore> kvStorePtr_;
     mutable std::mutex kvStorePtrMutex_;
     std::atomic<bool> toolsLoaded_ = false;
+    // read and written with std::atomic_load and std::atomic_store, written under kvStorePtrMutex_
+    std::shared_ptr<const CliToolCatalog> catalog_;
+    std::atomic<uint64_t> catalogRevision_ = 0;
 };
 
 } // namespace CliTool
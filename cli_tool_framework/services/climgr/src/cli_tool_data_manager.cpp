@@ -15,7 +15,9 @@
 
 #include "cli_tool_data_manager.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cinttypes>
 #include <dirent.h>
 #include <fstream>
 #include <nlohmann/json.hpp>
@@ -39,6 +41,78 @@ constexpr const char* ALL_CLI_TOOL_NAMES_KEY = "AllCliToolNames";
 
 const DistributedKv::AppId APP_ID { KV_STORE_APP_ID };
 const DistributedKv::StoreId STORE_ID { KV_STORE_STORE_ID };
+
+std::vector<ToolInfo>::const_iterator LowerBoundTool(const std::vector<ToolInfo> &tools, const std::string &name)
+{
+    return std::lower_bound(tools.begin(), tools.end(), name, [](const ToolInfo &tool, const std::string &value) {
+        return tool.name < value;
+    });
+}
+
+ToolSummary MakeToolSummary(const ToolInfo &tool)
+{
+    ToolSummary summary;
+    summary.name = tool.name;
+    summary.version = tool.version;
+    summary.description = tool.description;
+    return summary;
+}
+
+// one tool in the layout of ToolsRawData::FromToolInfoVec: length, then the dumped json
+std::string SerializeToolEntry(const ToolInfo &tool)
+{
+    std::string dumped = tool.ParseToJson().dump();
+    uint32_t strLen = dumped.length();
+    std::string entry(reinterpret_cast<const char*>(&strLen), sizeof(strLen));
+    entry.append(dumped);
+    return entry;
+}
+
+void JoinRawData(CliToolCatalog &catalog)
+{
+    uint32_t count = catalog.entries.size();
+    size_t size = sizeof(count);
+    for (const auto &entry : catalog.entries) {
+        size += entry.size();
+    }
+    catalog.rawData.clear();
+    catalog.rawData.reserve(size);
+    catalog.rawData.append(reinterpret_cast<const char*>(&count), sizeof(count));
+    for (const auto &entry : catalog.entries) {
+        catalog.rawData.append(entry);
+    }
+}
+
+std::shared_ptr<const CliToolCatalog> BuildCatalog(std::vector<ToolInfo> tools, uint64_t revision)
+{
+    auto catalog = std::make_shared<CliToolCatalog>();
+    catalog->revision = revision;
+    std::stable_sort(tools.begin(), tools.end(), [](const ToolInfo &left, const ToolInfo &right) {
+        return left.name < right.name;
+    });
+    for (auto &tool : tools) {
+        if (!catalog->tools.empty() && catalog->tools.back().name == tool.name) {
+            catalog->tools.back() = std::move(tool);
+            continue;
+        }
+        catalog->tools.push_back(std::move(tool));
+    }
+    for (const auto &tool : catalog->tools) {
+        catalog->summaries.push_back(MakeToolSummary(tool));
+        catalog->entries.push_back(SerializeToolEntry(tool));
+    }
+    JoinRawData(*catalog);
+    return catalog;
+}
+}
+
+const ToolInfo *CliToolCatalog::FindTool(const std::string &name) const
+{
+    auto iter = LowerBoundTool(tools, name);
+    if (iter == tools.end() || iter->name != name) {
+        return nullptr;
+    }
+    return &*iter;
 }
 
 CliToolDataManager &CliToolDataManager::GetInstance()
@@ -193,6 +267,7 @@ int32_t CliToolDataManager::SyncToolNames(const std::vector<std::string> &curren
                         DistributedKv::Status deleteStatus = kvStorePtr_->Delete(toolKey);
                         if (deleteStatus == DistributedKv::Status::SUCCESS) {
                             TAG_LOGI(AAFwkTag::CLI_TOOL, "Removed tool: %{public}s", oldName.c_str());
+                            RemoveCatalogTool(oldName);
                         } else {
                             TAG_LOGW(AAFwkTag::CLI_TOOL, "Failed to remove tool: %{public}s", oldName.c_str());
                         }
@@ -259,9 +334,18 @@ int32_t CliToolDataManager::ParseToolFromJsonFile(const std::string &filePath, T
     return ERR_OK;
 }
 
-int32_t CliToolDataManager::GetAllTools(std::vector<ToolInfo> &tools)
+int32_t CliToolDataManager::GetToolCatalog(std::shared_ptr<const CliToolCatalog> &catalog)
 {
+    catalog = std::atomic_load(&catalog_);
+    if (catalog != nullptr) {
+        return ERR_OK;
+    }
+
     std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
+    catalog = std::atomic_load(&catalog_);
+    if (catalog != nullptr) {
+        return ERR_OK;
+    }
     if (!CheckKvStore()) {
         TAG_LOGE(AAFwkTag::CLI_TOOL, "null kvStore");
         return ERR_NO_INIT;
@@ -274,7 +358,7 @@ int32_t CliToolDataManager::GetAllTools(std::vector<ToolInfo> &tools)
         return status;
     }
 
-    tools.clear();
+    std::vector<ToolInfo> tools;
     for (const auto &entry : allEntries) {
         nlohmann::json j = nlohmann::json::parse(entry.value.ToString(), nullptr, false);
         if (j.is_discarded()) {
@@ -286,19 +370,87 @@ int32_t CliToolDataManager::GetAllTools(std::vector<ToolInfo> &tools)
             tools.push_back(std::move(tool));
         }
     }
+    catalog = BuildCatalog(std::move(tools), catalogRevision_);
+    std::atomic_store(&catalog_, catalog);
+    TAG_LOGI(AAFwkTag::CLI_TOOL, "Loaded %{public}zu tools, revision: %{public}" PRIu64,
+        catalog->tools.size(), catalog->revision);
+    return ERR_OK;
+}
+
+uint64_t CliToolDataManager::GetToolsRevision() const
+{
+    return catalogRevision_;
+}
 
+void CliToolDataManager::UpdateCatalogTool(const ToolInfo &tool)
+{
+    auto catalog = std::atomic_load(&catalog_);
+    if (catalog == nullptr) {
+        catalogRevision_++;
+        return;
+    }
+    // only the stored tool is serialized again, the others keep their entries
+    auto newCatalog = std::make_shared<CliToolCatalog>(*catalog);
+    newCatalog->revision = ++catalogRevision_;
+    auto offset = LowerBoundTool(newCatalog->tools, tool.name) - newCatalog->tools.cbegin();
+    if (offset < static_cast<std::ptrdiff_t>(newCatalog->tools.size()) &&
+        newCatalog->tools[offset].name == tool.name) {
+        newCatalog->tools[offset] = tool;
+        newCatalog->summaries[offset] = MakeToolSummary(tool);
+        newCatalog->entries[offset] = SerializeToolEntry(tool);
+    } else {
+        newCatalog->tools.insert(newCatalog->tools.begin() + offset, tool);
+        newCatalog->summaries.insert(newCatalog->summaries.begin() + offset, MakeToolSummary(tool));
+        newCatalog->entries.insert(newCatalog->entries.begin() + offset, SerializeToolEntry(tool));
+    }
+    JoinRawData(*newCatalog);
+    std::atomic_store(&catalog_, std::shared_ptr<const CliToolCatalog>(std::move(newCatalog)));
+}
+
+void CliToolDataManager::RemoveCatalogTool(const std::string &name)
+{
+    auto catalog = std::atomic_load(&catalog_);
+    if (catalog == nullptr) {
+        catalogRevision_++;
+        return;
+    }
+    if (catalog->FindTool(name) == nullptr) {
+        return;
+    }
+    auto newCatalog = std::make_shared<CliToolCatalog>(*catalog);
+    newCatalog->revision = ++catalogRevision_;
+    auto offset = LowerBoundTool(newCatalog->tools, name) - newCatalog->tools.cbegin();
+    newCatalog->tools.erase(newCatalog->tools.begin() + offset);
+    newCatalog->summaries.erase(newCatalog->summaries.begin() + offset);
+    newCatalog->entries.erase(newCatalog->entries.begin() + offset);
+    JoinRawData(*newCatalog);
+    std::atomic_store(&catalog_, std::shared_ptr<const CliToolCatalog>(std::move(newCatalog)));
+}
+
+int32_t CliToolDataManager::GetAllTools(std::vector<ToolInfo> &tools)
+{
+    std::shared_ptr<const CliToolCatalog> catalog;
+    int32_t ret = GetToolCatalog(catalog);
+    if (ret != ERR_OK) {
+        return ret;
+    }
+
+    tools = catalog->tools;
     TAG_LOGI(AAFwkTag::CLI_TOOL, "Retrieved %{public}zu tools", tools.size());
     return ERR_OK;
 }
 
 int32_t CliToolDataManager::GetAllToolsRawData(ToolsRawData &rawData)
 {
-    std::vector<ToolInfo> tools;
-    int32_t ret = GetAllTools(tools);
+    std::shared_ptr<const CliToolCatalog> catalog;
+    int32_t ret = GetToolCatalog(catalog);
     if (ret != ERR_OK) {
         return ret;
     }
-    ToolsRawData::FromToolInfoVec(tools, rawData);
+    rawData.ownedData = catalog->rawData;
+    rawData.data = rawData.ownedData.data();
+    rawData.size = rawData.ownedData.size();
+    rawData.isMalloc = false;
     return ERR_OK;
 }
 
@@ -306,6 +458,16 @@ int32_t CliToolDataManager::GetToolByName(const std::string &name, ToolInfo &too
 {
     TAG_LOGI(AAFwkTag::CLI_TOOL, "GetToolByName called: %{public}s", name.c_str());
 
+    std::shared_ptr<const CliToolCatalog> catalog;
+    if (GetToolCatalog(catalog) == ERR_OK) {
+        const ToolInfo *cached = catalog->FindTool(name);
+        if (cached != nullptr) {
+            tool = *cached;
+            return ERR_OK;
+        }
+    }
+
+    // not in the catalog, let the KVStore tell a missing tool from a broken one
     std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
     if (!CheckKvStore()) {
         TAG_LOGE(AAFwkTag::SER_ROUTER, "null kvStore");
@@ -371,43 +533,19 @@ int32_t CliToolDataManager::StoreTool(const ToolInfo &tool)
     }
 
     TAG_LOGI(AAFwkTag::CLI_TOOL, "Stored tool: %{public}s", tool.name.c_str());
+    UpdateCatalogTool(tool);
     return ERR_OK;
 }
 
 int32_t CliToolDataManager::QueryToolSummaries(std::vector<ToolSummary> &summaries)
 {
-    std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-    if (!CheckKvStore()) {
-        TAG_LOGE(AAFwkTag::CLI_TOOL, "null kvStore");
-        return ERR_NO_INIT;
-    }
-
-    std::vector<DistributedKv::Entry> allEntries;
-    DistributedKv::Status status = kvStorePtr_->GetEntries(nullptr, allEntries);
-    if (status != DistributedKv::Status::SUCCESS) {
-        status = RestoreKvStore(status);
-        return status;
-    }
-
-    summaries.clear();
-    for (const auto &entry : allEntries) {
-        nlohmann::json j = nlohmann::json::parse(entry.value.ToString(), nullptr, false);
-        if (j.is_discarded()) {
-            TAG_LOGW(AAFwkTag::CLI_TOOL, "Failed to parse tool: %{public}s", entry.key.ToString().c_str());
-            continue;
-        }
-        ToolInfo tool;
-        if (!ToolInfo::ParseFromJson(j, tool)) {
-            continue;
-        }
-
-        ToolSummary summary;
-        summary.name = tool.name;
-        summary.version = tool.version;
-        summary.description = tool.description;
-        summaries.push_back(summary);
+    std::shared_ptr<const CliToolCatalog> catalog;
+    int32_t ret = GetToolCatalog(catalog);
+    if (ret != ERR_OK) {
+        return ret;
     }
 
+    summaries = catalog->summaries;
     TAG_LOGI(AAFwkTag::CLI_TOOL, "Retrieved %{public}zu tool summaries", summaries.size());
     return ERR_OK;
 }
@@ -427,6 +565,8 @@ DistributedKv::Status CliToolDataManager::RestoreKvStore(DistributedKv::Status s
             .baseDir = CLI_TOOLS_STORAGE_DIR
         };
         dataManager_.DeleteKvStore(APP_ID, STORE_ID, options.baseDir);
+        catalogRevision_++;
+        std::atomic_store(&catalog_, std::shared_ptr<const CliToolCatalog>());
         status = dataManager_.GetSingleKvStore(options, APP_ID, STORE_ID, kvStorePtr_);
         TAG_LOGE(AAFwkTag::CLI_TOOL, "Recreated KVStore with status: %{public}d", static_cast<int>(status));
     }
@@ -122,6 +122,7 @@ void CliToolDataManagerTest::TearDown()
     std::remove(TEST_TOOL3_FILE);
     CliToolDataManager::GetInstance().kvStorePtr_ = nullptr;
     CliToolDataManager::GetInstance().toolsLoaded_ = false;
+    CliToolDataManager::GetInstance().catalog_ = nullptr;
 }
 
 namespace {
@@ -1120,5 +1121,108 @@ HWTEST_F(CliToolDataManagerTest, CliToolDataManager_QueryToolSummaries_0100, Tes
     TAG_LOGI(AAFwkTag::ABILITYMGR, "CliToolDataManager_QueryToolSummaries_0100 end");
 }
 
+// ==================== ToolCatalog Tests ====================
+
+/**
+ * @tc.name: CliToolDataManager_ToolCatalog_001
+ * @tc.desc: Test the catalog is loaded once and follows the tools stored and removed afterwards
+ * @tc.type: FUNC
+ */
+HWTEST_F(CliToolDataManagerTest, CliToolDataManager_ToolCatalog_001, TestSize.Level1)
+{
+    auto mockStore = std::make_shared<MockSingleKvStore>();
+    mockStore->SetMockData("ohos-tool_b", BuildToolJson("ohos-tool_b"));
+    mockStore->SetMockData("ohos-tool_a", BuildToolJson("ohos-tool_a"));
+    auto &dataManager = CliToolDataManager::GetInstance();
+    dataManager.kvStorePtr_ = mockStore;
+
+    std::shared_ptr<const CliToolCatalog> catalog;
+    ASSERT_EQ(dataManager.GetToolCatalog(catalog), ERR_OK);
+    ASSERT_EQ(catalog->tools.size(), 2u);
+    EXPECT_EQ(catalog->tools[0].name, "ohos-tool_a");
+    EXPECT_EQ(catalog->summaries[1].name, "ohos-tool_b");
+    EXPECT_EQ(catalog->revision, dataManager.GetToolsRevision());
+
+    // served from the catalog without reading KVStore again
+    mockStore->GetEntries_ = DistributedKv::Status::ERROR;
+    mockStore->Get_ = DistributedKv::Status::ERROR;
+    std::vector<ToolSummary> summaries;
+    EXPECT_EQ(dataManager.QueryToolSummaries(summaries), ERR_OK);
+    EXPECT_EQ(summaries.size(), 2u);
+    ToolInfo tool;
+    EXPECT_EQ(dataManager.GetToolByName("ohos-tool_b", tool), ERR_OK);
+    EXPECT_EQ(tool.name, "ohos-tool_b");
+
+    uint64_t revision = dataManager.GetToolsRevision();
+    ToolInfo newTool;
+    newTool.name = "ohos-tool_c";
+    newTool.description = "New tool";
+    EXPECT_EQ(dataManager.StoreTool(newTool), ERR_OK);
+    EXPECT_GT(dataManager.GetToolsRevision(), revision);
+    ASSERT_EQ(dataManager.GetToolCatalog(catalog), ERR_OK);
+    EXPECT_EQ(catalog->revision, dataManager.GetToolsRevision());
+    ASSERT_EQ(catalog->tools.size(), 3u);
+    EXPECT_EQ(catalog->summaries[2].description, "New tool");
+
+    revision = dataManager.GetToolsRevision();
+    dataManager.RemoveCatalogTool("ohos-tool_missing");
+    EXPECT_EQ(dataManager.GetToolsRevision(), revision);
+    dataManager.RemoveCatalogTool("ohos-tool_a");
+    EXPECT_GT(dataManager.GetToolsRevision(), revision);
+    ASSERT_EQ(dataManager.GetToolCatalog(catalog), ERR_OK);
+    EXPECT_EQ(catalog->revision, dataManager.GetToolsRevision());
+    ASSERT_EQ(catalog->tools.size(), 2u);
+    EXPECT_EQ(catalog->FindTool("ohos-tool_a"), nullptr);
+    ASSERT_NE(catalog->FindTool("ohos-tool_c"), nullptr);
+    EXPECT_EQ(catalog->FindTool("ohos-tool_c")->name, "ohos-tool_c");
+}
+
+/**
+ * @tc.name: CliToolDataManager_ToolCatalog_002
+ * @tc.desc: Test tools stored one by one keep the catalog sorted and its raw data equal to a full serialization
+ * @tc.type: FUNC
+ */
+HWTEST_F(CliToolDataManagerTest, CliToolDataManager_ToolCatalog_002, TestSize.Level1)
+{
+    auto mockStore = std::make_shared<MockSingleKvStore>();
+    auto &dataManager = CliToolDataManager::GetInstance();
+    dataManager.kvStorePtr_ = mockStore;
+    std::shared_ptr<const CliToolCatalog> catalog;
+    ASSERT_EQ(dataManager.GetToolCatalog(catalog), ERR_OK);
+    EXPECT_TRUE(catalog->tools.empty());
+
+    for (const auto &name : { "ohos-tool_d", "ohos-tool_b", "ohos-tool_e", "ohos-tool_a", "ohos-tool_c" }) {
+        ToolInfo tool;
+        ASSERT_TRUE(ToolInfo::ParseFromJson(nlohmann::json::parse(BuildToolJson(name, "Old tool")), tool));
+        EXPECT_EQ(dataManager.StoreTool(tool), ERR_OK);
+    }
+    ToolInfo replaced;
+    ASSERT_TRUE(ToolInfo::ParseFromJson(nlohmann::json::parse(BuildToolJson("ohos-tool_c", "New tool")), replaced));
+    EXPECT_EQ(dataManager.StoreTool(replaced), ERR_OK);
+    dataManager.RemoveCatalogTool("ohos-tool_d");
+    dataManager.RemoveCatalogTool("ohos-tool_missing");
+
+    ASSERT_EQ(dataManager.GetToolCatalog(catalog), ERR_OK);
+    std::vector<std::string> names;
+    for (const auto &tool : catalog->tools) {
+        names.push_back(tool.name);
+    }
+    EXPECT_EQ(names, std::vector<std::string>({ "ohos-tool_a", "ohos-tool_b", "ohos-tool_c", "ohos-tool_e" }));
+    ASSERT_EQ(catalog->summaries.size(), names.size());
+    EXPECT_EQ(catalog->summaries[2].name, "ohos-tool_c");
+    EXPECT_EQ(catalog->summaries[2].description, "New tool");
+
+    ToolsRawData expected;
+    ToolsRawData::FromToolInfoVec(catalog->tools, expected);
+    EXPECT_EQ(catalog->rawData, expected.ownedData);
+
+    ToolsRawData rawData;
+    ASSERT_EQ(dataManager.GetAllToolsRawData(rawData), ERR_OK);
+    std::vector<ToolInfo> tools;
+    ASSERT_EQ(ToolsRawData::ToToolInfoVec(rawData, tools), ERR_OK);
+    ASSERT_EQ(tools.size(), names.size());
+    EXPECT_EQ(tools[2].description, "New tool");
+}
+
 } // namespace CliTool
 } // namespace OHOS
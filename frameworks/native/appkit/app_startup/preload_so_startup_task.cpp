@@ -114,6 +114,11 @@ const std::string &PreloadSoStartupTask::GetType() const
     return AppStartupTask::TASK_TYPE_PRELOAD_SO;
 }
 
+const std::string &PreloadSoStartupTask::GetOhmUrl() const
+{
+    return ohmUrl_;
+}
+
 int32_t PreloadSoStartupTask::RunTaskInit(std::unique_ptr<StartupTaskResultCallback> callback)
 {
     std::string soName;
@@ -15,6 +15,8 @@
 
 #include "startup_manager.h"
 
+#include <chrono>
+#include <cinttypes>
 #include <fstream>
 #include <nlohmann/json.hpp>
 #include <set>
@@ -23,11 +25,13 @@
 #include "config_policy_utils.h"
 #include "extractor.h"
 #include "event_report.h"
+#include "ffrt.h"
 #include "hilog_tag_wrapper.h"
 #include "hitrace_meter.h"
 #include "native_startup_task.h"
 #include "preload_system_so_startup_task.h"
 #include "preload_so_startup_task.h"
+#include "startup_task_cost_recorder.h"
 #include "startup_utils.h"
 
 namespace OHOS {
@@ -63,8 +67,15 @@ constexpr const char* PRELOAD_SYSTEM_SO_STARTUP_TASKS = "systemPreloadHintStartu
 constexpr const char* PRELOAD_SYSTEM_SO_ALLOWLIST_FILE_PATH = "/etc/ability_runtime_app_startup.json";
 constexpr const char* SYSTEM_PRELOAD_SO_ALLOW_LIST = "systemPreloadSoAllowList";
 constexpr const char* ARK_TS_MODE = "arkTSMode";
+constexpr const char* STARTUP_PROFILE_CACHE_DIR = "/data/storage/el2/base/cache/startup_profile";
+constexpr const char* SAVE_STARTUP_TASK_COST = "SaveStartupTaskCost";
 constexpr const int32_t PRIORITY_PRELOAD_SO = -20;
 
+int64_t GetElapsedUs(const std::chrono::steady_clock::time_point &begin)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+}
+
 struct StartupTaskResultCallbackInfo {
     std::unique_ptr<StartupTaskResultCallback> callback_;
 
@@ -187,6 +198,7 @@ int32_t StartupManager::BuildAutoAppStartupTaskManager(std::shared_ptr<AAFwk::Wa
         AddStartupTask(dep, autoStartupTasks, appStartupTasks_);
     }
 
+    StartupTaskCostRecorder::GetInstance().Load(STARTUP_PROFILE_CACHE_DIR);
     std::lock_guard guard(startupTaskManagerMutex_);
     TAG_LOGD(AAFwkTag::STARTUP, "autoStartupTasksManager build, id: %{public}u, tasks num: %{public}zu",
         startupTaskManagerId, autoStartupTasks.size());
@@ -287,6 +299,7 @@ int32_t StartupManager::BuildAppStartupTaskManager(const std::vector<std::string
         return result;
     }
 
+    StartupTaskCostRecorder::GetInstance().Load(STARTUP_PROFILE_CACHE_DIR);
     std::lock_guard guard(startupTaskManagerMutex_);
     TAG_LOGD(AAFwkTag::STARTUP, "startupTasksManager build, id: %{public}u, tasks num: %{public}zu",
         startupTaskManagerId, currentStartupTasks.size());
@@ -309,6 +322,10 @@ int32_t StartupManager::OnStartupTaskManagerComplete(uint32_t id)
     }
     TAG_LOGD(AAFwkTag::STARTUP, "erase StartupTaskManager id: %{public}u", id);
     startupTaskManagerMap_.erase(result);
+    ffrt::task_attr attr;
+    attr.name(SAVE_STARTUP_TASK_COST);
+    attr.qos(ffrt_qos_background);
+    ffrt::submit([]() { StartupTaskCostRecorder::GetInstance().Save(); }, attr);
     return ERR_OK;
 }
 
@@ -520,6 +537,7 @@ int32_t StartupManager::BuildStartupTaskManager(const std::map<std::string, std:
         TAG_LOGE(AAFwkTag::STARTUP, "input tasks empty.");
         return ERR_STARTUP_INTERNAL_ERROR;
     }
+    StartupTaskCostRecorder::GetInstance().Load(STARTUP_PROFILE_CACHE_DIR);
     std::lock_guard guard(startupTaskManagerMutex_);
     startupTaskManager = std::make_shared<StartupTaskManager>(startupTaskManagerId, tasks);
     if (startupTaskManager == nullptr) {
@@ -672,8 +690,8 @@ int32_t StartupManager::RunLoadModuleStartupConfigTask(
     }
     TAG_LOGD(AAFwkTag::STARTUP, "load module %{public}s, type: %{public}d", hapModuleInfo->name.c_str(),
         hapModuleInfo->moduleType);
-    std::string configStr;
-    int32_t result = GetStartupConfigString(configInfo, configStr);
+    ModuleStartupProfile profile;
+    int32_t result = LoadModuleStartupProfile(configInfo, profile);
     if (result != ERR_OK) {
         return result;
     }
@@ -681,13 +699,8 @@ int32_t StartupManager::RunLoadModuleStartupConfigTask(
     std::map<std::string, std::shared_ptr<AppStartupTask>> preloadSystemSoStartupTasks;
     std::vector<StartupTaskInfo> pendingStartupTaskInfos;
     std::pair<std::string, std::string> pendingConfigEntry;
-    bool success = AnalyzeStartupConfig(configInfo, configStr, preloadSoStartupTasks,
-        preloadSystemSoStartupTasks, pendingStartupTaskInfos, pendingConfigEntry);
-    if (!success) {
-        TAG_LOGE(AAFwkTag::STARTUP, "failed to parse app startup module %{public}s, type: %{public}d",
-            configInfo.name_.c_str(), configInfo.moduleType_);
-        return ERR_STARTUP_CONFIG_PARSE_ERROR;
-    }
+    ApplyStartupProfile(configInfo, profile, preloadSoStartupTasks, preloadSystemSoStartupTasks,
+        pendingStartupTaskInfos, pendingConfigEntry);
     std::lock_guard guard(appStartupConfigInitializationMutex_);
     preloadSoStartupTasks_.insert(preloadSoStartupTasks.begin(), preloadSoStartupTasks.end());
     pendingStartupTaskInfos_.insert(pendingStartupTaskInfos_.end(), pendingStartupTaskInfos.begin(),
@@ -724,18 +737,13 @@ int32_t StartupManager::RunLoadAppStartupConfigTask()
             continue;
         }
         TAG_LOGD(AAFwkTag::STARTUP, "load module %{public}s, type: %{public}d", item.name_.c_str(), item.moduleType_);
-        std::string configStr;
-        int32_t result = GetStartupConfigString(item, configStr);
+        ModuleStartupProfile profile;
+        int32_t result = LoadModuleStartupProfile(item, profile);
         if (result != ERR_OK) {
             return result;
         }
-        bool success = AnalyzeStartupConfig(item, configStr, preloadSoStartupTasks,
-            preloadSystemSoStartupTasks, pendingStartupTaskInfos, pendingConfigEntry);
-        if (!success) {
-            TAG_LOGE(AAFwkTag::STARTUP, "failed to parse app startup module %{public}s, type: %{public}d",
-                item.name_.c_str(), item.moduleType_);
-            return ERR_STARTUP_CONFIG_PARSE_ERROR;
-        }
+        ApplyStartupProfile(item, profile, preloadSoStartupTasks, preloadSystemSoStartupTasks,
+            pendingStartupTaskInfos, pendingConfigEntry);
     }
 
     std::lock_guard guard(appStartupConfigInitializationMutex_);
@@ -938,7 +946,7 @@ int32_t StartupManager::RunAppPreloadSoTaskMainThread(
     return ERR_OK;
 }
 
-int32_t StartupManager::GetStartupConfigString(const ModuleStartupConfigInfo &info, std::string &config)
+int32_t StartupManager::GetStartupConfigJson(const ModuleStartupConfigInfo &info, nlohmann::json &profileJson)
 {
     TAG_LOGD(AAFwkTag::STARTUP, "start");
     std::string appStartup = info.startupConfig_;
@@ -970,8 +978,7 @@ int32_t StartupManager::GetStartupConfigString(const ModuleStartupConfigInfo &in
             AAFwk::EventName::STARTUP_TASK_ERROR, HISYSEVENT_FAULT, eventInfo);
         return ERR_STARTUP_CONFIG_PATH_ERROR;
     }
-    std::string configData(startupConfig.get(), startupConfig.get() + len);
-    nlohmann::json profileJson = nlohmann::json::parse(configData, nullptr, false);
+    profileJson = nlohmann::json::parse(startupConfig.get(), startupConfig.get() + len, nullptr, false);
     if (profileJson.is_discarded()) {
         TAG_LOGE(AAFwkTag::STARTUP, "bad profile file");
         eventInfo.errCode = ERR_STARTUP_CONFIG_PARSE_ERROR;
@@ -980,26 +987,44 @@ int32_t StartupManager::GetStartupConfigString(const ModuleStartupConfigInfo &in
             AAFwk::EventName::STARTUP_TASK_ERROR, HISYSEVENT_FAULT, eventInfo);
         return ERR_STARTUP_CONFIG_PARSE_ERROR;
     }
-    config = profileJson.dump();
     return ERR_OK;
 }
 
-bool StartupManager::AnalyzeStartupConfig(const ModuleStartupConfigInfo& info, const std::string& startupConfig,
-    std::map<std::string, std::shared_ptr<AppStartupTask>>& preloadSoStartupTasks,
-    std::map<std::string, std::shared_ptr<AppStartupTask>>& preloadSystemSoStartupTasks,
-    std::vector<StartupTaskInfo>& pendingStartupTaskInfos, std::pair<std::string, std::string> &pendingConfigEntry)
+int32_t StartupManager::LoadModuleStartupProfile(const ModuleStartupConfigInfo& info, ModuleStartupProfile &profile)
 {
-    if (startupConfig.empty()) {
-        TAG_LOGE(AAFwkTag::STARTUP, "startupConfig invalid");
-        return false;
+    auto begin = std::chrono::steady_clock::now();
+    StartupProfileCache profileCache(STARTUP_PROFILE_CACHE_DIR);
+    StartupProfileKey key;
+    bool hasKey = StartupProfileCache::MakeKey(info.hapPath_, info.name_, info.startupConfig_, key);
+    if (hasKey && profileCache.Load(key, profile)) {
+        int64_t savedUs = profile.parseCostUs - GetElapsedUs(begin);
+        HITRACE_METER_FMT(HITRACE_TAG_APP, "StartupProfileCacheHit module:%s savedUs:%" PRId64,
+            info.name_.c_str(), savedUs);
+        TAG_LOGI(AAFwkTag::STARTUP, "profile cache hit, module: %{public}s, saved: %{public}" PRId64 "us",
+            info.name_.c_str(), savedUs);
+        return ERR_OK;
     }
 
-    nlohmann::json startupConfigJson = nlohmann::json::parse(startupConfig, nullptr, false);
-    if (startupConfigJson.is_discarded()) {
-        TAG_LOGE(AAFwkTag::STARTUP, "Failed to parse json string");
-        return false;
+    nlohmann::json startupConfigJson;
+    int32_t result = GetStartupConfigJson(info, startupConfigJson);
+    if (result != ERR_OK) {
+        return result;
     }
+    if (!AnalyzeStartupProfile(info, startupConfigJson, profile)) {
+        TAG_LOGE(AAFwkTag::STARTUP, "failed to parse app startup module %{public}s, type: %{public}d",
+            info.name_.c_str(), info.moduleType_);
+        return ERR_STARTUP_CONFIG_PARSE_ERROR;
+    }
+    profile.parseCostUs = GetElapsedUs(begin);
+    if (hasKey && !profileCache.Save(key, profile)) {
+        TAG_LOGW(AAFwkTag::STARTUP, "save profile cache of %{public}s failed", info.name_.c_str());
+    }
+    return ERR_OK;
+}
 
+bool StartupManager::AnalyzeStartupProfile(const ModuleStartupConfigInfo& info, nlohmann::json &startupConfigJson,
+    ModuleStartupProfile &profile)
+{
     if (info.moduleType_ == AppExecFwk::ModuleType::ENTRY || info.moduleType_ == AppExecFwk::ModuleType::FEATURE) {
         if (!(startupConfigJson.contains(CONFIG_ENTRY) && startupConfigJson[CONFIG_ENTRY].is_string())) {
             TAG_LOGE(AAFwkTag::STARTUP, "no config entry.");
@@ -1010,24 +1035,87 @@ bool StartupManager::AnalyzeStartupConfig(const ModuleStartupConfigInfo& info, c
             TAG_LOGE(AAFwkTag::STARTUP, "startup config empty.");
             return false;
         }
-        pendingConfigEntry.first = pendingConfigEntrySrc;
+        profile.configEntry.first = pendingConfigEntrySrc;
         if (startupConfigJson.contains(ARK_TS_MODE) && startupConfigJson[ARK_TS_MODE].is_string()) {
             TAG_LOGD(AAFwkTag::STARTUP, "has arkTSMode.");
-            std::string arkTSMode = startupConfigJson.at(ARK_TS_MODE).get<std::string>();
-            pendingConfigEntry.second = arkTSMode;
+            profile.configEntry.second = startupConfigJson.at(ARK_TS_MODE).get<std::string>();
         }
     }
 
-    if (!AnalyzeAppStartupTask(info, startupConfigJson, pendingStartupTaskInfos)) {
+    // SetMatchRules and SetSchedulerPhase turn lazy loading on, keep what this module asks for in the profile
+    bool enableLazyLoading = enableLazyLoadingAppStartupTasks_;
+    enableLazyLoadingAppStartupTasks_ = false;
+    std::map<std::string, std::shared_ptr<AppStartupTask>> preloadSoStartupTasks;
+    bool success = AnalyzeAppStartupTask(info, startupConfigJson, profile.startupTaskInfos) &&
+        AnalyzePreloadSoStartupTask(info, startupConfigJson, preloadSoStartupTasks);
+    profile.enableLazyLoading = enableLazyLoadingAppStartupTasks_;
+    enableLazyLoadingAppStartupTasks_ = enableLazyLoading;
+    if (!success) {
         return false;
     }
-    if (!AnalyzePreloadSoStartupTask(info, startupConfigJson, preloadSoStartupTasks)) {
-        return false;
+
+    for (const auto &iter : preloadSoStartupTasks) {
+        auto task = std::static_pointer_cast<PreloadSoStartupTask>(iter.second);
+        StartupTaskInfo taskInfo;
+        taskInfo.name = iter.first;
+        taskInfo.ohmUrl = task->GetOhmUrl();
+        taskInfo.dependencies = task->GetDependencies();
+        taskInfo.excludeFromAutoStart = task->GetIsExcludeFromAutoStart();
+        taskInfo.matchRules.uris = task->GetUriMatchRules();
+        taskInfo.matchRules.insightIntents = task->GetInsightIntentMatchRules();
+        taskInfo.matchRules.actions = task->GetActionMatchRules();
+        taskInfo.matchRules.customization = task->GetCustomizationMatchRules();
+        profile.preloadSoTaskInfos.emplace_back(std::move(taskInfo));
     }
-    AnalyzePreloadSystemSoStartupTask(startupConfigJson, preloadSystemSoStartupTasks);
+
+    // the allowlist may change with the system, it is applied when the profile is used
+    AnalyzePreloadSystemSoStartupTask(startupConfigJson, profile.preloadSystemSoTasks);
     return true;
 }
 
+void StartupManager::ApplyStartupProfile(const ModuleStartupConfigInfo& info, const ModuleStartupProfile &profile,
+    std::map<std::string, std::shared_ptr<AppStartupTask>>& preloadSoStartupTasks,
+    std::map<std::string, std::shared_ptr<AppStartupTask>>& preloadSystemSoStartupTasks,
+    std::vector<StartupTaskInfo>& pendingStartupTaskInfos, std::pair<std::string, std::string> &pendingConfigEntry)
+{
+    if (!profile.configEntry.first.empty()) {
+        pendingConfigEntry.first = profile.configEntry.first;
+        if (!profile.configEntry.second.empty()) {
+            pendingConfigEntry.second = profile.configEntry.second;
+        }
+    }
+
+    for (const auto &taskInfo : profile.startupTaskInfos) {
+        StartupTaskInfo startupTaskInfo = taskInfo;
+        startupTaskInfo.moduleName = info.name_;
+        startupTaskInfo.hapPath = info.hapPath_;
+        startupTaskInfo.esModule = info.esModule_;
+        startupTaskInfo.moduleType = info.moduleType_;
+        pendingStartupTaskInfos.emplace_back(std::move(startupTaskInfo));
+    }
+
+    std::string path = bundleName_ + "/" + info.name_;
+    for (const auto &taskInfo : profile.preloadSoTaskInfos) {
+        auto task = std::make_shared<PreloadSoStartupTask>(taskInfo.name, taskInfo.ohmUrl, path);
+        task->SetDependencies(taskInfo.dependencies);
+        task->SetIsExcludeFromAutoStart(taskInfo.excludeFromAutoStart);
+        task->SetMatchRules(taskInfo.matchRules);
+        preloadSoStartupTasks.emplace(taskInfo.name, task);
+    }
+
+    if (preloadSystemSoAllowlist_.empty()) {
+        TAG_LOGD(AAFwkTag::STARTUP, "preload system so allowlist is empty, skip analyzing");
+    } else {
+        for (const auto &task : profile.preloadSystemSoTasks) {
+            AddPreloadSystemSoStartupTask(task.first, task.second, preloadSystemSoStartupTasks);
+        }
+    }
+
+    if (profile.enableLazyLoading) {
+        enableLazyLoadingAppStartupTasks_ = true;
+    }
+}
+
 bool StartupManager::AnalyzeAppStartupTask(const ModuleStartupConfigInfo& info, nlohmann::json &startupConfigJson,
     std::vector<StartupTaskInfo>& pendingStartupTaskInfos)
 {
@@ -1121,28 +1209,23 @@ bool StartupManager::AnalyzePreloadSoStartupTaskInner(const ModuleStartupConfigI
     return true;
 }
 
-void StartupManager::AnalyzePreloadSystemSoStartupTask(nlohmann::json &startupConfigJson,
-    std::map<std::string, std::shared_ptr<AppStartupTask>>& preloadSoStartupTasks)
+void StartupManager::AnalyzePreloadSystemSoStartupTask(const nlohmann::json &startupConfigJson,
+    std::vector<std::pair<std::string, std::string>> &preloadSystemSoTasks)
 {
-    if (preloadSystemSoAllowlist_.empty()) {
-        TAG_LOGD(AAFwkTag::STARTUP, "preload system so allowlist is empty, skip analyzing");
-        return;
-    }
-
     if (!startupConfigJson.contains(PRELOAD_SYSTEM_SO_STARTUP_TASKS) ||
         !startupConfigJson[PRELOAD_SYSTEM_SO_STARTUP_TASKS].is_array()) {
         TAG_LOGD(AAFwkTag::STARTUP, "no preload system so startup tasks");
         return;
     }
 
-    for (const auto& module : startupConfigJson.at(PRELOAD_SYSTEM_SO_STARTUP_TASKS).get<nlohmann::json>()) {
-        AnalyzePreloadSystemSoStartupTaskInner(module, preloadSoStartupTasks);
+    for (const auto& module : startupConfigJson.at(PRELOAD_SYSTEM_SO_STARTUP_TASKS)) {
+        AnalyzePreloadSystemSoStartupTaskInner(module, preloadSystemSoTasks);
     }
 }
 
 void StartupManager::AnalyzePreloadSystemSoStartupTaskInner(
     const nlohmann::json &preloadStartupTaskJson,
-    std::map<std::string, std::shared_ptr<AppStartupTask>> &preloadSoStartupTasks)
+    std::vector<std::pair<std::string, std::string>> &preloadSystemSoTasks)
 {
     if (!preloadStartupTaskJson.is_object() ||
         !preloadStartupTaskJson.contains(NAME) || !preloadStartupTaskJson[NAME].is_string() ||
@@ -1151,13 +1234,18 @@ void StartupManager::AnalyzePreloadSystemSoStartupTaskInner(
         return;
     }
 
-    std::string ohmUrl = preloadStartupTaskJson.at(OHMURL).get<std::string>();
+    preloadSystemSoTasks.emplace_back(preloadStartupTaskJson.at(NAME).get<std::string>(),
+        preloadStartupTaskJson.at(OHMURL).get<std::string>());
+}
+
+void StartupManager::AddPreloadSystemSoStartupTask(const std::string &name, const std::string &ohmUrl,
+    std::map<std::string, std::shared_ptr<AppStartupTask>> &preloadSoStartupTasks)
+{
     if (preloadSystemSoAllowlist_.find(ohmUrl) == preloadSystemSoAllowlist_.end()) {
         TAG_LOGE(AAFwkTag::STARTUP, "ohmUrl %{public}s is in forbidden whitelist", ohmUrl.c_str());
         return;
     }
 
-    std::string name = preloadStartupTaskJson.at(NAME).get<std::string>();
     if (name.empty()) {
         TAG_LOGE(AAFwkTag::STARTUP, "field name cannot be empty, ohmUrl is %{public}s", ohmUrl.c_str());
         return;
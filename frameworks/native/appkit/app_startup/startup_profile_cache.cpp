@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "startup_profile_cache.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "hilog_tag_wrapper.h"
+
+namespace OHOS {
+namespace AbilityRuntime {
+namespace {
+constexpr uint32_t PROFILE_CACHE_MAGIC = 0x53505043; // "SPPC"
+constexpr uint32_t PROFILE_CACHE_VERSION = 1;
+constexpr uint32_t MAX_ITEM_COUNT = 4096;
+constexpr size_t MAX_CACHE_FILE_SIZE = 4 * 1024 * 1024;
+constexpr int64_t NS_PER_SECOND = 1000000000;
+constexpr const char* CACHE_FILE_PREFIX = "startup_profile_";
+constexpr const char* CACHE_FILE_SUFFIX = ".bin";
+constexpr const char* TEMP_FILE_SUFFIX = ".tmp";
+
+class ProfileWriter {
+public:
+    explicit ProfileWriter(std::string &data) : data_(data) {}
+
+    template<typename T>
+    void WriteValue(T value)
+    {
+        data_.append(reinterpret_cast<const char *>(&value), sizeof(value));
+    }
+
+    void WriteString(const std::string &value)
+    {
+        WriteValue(static_cast<uint32_t>(value.size()));
+        data_.append(value);
+    }
+
+    void WriteStringVector(const std::vector<std::string> &values)
+    {
+        WriteValue(static_cast<uint32_t>(values.size()));
+        for (const auto &value : values) {
+            WriteString(value);
+        }
+    }
+
+    void WriteTaskInfo(const StartupTaskInfo &info)
+    {
+        WriteString(info.name);
+        WriteString(info.srcEntry);
+        WriteString(info.ohmUrl);
+        WriteString(info.arkTSMode);
+        WriteStringVector(info.dependencies);
+        WriteValue(static_cast<uint8_t>(info.excludeFromAutoStart));
+        WriteValue(static_cast<uint8_t>(info.callCreateOnMainThread));
+        WriteValue(static_cast<uint8_t>(info.waitOnMainThread));
+        WriteValue(static_cast<uint8_t>(info.preAbilityStageLoad));
+        WriteStringVector(info.matchRules.uris);
+        WriteStringVector(info.matchRules.insightIntents);
+        WriteStringVector(info.matchRules.actions);
+        WriteStringVector(info.matchRules.customization);
+    }
+
+private:
+    std::string &data_;
+};
+
+class ProfileReader {
+public:
+    explicit ProfileReader(const std::string &data) : data_(data) {}
+
+    template<typename T>
+    bool ReadValue(T &value)
+    {
+        if (data_.size() - offset_ < sizeof(value)) {
+            return false;
+        }
+        memcpy(&value, data_.data() + offset_, sizeof(value));
+        offset_ += sizeof(value);
+        return true;
+    }
+
+    bool ReadBool(bool &value)
+    {
+        uint8_t byte = 0;
+        if (!ReadValue(byte)) {
+            return false;
+        }
+        value = byte != 0;
+        return true;
+    }
+
+    bool ReadString(std::string &value)
+    {
+        uint32_t size = 0;
+        if (!ReadValue(size) || data_.size() - offset_ < size) {
+            return false;
+        }
+        value.assign(data_, offset_, size);
+        offset_ += size;
+        return true;
+    }
+
+    bool ReadCount(uint32_t &count)
+    {
+        return ReadValue(count) && count <= MAX_ITEM_COUNT;
+    }
+
+    bool ReadStringVector(std::vector<std::string> &values)
+    {
+        uint32_t count = 0;
+        if (!ReadCount(count)) {
+            return false;
+        }
+        values.resize(count);
+        for (auto &value : values) {
+            if (!ReadString(value)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool ReadTaskInfo(StartupTaskInfo &info)
+    {
+        return ReadString(info.name) && ReadString(info.srcEntry) && ReadString(info.ohmUrl) &&
+            ReadString(info.arkTSMode) && ReadStringVector(info.dependencies) &&
+            ReadBool(info.excludeFromAutoStart) && ReadBool(info.callCreateOnMainThread) &&
+            ReadBool(info.waitOnMainThread) && ReadBool(info.preAbilityStageLoad) &&
+            ReadStringVector(info.matchRules.uris) && ReadStringVector(info.matchRules.insightIntents) &&
+            ReadStringVector(info.matchRules.actions) && ReadStringVector(info.matchRules.customization);
+    }
+
+    bool ReadTaskInfos(std::vector<StartupTaskInfo> &infos)
+    {
+        uint32_t count = 0;
+        if (!ReadCount(count)) {
+            return false;
+        }
+        infos.resize(count);
+        for (auto &info : infos) {
+            if (!ReadTaskInfo(info)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool IsEnd() const
+    {
+        return offset_ == data_.size();
+    }
+
+private:
+    const std::string &data_;
+    size_t offset_ = 0;
+};
+} // namespace
+
+bool StartupProfileKey::operator==(const StartupProfileKey &other) const
+{
+    return hapPath == other.hapPath && moduleName == other.moduleName && appStartup == other.appStartup &&
+        hapSize == other.hapSize && hapModifyTime == other.hapModifyTime;
+}
+
+StartupProfileCache::StartupProfileCache(const std::string &cacheDir) : cacheDir_(cacheDir)
+{
+}
+
+bool StartupProfileCache::MakeKey(const std::string &hapPath, const std::string &moduleName,
+    const std::string &appStartup, StartupProfileKey &key)
+{
+    struct stat hapStat = {};
+    if (hapPath.empty() || stat(hapPath.c_str(), &hapStat) != 0) {
+        TAG_LOGD(AAFwkTag::STARTUP, "stat hap failed, errno: %{public}d", errno);
+        return false;
+    }
+    key.hapPath = hapPath;
+    key.moduleName = moduleName;
+    key.appStartup = appStartup;
+    key.hapSize = static_cast<uint64_t>(hapStat.st_size);
+    key.hapModifyTime = static_cast<int64_t>(hapStat.st_mtim.tv_sec) * NS_PER_SECOND + hapStat.st_mtim.tv_nsec;
+    return true;
+}
+
+bool StartupProfileCache::Load(const StartupProfileKey &key, ModuleStartupProfile &profile) const
+{
+    std::ifstream file(GetFilePath(key), std::ios::in | std::ios::binary);
+    if (!file.is_open()) {
+        TAG_LOGD(AAFwkTag::STARTUP, "no profile cache of %{public}s", key.moduleName.c_str());
+        return false;
+    }
+    std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (data.size() > MAX_CACHE_FILE_SIZE || !Decode(data, key, profile)) {
+        TAG_LOGW(AAFwkTag::STARTUP, "profile cache of %{public}s is out of date", key.moduleName.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool StartupProfileCache::Save(const StartupProfileKey &key, const ModuleStartupProfile &profile) const
+{
+    if (mkdir(cacheDir_.c_str(), S_IRWXU) != 0 && errno != EEXIST) {
+        TAG_LOGW(AAFwkTag::STARTUP, "mkdir failed, errno: %{public}d", errno);
+        return false;
+    }
+    std::string data;
+    Encode(key, profile, data);
+    if (data.size() > MAX_CACHE_FILE_SIZE) {
+        TAG_LOGW(AAFwkTag::STARTUP, "profile of %{public}s is too large", key.moduleName.c_str());
+        return false;
+    }
+    // other processes of the application may read the file at the same time
+    std::string filePath = GetFilePath(key);
+    std::string tempPath = filePath + "." + std::to_string(getpid()) + TEMP_FILE_SUFFIX;
+    {
+        std::ofstream file(tempPath, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            TAG_LOGW(AAFwkTag::STARTUP, "open profile cache failed, errno: %{public}d", errno);
+            return false;
+        }
+        file.write(data.data(), static_cast<std::streamsize>(data.size()));
+        if (!file.good()) {
+            file.close();
+            unlink(tempPath.c_str());
+            return false;
+        }
+    }
+    if (rename(tempPath.c_str(), filePath.c_str()) != 0) {
+        TAG_LOGW(AAFwkTag::STARTUP, "rename profile cache failed, errno: %{public}d", errno);
+        unlink(tempPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+void StartupProfileCache::Encode(const StartupProfileKey &key, const ModuleStartupProfile &profile,
+    std::string &data)
+{
+    data.clear();
+    ProfileWriter writer(data);
+    writer.WriteValue(PROFILE_CACHE_MAGIC);
+    writer.WriteValue(PROFILE_CACHE_VERSION);
+    writer.WriteString(key.hapPath);
+    writer.WriteString(key.moduleName);
+    writer.WriteString(key.appStartup);
+    writer.WriteValue(key.hapSize);
+    writer.WriteValue(key.hapModifyTime);
+
+    writer.WriteString(profile.configEntry.first);
+    writer.WriteString(profile.configEntry.second);
+    writer.WriteValue(static_cast<uint32_t>(profile.startupTaskInfos.size()));
+    for (const auto &info : profile.startupTaskInfos) {
+        writer.WriteTaskInfo(info);
+    }
+    writer.WriteValue(static_cast<uint32_t>(profile.preloadSoTaskInfos.size()));
+    for (const auto &info : profile.preloadSoTaskInfos) {
+        writer.WriteTaskInfo(info);
+    }
+    writer.WriteValue(static_cast<uint32_t>(profile.preloadSystemSoTasks.size()));
+    for (const auto &task : profile.preloadSystemSoTasks) {
+        writer.WriteString(task.first);
+        writer.WriteString(task.second);
+    }
+    writer.WriteValue(static_cast<uint8_t>(profile.enableLazyLoading));
+    writer.WriteValue(profile.parseCostUs);
+}
+
+bool StartupProfileCache::Decode(const std::string &data, const StartupProfileKey &key,
+    ModuleStartupProfile &profile)
+{
+    ProfileReader reader(data);
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    if (!reader.ReadValue(magic) || magic != PROFILE_CACHE_MAGIC ||
+        !reader.ReadValue(version) || version != PROFILE_CACHE_VERSION) {
+        return false;
+    }
+    StartupProfileKey storedKey;
+    if (!reader.ReadString(storedKey.hapPath) || !reader.ReadString(storedKey.moduleName) ||
+        !reader.ReadString(storedKey.appStartup) || !reader.ReadValue(storedKey.hapSize) ||
+        !reader.ReadValue(storedKey.hapModifyTime) || !(storedKey == key)) {
+        return false;
+    }
+
+    ModuleStartupProfile result;
+    if (!reader.ReadString(result.configEntry.first) || !reader.ReadString(result.configEntry.second) ||
+        !reader.ReadTaskInfos(result.startupTaskInfos) || !reader.ReadTaskInfos(result.preloadSoTaskInfos)) {
+        return false;
+    }
+    uint32_t count = 0;
+    if (!reader.ReadCount(count)) {
+        return false;
+    }
+    result.preloadSystemSoTasks.resize(count);
+    for (auto &task : result.preloadSystemSoTasks) {
+        if (!reader.ReadString(task.first) || !reader.ReadString(task.second)) {
+            return false;
+        }
+    }
+    if (!reader.ReadBool(result.enableLazyLoading) || !reader.ReadValue(result.parseCostUs) || !reader.IsEnd()) {
+        return false;
+    }
+    profile = std::move(result);
+    return true;
+}
+
+std::string StartupProfileCache::GetFilePath(const StartupProfileKey &key) const
+{
+    size_t hash = std::hash<std::string>()(key.hapPath + "/" + key.moduleName);
+    return cacheDir_ + "/" + CACHE_FILE_PREFIX + std::to_string(hash) + CACHE_FILE_SUFFIX;
+}
+} // namespace AbilityRuntime
+} // namespace OHOS
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "startup_task_cost_recorder.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "hilog_tag_wrapper.h"
+
+namespace OHOS {
+namespace AbilityRuntime {
+namespace {
+constexpr const char* COST_FILE_NAME = "/startup_task_cost";
+constexpr const char* COST_FILE_HEADER = "startup_task_cost 1";
+constexpr const char* TEMP_FILE_SUFFIX = ".tmp";
+constexpr int DECIMAL_BASE = 10;
+constexpr size_t MAX_COST_COUNT = 1024;
+constexpr int64_t DEFAULT_COST_US = 1;
+constexpr int64_t MAX_COST_US = 60 * 1000 * 1000;
+// weight of the former cost when a new one is recorded, smooths the costs of different launches
+constexpr int64_t HISTORY_WEIGHT = 3;
+constexpr int64_t TOTAL_WEIGHT = 4;
+}
+
+StartupTaskCostRecorder &StartupTaskCostRecorder::GetInstance()
+{
+    static StartupTaskCostRecorder instance;
+    return instance;
+}
+
+void StartupTaskCostRecorder::Load(const std::string &cacheDir)
+{
+    std::lock_guard guard(mutex_);
+    if (isLoaded_) {
+        return;
+    }
+    isLoaded_ = true;
+    cacheDir_ = cacheDir;
+    std::ifstream file(cacheDir_ + COST_FILE_NAME);
+    std::string line;
+    if (!file.is_open() || !std::getline(file, line) || line != COST_FILE_HEADER) {
+        TAG_LOGD(AAFwkTag::STARTUP, "no startup task cost");
+        return;
+    }
+    while (costs_.size() < MAX_COST_COUNT && std::getline(file, line)) {
+        // line: <cost> <name>, the name may contain spaces
+        size_t pos = line.find(' ');
+        if (pos == std::string::npos || pos == 0 || pos + 1 == line.size()) {
+            continue;
+        }
+        char *end = nullptr;
+        long long cost = strtoll(line.c_str(), &end, DECIMAL_BASE);
+        if (end != line.c_str() + pos || cost <= 0 || cost > MAX_COST_US) {
+            continue;
+        }
+        // costs recorded before the load are newer
+        costs_.emplace(line.substr(pos + 1), static_cast<int64_t>(cost));
+    }
+    TAG_LOGD(AAFwkTag::STARTUP, "load %{public}zu startup task costs", costs_.size());
+}
+
+void StartupTaskCostRecorder::Save()
+{
+    // task managers of the same process share the temp file
+    std::lock_guard saveGuard(saveMutex_);
+    std::string data;
+    std::string cacheDir;
+    {
+        std::lock_guard guard(mutex_);
+        if (!isChanged_ || cacheDir_.empty()) {
+            return;
+        }
+        isChanged_ = false;
+        cacheDir = cacheDir_;
+        data.append(COST_FILE_HEADER).append("\n");
+        for (const auto &cost : costs_) {
+            data.append(std::to_string(cost.second)).append(" ").append(cost.first).append("\n");
+        }
+    }
+    if (mkdir(cacheDir.c_str(), S_IRWXU) != 0 && errno != EEXIST) {
+        TAG_LOGW(AAFwkTag::STARTUP, "mkdir failed, errno: %{public}d", errno);
+        return;
+    }
+    std::string filePath = cacheDir + COST_FILE_NAME;
+    std::string tempPath = filePath + "." + std::to_string(getpid()) + TEMP_FILE_SUFFIX;
+    {
+        std::ofstream file(tempPath, std::ios::out | std::ios::trunc);
+        if (!file.is_open()) {
+            TAG_LOGW(AAFwkTag::STARTUP, "open startup task cost failed, errno: %{public}d", errno);
+            return;
+        }
+        file << data;
+        if (!file.good()) {
+            file.close();
+            unlink(tempPath.c_str());
+            return;
+        }
+    }
+    if (rename(tempPath.c_str(), filePath.c_str()) != 0) {
+        TAG_LOGW(AAFwkTag::STARTUP, "rename startup task cost failed, errno: %{public}d", errno);
+        unlink(tempPath.c_str());
+    }
+}
+
+int64_t StartupTaskCostRecorder::GetCostUs(const std::string &name)
+{
+    std::lock_guard guard(mutex_);
+    auto iter = costs_.find(name);
+    if (iter == costs_.end()) {
+        return DEFAULT_COST_US;
+    }
+    return iter->second;
+}
+
+void StartupTaskCostRecorder::Record(const std::string &name, int64_t costUs)
+{
+    if (name.empty() || name.find('\n') != std::string::npos) {
+        return;
+    }
+    costUs = std::min(std::max(costUs, DEFAULT_COST_US), MAX_COST_US);
+    std::lock_guard guard(mutex_);
+    auto iter = costs_.find(name);
+    if (iter != costs_.end()) {
+        iter->second = (iter->second * HISTORY_WEIGHT + costUs) / TOTAL_WEIGHT;
+    } else if (costs_.size() < MAX_COST_COUNT) {
+        costs_.emplace(name, costUs);
+    } else {
+        return;
+    }
+    isChanged_ = true;
+}
+} // namespace AbilityRuntime
+} // namespace OHOS
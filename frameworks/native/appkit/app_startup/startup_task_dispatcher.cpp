@@ -15,14 +15,36 @@
 
 #include "startup_task_dispatcher.h"
 
+#include <algorithm>
+#include <chrono>
+
 #include "event_handler.h"
 #include "hilog_tag_wrapper.h"
 #include "startup_manager.h"
+#include "startup_task_cost_recorder.h"
 
 namespace OHOS {
 namespace AbilityRuntime {
-StartupTaskDispatcher::StartupTaskDispatcher(const std::map<std::string, std::shared_ptr<StartupTask>> &tasks,
-    const std::shared_ptr<StartupSortResult> &sortResult) : tasks_(tasks), sortResult_(sortResult)
+namespace {
+int64_t GetCurrentTimeUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+struct ReadyTaskCompare {
+    const std::vector<int64_t> &priorities;
+
+    bool operator()(uint32_t left, uint32_t right) const
+    {
+        // tasks of the same priority run in the order of their names
+        return priorities[left] < priorities[right] || (priorities[left] == priorities[right] && left > right);
+    }
+};
+}
+
+StartupTaskDispatcher::StartupTaskDispatcher(const std::shared_ptr<StartupSortResult> &sortResult)
+    : sortResult_(sortResult)
 {}
 
 StartupTaskDispatcher::~StartupTaskDispatcher()
@@ -37,17 +59,22 @@ int32_t StartupTaskDispatcher::Run(const std::shared_ptr<OnCompletedCallback> &c
         TAG_LOGE(AAFwkTag::STARTUP, "sortResult null");
         return ERR_STARTUP_INTERNAL_ERROR;
     }
-    for (auto &iter : tasks_) {
-        if (iter.second == nullptr) {
-            TAG_LOGE(AAFwkTag::STARTUP, "startup task %{public}s null", iter.first.c_str());
+    const auto &tasks = sortResult_->tasks_;
+    if (sortResult_->childrenIndexes_.size() != tasks.size() || sortResult_->inDegrees_.size() != tasks.size() ||
+        sortResult_->priorities_.size() != tasks.size()) {
+        TAG_LOGE(AAFwkTag::STARTUP, "sortResult invalid");
+        return ERR_STARTUP_INTERNAL_ERROR;
+    }
+    for (auto &task : tasks) {
+        if (task == nullptr) {
+            TAG_LOGE(AAFwkTag::STARTUP, "startup task null");
             return ERR_STARTUP_INTERNAL_ERROR;
         }
-        inDegreeMap_.emplace(iter.first, iter.second->GetDependenciesCount());
-        if (iter.second->GetWaitOnMainThread()) {
+        if (task->GetWaitOnMainThread()) {
             mainThreadAwaitCount_++;
         }
     }
-    tasksCount_ = tasks_.size();
+    tasksCount_ = tasks.size();
     completedCallback_ = completedCallback;
     mainThreadAwaitCallback_ = mainThreadAwaitCallback;
 
@@ -59,26 +86,15 @@ int32_t StartupTaskDispatcher::Run(const std::shared_ptr<OnCompletedCallback> &c
         }
     }
 
-    for (auto &iter : sortResult_->zeroDequeResult_) {
-        auto findResult = tasks_.find(iter);
-        if (findResult == tasks_.end()) {
-            TAG_LOGE(AAFwkTag::STARTUP, "startup task not found %{public}s", iter.c_str());
-            return ERR_STARTUP_INTERNAL_ERROR;
-        }
-        if (findResult->second == nullptr) {
-            TAG_LOGE(AAFwkTag::STARTUP, "startup task %{public}s null", iter.c_str());
-            return ERR_STARTUP_INTERNAL_ERROR;
-        }
-        if (isTimeoutStopped_) {
-            TAG_LOGD(AAFwkTag::STARTUP, "startup task dispatch timeout, stop running %{public}s", iter.c_str());
-            return ERR_STARTUP_TIMEOUT;
-        }
-        int32_t result = RunTaskInit(iter, findResult->second);
-        if (result != ERR_OK) {
-            return result;
+    {
+        std::lock_guard guard(readyTasksMutex_);
+        inDegrees_ = sortResult_->inDegrees_;
+        startTimesUs_.assign(tasks.size(), 0);
+        for (uint32_t index : sortResult_->zeroIndexes_) {
+            PushReadyTask(index);
         }
     }
-    return ERR_OK;
+    return RunReadyTasks();
 }
 
 void StartupTaskDispatcher::TimeoutStop()
@@ -86,8 +102,10 @@ void StartupTaskDispatcher::TimeoutStop()
     isTimeoutStopped_ = true;
 }
 
-void StartupTaskDispatcher::Dispatch(const std::string &name, const std::shared_ptr<StartupTaskResult> &result)
+void StartupTaskDispatcher::Dispatch(uint32_t index, const std::shared_ptr<StartupTaskResult> &result)
 {
+    const auto &task = sortResult_->tasks_[index];
+    const std::string &name = task->GetName();
     TAG_LOGD(AAFwkTag::STARTUP, "run startup task %{public}s dispatch", name.c_str());
     if (result == nullptr) {
         OnError(ERR_STARTUP_INTERNAL_ERROR, name + ": result is null");
@@ -97,16 +115,12 @@ void StartupTaskDispatcher::Dispatch(const std::string &name, const std::shared_
         OnError(name, result);
         return;
     }
-    auto findResult = tasks_.find(name);
-    if (findResult == tasks_.end() || findResult->second == nullptr) {
-        OnError(ERR_STARTUP_INTERNAL_ERROR, name + " not found");
-        return;
-    }
-    if (NotifyChildren(name, result) != ERR_OK) {
+    RecordTaskCost(index);
+    if (NotifyChildren(index, result) != ERR_OK) {
         return;
     }
 
-    if (findResult->second->GetWaitOnMainThread()) {
+    if (task->GetWaitOnMainThread()) {
         uint32_t oldAwaitCount = mainThreadAwaitCount_.fetch_sub(1);
         TAG_LOGD(AAFwkTag::STARTUP, "mainThreadAwaitCount %{public}d", oldAwaitCount - 1);
         if (oldAwaitCount == 1) {
@@ -124,64 +138,88 @@ void StartupTaskDispatcher::Dispatch(const std::string &name, const std::shared_
     }
 }
 
-int32_t StartupTaskDispatcher::NotifyChildren(const std::string &name, const std::shared_ptr<StartupTaskResult> &result)
+int32_t StartupTaskDispatcher::NotifyChildren(uint32_t index, const std::shared_ptr<StartupTaskResult> &result)
 {
-    if (sortResult_ == nullptr) {
-        OnError(ERR_STARTUP_INTERNAL_ERROR, name + ": sort result is null");
-        return ERR_STARTUP_INTERNAL_ERROR;
+    const std::string &name = sortResult_->tasks_[index]->GetName();
+    for (uint32_t child : sortResult_->childrenIndexes_[index]) {
+        sortResult_->tasks_[child]->RunTaskOnDependencyCompleted(name, result);
+        std::lock_guard guard(readyTasksMutex_);
+        inDegrees_[child]--;
+        if (inDegrees_[child] == 0) {
+            PushReadyTask(child);
+        }
     }
-    auto findResult = sortResult_->startupChildrenMap_.find(name);
-    if (findResult == sortResult_->startupChildrenMap_.end()) {
-        OnError(ERR_STARTUP_INTERNAL_ERROR, name + " is not found");
-        return ERR_STARTUP_INTERNAL_ERROR;
+    return RunReadyTasks();
+}
+
+void StartupTaskDispatcher::PushReadyTask(uint32_t index)
+{
+    auto &readyTasks = sortResult_->tasks_[index]->GetCallCreateOnMainThread() ?
+        readyMainThreadTasks_ : readyWorkerTasks_;
+    readyTasks.emplace_back(index);
+    std::push_heap(readyTasks.begin(), readyTasks.end(), ReadyTaskCompare { sortResult_->priorities_ });
+}
+
+bool StartupTaskDispatcher::PopReadyTask(uint32_t &index)
+{
+    auto &readyTasks = readyWorkerTasks_.empty() ? readyMainThreadTasks_ : readyWorkerTasks_;
+    if (readyTasks.empty()) {
+        return false;
     }
-    std::vector<std::shared_ptr<StartupTask>> zeroInDegree;
-    for (auto &child : findResult->second) {
-        auto childFindResult = inDegreeMap_.find(child);
-        if (childFindResult == inDegreeMap_.end()) {
-            OnError(ERR_STARTUP_INTERNAL_ERROR, child + "is not found in inDegreeMap_.");
-            return ERR_STARTUP_INTERNAL_ERROR;
-        }
-        auto childStartupTask = tasks_.find(child);
-        if (childStartupTask == tasks_.end()) {
-            OnError(ERR_STARTUP_INTERNAL_ERROR, child + "is not found in tasks_.");
-            return ERR_STARTUP_INTERNAL_ERROR;
-        }
-        if (childStartupTask->second == nullptr) {
-            OnError(ERR_STARTUP_INTERNAL_ERROR, child + " task is null.");
-            return ERR_STARTUP_INTERNAL_ERROR;
-        }
-        childStartupTask->second->RunTaskOnDependencyCompleted(name, result);
-        childFindResult->second--;
-        if (childFindResult->second == 0) {
-            zeroInDegree.emplace_back(childStartupTask->second);
+    std::pop_heap(readyTasks.begin(), readyTasks.end(), ReadyTaskCompare { sortResult_->priorities_ });
+    index = readyTasks.back();
+    readyTasks.pop_back();
+    return true;
+}
+
+int32_t StartupTaskDispatcher::RunReadyTasks()
+{
+    {
+        std::lock_guard guard(readyTasksMutex_);
+        if (isRunningReadyTasks_) {
+            // a task completed synchronously, the outer loop runs its children
+            return ERR_OK;
         }
+        isRunningReadyTasks_ = true;
     }
-    for (auto &iter : zeroInDegree) {
+    while (true) {
+        uint32_t index = 0;
+        {
+            std::lock_guard guard(readyTasksMutex_);
+            if (!PopReadyTask(index)) {
+                isRunningReadyTasks_ = false;
+                return ERR_OK;
+            }
+        }
+        int32_t result = ERR_OK;
         if (isTimeoutStopped_) {
             TAG_LOGD(AAFwkTag::STARTUP, "startup task dispatch timeout, stop running %{public}s",
-                iter->GetName().c_str());
-            return ERR_STARTUP_TIMEOUT;
+                sortResult_->tasks_[index]->GetName().c_str());
+            result = ERR_STARTUP_TIMEOUT;
+        } else {
+            result = RunTaskInit(index);
         }
-        int32_t runResult = RunTaskInit(iter->GetName(), iter);
-        if (runResult != ERR_OK) {
-            return runResult;
+        if (result != ERR_OK) {
+            std::lock_guard guard(readyTasksMutex_);
+            isRunningReadyTasks_ = false;
+            return result;
         }
     }
-    return ERR_OK;
 }
 
-int32_t StartupTaskDispatcher::RunTaskInit(const std::string &name, const std::shared_ptr<StartupTask> &task)
+int32_t StartupTaskDispatcher::RunTaskInit(uint32_t index)
 {
+    const auto &task = sortResult_->tasks_[index];
+    const std::string &name = task->GetName();
     TAG_LOGD(AAFwkTag::STARTUP, "%{public}s init", name.c_str());
     std::unique_ptr<StartupTaskResultCallback> callback = std::make_unique<StartupTaskResultCallback>();
-    callback->Push([weak = weak_from_this(), name](const std::shared_ptr<StartupTaskResult> &result) {
+    callback->Push([weak = weak_from_this(), index](const std::shared_ptr<StartupTaskResult> &result) {
         auto startupTaskDispatcher = weak.lock();
         if (startupTaskDispatcher == nullptr) {
             TAG_LOGD(AAFwkTag::STARTUP, "startupTaskDispatcher may have been release due to previous error");
             return;
         }
-        startupTaskDispatcher->Dispatch(name, result);
+        startupTaskDispatcher->Dispatch(index, result);
     });
     StartupTask::State state = task->GetState();
     if (state == StartupTask::State::CREATED) {
@@ -189,6 +227,11 @@ int32_t StartupTaskDispatcher::RunTaskInit(const std::string &name, const std::s
         if (result != ERR_OK) {
             return result;
         }
+        {
+            // only the tasks run by this dispatcher are measured
+            std::lock_guard guard(readyTasksMutex_);
+            startTimesUs_[index] = GetCurrentTimeUs();
+        }
         return task->RunTaskInit(std::move(callback));
     } else if (state == StartupTask::State::INITIALIZED) {
         callback->Call(task->GetResult());
@@ -202,6 +245,20 @@ int32_t StartupTaskDispatcher::RunTaskInit(const std::string &name, const std::s
     }
 }
 
+void StartupTaskDispatcher::RecordTaskCost(uint32_t index)
+{
+    int64_t startTimeUs = 0;
+    {
+        std::lock_guard guard(readyTasksMutex_);
+        startTimeUs = startTimesUs_[index];
+    }
+    if (startTimeUs == 0) {
+        return;
+    }
+    StartupTaskCostRecorder::GetInstance().Record(sortResult_->tasks_[index]->GetName(),
+        GetCurrentTimeUs() - startTimeUs);
+}
+
 void StartupTaskDispatcher::OnError(const std::string &name, const std::shared_ptr<StartupTaskResult> &result)
 {
     TAG_LOGE(AAFwkTag::STARTUP, "%{public}s failed, %{public}d", name.c_str(), result->GetResultCode());
@@ -81,7 +81,7 @@ int32_t StartupTaskManager::Prepare()
         TAG_LOGW(AAFwkTag::STARTUP, "no tasks");
         return ERR_STARTUP_INTERNAL_ERROR;
     }
-    dispatcher_ = std::make_shared<StartupTaskDispatcher>(tasks_, startupSortResult);
+    dispatcher_ = std::make_shared<StartupTaskDispatcher>(startupSortResult);
     return ERR_OK;
 }
 
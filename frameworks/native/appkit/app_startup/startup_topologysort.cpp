@@ -13,7 +13,10 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+
 #include "hilog_tag_wrapper.h"
+#include "startup_task_cost_recorder.h"
 #include "startup_topologysort.h"
 
 namespace OHOS {
@@ -26,80 +29,103 @@ int32_t StartupTopologySort::Sort(const std::map<std::string, std::shared_ptr<St
         TAG_LOGE(AAFwkTag::STARTUP, "null startupSortResult");
         return ERR_STARTUP_INTERNAL_ERROR;
     }
-    std::deque<std::string> zeroDeque;
-    std::map<std::string, std::uint32_t> inDegreeMap;
+    int32_t result = BuildGraph(startupMap, *startupSortResult);
+    if (result != ERR_OK) {
+        return result;
+    }
+    std::vector<uint32_t> sortedIndexes;
+    result = SortIndexes(*startupSortResult, sortedIndexes);
+    if (result != ERR_OK) {
+        return result;
+    }
+    CalculatePriorities(sortedIndexes, *startupSortResult);
+    return ERR_OK;
+}
+
+int32_t StartupTopologySort::BuildGraph(const std::map<std::string, std::shared_ptr<StartupTask>> &startupMap,
+    StartupSortResult &startupSortResult)
+{
+    std::map<std::string, uint32_t> indexes;
+    auto &tasks = startupSortResult.tasks_;
+    tasks.reserve(startupMap.size());
     for (auto &iter : startupMap) {
         if (iter.second == nullptr) {
             TAG_LOGE(AAFwkTag::STARTUP, "StartupTask null");
             return ERR_STARTUP_INTERNAL_ERROR;
         }
-        int32_t result = SortZeroDeque(iter.second, startupMap, inDegreeMap, zeroDeque, startupSortResult);
-        if (result != ERR_OK) {
-            return result;
+        indexes.emplace(iter.first, static_cast<uint32_t>(tasks.size()));
+        tasks.emplace_back(iter.second);
+    }
+
+    startupSortResult.childrenIndexes_.resize(tasks.size());
+    startupSortResult.inDegrees_.resize(tasks.size(), 0);
+    for (uint32_t index = 0; index < tasks.size(); index++) {
+        std::vector<std::string> dependencies = tasks[index]->GetDependencies();
+        if (dependencies.empty()) {
+            startupSortResult.zeroIndexes_.emplace_back(index);
+            continue;
+        }
+        for (auto &parentName : dependencies) {
+            auto parent = indexes.find(parentName);
+            if (parent == indexes.end()) {
+                TAG_LOGE(AAFwkTag::STARTUP, "%{public}s, failed to find dep: %{public}s",
+                    tasks[index]->GetName().c_str(), parentName.c_str());
+                return ERR_STARTUP_DEPENDENCY_NOT_FOUND;
+            }
+            startupSortResult.childrenIndexes_[parent->second].emplace_back(index);
+            startupSortResult.inDegrees_[index]++;
         }
     }
+    return ERR_OK;
+}
 
+int32_t StartupTopologySort::SortIndexes(const StartupSortResult &startupSortResult,
+    std::vector<uint32_t> &sortedIndexes)
+{
+    const auto &tasks = startupSortResult.tasks_;
+    std::vector<uint32_t> inDegrees = startupSortResult.inDegrees_;
+    sortedIndexes = startupSortResult.zeroIndexes_;
+    sortedIndexes.reserve(tasks.size());
     uint32_t mainStartupCount = 0;
     uint32_t threadStartupCount = 0;
-    while (!zeroDeque.empty()) {
-        std::string key = zeroDeque.front();
-        zeroDeque.pop_front();
-        auto it = startupMap.find(key);
-        if (it == startupMap.end()) {
-            TAG_LOGE(AAFwkTag::STARTUP, "startup not found: %{public}s", key.c_str());
-            return ERR_STARTUP_INTERNAL_ERROR;
-        }
-        if (it->second->GetCallCreateOnMainThread()) {
+    for (size_t i = 0; i < sortedIndexes.size(); i++) {
+        uint32_t index = sortedIndexes[i];
+        if (tasks[index]->GetCallCreateOnMainThread()) {
             mainStartupCount++;
         } else {
             threadStartupCount++;
         }
-
-        std::vector<std::string> &childrenStartupVector = startupSortResult->startupChildrenMap_[key];
-        for (auto &child : childrenStartupVector) {
-            inDegreeMap[child]--;
-            if (inDegreeMap[child] == 0) {
-                zeroDeque.push_back(child);
+        for (uint32_t child : startupSortResult.childrenIndexes_[index]) {
+            inDegrees[child]--;
+            if (inDegrees[child] == 0) {
+                sortedIndexes.emplace_back(child);
             }
         }
     }
 
-    if (mainStartupCount + threadStartupCount != startupMap.size()) {
+    if (sortedIndexes.size() != tasks.size()) {
         TAG_LOGE(AAFwkTag::STARTUP, "circular dependency, main: %{public}u, thread: %{public}u, startupMap %{public}zu",
-            mainStartupCount, threadStartupCount, startupMap.size());
+            mainStartupCount, threadStartupCount, tasks.size());
         return ERR_STARTUP_CIRCULAR_DEPENDENCY;
     }
     TAG_LOGD(AAFwkTag::STARTUP, "main: %{public}u, thread: %{public}u", mainStartupCount, threadStartupCount);
     return ERR_OK;
 }
 
-int32_t StartupTopologySort::SortZeroDeque(const std::shared_ptr<StartupTask> &startup,
-    const std::map<std::string, std::shared_ptr<StartupTask>> &startupMap,
-    std::map<std::string, std::uint32_t> &inDegreeMap, std::deque<std::string> &zeroDeque,
-    std::shared_ptr<StartupSortResult> &startupSortResult)
+void StartupTopologySort::CalculatePriorities(const std::vector<uint32_t> &sortedIndexes,
+    StartupSortResult &startupSortResult)
 {
-    std::string key = startup->GetName();
-    auto result = inDegreeMap.emplace(key, startup->GetDependenciesCount());
-    if (!result.second) {
-        TAG_LOGE(AAFwkTag::STARTUP, "%{public}s, emplace to inDegreeMap failed", key.c_str());
-        return ERR_STARTUP_INTERNAL_ERROR;
-    }
-    std::vector<std::string> dependencies = startup->GetDependencies();
-    if (dependencies.empty()) {
-        zeroDeque.push_back(key);
-        startupSortResult->zeroDequeResult_.push_back(key);
-    } else {
-        for (auto &parentName : dependencies) {
-            if (startupMap.find(parentName) == startupMap.end()) {
-                TAG_LOGE(AAFwkTag::STARTUP,
-                    "%{public}s, failed to find dep: %{public}s", key.c_str(), parentName.c_str());
-                return ERR_STARTUP_DEPENDENCY_NOT_FOUND;
-            }
-            auto &childStartVector = startupSortResult->startupChildrenMap_[parentName];
-            childStartVector.push_back(key);
+    auto &priorities = startupSortResult.priorities_;
+    priorities.assign(startupSortResult.tasks_.size(), 0);
+    auto &costRecorder = StartupTaskCostRecorder::GetInstance();
+    // children are sorted after their parents, so they are calculated first in reverse order
+    for (auto iter = sortedIndexes.rbegin(); iter != sortedIndexes.rend(); ++iter) {
+        int64_t childPriority = 0;
+        for (uint32_t child : startupSortResult.childrenIndexes_[*iter]) {
+            childPriority = std::max(childPriority, priorities[child]);
         }
+        priorities[*iter] = costRecorder.GetCostUs(startupSortResult.tasks_[*iter]->GetName()) + childPriority;
     }
-    return ERR_OK;
 }
 } // namespace AbilityRuntime
 } // namespace OHOS
@@ -55,6 +55,7 @@ namespace OHOS {
 namespace AbilityRuntime {
 namespace {
 constexpr int64_t ASSET_FILE_MAX_SIZE = 32 * 1024 * 1024;
+constexpr size_t ASSET_ENTRY_MAX_COUNT = 4096;
 constexpr int32_t API8 = 8;
 constexpr int32_t API12 = 12;
 const std::string BUNDLE_NAME_FLAG = "@bundle:";
@@ -143,6 +144,37 @@ void ReleaseWorkerSafeMemFunc(void* mapper)
     }
 }
 
+AssetEntryIndex& AssetEntryIndex::GetInstance()
+{
+    static AssetEntryIndex instance;
+    return instance;
+}
+
+bool AssetEntryIndex::HasEntry(const std::string& loadPath, const std::string& entryName, const EntryLookup& lookup)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto hapIter = entries_.find(loadPath);
+        if (hapIter != entries_.end()) {
+            auto entryIter = hapIter->second.find(entryName);
+            if (entryIter != hapIter->second.end()) {
+                return entryIter->second;
+            }
+        }
+    }
+    // looked up without the lock, workers of other haps are not blocked by the extractor
+    bool exist = lookup != nullptr && lookup(entryName);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (entryCount_ >= ASSET_ENTRY_MAX_COUNT) {
+        entries_.clear();
+        entryCount_ = 0;
+    }
+    if (entries_[loadPath].emplace(entryName, exist).second) {
+        entryCount_++;
+    }
+    return exist;
+}
+
 std::string AssetHelper::NormalizedFileName(const std::string& fileName) const
 {
     std::string normalizedFilePath;
@@ -419,9 +451,13 @@ bool AssetHelper::ReadFilePathData(const std::string& filePath, uint8_t** buff,
     size_t fileLen = 0;
     if (!GetIsStageModel()) {
         bool flag = false;
+        auto lookup = [extractor](const std::string& entryName) { return extractor->HasEntry(entryName); };
         for (const auto& basePath : workerInfo_->assetBasePathStr) {
             realfilePath = basePath + filePath;
             TAG_LOGD(AAFwkTag::JSRUNTIME, "realfilePath: %{private}s", realfilePath.c_str());
+            if (!AssetEntryIndex::GetInstance().HasEntry(loadPath, realfilePath, lookup)) {
+                continue;
+            }
             if (extractor->ExtractToBufByName(realfilePath, dataPtr, fileLen)) {
                 flag = true;
                 break;
@@ -477,10 +513,6 @@ bool AssetHelper::ReadFilePathData(const std::string& filePath, uint8_t** buff,
 
 void AssetHelper::GetAmi(std::string& ami, const std::string& filePath)
 {
-    size_t slashPos = filePath.find_last_of("/");
-    std::string fileName = filePath.substr(slashPos + 1);
-    std::string path = filePath.substr(0, slashPos + 1);
-
     std::string loadPath = ExtractorUtil::GetLoadFilePath((workerInfo_->hapPath).GetOriginString());
     bool newCreate = false;
     std::shared_ptr<Extractor> extractor = ExtractorUtil::GetExtractor(loadPath, newCreate);
@@ -488,48 +520,16 @@ void AssetHelper::GetAmi(std::string& ami, const std::string& filePath)
         TAG_LOGE(AAFwkTag::JSRUNTIME, "loadPath %{private}s GetExtractor failed", loadPath.c_str());
         return;
     }
-    std::vector<std::string> files;
-    for (const auto& basePath : workerInfo_->assetBasePathStr) {
-        std::string assetPath = basePath + path;
-        TAG_LOGI(AAFwkTag::JSRUNTIME, "assetPath: %{private}s", assetPath.c_str());
-        bool res = extractor->IsDirExist(assetPath);
-        if (!res) {
-            continue;
-        }
-        res = extractor->GetFileList(assetPath, files);
-        if (!res) {
-            continue;
-        }
-    }
-
-    std::string targetFilePath;
-    bool flag = false;
-    for (const auto& file : files) {
-        size_t filePos = file.find_last_of("/");
-        if (filePos != std::string::npos) {
-            if (file.substr(filePos + 1) == fileName) {
-                targetFilePath = path + fileName;
-                flag = true;
-                break;
-            }
-        }
-    }
-
-    TAG_LOGD(AAFwkTag::JSRUNTIME, "targetFilePath %{private}s", targetFilePath.c_str());
-
-    if (!flag) {
-        TAG_LOGE(AAFwkTag::JSRUNTIME, "get targetFilePath failed");
-        return;
-    }
-
+    auto lookup = [extractor](const std::string& entryName) { return extractor->HasEntry(entryName); };
     for (const auto& basePath : workerInfo_->assetBasePathStr) {
-        std::string filePathName = basePath + targetFilePath;
-        bool hasFile = extractor->HasEntry(filePathName);
-        if (hasFile) {
+        std::string filePathName = basePath + filePath;
+        if (AssetEntryIndex::GetInstance().HasEntry(loadPath, filePathName, lookup)) {
             ami = (workerInfo_->hapPath).GetOriginString() + "/" + filePathName;
+            TAG_LOGD(AAFwkTag::JSRUNTIME, "targetFilePath %{private}s", filePathName.c_str());
             return;
         }
     }
+    TAG_LOGE(AAFwkTag::JSRUNTIME, "get targetFilePath failed");
 }
 
 bool AssetHelper::GetIsStageModel()
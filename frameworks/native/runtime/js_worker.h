@@ -16,7 +16,10 @@
 #ifndef OHOS_ABILITY_RUNTIME_JS_WORKER_H
 #define OHOS_ABILITY_RUNTIME_JS_WORKER_H
 
+#include <functional>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include "bundle_mgr_proxy.h"
 #include "js_environment_impl.h"
 #include "native_engine/native_engine.h"
@@ -31,6 +34,31 @@ void UpdateContainerScope(int32_t id);
 void RestoreContainerScope(int32_t id);
 void SetJsFramework();
 
+/**
+ * @class AssetEntryIndex
+ * Whether the entries looked up by the workers exist in the hap, shared by all the workers of the process. A
+ * hap is not replaced while the process is alive, so each entry is looked up in the hap at most once.
+ */
+class AssetEntryIndex final {
+public:
+    using EntryLookup = std::function<bool(const std::string&)>;
+
+    static AssetEntryIndex& GetInstance();
+
+    /**
+     * @brief Check whether the hap has the entry.
+     * @param loadPath The load path of the hap.
+     * @param lookup Look up the entry in the hap, called only if the entry is not in the index.
+     */
+    bool HasEntry(const std::string& loadPath, const std::string& entryName, const EntryLookup& lookup);
+
+private:
+    std::mutex mutex_;
+    // load path of the hap -> entry name -> exist
+    std::unordered_map<std::string, std::unordered_map<std::string, bool>> entries_;
+    size_t entryCount_ = 0;
+};
+
 class AssetHelper final {
 public:
     explicit AssetHelper(std::shared_ptr<JsEnv::WorkerInfo> workerInfo);
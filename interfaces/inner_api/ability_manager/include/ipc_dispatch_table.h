@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_RUNTIME_IPC_DISPATCH_TABLE_H
+#define OHOS_ABILITY_RUNTIME_IPC_DISPATCH_TABLE_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "message_option.h"
+#include "message_parcel.h"
+
+namespace OHOS {
+namespace AAFwk {
+/**
+ * @class IpcDispatchTable
+ * Dense code to stage table for stubs that split OnRemoteRequest into a chain of stage functions.
+ * Each stage returns notExistCode for codes it does not handle. The first dispatch of a code walks
+ * the chain once and binds the code to the stage that handled it, later dispatches jump to that stage
+ * directly. Call count and latency histogram are kept per bound code for dump.
+ */
+template<typename Stub, uint32_t CODE_LIMIT>
+class IpcDispatchTable final {
+public:
+    using StageHandler = int (Stub::*)(uint32_t, MessageParcel &, MessageParcel &, MessageOption &);
+
+    static constexpr uint16_t MAX_SLOT_COUNT = 512;
+    static constexpr size_t BUCKET_COUNT = 8;
+    static constexpr std::array<int64_t, BUCKET_COUNT - 1> BUCKET_BOUNDS_US = {
+        100, 500, 1000, 5000, 10000, 50000, 100000 };
+
+    template<size_t STAGE_COUNT>
+    IpcDispatchTable(const std::array<StageHandler, STAGE_COUNT> &stages, int notExistCode)
+        : stages_(stages.begin(), stages.end()), notExistCode_(notExistCode)
+    {}
+
+    ~IpcDispatchTable() = default;
+
+    /**
+     * Dispatch the request to the stage bound to code.
+     *
+     * @return The stage result, notExistCode if no stage handles the code.
+     */
+    int Dispatch(Stub *stub, uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option)
+    {
+        uint16_t slotId = (code < CODE_LIMIT) ? codeSlots_[code].load(std::memory_order_acquire) : 0;
+        if (slotId == 0) {
+            return ResolveAndDispatch(stub, code, data, reply, option);
+        }
+        auto &slot = slots_[slotId - 1];
+        auto begin = std::chrono::steady_clock::now();
+        int ret = (stub->*stages_[slot.stage.load(std::memory_order_relaxed)])(code, data, reply, option);
+        RecordLatency(slot, begin);
+        return ret;
+    }
+
+    /**
+     * Dump call count and latency histogram of every bound code, most called first.
+     *
+     * @param result The dump output.
+     */
+    void Dump(std::string &result) const
+    {
+        std::vector<const Slot *> boundSlots;
+        uint16_t slotCount = std::min<uint16_t>(nextSlot_.load(std::memory_order_acquire), MAX_SLOT_COUNT);
+        for (uint16_t i = 0; i < slotCount; i++) {
+            const auto &slot = slots_[i];
+            uint32_t code = slot.code.load(std::memory_order_relaxed);
+            if (code < CODE_LIMIT && codeSlots_[code].load(std::memory_order_acquire) == i + 1) {
+                boundSlots.push_back(&slot);
+            }
+        }
+        std::sort(boundSlots.begin(), boundSlots.end(), [](const Slot *left, const Slot *right) {
+            return left->count.load(std::memory_order_relaxed) > right->count.load(std::memory_order_relaxed);
+        });
+        result.append("code    stage  count       avg(us)  max(us)  histogram(<100us|<500us|<1ms|<5ms|<10ms|"
+            "<50ms|<100ms|>=100ms)\n");
+        for (const auto *slot : boundSlots) {
+            uint64_t count = slot->count.load(std::memory_order_relaxed);
+            uint64_t avg = (count == 0) ? 0 : slot->totalUs.load(std::memory_order_relaxed) / count;
+            result.append(std::to_string(slot->code.load(std::memory_order_relaxed))).append("    ")
+                .append(std::to_string(slot->stage.load(std::memory_order_relaxed))).append("      ")
+                .append(std::to_string(count)).append("    ")
+                .append(std::to_string(avg)).append("    ")
+                .append(std::to_string(slot->maxUs.load(std::memory_order_relaxed))).append("    ");
+            for (size_t i = 0; i < BUCKET_COUNT; i++) {
+                result.append(std::to_string(slot->buckets[i].load(std::memory_order_relaxed)))
+                    .append(i + 1 == BUCKET_COUNT ? "\n" : "|");
+            }
+        }
+    }
+
+private:
+    struct Slot {
+        std::atomic<uint32_t> code = 0;
+        std::atomic<uint8_t> stage = 0;
+        std::atomic<uint64_t> count = 0;
+        std::atomic<uint64_t> totalUs = 0;
+        std::atomic<uint64_t> maxUs = 0;
+        std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets {};
+    };
+
+    int ResolveAndDispatch(Stub *stub, uint32_t code, MessageParcel &data, MessageParcel &reply,
+        MessageOption &option)
+    {
+        for (size_t stage = 0; stage < stages_.size(); stage++) {
+            auto begin = std::chrono::steady_clock::now();
+            int ret = (stub->*stages_[stage])(code, data, reply, option);
+            if (ret == notExistCode_) {
+                continue;
+            }
+            Slot *slot = BindSlot(code, static_cast<uint8_t>(stage));
+            if (slot != nullptr) {
+                RecordLatency(*slot, begin);
+            }
+            return ret;
+        }
+        return notExistCode_;
+    }
+
+    Slot *BindSlot(uint32_t code, uint8_t stage)
+    {
+        if (code >= CODE_LIMIT) {
+            return nullptr;
+        }
+        uint16_t slotId = nextSlot_.fetch_add(1, std::memory_order_acq_rel) + 1;
+        if (slotId > MAX_SLOT_COUNT) {
+            nextSlot_.store(MAX_SLOT_COUNT, std::memory_order_release);
+            return nullptr;
+        }
+        auto &slot = slots_[slotId - 1];
+        slot.code.store(code, std::memory_order_relaxed);
+        slot.stage.store(stage, std::memory_order_relaxed);
+        uint16_t expected = 0;
+        if (!codeSlots_[code].compare_exchange_strong(expected, slotId, std::memory_order_acq_rel)) {
+            // another thread bound this code first, the slot stays unused.
+            return &slots_[expected - 1];
+        }
+        return &slot;
+    }
+
+    static void RecordLatency(Slot &slot, std::chrono::steady_clock::time_point begin)
+    {
+        int64_t costUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - begin).count();
+        size_t bucket = std::upper_bound(BUCKET_BOUNDS_US.begin(), BUCKET_BOUNDS_US.end(), costUs) -
+            BUCKET_BOUNDS_US.begin();
+        slot.count.fetch_add(1, std::memory_order_relaxed);
+        slot.totalUs.fetch_add(static_cast<uint64_t>(costUs), std::memory_order_relaxed);
+        slot.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+        uint64_t maxUs = slot.maxUs.load(std::memory_order_relaxed);
+        while (static_cast<uint64_t>(costUs) > maxUs &&
+            !slot.maxUs.compare_exchange_weak(maxUs, static_cast<uint64_t>(costUs), std::memory_order_relaxed)) {}
+    }
+
+    const std::vector<StageHandler> stages_;
+    const int notExistCode_;
+    std::atomic<uint16_t> nextSlot_ = 0;
+    std::array<std::atomic<uint16_t>, CODE_LIMIT> codeSlots_ {};
+    std::array<Slot, MAX_SLOT_COUNT> slots_ {};
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // OHOS_ABILITY_RUNTIME_IPC_DISPATCH_TABLE_H
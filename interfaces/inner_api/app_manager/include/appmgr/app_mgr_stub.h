@@ -19,6 +19,7 @@
 #include <map>
 
 #include "app_mgr_interface.h"
+#include "ipc_dispatch_table.h"
 #include "iremote_stub.h"
 #include "nocopyable.h"
 #include "string_ex.h"
@@ -64,6 +65,12 @@ public:
     virtual int32_t GetSupportedProcessCachePids(const std::string &bundleName,
         std::vector<int32_t> &pidList) override;
 
+    /**
+     * Dump call count and latency histogram of each interface code.
+     * @param result, the dump output.
+     */
+    void DumpIpcDispatchStat(std::string &result);
+
 private:
     int32_t HandleAttachApplication(MessageParcel &data, MessageParcel &reply);
     int32_t HandlePreloadApplication(MessageParcel &data, MessageParcel &reply);
@@ -215,6 +222,9 @@ private:
         MessageParcel &reply, MessageOption &option);
     int32_t OnRemoteRequestInnerNinth(uint32_t code, MessageParcel &data,
         MessageParcel &reply, MessageOption &option);
+    static constexpr uint32_t IPC_DISPATCH_CODE_LIMIT = 256;
+    using DispatchTable = AAFwk::IpcDispatchTable<AppMgrStub, IPC_DISPATCH_CODE_LIMIT>;
+    static DispatchTable &GetDispatchTable();
     int32_t HandleGetSupportedProcessCachePids(MessageParcel &data, MessageParcel &reply);
     int32_t HandleUpdateProcessMemoryState(MessageParcel &data, MessageParcel &reply);
     int32_t HandleLaunchAbility(MessageParcel &data, MessageParcel &reply);
@@ -100,6 +100,13 @@ public:
      */
     virtual void OnAppStateChanged(const AppStateData &appStateData) override;
 
+    /**
+     * Batched application state changed callback.
+     *
+     * @param appStateDataList Application state data list.
+     */
+    virtual void OnAppStatesChanged(const std::vector<AppStateData> &appStateDataList) override;
+
      /**
      * Called when one process is reused.
      *
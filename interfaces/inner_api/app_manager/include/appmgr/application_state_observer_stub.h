@@ -188,6 +188,8 @@ private:
 
     int32_t HandleOnAppStateChanged(MessageParcel &data, MessageParcel &reply);
 
+    int32_t HandleOnAppStatesChanged(MessageParcel &data, MessageParcel &reply);
+
     int32_t HandleOnProcessReused(MessageParcel &data, MessageParcel &reply);
 
     int32_t HandleOnAppStarted(MessageParcel &data, MessageParcel &reply);
@@ -16,6 +16,8 @@
 #ifndef OHOS_ABILITY_RUNTIME_IAPPLICATION_STATE_OBSERVER_H
 #define OHOS_ABILITY_RUNTIME_IAPPLICATION_STATE_OBSERVER_H
 
+#include <vector>
+
 #include "ability_state_data.h"
 #include "app_state_data.h"
 #include "page_state_data.h"
@@ -103,6 +105,19 @@ public:
      */
     virtual void OnAppStateChanged(const AppStateData &appStateData) {}
 
+    /**
+     * Batched application state changed callback, entries are ordered from oldest to newest.
+     * Only observe APP_STATE_FOREGROUND and APP_STATE_BACKGROUND
+     *
+     * @param appStateDataList Application state data list.
+     */
+    virtual void OnAppStatesChanged(const std::vector<AppStateData> &appStateDataList)
+    {
+        for (const auto &appStateData : appStateDataList) {
+            OnAppStateChanged(appStateData);
+        }
+    }
+
     /**
      * Called when one process is reused.
      *
@@ -194,6 +209,7 @@ public:
         TRANSACT_ON_KEEP_ALIVE_STATE_CHANGED,
         TRANSACT_ON_PRELOAD_PROCESS_STATE_CHANGED,
         TRANSACT_ON_PROCESS_TYPE_CHANGED,
+        TRANSACT_ON_APP_STATES_CHANGED,
     };
 };
 }  // namespace AppExecFwk
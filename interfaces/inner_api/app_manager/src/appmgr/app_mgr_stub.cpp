@@ -63,43 +63,28 @@ int AppMgrStub::OnRemoteRequest(uint32_t code, MessageParcel &data, MessageParce
     return OnRemoteRequestInner(code, data, reply, option);
 }
 
+AppMgrStub::DispatchTable &AppMgrStub::GetDispatchTable()
+{
+    static constexpr std::array<DispatchTable::StageHandler, 9> stages = {
+        &AppMgrStub::OnRemoteRequestInnerFirst, &AppMgrStub::OnRemoteRequestInnerSecond,
+        &AppMgrStub::OnRemoteRequestInnerThird, &AppMgrStub::OnRemoteRequestInnerFourth,
+        &AppMgrStub::OnRemoteRequestInnerFifth, &AppMgrStub::OnRemoteRequestInnerSixth,
+        &AppMgrStub::OnRemoteRequestInnerSeventh, &AppMgrStub::OnRemoteRequestInnerEighth,
+        &AppMgrStub::OnRemoteRequestInnerNinth,
+    };
+    static DispatchTable dispatchTable(stages, INVALID_FD);
+    return dispatchTable;
+}
+
+void AppMgrStub::DumpIpcDispatchStat(std::string &result)
+{
+    GetDispatchTable().Dump(result);
+}
+
 int32_t AppMgrStub::OnRemoteRequestInner(uint32_t code, MessageParcel &data,
     MessageParcel &reply, MessageOption &option)
 {
-    int retCode = ERR_OK;
-    retCode = OnRemoteRequestInnerFirst(code, data, reply, option);
-    if (retCode != INVALID_FD) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerSecond(code, data, reply, option);
-    if (retCode != INVALID_FD) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerThird(code, data, reply, option);
-    if (retCode != INVALID_FD) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerFourth(code, data, reply, option);
-    if (retCode != INVALID_FD) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerFifth(code, data, reply, option);
-    if (retCode != INVALID_FD) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerSixth(code, data, reply, option);
-    if (retCode != INVALID_FD) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerSeventh(code, data, reply, option);
-    if (retCode != INVALID_FD) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerEighth(code, data, reply, option);
-    if (retCode != INVALID_FD) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerNinth(code, data, reply, option);
+    int32_t retCode = GetDispatchTable().Dispatch(this, code, data, reply, option);
     if (retCode != INVALID_FD) {
         return retCode;
     }
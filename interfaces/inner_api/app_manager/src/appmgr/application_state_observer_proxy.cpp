@@ -273,6 +273,34 @@ void ApplicationStateObserverProxy::OnAppStateChanged(const AppStateData &appSta
     }
 }
 
+void ApplicationStateObserverProxy::OnAppStatesChanged(const std::vector<AppStateData> &appStateDataList)
+{
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option(MessageOption::TF_ASYNC);
+    if (!WriteInterfaceToken(data)) {
+        TAG_LOGE(AAFwkTag::APPMGR, "WriteInterfaceToken failed");
+        return;
+    }
+    if (!data.WriteInt32(static_cast<int32_t>(appStateDataList.size()))) {
+        TAG_LOGE(AAFwkTag::APPMGR, "write size failed");
+        return;
+    }
+    for (const auto &appStateData : appStateDataList) {
+        if (!data.WriteParcelable(&appStateData)) {
+            TAG_LOGE(AAFwkTag::APPMGR, "write appStateData failed");
+            return;
+        }
+    }
+    int32_t ret = SendTransactCmd(
+        static_cast<uint32_t>(IApplicationStateObserver::Message::TRANSACT_ON_APP_STATES_CHANGED),
+        data, reply, option);
+    if (ret != NO_ERROR && ret != ERR_INVALID_STUB) {
+        TAG_LOGW(AAFwkTag::APPMGR, "SendRequest is failed, error code: %{public}d, size: %{public}zu",
+            ret, appStateDataList.size());
+    }
+}
+
 void ApplicationStateObserverProxy::OnAppStarted(const AppStateData &appStateData)
 {
     MessageParcel data;
@@ -21,6 +21,9 @@
 
 namespace OHOS {
 namespace AppExecFwk {
+namespace {
+constexpr int32_t MAX_APP_STATE_BATCH_SIZE = 128;
+}
 std::mutex ApplicationStateObserverStub::callbackMutex_;
 int ApplicationStateObserverStub::OnRemoteRequest(
     uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option)
@@ -73,6 +76,8 @@ int ApplicationStateObserverStub::OnRemoteRequest(
             return HandleOnProcessPreForegroundChanged(data, reply);
         case Message::TRANSACT_ON_PROCESS_TYPE_CHANGED:
             return HandleOnProcessTypeChanged(data, reply);
+        case Message::TRANSACT_ON_APP_STATES_CHANGED:
+            return HandleOnAppStatesChanged(data, reply);
     }
     TAG_LOGW(AAFwkTag::APPMGR, "ApplicationStateObserverStub::OnRemoteRequest, default case, need check");
     return IPCObjectStub::OnRemoteRequest(code, data, reply, option);
@@ -292,6 +297,28 @@ int32_t ApplicationStateObserverStub::HandleOnAppStateChanged(MessageParcel &dat
     return NO_ERROR;
 }
 
+int32_t ApplicationStateObserverStub::HandleOnAppStatesChanged(MessageParcel &data, MessageParcel &reply)
+{
+    int32_t size = data.ReadInt32();
+    if (size <= 0 || size > MAX_APP_STATE_BATCH_SIZE) {
+        TAG_LOGE(AAFwkTag::APPMGR, "invalid size: %{public}d", size);
+        return ERR_INVALID_VALUE;
+    }
+    std::vector<AppStateData> appStateDataList;
+    appStateDataList.reserve(size);
+    for (int32_t i = 0; i < size; i++) {
+        std::unique_ptr<AppStateData> appStateData(data.ReadParcelable<AppStateData>());
+        if (!appStateData) {
+            TAG_LOGE(AAFwkTag::APPMGR, "ReadParcelable<AppStateData> failed");
+            return ERR_APPEXECFWK_PARCEL_ERROR;
+        }
+        appStateDataList.emplace_back(*appStateData);
+    }
+
+    OnAppStatesChanged(appStateDataList);
+    return NO_ERROR;
+}
+
 void ApplicationStateObserverRecipient::OnRemoteDied(const wptr<IRemoteObject> &__attribute__((unused)) remote)
 {
     TAG_LOGD(AAFwkTag::APPMGR, "called");
@@ -29,6 +29,8 @@ public:
 
     const std::string &GetType() const override;
 
+    const std::string &GetOhmUrl() const;
+
     int32_t RunTaskInit(std::unique_ptr<StartupTaskResultCallback> callback) override;
 
     int32_t RunTaskOnDependencyCompleted(const std::string& dependencyName,
@@ -30,6 +30,7 @@
 #include "preload_so_startup_task.h"
 #include "singleton.h"
 #include "startup_config.h"
+#include "startup_profile_cache.h"
 #include "startup_task_manager.h"
 
 namespace OHOS {
@@ -174,8 +175,11 @@ private:
     int32_t RunAppPreloadSoTaskMainThread(const std::map<std::string, std::shared_ptr<StartupTask>> &appPreloadSoTasks,
         std::unique_ptr<StartupTaskResultCallback> callback);
 
-    static int32_t GetStartupConfigString(const ModuleStartupConfigInfo& info, std::string& config);
-    bool AnalyzeStartupConfig(const ModuleStartupConfigInfo& info, const std::string& startupConfig,
+    static int32_t GetStartupConfigJson(const ModuleStartupConfigInfo& info, nlohmann::json &profileJson);
+    int32_t LoadModuleStartupProfile(const ModuleStartupConfigInfo& info, ModuleStartupProfile &profile);
+    bool AnalyzeStartupProfile(const ModuleStartupConfigInfo& info, nlohmann::json &startupConfigJson,
+        ModuleStartupProfile &profile);
+    void ApplyStartupProfile(const ModuleStartupConfigInfo& info, const ModuleStartupProfile &profile,
         std::map<std::string, std::shared_ptr<AppStartupTask>>& preloadSoStartupTasks,
         std::map<std::string, std::shared_ptr<AppStartupTask>>& preloadSystemSoStartupTasks,
         std::vector<StartupTaskInfo>& pendingStartupTaskInfos,
@@ -190,9 +194,11 @@ private:
     bool AnalyzePreloadSoStartupTaskInner(const ModuleStartupConfigInfo& info,
         const nlohmann::json &preloadStartupTaskJson,
         std::map<std::string, std::shared_ptr<AppStartupTask>>& preloadSoStartupTasks);
-    void AnalyzePreloadSystemSoStartupTask(nlohmann::json &startupConfigJson,
-        std::map<std::string, std::shared_ptr<AppStartupTask>>& preloadSoStartupTasks);
+    void AnalyzePreloadSystemSoStartupTask(const nlohmann::json &startupConfigJson,
+        std::vector<std::pair<std::string, std::string>> &preloadSystemSoTasks);
     void AnalyzePreloadSystemSoStartupTaskInner(const nlohmann::json &preloadStartupTaskJson,
+        std::vector<std::pair<std::string, std::string>> &preloadSystemSoTasks);
+    void AddPreloadSystemSoStartupTask(const std::string &name, const std::string &ohmUrl,
         std::map<std::string, std::shared_ptr<AppStartupTask>>& preloadSoStartupTasks);
     void SetOptionalParameters(const nlohmann::json& module, AppExecFwk::ModuleType moduleType,
         StartupTaskInfo& startupTaskInfo);
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_RUNTIME_STARTUP_PROFILE_CACHE_H
+#define OHOS_ABILITY_RUNTIME_STARTUP_PROFILE_CACHE_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "app_startup_task.h"
+
+namespace OHOS {
+namespace AbilityRuntime {
+/**
+ * The startup profile of a module is valid as long as the hap file is not replaced, so the size and the
+ * modification time of the hap file stand for its version.
+ */
+struct StartupProfileKey {
+    std::string hapPath;
+    std::string moduleName;
+    std::string appStartup;
+    uint64_t hapSize = 0;
+    int64_t hapModifyTime = 0;
+
+    bool operator==(const StartupProfileKey &other) const;
+};
+
+/**
+ * Startup profile of a module, parsed from the json file in the hap.
+ */
+struct ModuleStartupProfile {
+    std::pair<std::string, std::string> configEntry;
+    std::vector<StartupTaskInfo> startupTaskInfos;
+    // name, ohmUrl, dependencies, excludeFromAutoStart and matchRules of the preload so tasks
+    std::vector<StartupTaskInfo> preloadSoTaskInfos;
+    // name and ohmUrl of the preload system so tasks, not filtered by the allowlist
+    std::vector<std::pair<std::string, std::string>> preloadSystemSoTasks;
+    bool enableLazyLoading = false;
+    // time spent on extracting and parsing the profile, a hit saves it
+    int64_t parseCostUs = 0;
+};
+
+/**
+ * @class StartupProfileCache
+ * Parsed startup profiles kept in the cache directory of the application, one file per module. A file is
+ * used only if the key stored in it is the same as the one looked up by, any error is treated as a miss.
+ */
+class StartupProfileCache {
+public:
+    explicit StartupProfileCache(const std::string &cacheDir);
+    ~StartupProfileCache() = default;
+
+    /**
+     * @brief Build the key of a module from the stat of its hap file.
+     * @return Returns false if the hap file is not accessible.
+     */
+    static bool MakeKey(const std::string &hapPath, const std::string &moduleName, const std::string &appStartup,
+        StartupProfileKey &key);
+
+    bool Load(const StartupProfileKey &key, ModuleStartupProfile &profile) const;
+
+    bool Save(const StartupProfileKey &key, const ModuleStartupProfile &profile) const;
+
+    static void Encode(const StartupProfileKey &key, const ModuleStartupProfile &profile, std::string &data);
+
+    static bool Decode(const std::string &data, const StartupProfileKey &key, ModuleStartupProfile &profile);
+
+private:
+    std::string GetFilePath(const StartupProfileKey &key) const;
+
+    std::string cacheDir_;
+};
+} // namespace AbilityRuntime
+} // namespace OHOS
+#endif // OHOS_ABILITY_RUNTIME_STARTUP_PROFILE_CACHE_H
@@ -16,11 +16,11 @@
 #ifndef OHOS_ABILITY_RUNTIME_STARTUP_SORT_RESULT_H
 #define OHOS_ABILITY_RUNTIME_STARTUP_SORT_RESULT_H
 
-#include <deque>
-#include <map>
-#include <string>
+#include <memory>
 #include <vector>
 
+#include "startup_task.h"
+
 namespace OHOS {
 namespace AbilityRuntime {
 class StartupSortResult {
@@ -29,8 +29,13 @@ public:
 
     ~StartupSortResult() = default;
 
-    std::map<std::string, std::vector<std::string>> startupChildrenMap_;
-    std::deque<std::string> zeroDequeResult_;
+    // the startup graph compiled by StartupTopologySort, tasks are referred to by their index in tasks_
+    std::vector<std::shared_ptr<StartupTask>> tasks_;
+    std::vector<std::vector<uint32_t>> childrenIndexes_;
+    std::vector<uint32_t> inDegrees_;
+    // cost of the longest path from the task to the end of the graph, the task itself included
+    std::vector<int64_t> priorities_;
+    std::vector<uint32_t> zeroIndexes_;
 };
 } // namespace AbilityRuntime
 } // namespace OHOS
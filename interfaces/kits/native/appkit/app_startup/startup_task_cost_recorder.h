@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_RUNTIME_STARTUP_TASK_COST_RECORDER_H
+#define OHOS_ABILITY_RUNTIME_STARTUP_TASK_COST_RECORDER_H
+
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace OHOS {
+namespace AbilityRuntime {
+/**
+ * @class StartupTaskCostRecorder
+ * Measured costs of the startup tasks, keyed by task name. The costs weight the critical paths of the startup
+ * graph, and are kept in the cache directory of the application so that later launches are ordered by them.
+ */
+class StartupTaskCostRecorder {
+public:
+    static StartupTaskCostRecorder &GetInstance();
+
+    /**
+     * @brief Load the costs saved by former launches, only the first call of the process reads the file.
+     */
+    void Load(const std::string &cacheDir);
+
+    /**
+     * @brief Save the costs if any of them was recorded after the last load or save.
+     */
+    void Save();
+
+    /**
+     * @brief Get the smoothed cost of a task.
+     * @return Returns the default cost if the task was never measured.
+     */
+    int64_t GetCostUs(const std::string &name);
+
+    void Record(const std::string &name, int64_t costUs);
+
+private:
+    StartupTaskCostRecorder() = default;
+    ~StartupTaskCostRecorder() = default;
+
+    std::mutex mutex_;
+    std::mutex saveMutex_;
+    bool isLoaded_ = false;
+    bool isChanged_ = false;
+    std::string cacheDir_;
+    std::map<std::string, int64_t> costs_;
+};
+} // namespace AbilityRuntime
+} // namespace OHOS
+#endif // OHOS_ABILITY_RUNTIME_STARTUP_TASK_COST_RECORDER_H
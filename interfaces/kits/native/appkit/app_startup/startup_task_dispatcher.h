@@ -16,8 +16,9 @@
 #ifndef OHOS_ABILITY_RUNTIME_STARTUP_TASK_DISPATCHER_H
 #define OHOS_ABILITY_RUNTIME_STARTUP_TASK_DISPATCHER_H
 
-#include <map>
 #include <atomic>
+#include <mutex>
+#include <vector>
 
 #include "startup_sort_result.h"
 #include "startup_task_result.h"
@@ -28,8 +29,7 @@ namespace OHOS {
 namespace AbilityRuntime {
 class StartupTaskDispatcher : public std::enable_shared_from_this<StartupTaskDispatcher> {
 public:
-    StartupTaskDispatcher(const std::map<std::string, std::shared_ptr<StartupTask>> &tasks,
-        const std::shared_ptr<StartupSortResult> &sortResult);
+    explicit StartupTaskDispatcher(const std::shared_ptr<StartupSortResult> &sortResult);
 
     ~StartupTaskDispatcher();
 
@@ -39,18 +39,29 @@ public:
     void TimeoutStop();
 
 private:
-    const std::map<std::string, std::shared_ptr<StartupTask>> &tasks_;
     std::shared_ptr<StartupSortResult> sortResult_;
-    std::map<std::string, std::uint32_t> inDegreeMap_;
+    std::mutex readyTasksMutex_;
+    // indexed like the tasks of sortResult_, guarded by readyTasksMutex_
+    std::vector<uint32_t> inDegrees_;
+    std::vector<int64_t> startTimesUs_;
+    // heaps of the tasks whose dependencies are completed, the task with the longest path to the end first.
+    // tasks running on the main thread block the others, they are started after all the ready worker tasks.
+    std::vector<uint32_t> readyWorkerTasks_;
+    std::vector<uint32_t> readyMainThreadTasks_;
+    bool isRunningReadyTasks_ = false;
     std::atomic<uint32_t> mainThreadAwaitCount_ = 0;
     std::atomic<uint32_t> tasksCount_ = 0;
     std::shared_ptr<OnCompletedCallback> completedCallback_;
     std::shared_ptr<OnCompletedCallback> mainThreadAwaitCallback_;
     std::atomic<bool> isTimeoutStopped_ = false;
 
-    void Dispatch(const std::string &name, const std::shared_ptr<StartupTaskResult> &result);
-    int32_t NotifyChildren(const std::string &name, const std::shared_ptr<StartupTaskResult> &result);
-    int32_t RunTaskInit(const std::string &name, const std::shared_ptr<StartupTask> &task);
+    void Dispatch(uint32_t index, const std::shared_ptr<StartupTaskResult> &result);
+    int32_t NotifyChildren(uint32_t index, const std::shared_ptr<StartupTaskResult> &result);
+    void PushReadyTask(uint32_t index);
+    bool PopReadyTask(uint32_t &index);
+    int32_t RunReadyTasks();
+    int32_t RunTaskInit(uint32_t index);
+    void RecordTaskCost(uint32_t index);
     void OnError(const std::string &name, const std::shared_ptr<StartupTaskResult> &result);
     void OnError(int32_t errorCode, const std::string &errorMessage);
 };
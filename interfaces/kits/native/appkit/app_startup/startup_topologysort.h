@@ -16,7 +16,6 @@
 #ifndef OHOS_ABILITY_RUNTIME_STARTUP_TOPOLOGY_SORT_H
 #define OHOS_ABILITY_RUNTIME_STARTUP_TOPOLOGY_SORT_H
 
-#include <deque>
 #include <map>
 #include <string>
 #include <vector>
@@ -36,10 +35,12 @@ public:
         std::shared_ptr<StartupSortResult> &startupSortResult);
 
 private:
-    static int32_t SortZeroDeque(const std::shared_ptr<StartupTask> &startup,
-        const std::map<std::string, std::shared_ptr<StartupTask>> &startupMap,
-        std::map<std::string, std::uint32_t> &inDegreeMap, std::deque<std::string> &zeroDeque,
-        std::shared_ptr<StartupSortResult> &startupSortResult);
+    static int32_t BuildGraph(const std::map<std::string, std::shared_ptr<StartupTask>> &startupMap,
+        StartupSortResult &startupSortResult);
+
+    static int32_t SortIndexes(const StartupSortResult &startupSortResult, std::vector<uint32_t> &sortedIndexes);
+
+    static void CalculatePriorities(const std::vector<uint32_t> &sortedIndexes, StartupSortResult &startupSortResult);
 };
 } // namespace AbilityRuntime
 } // namespace OHOS
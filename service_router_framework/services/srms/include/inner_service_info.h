@@ -112,6 +112,24 @@ public:
         return appInfo_;
     }
 
+    /**
+     * @brief Get business ability infos.
+     * @return Return business ability infos
+     */
+    const std::vector<BusinessAbilityInfo> &GetBusinessAbilityInfos() const
+    {
+        return businessAbilityInfos_;
+    }
+
+    /**
+     * @brief Get purposeInfos.
+     * @return Return purposeInfos
+     */
+    const std::vector<PurposeInfo> &GetPurposeInfos() const
+    {
+        return purposeInfos_;
+    }
+
     /**
      * @brief Get bundle name.
      * @return Return bundle name
@@ -18,6 +18,7 @@
 
 #include <map>
 #include <mutex>
+#include <shared_mutex>
 #include <vector>
 #include <string>
 #include <singleton.h>
@@ -84,13 +85,26 @@ private:
      */
     void UpdateBundleInfoLocked(const BundleInfo &bundleInfo);
 
+    /**
+     * @brief Replace the inner service info of a bundle and its entries in the indexes.
+     * @param bundleName Indicates the bundle name.
+     * @param innerServiceInfo Indicates the new inner service info.
+     */
+    void SetInnerServiceInfoLocked(const std::string &bundleName, InnerServiceInfo &&innerServiceInfo);
+
+    void EraseInnerServiceInfoLocked(const std::string &bundleName);
+
     BusinessType GetBusinessType(const BusinessAbilityFilter &filter) const;
 
     void ClearAllBundleInfos();
 
 private:
-    mutable std::mutex bundleInfoMutex_;
+    mutable std::shared_mutex bundleInfoMutex_;
     std::map<std::string, InnerServiceInfo> innerServiceInfos_;
+    // business type -> bundle name -> business ability infos of the bundle
+    std::map<BusinessType, std::map<std::string, std::vector<BusinessAbilityInfo>>> businessIndex_;
+    // purpose name -> bundle name -> purpose infos of the bundle
+    std::map<std::string, std::map<std::string, std::vector<PurposeInfo>>> purposeIndex_;
 };
 } // namespace AbilityRuntime
 } // namespace OHOS
@@ -46,7 +46,7 @@ bool ServiceRouterDataMgr::LoadAllBundleInfos()
         return false;
     }
 
-    std::lock_guard<std::mutex> lock(bundleInfoMutex_);
+    std::unique_lock<std::shared_mutex> lock(bundleInfoMutex_);
     for (const auto &bundleInfo : bundleInfos) {
         UpdateBundleInfoLocked(bundleInfo);
     }
@@ -68,7 +68,7 @@ bool ServiceRouterDataMgr::LoadBundleInfo(const std::string &bundleName)
         return false;
     }
 
-    std::lock_guard<std::mutex> lock(bundleInfoMutex_);
+    std::unique_lock<std::shared_mutex> lock(bundleInfoMutex_);
     UpdateBundleInfoLocked(bundleInfo);
     return true;
 }
@@ -88,20 +88,61 @@ void ServiceRouterDataMgr::UpdateBundleInfoLocked(const BundleInfo &bundleInfo)
     if (BundleInfoResolveUtil::ResolveBundleInfo(bundleInfo, purposeInfos, businessAbilityInfos,
         innerServiceInfo.GetAppInfo())) {
         innerServiceInfo.UpdateInnerServiceInfo(purposeInfos, businessAbilityInfos);
-        innerServiceInfos_.try_emplace(bundleInfo.name, innerServiceInfo);
+        SetInnerServiceInfoLocked(bundleInfo.name, std::move(innerServiceInfo));
     }
 }
 
-void ServiceRouterDataMgr::DeleteBundleInfo(const std::string &bundleName)
+void ServiceRouterDataMgr::SetInnerServiceInfoLocked(const std::string &bundleName,
+    InnerServiceInfo &&innerServiceInfo)
+{
+    EraseInnerServiceInfoLocked(bundleName);
+    for (const auto &businessAbilityInfo : innerServiceInfo.GetBusinessAbilityInfos()) {
+        businessIndex_[businessAbilityInfo.businessType][bundleName].emplace_back(businessAbilityInfo);
+    }
+    for (const auto &purposeInfo : innerServiceInfo.GetPurposeInfos()) {
+        purposeIndex_[purposeInfo.purposeName][bundleName].emplace_back(purposeInfo);
+    }
+    innerServiceInfos_.emplace(bundleName, std::move(innerServiceInfo));
+}
+
+void ServiceRouterDataMgr::EraseInnerServiceInfoLocked(const std::string &bundleName)
 {
-    TAG_LOGD(AAFwkTag::SER_ROUTER, "Called");
-    std::lock_guard<std::mutex> lock(bundleInfoMutex_);
     auto infoItem = innerServiceInfos_.find(bundleName);
     if (infoItem == innerServiceInfos_.end()) {
+        return;
+    }
+    for (const auto &businessAbilityInfo : infoItem->second.GetBusinessAbilityInfos()) {
+        auto indexItem = businessIndex_.find(businessAbilityInfo.businessType);
+        if (indexItem == businessIndex_.end()) {
+            continue;
+        }
+        indexItem->second.erase(bundleName);
+        if (indexItem->second.empty()) {
+            businessIndex_.erase(indexItem);
+        }
+    }
+    for (const auto &purposeInfo : infoItem->second.GetPurposeInfos()) {
+        auto indexItem = purposeIndex_.find(purposeInfo.purposeName);
+        if (indexItem == purposeIndex_.end()) {
+            continue;
+        }
+        indexItem->second.erase(bundleName);
+        if (indexItem->second.empty()) {
+            purposeIndex_.erase(indexItem);
+        }
+    }
+    innerServiceInfos_.erase(infoItem);
+}
+
+void ServiceRouterDataMgr::DeleteBundleInfo(const std::string &bundleName)
+{
+    TAG_LOGD(AAFwkTag::SER_ROUTER, "Called");
+    std::unique_lock<std::shared_mutex> lock(bundleInfoMutex_);
+    if (innerServiceInfos_.find(bundleName) == innerServiceInfos_.end()) {
         TAG_LOGE(AAFwkTag::SER_ROUTER, "innerServiceInfo not found");
         return;
     }
-    innerServiceInfos_.erase(bundleName);
+    EraseInnerServiceInfoLocked(bundleName);
 }
 
 int32_t ServiceRouterDataMgr::QueryBusinessAbilityInfos(const BusinessAbilityFilter &filter,
@@ -114,9 +155,13 @@ int32_t ServiceRouterDataMgr::QueryBusinessAbilityInfos(const BusinessAbilityFil
         return ERR_BUNDLE_MANAGER_PARAM_ERROR;
     }
 
-    std::lock_guard<std::mutex> lock(bundleInfoMutex_);
-    for (const auto &item : innerServiceInfos_) {
-        item.second.FindBusinessAbilityInfos(validType, businessAbilityInfos);
+    std::shared_lock<std::shared_mutex> lock(bundleInfoMutex_);
+    auto indexItem = businessIndex_.find(validType);
+    if (indexItem == businessIndex_.end()) {
+        return ERR_OK;
+    }
+    for (const auto &[bundleName, infos] : indexItem->second) {
+        businessAbilityInfos.insert(businessAbilityInfos.end(), infos.begin(), infos.end());
     }
     return ERR_OK;
 }
@@ -130,12 +175,16 @@ int32_t ServiceRouterDataMgr::QueryPurposeInfos(const Want &want, const std::str
         return ERR_BUNDLE_MANAGER_PARAM_ERROR;
     }
 
-    std::lock_guard<std::mutex> lock(bundleInfoMutex_);
+    std::shared_lock<std::shared_mutex> lock(bundleInfoMutex_);
     ElementName element = want.GetElement();
     std::string bundleName = element.GetBundleName();
     if (bundleName.empty()) {
-        for (const auto &item : innerServiceInfos_) {
-            item.second.FindPurposeInfos(purposeName, purposeInfos);
+        auto indexItem = purposeIndex_.find(purposeName);
+        if (indexItem == purposeIndex_.end()) {
+            return ERR_OK;
+        }
+        for (const auto &[name, infos] : indexItem->second) {
+            purposeInfos.insert(purposeInfos.end(), infos.begin(), infos.end());
         }
     } else {
         auto infoItem = innerServiceInfos_.find(bundleName);
@@ -168,10 +217,12 @@ BusinessType ServiceRouterDataMgr::GetBusinessType(const BusinessAbilityFilter &
 
 void ServiceRouterDataMgr::ClearAllBundleInfos()
 {
-    std::lock_guard<std::mutex> lock(bundleInfoMutex_);
+    std::unique_lock<std::shared_mutex> lock(bundleInfoMutex_);
     if (!innerServiceInfos_.empty()) {
         innerServiceInfos_.clear();
     }
+    businessIndex_.clear();
+    purposeIndex_.clear();
 }
 }  // namespace AbilityRuntime
 }  // namespace OHOS
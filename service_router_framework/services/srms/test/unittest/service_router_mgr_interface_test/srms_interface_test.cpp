@@ -37,6 +37,21 @@ const std::string WRONG_BUNDLE_NAME = "wrong";
 const std::string MIME_TYPE = "html";
 const std::string BUNDLE_NAME = "bundleName";
 const std::string PURPOSE_NAME = "pay";
+
+InnerServiceInfo BuildInnerServiceInfo(const std::string &bundleName, const std::string &purposeName)
+{
+    BusinessAbilityInfo businessAbilityInfo;
+    businessAbilityInfo.bundleName = bundleName;
+    businessAbilityInfo.businessType = BusinessType::SHARE;
+    PurposeInfo purposeInfo;
+    purposeInfo.bundleName = bundleName;
+    purposeInfo.purposeName = purposeName;
+    std::vector<BusinessAbilityInfo> businessAbilityInfos = { businessAbilityInfo };
+    std::vector<PurposeInfo> purposeInfos = { purposeInfo };
+    InnerServiceInfo innerServiceInfo;
+    innerServiceInfo.UpdateInnerServiceInfo(purposeInfos, businessAbilityInfos);
+    return innerServiceInfo;
+}
 }  // namespace
 
 class ServiceRouterMgrInterfaceTest : public testing::Test {
@@ -499,6 +514,94 @@ HWTEST_F(ServiceRouterMgrInterfaceTest, ServiceRouterMgrInterfaceTest_0026, Func
     }
 }
 
+/**
+ * @tc.number: ServiceRouterMgrInterfaceTest_0027
+ * @tc.name: test SetInnerServiceInfoLocked
+ * @tc.desc: queries are served from the indexes, ordered by bundle name
+ */
+HWTEST_F(ServiceRouterMgrInterfaceTest, ServiceRouterMgrInterfaceTest_0027, Function | SmallTest | Level1)
+{
+    auto serviceRouterMgr = std::make_shared<ServiceRouterDataMgr>();
+    serviceRouterMgr->SetInnerServiceInfoLocked("bundleB", BuildInnerServiceInfo("bundleB", PURPOSE_NAME));
+    serviceRouterMgr->SetInnerServiceInfoLocked("bundleA", BuildInnerServiceInfo("bundleA", PURPOSE_NAME));
+    serviceRouterMgr->SetInnerServiceInfoLocked("bundleC", BuildInnerServiceInfo("bundleC", "other"));
+
+    BusinessAbilityFilter filter;
+    filter.businessType = BusinessType::SHARE;
+    std::vector<BusinessAbilityInfo> abilityInfos;
+    EXPECT_EQ(serviceRouterMgr->QueryBusinessAbilityInfos(filter, abilityInfos), ERR_OK);
+    ASSERT_EQ(abilityInfos.size(), 3);
+    EXPECT_EQ(abilityInfos[0].bundleName, "bundleA");
+    EXPECT_EQ(abilityInfos[2].bundleName, "bundleC");
+
+    Want want;
+    std::vector<PurposeInfo> purposeInfos;
+    EXPECT_EQ(serviceRouterMgr->QueryPurposeInfos(want, PURPOSE_NAME, purposeInfos), ERR_OK);
+    ASSERT_EQ(purposeInfos.size(), 2);
+    EXPECT_EQ(purposeInfos[0].bundleName, "bundleA");
+    EXPECT_EQ(purposeInfos[1].bundleName, "bundleB");
+
+    purposeInfos.clear();
+    want.SetElementName("bundleC", "");
+    EXPECT_EQ(serviceRouterMgr->QueryPurposeInfos(want, PURPOSE_NAME, purposeInfos), ERR_OK);
+    EXPECT_TRUE(purposeInfos.empty());
+}
+
+/**
+ * @tc.number: ServiceRouterMgrInterfaceTest_0028
+ * @tc.name: test SetInnerServiceInfoLocked and DeleteBundleInfo
+ * @tc.desc: replacing or deleting a bundle drops its old index entries
+ */
+HWTEST_F(ServiceRouterMgrInterfaceTest, ServiceRouterMgrInterfaceTest_0028, Function | SmallTest | Level1)
+{
+    auto serviceRouterMgr = std::make_shared<ServiceRouterDataMgr>();
+    serviceRouterMgr->SetInnerServiceInfoLocked(BUNDLE_NAME, BuildInnerServiceInfo(BUNDLE_NAME, PURPOSE_NAME));
+    serviceRouterMgr->SetInnerServiceInfoLocked(BUNDLE_NAME, BuildInnerServiceInfo(BUNDLE_NAME, "other"));
+
+    Want want;
+    std::vector<PurposeInfo> purposeInfos;
+    EXPECT_EQ(serviceRouterMgr->QueryPurposeInfos(want, PURPOSE_NAME, purposeInfos), ERR_OK);
+    EXPECT_TRUE(purposeInfos.empty());
+    EXPECT_EQ(serviceRouterMgr->QueryPurposeInfos(want, "other", purposeInfos), ERR_OK);
+    EXPECT_EQ(purposeInfos.size(), 1);
+
+    serviceRouterMgr->DeleteBundleInfo(BUNDLE_NAME);
+    EXPECT_TRUE(serviceRouterMgr->innerServiceInfos_.empty());
+    EXPECT_TRUE(serviceRouterMgr->businessIndex_.empty());
+    EXPECT_TRUE(serviceRouterMgr->purposeIndex_.empty());
+}
+
+/**
+ * @tc.number: ServiceRouterMgrInterfaceTest_0029
+ * @tc.name: test QueryPurposeInfos and QueryBusinessAbilityInfos
+ * @tc.desc: a rare purpose among many installed bundles is found through the indexes
+ */
+HWTEST_F(ServiceRouterMgrInterfaceTest, ServiceRouterMgrInterfaceTest_0029, Function | MediumTest | Level1)
+{
+    constexpr int32_t bundleCount = 200;
+    auto serviceRouterMgr = std::make_shared<ServiceRouterDataMgr>();
+    for (int32_t i = 0; i < bundleCount; i++) {
+        std::string bundleName = BUNDLE_NAME + std::to_string(i);
+        serviceRouterMgr->SetInnerServiceInfoLocked(bundleName,
+            BuildInnerServiceInfo(bundleName, i == bundleCount / 2 ? PURPOSE_NAME : "other"));
+    }
+    Want want;
+    std::vector<PurposeInfo> purposeInfos;
+    EXPECT_EQ(serviceRouterMgr->QueryPurposeInfos(want, PURPOSE_NAME, purposeInfos), ERR_OK);
+    ASSERT_EQ(purposeInfos.size(), 1);
+    EXPECT_EQ(purposeInfos[0].bundleName, BUNDLE_NAME + std::to_string(bundleCount / 2));
+
+    purposeInfos.clear();
+    EXPECT_EQ(serviceRouterMgr->QueryPurposeInfos(want, "other", purposeInfos), ERR_OK);
+    EXPECT_EQ(purposeInfos.size(), bundleCount - 1);
+
+    BusinessAbilityFilter filter;
+    filter.businessType = BusinessType::SHARE;
+    std::vector<BusinessAbilityInfo> abilityInfos;
+    EXPECT_EQ(serviceRouterMgr->QueryBusinessAbilityInfos(filter, abilityInfos), ERR_OK);
+    EXPECT_EQ(abilityInfos.size(), bundleCount);
+}
+
 /**
  * @tc.number: serviceRouterMgrProxy
  * @tc.name: test QueryBusinessAbilityInfos
@@ -24,6 +24,7 @@
 #include "ability_config.h"
 #include "ability_info.h"
 #include "base_extension_record.h"
+#include "extension_record_index.h"
 namespace OHOS {
 namespace AAFwk {
 /**
@@ -124,6 +125,8 @@ public:
         uint32_t devLruCnt_ = 0;
         std::map<uint32_t, ProcRecordsInfo> procLruMap_;
         std::list<std::shared_ptr<BaseExtensionRecord>> devRecLru_;
+        // records of devRecLru_, changed together with devRecLru_ under mutex_
+        ExtensionRecordIndex devRecIndex_;
         std::shared_ptr<BaseExtensionRecord> AddToProcLru(std::shared_ptr<BaseExtensionRecord> abilityRecord);
         std::shared_ptr<BaseExtensionRecord> AddToDevLru(std::shared_ptr<BaseExtensionRecord> abilityRecord,
             std::shared_ptr<BaseExtensionRecord> rec);
@@ -32,6 +32,7 @@
 #include "base_extension_record.h"
 #include "event_report.h"
 #include "extension_config.h"
+#include "extension_record_index.h"
 #include "extension_running_info.h"
 #include "modular_object_extension_info.h"
 #include "modular_object_manager.h"
@@ -632,6 +633,8 @@ protected:
     int userId_;
     ServiceMapType serviceMap_;
     ffrt::mutex serviceMapMutex_;
+    // records of serviceMap_ by token and id, changed together with serviceMap_ under serviceMapMutex_
+    ExtensionRecordIndex serviceIndex_;
     ffrt::mutex serialMutex_;
     std::shared_ptr<TaskHandlerWrap> taskHandler_;
     std::shared_ptr<EventHandlerWrap> eventHandler_;
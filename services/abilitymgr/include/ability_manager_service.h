@@ -3076,6 +3076,7 @@ private:
         const std::string &args, std::vector<std::string> &info, bool isClient, bool isUserID, int userId);
     ErrCode ProcessMultiParam(std::vector<std::string>& argsStr, std::string& result);
     int Dump(const std::vector<std::u16string>& args, std::string& result);
+    void DumpInterceptorStat(std::string& result);
 
     // multi user
     void StartFreezingScreen();
@@ -25,6 +25,7 @@
 #endif // WITH_DLP
 #include "iconnection_observer.h"
 #include "iforeground_app_connection.h"
+#include "ipc_dispatch_table.h"
 
 namespace OHOS {
 namespace AAFwk {
@@ -58,6 +59,13 @@ public:
      */
     virtual int DoAbilityBackground(const sptr<IRemoteObject> &token, uint32_t flag) override;
 
+    /**
+     * Dump call count and latency histogram of each interface code.
+     *
+     * @param result, the dump output.
+     */
+    void DumpIpcDispatchStat(std::string &result);
+
     virtual int RegisterObserver(const sptr<AbilityRuntime::IConnectionObserver> &observer);
 
     virtual int UnregisterObserver(const sptr<AbilityRuntime::IConnectionObserver> &observer);
@@ -435,12 +443,9 @@ private:
         MessageParcel &reply, MessageOption &option);
     int OnRemoteRequestInnerTwentySecond(uint32_t code, MessageParcel &data,
         MessageParcel &reply, MessageOption &option);
-    int HandleOnRemoteRequestInnerFirst(uint32_t code, MessageParcel &data,
-        MessageParcel &reply, MessageOption &option);
-    int HandleOnRemoteRequestInnerSecond(uint32_t code, MessageParcel &data,
-        MessageParcel &reply, MessageOption &option);
-    int HandleOnRemoteRequestInnerThird(uint32_t code, MessageParcel &data,
-        MessageParcel &reply, MessageOption &option);
+    static constexpr uint32_t IPC_DISPATCH_CODE_LIMIT = 6400;
+    using DispatchTable = IpcDispatchTable<AbilityManagerStub, IPC_DISPATCH_CODE_LIMIT>;
+    static DispatchTable &GetDispatchTable();
     int32_t OpenLinkInner(MessageParcel &data, MessageParcel &reply);
     int32_t TerminateMissionInner(MessageParcel &data, MessageParcel &reply);
     int32_t BlockAllAppStartInner(MessageParcel &data, MessageParcel &reply);
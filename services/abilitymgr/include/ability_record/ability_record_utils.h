@@ -66,9 +66,17 @@ public:
     virtual ~Token();
 
     std::shared_ptr<AbilityRecord> GetAbilityRecord() const;
+
+    /**
+     * @brief Resolve the ability record of a token. Every token lives in a registry from its construction to its
+     * destruction, so a local token is recognized by its address, without comparing the descriptor. Proxies and
+     * other remote objects are never in the registry.
+     */
     static std::shared_ptr<AbilityRecord> GetAbilityRecordByToken(sptr<IRemoteObject> token);
 
 private:
+    static bool IsLocalToken(const IRemoteObject *object);
+
     std::weak_ptr<AbilityRecord> abilityRecord_;  // ability of this token
 };
 
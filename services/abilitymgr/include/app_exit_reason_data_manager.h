@@ -16,8 +16,11 @@
 #ifndef OHOS_ABILITY_RUNTIME_APP_EXIT_REASON_DATA_MANAGER_H
 #define OHOS_ABILITY_RUNTIME_APP_EXIT_REASON_DATA_MANAGER_H
 
+#include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "ability_util.h"
@@ -109,6 +112,22 @@ private:
     DistributedKv::Value ConvertAccessTokenIdToValue(uint32_t accessTokenId);
     DistributedKv::Status RestoreKvStore(DistributedKv::Status status);
     static void PutAsync(const DistributedKv::Key &key, const DistributedKv::Value &value);
+    static void DeleteAsync(const DistributedKv::Key &key);
+    void ScheduleFlush();
+    // Returns the first error, the failed writes are queued again for the next flush.
+    DistributedKv::Status FlushPendingWrites();
+    void RequeuePendingWrites(const std::unordered_map<std::string, DistributedKv::Value> &puts,
+        const std::unordered_set<std::string> &deletes);
+
+    DistributedKv::Status LoadMirror();
+    bool IsMirrorOf(const std::shared_ptr<DistributedKv::SingleKvStore> &kvStore) const;
+    bool GetMirrorEntry(const std::string &key, DistributedKv::Value &value);
+    void InsertMirrorEntry(const std::string &key, const DistributedKv::Value &value);
+    void EraseMirrorEntry(const std::string &key);
+    void UpdateMirrorEntry(const std::string &key, const DistributedKv::Value &value);
+    void RemoveMirrorEntry(const std::string &key);
+    DistributedKv::Status GetValue(const DistributedKv::Key &key, DistributedKv::Value &value);
+    std::vector<std::string> GetAppKeys(const std::string &bundleName, uint32_t accessTokenId);
 
     const DistributedKv::AppId appId_ { "app_exit_reason_storage" };
     const DistributedKv::StoreId storeId_ { "app_exit_reason_infos" };
@@ -116,6 +135,17 @@ private:
     std::shared_ptr<DistributedKv::SingleKvStore> kvStorePtr_;
     mutable ffrt::mutex kvStorePtrMutex_;
     DatabaseWriteCounter dbWriteCounter_;
+
+    // All entries of kvStorePtr_, loaded once and written back asynchronously. kvStorePtrMutex_ may be held
+    // while locking mirrorMutex_, never the reverse.
+    mutable ffrt::mutex mirrorMutex_;
+    std::weak_ptr<DistributedKv::SingleKvStore> mirrorStore_;
+    std::unordered_map<std::string, DistributedKv::Value> mirror_;
+    // bundle name -> keys of ui extension exit reasons
+    std::unordered_map<std::string, std::unordered_set<std::string>> bundleKeys_;
+    std::unordered_map<std::string, DistributedKv::Value> pendingPuts_;
+    std::unordered_set<std::string> pendingDeletes_;
+    bool flushScheduled_ = false;
 };
 } // namespace AbilityRuntime
 } // namespace OHOS
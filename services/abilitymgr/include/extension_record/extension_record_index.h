@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_RUNTIME_EXTENSION_RECORD_INDEX_H
+#define OHOS_ABILITY_RUNTIME_EXTENSION_RECORD_INDEX_H
+
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include "base_extension_record.h"
+
+namespace OHOS {
+namespace AAFwk {
+/**
+ * @class ExtensionRecordIndex
+ * Index of the extension records held by a container, by token, record id and assert fault session id.
+ * The owner adds and removes a record together with the container. Lookups share the lock, and a record is
+ * returned only if it still carries the key it is looked up by.
+ */
+class ExtensionRecordIndex {
+public:
+    ExtensionRecordIndex() = default;
+    ~ExtensionRecordIndex() = default;
+
+    void Add(const std::shared_ptr<BaseExtensionRecord> &record);
+
+    /**
+     * Remove one reference of record, keys taken by another record since it was added are kept.
+     */
+    void Remove(const std::shared_ptr<BaseExtensionRecord> &record);
+
+    std::shared_ptr<BaseExtensionRecord> FindByToken(const sptr<IRemoteObject> &token) const;
+
+    std::shared_ptr<BaseExtensionRecord> FindById(int64_t recordId) const;
+
+    std::shared_ptr<BaseExtensionRecord> FindBySessionId(const std::string &assertSessionId) const;
+
+    bool Contains(int64_t recordId) const;
+
+    size_t Size() const;
+
+    void Clear();
+
+private:
+    struct Entry {
+        std::weak_ptr<BaseExtensionRecord> record;
+        IRemoteObject *token = nullptr;
+        std::string assertSessionId;
+        uint32_t refCount = 1;
+    };
+
+    std::shared_ptr<BaseExtensionRecord> FindByIdLocked(int64_t recordId) const;
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<int64_t, Entry> records_;
+    std::unordered_map<IRemoteObject *, int64_t> tokenIndex_;
+    std::unordered_map<std::string, int64_t> sessionIndex_;
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // OHOS_ABILITY_RUNTIME_EXTENSION_RECORD_INDEX_H
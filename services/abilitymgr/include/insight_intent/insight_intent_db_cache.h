@@ -16,6 +16,7 @@
 #ifndef OHOS_INSIGHT_INTENT_DB_CACHE_H
 #define OHOS_INSIGHT_INTENT_DB_CACHE_H
 
+#include <list>
 #include <mutex>
 #include <singleton.h>
 #include <vector>
@@ -61,10 +62,48 @@ public:
     bool IsCacheInitialized(int32_t userId);
     void BackupRdb();
 private:
+    // parsed intents of one bundle, indexed by (moduleName, intentName)
+    struct BundleIntentCache {
+        std::vector<ExtractInsightIntentInfo> infos;
+        std::vector<InsightIntentInfo> configInfos;
+        std::map<std::pair<std::string, std::string>, size_t> infoIndex;
+        std::map<std::pair<std::string, std::string>, size_t> configIndex;
+        std::list<std::string>::iterator lruIter;
+
+        void RebuildIndex();
+        void RemoveModule(const std::string &moduleName);
+        // one unit per intent, and one for the bundle so empty bundles count too
+        size_t Cost() const
+        {
+            return infos.size() + configInfos.size() + 1;
+        }
+    };
+
+    BundleIntentCache *GetBundleIntentCacheLocked(const std::string &bundleName);
+    void PutBundleIntentCacheLocked(const std::string &bundleName, BundleIntentCache &&cache);
+    void EraseBundleIntentCacheLocked(const std::string &bundleName);
+    void DropBundleIntentCacheLocked(const std::string &bundleName);
+    void ResetIntentCacheLocked(int32_t userId, const std::vector<ExtractInsightIntentInfo> &infos,
+        const std::vector<InsightIntentInfo> &configInfos);
+    void UpdateModuleIntentCacheLocked(const std::string &bundleName, const std::string &moduleName,
+        const ExtractInsightIntentProfileInfoVec &profileInfos, const std::vector<InsightIntentInfo> &configInfos);
+    void RemoveModuleIntentCacheLocked(const std::string &bundleName, const std::string &moduleName);
+
     int32_t userId_ = -1;
     mutable std::mutex genericInfosMutex_;
     std::map<std::string, std::vector<ExtractInsightIntentGenericInfo>> intentGenericInfos_;
     std::map<std::string, std::string> bundleVersionMap_;
+
+    // Parsed intents of cacheUserId_. Bundles are loaded on first use, the least recently used ones are
+    // evicted when the total cost exceeds MAX_INTENT_CACHE_COST. allIntentsCached_ is set only while every
+    // bundle of the user is in the cache. The mutex is also held across storage writes, so a bundle loaded
+    // on a miss can't miss a concurrent update.
+    std::mutex intentCacheMutex_;
+    int32_t cacheUserId_ = -1;
+    bool allIntentsCached_ = false;
+    size_t intentCacheCost_ = 0;
+    std::map<std::string, BundleIntentCache> intentCache_;
+    std::list<std::string> intentCacheLru_;
 };
 }  // namespace AbilityRuntime
 }  // namespace OHOS
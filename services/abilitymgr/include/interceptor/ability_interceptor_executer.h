@@ -16,7 +16,12 @@
 #ifndef OHOS_ABILITY_RUNTIME_ABILITY_INTERCEPTOR_EXECUTER_H
 #define OHOS_ABILITY_RUNTIME_ABILITY_INTERCEPTOR_EXECUTER_H
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
 #include <unordered_map>
+#include <vector>
 #include "ability_interceptor_interface.h"
 #include "cpp/mutex.h"
 
@@ -26,6 +31,8 @@ using InterceptorMap = std::unordered_map<std::string, std::shared_ptr<IAbilityI
 /**
  * @class AbilityInterceptorExecuter
  * AbilityInterceptorExecuter excute the interceptors.
+ * Interceptors run in the order they are added. The chain of each request type is built when an interceptor
+ * is added or removed and published as an immutable snapshot, DoProcess only takes a reference to it.
  */
 class AbilityInterceptorExecuter {
 public:
@@ -51,11 +58,44 @@ public:
      * Excute the DoProcess of the interceptors.
      */
     ErrCode DoProcess(const AbilityInterceptorParam &param);
+
+    /**
+     * Dump call count and latency histogram of every interceptor.
+     *
+     * @param result The dump output.
+     */
+    void Dump(std::string &result) const;
 private:
-    InterceptorMap GetInterceptorMapCopy();
+    static constexpr size_t REQUEST_TYPE_COUNT = 2;
+    static constexpr size_t BUCKET_COUNT = 6;
+    static constexpr std::array<int64_t, BUCKET_COUNT - 1> BUCKET_BOUNDS_US = { 100, 500, 1000, 5000, 10000 };
+
+    struct InterceptorEntry {
+        std::string name;
+        std::string traceName;
+        std::shared_ptr<IAbilityInterceptor> interceptor;
+        uint32_t requestTypes = INTERCEPTOR_REQUEST_ALL;
+        std::atomic<uint64_t> count = 0;
+        std::atomic<uint64_t> totalUs = 0;
+        std::atomic<uint64_t> maxUs = 0;
+        std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets {};
+    };
+
+    // never changed once published
+    struct InterceptorChain {
+        std::vector<std::shared_ptr<InterceptorEntry>> entries;
+        std::array<std::vector<InterceptorEntry *>, REQUEST_TYPE_COUNT> chains;
+    };
+
+    std::shared_ptr<const InterceptorChain> GetChain() const;
+    void PublishChain(std::vector<std::shared_ptr<InterceptorEntry>> entries);
+    static size_t GetRequestTypeIndex(const AbilityInterceptorParam &param);
+    static void RecordLatency(InterceptorEntry &entry, std::chrono::steady_clock::time_point begin);
 private:
     std::recursive_mutex interceptorMapLock_;
     std::unordered_map<std::string, std::shared_ptr<IAbilityInterceptor>> interceptorMap_;
+    // read and written with std::atomic_load and std::atomic_store, written under interceptorMapLock_
+    std::shared_ptr<const InterceptorChain> chain_ = std::make_shared<const InterceptorChain>();
 };
 } // namespace AAFwk
 } // namespace OHOS
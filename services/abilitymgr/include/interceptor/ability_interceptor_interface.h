@@ -48,6 +48,15 @@ struct AbilityInterceptorParam {
     bool fromConnect = false;
 };
 
+/**
+ * Kinds of start request, an interceptor is only called for the kinds it applies to.
+ */
+enum InterceptorRequestType : uint32_t {
+    INTERCEPTOR_REQUEST_WITHOUT_CALLER = 1 << 0,
+    INTERCEPTOR_REQUEST_WITH_CALLER = 1 << 1,
+    INTERCEPTOR_REQUEST_ALL = INTERCEPTOR_REQUEST_WITHOUT_CALLER | INTERCEPTOR_REQUEST_WITH_CALLER,
+};
+
 /**
  * @class IAbilityInterceptor
  * IAbilityInterceptor is used to intercept a different type of start request.
@@ -60,6 +69,16 @@ public:
      * Excute interception processing.
      */
     virtual ErrCode DoProcess(const AbilityInterceptorParam &param) = 0;
+
+    /**
+     * Kinds of start request the interceptor applies to, read once when the interceptor is added.
+     *
+     * @return Mask of InterceptorRequestType.
+     */
+    virtual uint32_t GetRequestTypes() const
+    {
+        return INTERCEPTOR_REQUEST_ALL;
+    }
 };
 } // namespace AAFwk
 } // namespace OHOS
@@ -27,6 +27,10 @@ public:
     ExtensionControlInterceptor() = default;
     ~ExtensionControlInterceptor() = default;
     ErrCode DoProcess(const AbilityInterceptorParam &param) override;
+    uint32_t GetRequestTypes() const override
+    {
+        return INTERCEPTOR_REQUEST_WITH_CALLER;
+    }
 private:
     bool IsExtensionStartThirdPartyAppEnable(std::string extensionTypeName, std::string targetBundleName);
     bool IsExtensionStartServiceEnable(std::string extensionTypeName, std::string targetUri);
@@ -16,12 +16,15 @@
 #ifndef OHOS_ABILITY_RUNTIME_MISSION_DATA_STORAGE_H
 #define OHOS_ABILITY_RUNTIME_MISSION_DATA_STORAGE_H
 
+#include <array>
+#include <atomic>
 #include <list>
 #include <mutex>
 #include <queue>
 #include "cpp/mutex.h"
 
 #include "inner_mission_info.h"
+#include "mission_info_log.h"
 #include "mission_snapshot.h"
 
 namespace OHOS {
@@ -31,6 +34,7 @@ constexpr const char* MISSION_DATA_FILE_PATH = "MissionInfo";
 constexpr const char* MISSION_JSON_FILE_PREFIX = "mission";
 constexpr const char* LOW_RESOLUTION_FLAG = "little";
 constexpr const char* JSON_FILE_SUFFIX = ".json";
+constexpr const char* MISSION_LOG_FILE_NAME = "missions.log";
 constexpr const char* JPEG_FILE_SUFFIX = ".jpg";
 constexpr const char* FILE_SEPARATOR = "/";
 constexpr const char* UNDERLINE_SEPARATOR = "_";
@@ -67,6 +71,28 @@ public:
      */
     void SaveMissionSnapshot(int32_t missionId, const MissionSnapshot& missionSnapshot);
 
+    /**
+     * @brief Cache the snapshot and mark it as the one to save for the mission, an earlier queued
+     * snapshot of the same mission is superseded.
+     * @param missionId Indicates this mission id.
+     * @param missionSnapshot the mission snapshot to save
+     * @return The generation to pass to SaveQueuedSnapshot.
+     */
+    uint64_t QueueMissionSnapshot(int32_t missionId, const MissionSnapshot& missionSnapshot);
+
+    /**
+     * @brief Encode a queued snapshot to files, dropped if a newer snapshot of the mission is queued.
+     * @param missionId Indicates this mission id.
+     * @param generation The generation returned by QueueMissionSnapshot.
+     */
+    void SaveQueuedSnapshot(int32_t missionId, uint64_t generation);
+
+    /**
+     * @brief Dump the counters of snapshot encoding.
+     * @param info Output of the dump.
+     */
+    void DumpSnapshotStats(std::vector<std::string> &info) const;
+
     /**
      * @brief Delete mission snapshot
      * @param missionId Indicates this mission id.
@@ -126,12 +152,39 @@ private:
     std::string GetMissionDataDirPath() const;
 
     /**
-     * @brief Get the file path for storing mission data
+     * @brief Get the legacy json file path of a mission, such files are migrated into the mission log
      * @param missionId The ID of the mission
      * @return Full path to the mission data file
      */
     std::string GetMissionDataFilePath(int missionId);
 
+    /**
+     * @brief Get the mission log of current user, the log is created on first use.
+     * @return The mission log.
+     */
+    MissionInfoLog &GetMissionLog();
+
+    /**
+     * @brief Ensure the mission data directory exists.
+     * @return Returns true if the directory exists.
+     */
+    bool EnsureMissionDataDir();
+
+    /**
+     * @brief Read missions saved as one json file each, files that fail to parse are skipped.
+     * @param records Output, legacy missions are added to it.
+     * @param legacyFiles Output, the files that are parsed into records.
+     */
+    void LoadLegacyMissionFiles(std::map<int32_t, std::string> &records, std::vector<std::string> &legacyFiles);
+
+    /**
+     * @brief Replace the mission log with records, then remove the legacy files merged into them.
+     * @param records The records of the mission log merged with the legacy missions.
+     * @param legacyFiles The legacy files parsed into records.
+     */
+    void MigrateLegacyMissionFiles(const std::map<int32_t, std::string> &records,
+        const std::vector<std::string> &legacyFiles);
+
     /**
      * @brief Get the path for storing mission snapshot
      * @param missionId The ID of the mission
@@ -141,7 +194,7 @@ private:
     std::string GetMissionSnapshotPath(int32_t missionId, bool isLowResolution) const;
 
     /**
-     * @brief Validate the given file name
+     * @brief Validate the given legacy json file name
      * @param fileName The file name to validate
      * @return true if the file name is valid, false otherwise
      */
@@ -151,23 +204,50 @@ private:
     template<typename T>
     void WriteToJpeg(const std::string &filePath, T &snapshot) const;
 
-    bool GetCachedSnapshot(int32_t missionId, MissionSnapshot& missionSnapshot);
+    template<typename Output, typename T>
+    bool PackJpeg(Output &output, T &image) const;
 
-    bool SaveCachedSnapshot(int32_t missionId, const MissionSnapshot& missionSnapshot);
+    bool GetCachedSnapshot(int32_t missionId, MissionSnapshot& missionSnapshot);
 
-    bool DeleteCachedSnapshot(int32_t missionId);
     void DeleteMissionSnapshot(int32_t missionId, bool isLowResolution);
 
-    void SaveSnapshotFile(int32_t missionId, const MissionSnapshot& missionSnapshot);
-
     void SaveSnapshotFile(int32_t missionId, const std::shared_ptr<OHOS::Media::PixelMap>& snapshot,
         bool isPrivate, bool isLowResolution);
 
+    void SavePrivateSnapshotFile(const std::string &filePath, int32_t width, int32_t height);
+
+    std::shared_ptr<const std::string> GetPrivatePlaceholder(int32_t width, int32_t height);
+
+    bool IsSnapshotSuperseded(int32_t missionId, uint64_t generation);
+
+    ffrt::mutex &GetSnapshotFileMutex(int32_t missionId);
+
+    struct QueuedSnapshot {
+        uint64_t generation = 0;
+        bool isPrivate = false;
+    };
+
     std::map<int32_t, std::shared_ptr<Media::PixelMap>> cachedPixelMap_;
+    // latest queued snapshot of each mission, the pixel map is in cachedPixelMap_, guarded by cachedPixelMapMutex_
+    std::map<int32_t, QueuedSnapshot> queuedSnapshots_;
+    uint64_t snapshotGeneration_ = 0;
+    // encoded jpeg of an opaque white image, keyed by width and height
+    std::map<std::pair<int32_t, int32_t>, std::shared_ptr<const std::string>> privatePlaceholders_;
+    ffrt::mutex privatePlaceholderMutex_;
+    // held while the snapshot files of a mission are written or removed, shared by missions with the same index
+    static constexpr size_t SNAPSHOT_FILE_MUTEX_COUNT = 16;
+    std::array<ffrt::mutex, SNAPSHOT_FILE_MUTEX_COUNT> snapshotFileMutexes_;
 #endif
 
+    std::atomic<uint64_t> encodedSnapshotCount_ = 0;
+    std::atomic<uint64_t> droppedSnapshotCount_ = 0;
+    std::atomic<uint64_t> placeholderHitCount_ = 0;
+    std::atomic<uint64_t> totalEncodeTime_ = 0;
+    std::atomic<uint64_t> maxEncodeTime_ = 0;
     int userId_ = 0;
     ffrt::mutex cachedPixelMapMutex_;
+    ffrt::mutex missionLogMutex_;
+    std::unique_ptr<MissionInfoLog> missionLog_;
 };
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_RUNTIME_MISSION_INFO_LOG_H
+#define OHOS_ABILITY_RUNTIME_MISSION_INFO_LOG_H
+
+#include <map>
+#include <string>
+
+namespace OHOS {
+namespace AAFwk {
+/**
+ * @class MissionInfoLog
+ * Append-only log of mission records in one file. Every save or delete appends a checksummed record,
+ * loading replays the file with one sequential read. A torn record at the tail, left by a crash during
+ * append, is cut off on load. The file is rewritten with the live records only when dead records
+ * dominate it. Not thread safe, callers serialize access.
+ */
+class MissionInfoLog {
+public:
+    explicit MissionInfoLog(const std::string &filePath);
+    ~MissionInfoLog();
+
+    /**
+     * @brief Replay the log, only the first call reads the file.
+     * @param records Output, mission id to the last saved content.
+     * @return Returns true if the log is readable or does not exist yet.
+     */
+    bool Load(std::map<int32_t, std::string> &records);
+
+    /**
+     * @brief Append the content of a mission.
+     * @return Returns true if the record is appended.
+     */
+    bool Put(int32_t missionId, const std::string &content);
+
+    /**
+     * @brief Append a delete record of a mission.
+     * @return Returns false if the mission has no record or append fail.
+     */
+    bool Delete(int32_t missionId);
+
+    /**
+     * @brief Replace the whole log with records, used to import missions saved in other formats.
+     * @return Returns true if the new log file is in place and synced to disk.
+     */
+    bool Reset(const std::map<int32_t, std::string> &records);
+
+private:
+    enum RecordType : uint8_t {
+        RECORD_PUT = 1,
+        RECORD_DELETE = 2,
+    };
+
+    struct RecordHeader {
+        uint32_t magic = 0;
+        uint32_t type = 0;
+        int32_t missionId = 0;
+        uint32_t length = 0;
+        uint32_t checksum = 0;
+    };
+
+    bool EnsureLoaded();
+    bool Append(RecordType type, int32_t missionId, const std::string &content);
+    bool OpenForAppend();
+    void Close();
+    void CompactIfNeeded();
+    static std::string EncodeRecord(RecordType type, int32_t missionId, const std::string &content);
+    static uint32_t Checksum(const RecordHeader &header, const char *content, size_t length);
+
+    std::string filePath_;
+    int fd_ = -1;
+    bool loaded_ = false;
+    // size of valid records in the file
+    size_t fileSize_ = 0;
+    // size of the put records that are still live
+    size_t liveSize_ = 0;
+    std::map<int32_t, std::string> records_;
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // OHOS_ABILITY_RUNTIME_MISSION_INFO_LOG_H
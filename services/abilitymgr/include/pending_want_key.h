@@ -55,6 +55,11 @@ public:
     int32_t GetCode();
     int32_t GetUserId();
     bool IsEqualsRequestWant(const Want &otherWant);
+    /**
+     * Hash of the fields compared when looking up a record by key, keys that match have the same hash.
+     * The request want contributes its element, action, uri and parameter names.
+     */
+    size_t GetHashCode();
     int32_t GetAppIndex();
     void GetAllBundleNames(std::vector<std::string> &bundleNames);
     void ClearAllWantsInfosFd();
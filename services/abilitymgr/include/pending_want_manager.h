@@ -21,6 +21,7 @@
 #include <map>
 #include <vector>
 #include <string>
+#include <unordered_map>
 #include "cpp/mutex.h"
 
 #include "ability_manager_errors.h"
@@ -200,6 +201,8 @@ private:
     void ReduceWantAgentNumber(std::shared_ptr<PendingWantKey> pendingKey);
 
     sptr<PendingWantRecord> GetPendingWantRecordByKey(const std::shared_ptr<PendingWantKey> &key);
+    void EraseWantRecordIndexLocked(const std::shared_ptr<PendingWantKey> &key);
+    void EraseWantRecordLocked(const std::shared_ptr<PendingWantKey> &key);
     bool CheckPendingWantRecordByKey(
         const std::shared_ptr<PendingWantKey> &inputKey, const std::shared_ptr<PendingWantKey> &key);
 
@@ -216,6 +219,8 @@ private:
     std::shared_ptr<TaskHandlerWrap> taskHandler_;
     std::unordered_map<std::string, AgentCount> wantAgentCount_;
     std::map<std::shared_ptr<PendingWantKey>, sptr<PendingWantRecord>> wantRecords_;
+    // keys of wantRecords_ by PendingWantKey::GetHashCode, a key is only updated with a want equal to its own
+    std::unordered_multimap<size_t, std::shared_ptr<PendingWantKey>> wantRecordIndex_;
     ffrt::mutex mutex_;
     ffrt::mutex countMutex_;
 };
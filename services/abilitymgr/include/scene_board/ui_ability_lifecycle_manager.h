@@ -20,7 +20,9 @@
 #include <map>
 #include <memory>
 #include <queue>
+#include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "ability_manager_constants.h"
 #include "ffrt.h"
@@ -73,6 +75,29 @@ struct AbilitiesRequest {
     uint32_t doneCount = 0;
 };
 
+/**
+ * Bundle, module, app index and instance key of a session record, the properties compared when a singleton,
+ * specified or standard ability is reused.
+ */
+struct SessionAbilityKey {
+    std::string bundleName;
+    std::string moduleName;
+    int32_t appIndex = 0;
+    std::string instanceKey;
+
+    bool operator<(const SessionAbilityKey &other) const
+    {
+        return std::tie(bundleName, moduleName, appIndex, instanceKey) <
+            std::tie(other.bundleName, other.moduleName, other.appIndex, other.instanceKey);
+    }
+
+    bool operator==(const SessionAbilityKey &other) const
+    {
+        return std::tie(bundleName, moduleName, appIndex, instanceKey) ==
+            std::tie(other.bundleName, other.moduleName, other.appIndex, other.instanceKey);
+    }
+};
+
 class UIAbilityLifecycleManager : public std::enable_shared_from_this<UIAbilityLifecycleManager> {
 public:
     UIAbilityLifecycleManager() = default;
@@ -1308,7 +1333,23 @@ private:
     bool CheckStartByOEExt(const AbilityRequest &abilityRequest, int32_t requestId,
         int32_t &persistentId, bool &reuse);
     bool CalcHideNativeWindow(int32_t persistentId, const AppExecFwk::AbilityInfo& abilityInfo);
-    
+
+    /**
+     * Insert, replace and erase of sessionAbilityMap_ must go through these, so that the indexes stay in step.
+     * Lookups trust the indexes, a session missing from them is not found, there is no fallback scan of the map.
+     */
+    void AddSessionRecord(int32_t sessionId, const UIAbilityRecordPtr &abilityRecord);
+    void EraseSessionRecord(int32_t sessionId);
+    void UpdateSessionPid(const sptr<IRemoteObject> &token, pid_t pid);
+    void AddSessionIndex(int32_t sessionId, const UIAbilityRecordPtr &abilityRecord);
+    void RemoveSessionIndex(int32_t sessionId);
+    UIAbilityRecordPtr GetSessionRecord(int32_t sessionId) const;
+    bool FindSessionIdByToken(const sptr<IRemoteObject> &token, int32_t &sessionId) const;
+    std::vector<int32_t> GetSessionIdsByKey(const SessionAbilityKey &key) const;
+    std::vector<int32_t> GetSessionIdsByPid(pid_t pid) const;
+    static SessionAbilityKey MakeSessionAbilityKey(const UIAbilityRecordPtr &abilityRecord);
+    static SessionAbilityKey MakeSessionAbilityKey(const AbilityRequest &abilityRequest);
+
     struct CallerInfo {
         uint32_t callerTokenId = 0;
         Want targetWant;
@@ -1317,6 +1358,16 @@ private:
     int64_t gamePreLaunchCompleteTime_ = 30 * 1000 * 1000; // 30s
     mutable ffrt::mutex sessionLock_;
     std::unordered_map<int32_t, UIAbilityRecordPtr> sessionAbilityMap_;
+    // secondary indexes of sessionAbilityMap_, guarded by sessionLock_
+    struct SessionIndexEntry {
+        IRemoteObject *token = nullptr;
+        SessionAbilityKey key;
+        pid_t pid = 0;
+    };
+    std::unordered_map<int32_t, SessionIndexEntry> sessionIndexEntries_;
+    std::unordered_map<IRemoteObject *, int32_t> tokenIndex_;
+    std::map<SessionAbilityKey, std::unordered_set<int32_t>> sessionKeyIndex_;
+    std::unordered_map<pid_t, std::unordered_set<int32_t>> pidIndex_;
     std::unordered_map<int32_t, UIAbilityRecordPtr> lowMemKillAbilityMap_;
     std::unordered_map<int32_t, UIAbilityRecordPtr> tmpAbilityMap_;
     std::unordered_map<UIAbilityRecordPtr, std::list<AbilityRequest>> callRequestCache_;
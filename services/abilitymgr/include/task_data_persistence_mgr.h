@@ -95,6 +95,12 @@ public:
      */
     bool GetMissionSnapshot(int missionId, MissionSnapshot& missionSnapshot, bool isLowResolution);
 
+    /**
+     * @brief Dump the snapshot encoding counters of current user.
+     * @param info Output of the dump.
+     */
+    void DumpSnapshotStats(std::vector<std::string> &info);
+
 private:
     int32_t currentUserId_ = -1;
     std::shared_ptr<MissionDataStorage> currentMissionDataStorage_;
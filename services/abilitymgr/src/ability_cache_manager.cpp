@@ -47,6 +47,7 @@ void AbilityCacheManager::RemoveAbilityRecInDevList(std::shared_ptr<BaseExtensio
     uint32_t accessTokenId = abilityRecord->GetApplicationInfo().accessTokenId;
     while (it != devRecLru_.end()) {
         if ((*it) && (*it)->GetRecordId() == abilityRecord->GetRecordId()) {
+            devRecIndex_.Remove(*it);
             devRecLru_.erase(it);
             devLruCnt_--;
             return;
@@ -114,16 +115,19 @@ std::shared_ptr<BaseExtensionRecord> AbilityCacheManager::AddToDevLru(
 {
     if (rec != nullptr) {
         devRecLru_.push_back(abilityRecord);
+        devRecIndex_.Add(abilityRecord);
         devLruCnt_++;
         return rec;
     }
     if (devLruCnt_ == devLruCapacity_ && devLruCnt_ > 0) {
         rec = devRecLru_.front();
         RemoveAbilityRecInProcList(rec);
+        devRecIndex_.Remove(rec);
         devRecLru_.pop_front();
         devLruCnt_--;
     }
     devRecLru_.push_back(abilityRecord);
+    devRecIndex_.Add(abilityRecord);
     devLruCnt_++;
     return rec;
 }
@@ -150,6 +154,10 @@ void AbilityCacheManager::Remove(std::shared_ptr<BaseExtensionRecord> abilityRec
     TAG_LOGD(AAFwkTag::SERVICE_EXT, "Remove the ability from lru, service:%{public}s, extension type %{public}d",
         abilityRecord->GetURI().c_str(), abilityRecord->GetAbilityInfo().extensionAbilityType);
     std::lock_guard<std::mutex> lock(mutex_);
+    // most removed records, such as every disconnected service, were never cached
+    if (!devRecIndex_.Contains(abilityRecord->GetAbilityRecordId())) {
+        return;
+    }
     RemoveAbilityRecInProcList(abilityRecord);
     RemoveAbilityRecInDevList(abilityRecord);
 }
@@ -204,22 +212,13 @@ std::shared_ptr<BaseExtensionRecord> AbilityCacheManager::FindRecordByToken(cons
         TAG_LOGE(AAFwkTag::SERVICE_EXT, "null token");
         return nullptr;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto it = devRecLru_.begin();
-    while (it != devRecLru_.end()) {
-        if (*it) {
-            sptr<IRemoteObject> srcToken = (*it)->GetToken();
-            if (srcToken == token) {
-                std::shared_ptr<BaseExtensionRecord> &abilityRecord = *it;
-                TAG_LOGD(AAFwkTag::SERVICE_EXT,
-                    "Find the ability by token from lru, service:%{public}s, extension type %{public}d",
-                    abilityRecord->GetURI().c_str(), abilityRecord->GetAbilityInfo().extensionAbilityType);
-                return abilityRecord;
-            }
-        }
-        it++;
+    auto abilityRecord = devRecIndex_.FindByToken(token);
+    if (abilityRecord != nullptr) {
+        TAG_LOGD(AAFwkTag::SERVICE_EXT,
+            "Find the ability by token from lru, service:%{public}s, extension type %{public}d",
+            abilityRecord->GetURI().c_str(), abilityRecord->GetAbilityInfo().extensionAbilityType);
     }
-    return nullptr;
+    return abilityRecord;
 }
 
 std::list<std::shared_ptr<BaseExtensionRecord>> AbilityCacheManager::GetAbilityList()
@@ -230,25 +229,13 @@ std::list<std::shared_ptr<BaseExtensionRecord>> AbilityCacheManager::GetAbilityL
 
 std::shared_ptr<BaseExtensionRecord> AbilityCacheManager::FindRecordBySessionId(const std::string &assertSessionId)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto it = devRecLru_.begin();
-    while (it != devRecLru_.end()) {
-        if (!*it) {
-            it++;
-            continue;
-        }
-        auto assertSessionStr = (*it)->GetStringParam(Want::PARAM_ASSERT_FAULT_SESSION_ID);
-        if (assertSessionStr == assertSessionId) {
-            std::shared_ptr<BaseExtensionRecord> &abilityRecord = *it;
-            TAG_LOGD(AAFwkTag::SERVICE_EXT,
-                "Find the ability by sessionId from lru, service:%{public}s, extension type %{public}d",
-                abilityRecord->GetURI().c_str(), abilityRecord->GetAbilityInfo().extensionAbilityType);
-            return abilityRecord;
-        } else {
-            it++;
-        }
+    auto abilityRecord = devRecIndex_.FindBySessionId(assertSessionId);
+    if (abilityRecord != nullptr) {
+        TAG_LOGD(AAFwkTag::SERVICE_EXT,
+            "Find the ability by sessionId from lru, service:%{public}s, extension type %{public}d",
+            abilityRecord->GetURI().c_str(), abilityRecord->GetAbilityInfo().extensionAbilityType);
     }
-    return nullptr;
+    return abilityRecord;
 }
 
 std::shared_ptr<BaseExtensionRecord> AbilityCacheManager::FindRecordByServiceKey(const std::string &serviceKey)
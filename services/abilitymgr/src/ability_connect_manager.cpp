@@ -305,6 +305,7 @@ void AbilityConnectManager::RemoveServiceFromMapSafe(const std::string &serviceK
     auto it = serviceMap_.find(serviceKey);
     if (it != serviceMap_.end()) {
         NotifyExtensionTerminated(it->second);
+        serviceIndex_.Remove(it->second);
     }
     serviceMap_.erase(serviceKey);
     TAG_LOGD(AAFwkTag::EXT, "ServiceMap remove, size:%{public}zu", serviceMap_.size());
@@ -1220,37 +1221,13 @@ std::shared_ptr<BaseExtensionRecord> AbilityConnectManager::GetServiceRecordByEl
 std::shared_ptr<BaseExtensionRecord> AbilityConnectManager::GetExtensionByTokenFromServiceMap(
     const sptr<IRemoteObject> &token)
 {
-    auto IsMatch = [token](auto service) {
-        if (!service.second) {
-            return false;
-        }
-        sptr<IRemoteObject> srcToken = service.second->GetToken();
-        return srcToken == token;
-    };
-    std::lock_guard lock(serviceMapMutex_);
-    auto serviceRecord = std::find_if(serviceMap_.begin(), serviceMap_.end(), IsMatch);
-    if (serviceRecord != serviceMap_.end()) {
-        return serviceRecord->second;
-    }
-    return nullptr;
+    return serviceIndex_.FindByToken(token);
 }
 
 std::shared_ptr<BaseExtensionRecord> AbilityConnectManager::GetExtensionByIdFromServiceMap(
     const int64_t &abilityRecordId)
 {
-    auto IsMatch = [abilityRecordId](auto &service) {
-        if (!service.second) {
-            return false;
-        }
-        return service.second->GetAbilityRecordId() == abilityRecordId;
-    };
-
-    std::lock_guard lock(serviceMapMutex_);
-    auto serviceRecord = std::find_if(serviceMap_.begin(), serviceMap_.end(), IsMatch);
-    if (serviceRecord != serviceMap_.end()) {
-        return serviceRecord->second;
-    }
-    return nullptr;
+    return serviceIndex_.FindById(abilityRecordId);
 }
 
 std::shared_ptr<BaseExtensionRecord> AbilityConnectManager::GetExtensionByIdFromTerminatingMap(
@@ -2525,6 +2502,7 @@ void AbilityConnectManager::CloseAssertDialog(const std::string &assertSessionId
             if (assertSessionStr == assertSessionId) {
                 abilityRecord = item.second;
                 NotifyExtensionTerminated(abilityRecord);
+                serviceIndex_.Remove(abilityRecord);
                 serviceMap_.erase(item.first);
                 TAG_LOGD(AAFwkTag::EXT, "ServiceMap remove, size:%{public}zu", serviceMap_.size());
                 break;
@@ -2818,6 +2796,7 @@ void AbilityConnectManager::PauseExtensions()
                 (targetExtension->GetKeepAlive() && userId_ != U0_USER_ID))) {
                 NotifyExtensionTerminated(targetExtension);
                 terminatingExtensionList_.push_back(it->second);
+                serviceIndex_.Remove(targetExtension);
                 it = serviceMap_.erase(it);
                 TAG_LOGI(AAFwkTag::EXT, "terminate ability:%{public}s, serviceMap size:%{public}zu",
                     targetExtension->GetAbilityInfo().name.c_str(), serviceMap_.size());
@@ -3040,6 +3019,7 @@ void AbilityConnectManager::MoveToTerminatingMap(const std::shared_ptr<BaseExten
     auto slotIt = serviceMap_.find(serviceKey);
     if (slotIt != serviceMap_.end()) {
         if (slotIt->second == abilityRecord) {
+            serviceIndex_.Remove(abilityRecord);
             serviceMap_.erase(slotIt);
         } else {
             TAG_LOGW(AAFwkTag::EXT, "phantom key skip: serviceKey=%{public}s held by a different record "
@@ -3204,8 +3184,10 @@ bool AbilityConnectManager::AddToServiceMap(const std::string &key, std::shared_
     TAG_LOGD(AAFwkTag::EXT, "ServiceMap add, size:%{public}zu", serviceMap_.size());
     if (!insert.second) {
         TAG_LOGW(AAFwkTag::EXT, "record exist: %{public}s", key.c_str());
+        return false;
     }
-    return insert.second;
+    serviceIndex_.Add(abilityRecord);
+    return true;
 }
 
 AbilityConnectManager::ServiceMapType AbilityConnectManager::GetServiceMap()
@@ -207,6 +207,8 @@ namespace {
 
 constexpr const char* ARGS_USER_ID = "-u";
 constexpr const char* ARGS_CLIENT = "-c";
+constexpr const char* ARGS_IPC_DISPATCH = "--ipc-dispatch";
+constexpr const char* ARGS_INTERCEPTOR = "--interceptor";
 constexpr const char* ILLEGAL_INFORMATION = "The arguments are illegal and you can enter '-h' for help.";
 
 constexpr int32_t NEW_RULE_VALUE_SIZE = 6;
@@ -529,6 +531,7 @@ void AbilityManagerService::InitDeepLinkReserve()
 
 void AbilityManagerService::InitInterceptor()
 {
+    // interceptors run in the order they are added, the first one that blocks decides the start error
     interceptorExecuter_ = std::make_shared<AbilityInterceptorExecuter>();
     interceptorExecuter_->AddInterceptor("ScreenUnlock", std::make_shared<ScreenUnlockInterceptor>());
     interceptorExecuter_->AddInterceptor("CrowdTest", std::make_shared<CrowdTestInterceptor>());
@@ -12433,6 +12436,10 @@ int AbilityManagerService::Dump(const std::vector<std::u16string>& args, std::st
 
     if (argsStr[0] == "-h") {
         DumpUtils::ShowHelp(result);
+    } else if (argsStr[0] == ARGS_IPC_DISPATCH) {
+        DumpIpcDispatchStat(result);
+    } else if (argsStr[0] == ARGS_INTERCEPTOR) {
+        DumpInterceptorStat(result);
     } else {
         errCode = ProcessMultiParam(argsStr, result);
         if (errCode == ERR_AAFWK_HIDUMP_INVALID_ARGS) {
@@ -12442,6 +12449,18 @@ int AbilityManagerService::Dump(const std::vector<std::u16string>& args, std::st
     return errCode;
 }
 
+void AbilityManagerService::DumpInterceptorStat(std::string& result)
+{
+    if (interceptorExecuter_ != nullptr) {
+        result.append("before check:\n");
+        interceptorExecuter_->Dump(result);
+    }
+    if (afterCheckExecuter_ != nullptr) {
+        result.append("after check:\n");
+        afterCheckExecuter_->Dump(result);
+    }
+}
+
 ErrCode AbilityManagerService::ProcessMultiParam(std::vector<std::string>& argsStr, std::string& result)
 {
     TAG_LOGD(AAFwkTag::ABILITYMGR, "%{public}s begin", __func__);
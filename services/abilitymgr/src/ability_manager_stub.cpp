@@ -1057,134 +1057,40 @@ int AbilityManagerStub::OnRemoteRequestInnerTwentySecond(uint32_t code, MessageP
     return ERR_CODE_NOT_EXIST;
 }
 
-int AbilityManagerStub::OnRemoteRequestInner(uint32_t code, MessageParcel &data,
-    MessageParcel &reply, MessageOption &option)
-{
-    int retCode = ERR_OK;
-    retCode = HandleOnRemoteRequestInnerFirst(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = HandleOnRemoteRequestInnerSecond(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = HandleOnRemoteRequestInnerThird(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-
-    TAG_LOGW(AAFwkTag::ABILITYMGR, "default case");
-    return IPCObjectStub::OnRemoteRequest(code, data, reply, option);
+AbilityManagerStub::DispatchTable &AbilityManagerStub::GetDispatchTable()
+{
+    static constexpr std::array<DispatchTable::StageHandler, 22> stages = {
+        &AbilityManagerStub::OnRemoteRequestInnerFirst, &AbilityManagerStub::OnRemoteRequestInnerSecond,
+        &AbilityManagerStub::OnRemoteRequestInnerThird, &AbilityManagerStub::OnRemoteRequestInnerFourth,
+        &AbilityManagerStub::OnRemoteRequestInnerFifth, &AbilityManagerStub::OnRemoteRequestInnerSixth,
+        &AbilityManagerStub::OnRemoteRequestInnerSeventh, &AbilityManagerStub::OnRemoteRequestInnerEighth,
+        &AbilityManagerStub::OnRemoteRequestInnerNinth, &AbilityManagerStub::OnRemoteRequestInnerTenth,
+        &AbilityManagerStub::OnRemoteRequestInnerEleventh, &AbilityManagerStub::OnRemoteRequestInnerTwelveth,
+        &AbilityManagerStub::OnRemoteRequestInnerThirteenth, &AbilityManagerStub::OnRemoteRequestInnerFourteenth,
+        &AbilityManagerStub::OnRemoteRequestInnerFifteenth, &AbilityManagerStub::OnRemoteRequestInnerSixteenth,
+        &AbilityManagerStub::OnRemoteRequestInnerSeventeenth, &AbilityManagerStub::OnRemoteRequestInnerEighteenth,
+        &AbilityManagerStub::OnRemoteRequestInnerNineteenth, &AbilityManagerStub::OnRemoteRequestInnerTwentieth,
+        &AbilityManagerStub::OnRemoteRequestInnerTwentyFirst, &AbilityManagerStub::OnRemoteRequestInnerTwentySecond,
+    };
+    static DispatchTable dispatchTable(stages, ERR_CODE_NOT_EXIST);
+    return dispatchTable;
 }
 
-int AbilityManagerStub::HandleOnRemoteRequestInnerFirst(uint32_t code, MessageParcel &data,
-    MessageParcel &reply, MessageOption &option)
+void AbilityManagerStub::DumpIpcDispatchStat(std::string &result)
 {
-    int retCode = ERR_OK;
-    retCode = OnRemoteRequestInnerFirst(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerSecond(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerThird(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerFourth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerFifth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerSixth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerSeventh(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerEighth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerNinth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerTenth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    return ERR_CODE_NOT_EXIST;
+    GetDispatchTable().Dump(result);
 }
 
-int AbilityManagerStub::HandleOnRemoteRequestInnerSecond(uint32_t code, MessageParcel &data,
+int AbilityManagerStub::OnRemoteRequestInner(uint32_t code, MessageParcel &data,
     MessageParcel &reply, MessageOption &option)
 {
-    int retCode = ERR_OK;
-    retCode = OnRemoteRequestInnerEleventh(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerTwelveth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerThirteenth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerFourteenth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerFifteenth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerSixteenth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerSeventeenth(code, data, reply, option);
+    int retCode = GetDispatchTable().Dispatch(this, code, data, reply, option);
     if (retCode != ERR_CODE_NOT_EXIST) {
         return retCode;
     }
-    retCode = OnRemoteRequestInnerEighteenth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerNineteenth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerTwentieth(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    return ERR_CODE_NOT_EXIST;
-}
 
-int AbilityManagerStub::HandleOnRemoteRequestInnerThird(uint32_t code, MessageParcel &data,
-    MessageParcel &reply, MessageOption &option)
-{
-    int retCode = ERR_OK;
-    retCode = OnRemoteRequestInnerTwentyFirst(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    retCode = OnRemoteRequestInnerTwentySecond(code, data, reply, option);
-    if (retCode != ERR_CODE_NOT_EXIST) {
-        return retCode;
-    }
-    return ERR_CODE_NOT_EXIST;
+    TAG_LOGW(AAFwkTag::ABILITYMGR, "default case");
+    return IPCObjectStub::OnRemoteRequest(code, data, reply, option);
 }
 
 int AbilityManagerStub::OnRemoteRequest(uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option)
@@ -15,16 +15,48 @@
 
 #include "ability_record/ability_record_utils.h"
 
+#include <shared_mutex>
+#include <unordered_set>
+
 #include "ability_config.h"
 #include "hilog_tag_wrapper.h"
 
 namespace OHOS {
 namespace AAFwk {
+namespace {
+struct TokenRegistry {
+    std::shared_mutex mutex;
+    std::unordered_set<const IRemoteObject *> tokens;
+};
+
+TokenRegistry &GetTokenRegistry()
+{
+    // never destroyed, tokens held by singletons may be released after static destruction
+    static TokenRegistry *registry = new TokenRegistry();
+    return *registry;
+}
+}
+
 Token::Token(std::weak_ptr<AbilityRecord> abilityRecord) : abilityRecord_(abilityRecord)
-{}
+{
+    auto &registry = GetTokenRegistry();
+    std::unique_lock<std::shared_mutex> lock(registry.mutex);
+    registry.tokens.insert(this);
+}
 
 Token::~Token()
-{}
+{
+    auto &registry = GetTokenRegistry();
+    std::unique_lock<std::shared_mutex> lock(registry.mutex);
+    registry.tokens.erase(this);
+}
+
+bool Token::IsLocalToken(const IRemoteObject *object)
+{
+    auto &registry = GetTokenRegistry();
+    std::shared_lock<std::shared_mutex> lock(registry.mutex);
+    return registry.tokens.find(object) != registry.tokens.end();
+}
 
 std::shared_ptr<AbilityRecord> Token::GetAbilityRecordByToken(sptr<IRemoteObject> token)
 {
@@ -32,21 +64,9 @@ std::shared_ptr<AbilityRecord> Token::GetAbilityRecordByToken(sptr<IRemoteObject
         return nullptr;
     }
 
-    std::string descriptor = Str16ToStr8(token->GetObjectDescriptor());
-    if (descriptor != "ohos.aafwk.AbilityToken") {
-        TAG_LOGD(AAFwkTag::ABILITYMGR, "descriptor:%{public}s", descriptor.c_str());
-        return nullptr;
-    }
-
-    // Double check if token is valid
-    sptr<IAbilityToken> theToken = iface_cast<IAbilityToken>(token);
-    if (!theToken) {
-        TAG_LOGE(AAFwkTag::ABILITYMGR, "input err");
-        return nullptr;
-    }
-    std::u16string castDescriptor = theToken->GetDescriptor();
-    if (castDescriptor != u"ohos.aafwk.AbilityToken") {
-        TAG_LOGE(AAFwkTag::ABILITYMGR, "Input token iface_cast error:%{public}s.", Str16ToStr8(castDescriptor).c_str());
+    // the caller holds a reference of the object, so a registered address is a live token
+    if (!IsLocalToken(token.GetRefPtr())) {
+        TAG_LOGD(AAFwkTag::ABILITYMGR, "not ability token, proxy: %{public}d", token->IsProxyObject());
         return nullptr;
     }
 
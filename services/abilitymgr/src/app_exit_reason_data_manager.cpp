@@ -151,7 +151,6 @@ int32_t AppExitReasonDataManager::DeleteAppExitReason(const std::string &bundleN
 
 int32_t AppExitReasonDataManager::DeleteAppExitReason(const std::string &bundleName, uint32_t accessTokenId)
 {
-    auto accessTokenIdStr = std::to_string(accessTokenId);
     if (bundleName.empty() || accessTokenId == Security::AccessToken::INVALID_TOKENID) {
         TAG_LOGW(AAFwkTag::ABILITYMGR, "invalid value");
         return ERR_INVALID_VALUE;
@@ -166,28 +165,15 @@ int32_t AppExitReasonDataManager::DeleteAppExitReason(const std::string &bundleN
         }
     }
 
-    std::string keyUiExten = bundleName + SEPARATOR;
-    std::vector<DistributedKv::Entry> allEntries;
-    DistributedKv::Status status = kvStorePtr_->GetEntries(nullptr, allEntries);
-    if (status != DistributedKv::Status::SUCCESS) {
-        TAG_LOGE(AAFwkTag::ABILITYMGR, "error: %{public}d", status);
+    if (LoadMirror() != DistributedKv::Status::SUCCESS) {
         return ERR_INVALID_OPERATION;
     }
-
-    for (const auto &item : allEntries) {
-        const auto &keyValue = item.key.ToString();
-        if (keyValue.find(accessTokenIdStr) == std::string::npos &&
-            keyValue.find(keyUiExten) == std::string::npos) {
-            continue;
-        }
-
-        std::lock_guard lock(kvStorePtrMutex_);
-        auto errCode = kvStorePtr_->Delete(item.key);
-        status = (errCode != DistributedKv::Status::SUCCESS) ? errCode : status;
+    for (const auto &key : GetAppKeys(bundleName, accessTokenId)) {
+        DeleteAsync(DistributedKv::Key(key));
     }
-
-    if (status != DistributedKv::Status::SUCCESS) {
-        TAG_LOGE(AAFwkTag::ABILITYMGR, "error: %{public}d", status);
+    // the caller is told whether the data of the application is really gone
+    if (FlushPendingWrites() != DistributedKv::Status::SUCCESS) {
+        TAG_LOGE(AAFwkTag::ABILITYMGR, "delete exit reason failed, bundleName: %{public}s", bundleName.c_str());
         return ERR_INVALID_OPERATION;
     }
     return ERR_OK;
@@ -211,34 +197,28 @@ int32_t AppExitReasonDataManager::GetAppExitReason(const std::string &bundleName
         }
     }
 
-    std::vector<DistributedKv::Entry> allEntries;
-    DistributedKv::Status status = kvStorePtr_->GetEntries(nullptr, allEntries);
-    if (status != DistributedKv::Status::SUCCESS) {
-        TAG_LOGE(AAFwkTag::ABILITYMGR, "get entries error: %{public}d", status);
+    if (LoadMirror() != DistributedKv::Status::SUCCESS) {
         return ERR_INVALID_VALUE;
     }
+    DistributedKv::Value value;
+    if (!GetMirrorEntry(accessTokenIdStr, value)) {
+        return ERR_OK;
+    }
 
     std::vector<std::string> abilityList;
-    for (const auto &item : allEntries) {
-        if (item.key.ToString() == accessTokenIdStr) {
-            ConvertAppExitReasonInfoFromValue(item.value, exitReason, time_stamp, abilityList, processInfo,
-                withKillMsg);
-            auto pos = std::find(abilityList.begin(), abilityList.end(), abilityName);
-            if (pos != abilityList.end()) {
-                HandleAbilityMatchAndCleanup(abilityName, abilityList, isSetReason, cleanFlag);
-                UpdateAppExitReason(accessTokenId, abilityList, exitReason, processInfo, withKillMsg);
-            }
-            TAG_LOGD(AAFwkTag::ABILITYMGR, "current bundle name: %{public}s, tokenId:%{private}u, reason: %{public}d,"
-                "  exitMsg: %{public}s, abilityName:%{public}s, isSetReason:%{public}d, killId:%{public}d",
-                bundleName.c_str(), accessTokenId, exitReason.reason, exitReason.exitMsg.c_str(),
-                abilityName.c_str(), isSetReason, exitReason.killId);
-            if (abilityList.empty()) {
-                InnerDeleteAppExitReason(accessTokenIdStr);
-            }
-            break;
-        }
+    ConvertAppExitReasonInfoFromValue(value, exitReason, time_stamp, abilityList, processInfo, withKillMsg);
+    auto pos = std::find(abilityList.begin(), abilityList.end(), abilityName);
+    if (pos != abilityList.end()) {
+        HandleAbilityMatchAndCleanup(abilityName, abilityList, isSetReason, cleanFlag);
+        UpdateAppExitReason(accessTokenId, abilityList, exitReason, processInfo, withKillMsg);
+    }
+    TAG_LOGD(AAFwkTag::ABILITYMGR, "current bundle name: %{public}s, tokenId:%{private}u, reason: %{public}d,"
+        "  exitMsg: %{public}s, abilityName:%{public}s, isSetReason:%{public}d, killId:%{public}d",
+        bundleName.c_str(), accessTokenId, exitReason.reason, exitReason.exitMsg.c_str(),
+        abilityName.c_str(), isSetReason, exitReason.killId);
+    if (abilityList.empty()) {
+        InnerDeleteAppExitReason(accessTokenIdStr);
     }
-
     return ERR_OK;
 }
 
@@ -262,32 +242,21 @@ void AppExitReasonDataManager::UpdateAppExitReason(uint32_t accessTokenId, const
     }
 
     DistributedKv::Key key(std::to_string(accessTokenId));
-    DistributedKv::Status status;
     DistributedKv::Value value = ConvertAppExitReasonInfoToValue(abilityList, exitReason, processInfo, withKillMsg);
-    {
-        std::lock_guard lock(kvStorePtrMutex_);
-        status = kvStorePtr_->Put(key, value);
-    }
-    if (status != DistributedKv::Status::SUCCESS) {
-        TAG_LOGE(AAFwkTag::ABILITYMGR, "error: %{public}d", status);
-    }
-    dbWriteCounter_.UpdateWriteCount(APP_EXIT_REASON_STORAGE_DIR);
+    PutAsync(key, value);
 }
 
 int32_t AppExitReasonDataManager::RecordSignalReason(int32_t pid, int32_t uid, int32_t signal, std::string &bundleName)
 {
-    std::vector<DistributedKv::Entry> allEntries;
-    DistributedKv::Status status = DistributedKv::SUCCESS;
     {
         std::lock_guard lock(kvStorePtrMutex_);
         if (!CheckKvStore()) {
             TAG_LOGE(AAFwkTag::ABILITYMGR, "null kvStore");
             return ERR_NO_INIT;
         }
-        status = kvStorePtr_->GetEntries(nullptr, allEntries);
     }
+    DistributedKv::Status status = LoadMirror();
     if (status != DistributedKv::Status::SUCCESS) {
-        TAG_LOGE(AAFwkTag::ABILITYMGR, "get entries error: %{public}d", status);
         {
             std::lock_guard lock(kvStorePtrMutex_);
             status = RestoreKvStore(status);
@@ -305,11 +274,10 @@ int32_t AppExitReasonDataManager::RecordSignalReason(int32_t pid, int32_t uid, i
     exitReason.reason = AAFwk::REASON_NORMAL;
     exitReason.subReason = signal;
 
-    for (const auto &item : allEntries) {
-        if (item.key.ToString() == std::to_string(accessTokenId)) {
-            TAG_LOGI(AAFwkTag::ABILITYMGR, "record exist, not record signal reason any more");
-            return 0;
-        }
+    DistributedKv::Value value;
+    if (GetMirrorEntry(std::to_string(accessTokenId), value)) {
+        TAG_LOGI(AAFwkTag::ABILITYMGR, "record exist, not record signal reason any more");
+        return 0;
     }
     ret = SetAppExitReason(cacheInfo.bundleName, accessTokenId, cacheInfo.abilityNames, exitReason,
         cacheInfo.exitInfo, false);
@@ -424,16 +392,7 @@ void AppExitReasonDataManager::InnerDeleteAppExitReason(const std::string &keyNa
         return;
     }
 
-    DistributedKv::Key key(keyName);
-    DistributedKv::Status status;
-    {
-        std::lock_guard lock(kvStorePtrMutex_);
-        status = kvStorePtr_->Delete(key);
-    }
-
-    if (status != DistributedKv::Status::SUCCESS) {
-        TAG_LOGE(AAFwkTag::ABILITYMGR, "error: %{public}d", status);
-    }
+    DeleteAsync(DistributedKv::Key(keyName));
 }
 
 int32_t AppExitReasonDataManager::AddAbilityRecoverInfo(uint32_t accessTokenId,
@@ -456,7 +415,7 @@ int32_t AppExitReasonDataManager::AddAbilityRecoverInfo(uint32_t accessTokenId,
     DistributedKv::Status status;
     {
         std::lock_guard lock(kvStorePtrMutex_);
-        status = kvStorePtr_->Get(key, value);
+        status = GetValue(key, value);
     }
     if (status != DistributedKv::Status::SUCCESS && status != DistributedKv::Status::KEY_NOT_FOUND) {
         TAG_LOGE(AAFwkTag::ABILITYMGR, "AddAbilityRecoverInfo get error: %{public}d", status);
@@ -483,6 +442,9 @@ int32_t AppExitReasonDataManager::AddAbilityRecoverInfo(uint32_t accessTokenId,
     {
         std::lock_guard lock(kvStorePtrMutex_);
         status = kvStorePtr_->Put(key, value);
+        if (status == DistributedKv::Status::SUCCESS) {
+            UpdateMirrorEntry(key.ToString(), value);
+        }
     }
 
     if (status != DistributedKv::Status::SUCCESS) {
@@ -511,7 +473,7 @@ int32_t AppExitReasonDataManager::DeleteAllRecoverInfoByTokenId(uint32_t tokenId
     DistributedKv::Status status;
     {
         std::lock_guard lock(kvStorePtrMutex_);
-        status = kvStorePtr_->Get(key, value);
+        status = GetValue(key, value);
     }
     if (status != DistributedKv::Status::SUCCESS) {
         TAG_LOGE(AAFwkTag::ABILITYMGR, "failed:%{public}d", status);
@@ -549,7 +511,7 @@ int32_t AppExitReasonDataManager::DeleteAbilityRecoverInfoBySessionId(const int3
     DistributedKv::Status status;
     {
         std::lock_guard lock(kvStorePtrMutex_);
-        status = kvStorePtr_->Get(key, value);
+        status = GetValue(key, value);
     }
     if (status != DistributedKv::Status::SUCCESS) {
         TAG_LOGE(AAFwkTag::ABILITYMGR, "failed:%{public}d", status);
@@ -597,7 +559,7 @@ int32_t AppExitReasonDataManager::DeleteAbilityRecoverInfo(
     DistributedKv::Status status;
     {
         std::lock_guard lock(kvStorePtrMutex_);
-        status = kvStorePtr_->Get(key, value);
+        status = GetValue(key, value);
     }
     if (status != DistributedKv::Status::SUCCESS) {
         TAG_LOGW(AAFwkTag::ABILITYMGR, "DBStatus:%{public}d", status);
@@ -648,7 +610,7 @@ int32_t AppExitReasonDataManager::GetAbilityRecoverInfo(
     DistributedKv::Status status;
     {
         std::lock_guard lock(kvStorePtrMutex_);
-        status = kvStorePtr_->Get(key, value);
+        status = GetValue(key, value);
     }
     if (status != DistributedKv::Status::SUCCESS) {
         if (status == DistributedKv::Status::KEY_NOT_FOUND) {
@@ -683,7 +645,7 @@ uint32_t AppExitReasonDataManager::GetTokenIdBySessionID(const int32_t sessionId
     DistributedKv::Status status;
     {
         std::lock_guard lock(kvStorePtrMutex_);
-        status = kvStorePtr_->Get(key, value);
+        status = GetValue(key, value);
     }
     if (status != DistributedKv::Status::SUCCESS) {
         TAG_LOGE(AAFwkTag::ABILITYMGR, "failed:%{public}d", status);
@@ -739,25 +701,14 @@ bool AppExitReasonDataManager::GetUIExtensionAbilityExitReason(const std::string
         }
     }
 
-    std::vector<DistributedKv::Entry> allEntries;
-    DistributedKv::Status status = kvStorePtr_->GetEntries(nullptr, allEntries);
-    if (status != DistributedKv::Status::SUCCESS) {
-        TAG_LOGE(AAFwkTag::ABILITYMGR, "error: %{public}d", status);
+    DistributedKv::Value value;
+    if (LoadMirror() != DistributedKv::Status::SUCCESS || !GetMirrorEntry(keyEx, value)) {
         return false;
     }
     std::vector<std::string> abilityList;
-    bool isHaveReason = false;
-    for (const auto &item : allEntries) {
-        if (item.key.ToString() == keyEx) {
-            ConvertAppExitReasonInfoFromValue(item.value, exitReason, time_stamp, abilityList,
-                processInfo, withKillMsg);
-            isHaveReason = true;
-            InnerDeleteAppExitReason(keyEx);
-            break;
-        }
-    }
-
-    return isHaveReason;
+    ConvertAppExitReasonInfoFromValue(value, exitReason, time_stamp, abilityList, processInfo, withKillMsg);
+    InnerDeleteAppExitReason(keyEx);
+    return true;
 }
 
 void AppExitReasonDataManager::UpdateAbilityRecoverInfo(uint32_t accessTokenId,
@@ -774,6 +725,9 @@ void AppExitReasonDataManager::UpdateAbilityRecoverInfo(uint32_t accessTokenId,
     {
         std::lock_guard lock(kvStorePtrMutex_);
         status = kvStorePtr_->Delete(key);
+        if (status == DistributedKv::Status::SUCCESS) {
+            RemoveMirrorEntry(key.ToString());
+        }
     }
     if (status != DistributedKv::Status::SUCCESS) {
         TAG_LOGE(AAFwkTag::ABILITYMGR, "error: %{public}d", status);
@@ -784,6 +738,9 @@ void AppExitReasonDataManager::UpdateAbilityRecoverInfo(uint32_t accessTokenId,
     {
         std::lock_guard lock(kvStorePtrMutex_);
         status = kvStorePtr_->Put(key, value);
+        if (status == DistributedKv::Status::SUCCESS) {
+            UpdateMirrorEntry(key.ToString(), value);
+        }
     }
     if (status != DistributedKv::Status::SUCCESS) {
         TAG_LOGE(AAFwkTag::ABILITYMGR, "failed: %{public}d", status);
@@ -859,6 +816,9 @@ void AppExitReasonDataManager::InnerDeleteAbilityRecoverInfo(uint32_t accessToke
     {
         std::lock_guard lock(kvStorePtrMutex_);
         status = kvStorePtr_->Delete(key);
+        if (status == DistributedKv::Status::SUCCESS) {
+            RemoveMirrorEntry(key.ToString());
+        }
     }
 
     if (status != DistributedKv::Status::SUCCESS) {
@@ -881,6 +841,9 @@ void AppExitReasonDataManager::InnerAddSessionId(const int sessionId, uint32_t a
     {
         std::lock_guard lock(kvStorePtrMutex_);
         status = kvStorePtr_->Put(key, value);
+        if (status == DistributedKv::Status::SUCCESS) {
+            UpdateMirrorEntry(key.ToString(), value);
+        }
     }
     if (status != DistributedKv::Status::SUCCESS) {
         TAG_LOGE(AAFwkTag::ABILITYMGR, "AddSessionId error : %{public}d", status);
@@ -902,6 +865,9 @@ void AppExitReasonDataManager::InnerDeleteSessionId(const int sessionId)
     {
         std::lock_guard lock(kvStorePtrMutex_);
         status = kvStorePtr_->Delete(key);
+        if (status == DistributedKv::Status::SUCCESS) {
+            RemoveMirrorEntry(key.ToString());
+        }
     }
  
     if (status != DistributedKv::Status::SUCCESS) {
@@ -1000,30 +966,60 @@ int32_t AppExitReasonDataManager::GetRecordAppAbilityNames(const uint32_t access
         }
     }
 
-    std::vector<DistributedKv::Entry> allEntries;
-    DistributedKv::Status status = kvStorePtr_->GetEntries(nullptr, allEntries);
-    if (status != DistributedKv::Status::SUCCESS) {
-        TAG_LOGE(AAFwkTag::ABILITYMGR, "get entries error: %{public}d", status);
+    if (LoadMirror() != DistributedKv::Status::SUCCESS) {
         return AAFwk::ERR_GET_EXIT_INFO_FAILED;
     }
+    DistributedKv::Value value;
+    if (!GetMirrorEntry(accessTokenIdStr, value)) {
+        return ERR_OK;
+    }
 
     AAFwk::ExitReason exitReason = {};
     int64_t timeStamp = 0;
     AppExecFwk::RunningProcessInfo processInfo = {};
     bool withKillMsg = false;
-    for (const auto &item : allEntries) {
-        if (item.key.ToString() == accessTokenIdStr) {
-            ConvertAppExitReasonInfoFromValue(item.value, exitReason, timeStamp, abilityLists, processInfo,
-                withKillMsg);
-        }
-    }
-
+    ConvertAppExitReasonInfoFromValue(value, exitReason, timeStamp, abilityLists, processInfo, withKillMsg);
     return ERR_OK;
 }
 
 void AppExitReasonDataManager::PutAsync(const DistributedKv::Key &key, const DistributedKv::Value &value)
 {
-    ffrt::submit([key, value]() {
+    auto pThis = DelayedSingleton<AppExitReasonDataManager>::GetInstance();
+    if (!pThis) {
+        TAG_LOGE(AAFwkTag::ABILITYMGR, "null pThis");
+        return;
+    }
+    std::string keyStr = key.ToString();
+    std::lock_guard lock(pThis->mirrorMutex_);
+    pThis->pendingDeletes_.erase(keyStr);
+    pThis->pendingPuts_[keyStr] = value;
+    pThis->InsertMirrorEntry(keyStr, value);
+    pThis->ScheduleFlush();
+}
+
+void AppExitReasonDataManager::DeleteAsync(const DistributedKv::Key &key)
+{
+    auto pThis = DelayedSingleton<AppExitReasonDataManager>::GetInstance();
+    if (!pThis) {
+        TAG_LOGE(AAFwkTag::ABILITYMGR, "null pThis");
+        return;
+    }
+    std::string keyStr = key.ToString();
+    std::lock_guard lock(pThis->mirrorMutex_);
+    pThis->pendingPuts_.erase(keyStr);
+    pThis->pendingDeletes_.insert(keyStr);
+    pThis->EraseMirrorEntry(keyStr);
+    pThis->ScheduleFlush();
+}
+
+void AppExitReasonDataManager::ScheduleFlush()
+{
+    // writes made before the task runs go to the store in the same batch
+    if (flushScheduled_) {
+        return;
+    }
+    flushScheduled_ = true;
+    ffrt::submit([]() {
         auto pThis = DelayedSingleton<AppExitReasonDataManager>::GetInstance();
         HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, PUT_TASK_NAME);
         AAFwk::RecordCostTimeUtil timeRecord(PUT_TASK_NAME);
@@ -1031,17 +1027,221 @@ void AppExitReasonDataManager::PutAsync(const DistributedKv::Key &key, const Dis
             TAG_LOGE(AAFwkTag::ABILITYMGR, "null pThis");
             return;
         }
-        std::lock_guard lock(pThis->kvStorePtrMutex_);
-        if (!pThis->kvStorePtr_) {
-            TAG_LOGE(AAFwkTag::ABILITYMGR, "null kvStorePtr_");
-            return;
+        pThis->FlushPendingWrites();
+        }, ffrt::task_attr().name(PUT_TASK_NAME));
+}
+
+DistributedKv::Status AppExitReasonDataManager::FlushPendingWrites()
+{
+    std::lock_guard kvLock(kvStorePtrMutex_);
+    std::unordered_map<std::string, DistributedKv::Value> puts;
+    std::unordered_set<std::string> deletes;
+    {
+        std::lock_guard lock(mirrorMutex_);
+        puts.swap(pendingPuts_);
+        deletes.swap(pendingDeletes_);
+        flushScheduled_ = false;
+    }
+    if (!kvStorePtr_) {
+        TAG_LOGE(AAFwkTag::ABILITYMGR, "null kvStorePtr_");
+        RequeuePendingWrites(puts, deletes);
+        return DistributedKv::Status::ILLEGAL_STATE;
+    }
+    TAG_LOGD(AAFwkTag::ABILITYMGR, "puts: %{public}zu, deletes: %{public}zu", puts.size(), deletes.size());
+    DistributedKv::Status result = DistributedKv::Status::SUCCESS;
+    if (!deletes.empty()) {
+        std::vector<DistributedKv::Key> keys(deletes.begin(), deletes.end());
+        auto status = (keys.size() == 1) ? kvStorePtr_->Delete(keys.front()) : kvStorePtr_->DeleteBatch(keys);
+        if (status != DistributedKv::Status::SUCCESS) {
+            TAG_LOGW(AAFwkTag::ABILITYMGR, "delete error: %{public}d, retry on next flush", status);
+            RequeuePendingWrites({}, deletes);
+            result = status;
         }
-        auto status = pThis->kvStorePtr_->Put(key, value);
+    }
+    if (!puts.empty()) {
+        std::vector<DistributedKv::Entry> entries;
+        entries.reserve(puts.size());
+        for (const auto &[key, value] : puts) {
+            DistributedKv::Entry entry;
+            entry.key = key;
+            entry.value = value;
+            entries.emplace_back(entry);
+        }
+        auto status = (entries.size() == 1) ? kvStorePtr_->Put(entries.front().key, entries.front().value) :
+            kvStorePtr_->PutBatch(entries);
         if (status != DistributedKv::Status::SUCCESS) {
-            TAG_LOGW(AAFwkTag::ABILITYMGR, "insert error: %{public}d", status);
+            TAG_LOGW(AAFwkTag::ABILITYMGR, "insert error: %{public}d, retry on next flush", status);
+            RequeuePendingWrites(puts, {});
+            if (result == DistributedKv::Status::SUCCESS) {
+                result = status;
+            }
         }
-        pThis->dbWriteCounter_.UpdateWriteCount(APP_EXIT_REASON_STORAGE_DIR);
-        }, ffrt::task_attr().name(PUT_TASK_NAME));
+    }
+    dbWriteCounter_.UpdateWriteCount(APP_EXIT_REASON_STORAGE_DIR);
+    return result;
+}
+
+void AppExitReasonDataManager::RequeuePendingWrites(const std::unordered_map<std::string, DistributedKv::Value> &puts,
+    const std::unordered_set<std::string> &deletes)
+{
+    // writes queued while the batch was in flight are newer and win
+    std::lock_guard lock(mirrorMutex_);
+    for (const auto &key : deletes) {
+        if (pendingPuts_.count(key) == 0) {
+            pendingDeletes_.insert(key);
+        }
+    }
+    for (const auto &[key, value] : puts) {
+        if (pendingPuts_.count(key) == 0 && pendingDeletes_.count(key) == 0) {
+            pendingPuts_.emplace(key, value);
+        }
+    }
+}
+
+DistributedKv::Status AppExitReasonDataManager::LoadMirror()
+{
+    std::lock_guard kvLock(kvStorePtrMutex_);
+    if (kvStorePtr_ == nullptr) {
+        TAG_LOGE(AAFwkTag::ABILITYMGR, "null kvStorePtr_");
+        return DistributedKv::Status::ERROR;
+    }
+    {
+        std::lock_guard lock(mirrorMutex_);
+        if (IsMirrorOf(kvStorePtr_)) {
+            return DistributedKv::Status::SUCCESS;
+        }
+    }
+
+    AAFwk::RecordCostTimeUtil timeRecord("LoadMirror");
+    std::vector<DistributedKv::Entry> allEntries;
+    DistributedKv::Status status = kvStorePtr_->GetEntries(nullptr, allEntries);
+    if (status != DistributedKv::Status::SUCCESS) {
+        TAG_LOGE(AAFwkTag::ABILITYMGR, "get entries error: %{public}d", status);
+        return status;
+    }
+    std::lock_guard lock(mirrorMutex_);
+    mirror_.clear();
+    bundleKeys_.clear();
+    for (const auto &item : allEntries) {
+        InsertMirrorEntry(item.key.ToString(), item.value);
+    }
+    // not flushed yet, newer than the store
+    for (const auto &[key, value] : pendingPuts_) {
+        InsertMirrorEntry(key, value);
+    }
+    for (const auto &key : pendingDeletes_) {
+        EraseMirrorEntry(key);
+    }
+    mirrorStore_ = kvStorePtr_;
+    TAG_LOGI(AAFwkTag::ABILITYMGR, "mirror loaded, size: %{public}zu", mirror_.size());
+    return DistributedKv::Status::SUCCESS;
+}
+
+bool AppExitReasonDataManager::IsMirrorOf(const std::shared_ptr<DistributedKv::SingleKvStore> &kvStore) const
+{
+    // the weak pointer keeps the control block alive, so a new store never compares equal to a released one
+    return !mirrorStore_.expired() && !mirrorStore_.owner_before(kvStore) && !kvStore.owner_before(mirrorStore_);
+}
+
+bool AppExitReasonDataManager::GetMirrorEntry(const std::string &key, DistributedKv::Value &value)
+{
+    std::lock_guard lock(mirrorMutex_);
+    auto iter = mirror_.find(key);
+    if (iter == mirror_.end()) {
+        return false;
+    }
+    value = iter->second;
+    return true;
+}
+
+void AppExitReasonDataManager::InsertMirrorEntry(const std::string &key, const DistributedKv::Value &value)
+{
+    mirror_[key] = value;
+    auto pos = key.find(SEPARATOR);
+    if (pos != std::string::npos) {
+        bundleKeys_[key.substr(0, pos)].insert(key);
+    }
+}
+
+void AppExitReasonDataManager::EraseMirrorEntry(const std::string &key)
+{
+    if (mirror_.erase(key) == 0) {
+        return;
+    }
+    auto pos = key.find(SEPARATOR);
+    if (pos == std::string::npos) {
+        return;
+    }
+    auto iter = bundleKeys_.find(key.substr(0, pos));
+    if (iter != bundleKeys_.end()) {
+        iter->second.erase(key);
+        if (iter->second.empty()) {
+            bundleKeys_.erase(iter);
+        }
+    }
+}
+
+void AppExitReasonDataManager::UpdateMirrorEntry(const std::string &key, const DistributedKv::Value &value)
+{
+    std::lock_guard lock(mirrorMutex_);
+    pendingPuts_.erase(key);
+    pendingDeletes_.erase(key);
+    InsertMirrorEntry(key, value);
+}
+
+void AppExitReasonDataManager::RemoveMirrorEntry(const std::string &key)
+{
+    std::lock_guard lock(mirrorMutex_);
+    pendingPuts_.erase(key);
+    pendingDeletes_.erase(key);
+    EraseMirrorEntry(key);
+}
+
+DistributedKv::Status AppExitReasonDataManager::GetValue(const DistributedKv::Key &key, DistributedKv::Value &value)
+{
+    {
+        std::lock_guard lock(mirrorMutex_);
+        std::string keyStr = key.ToString();
+        if (IsMirrorOf(kvStorePtr_) || pendingPuts_.count(keyStr) > 0 || pendingDeletes_.count(keyStr) > 0) {
+            auto iter = mirror_.find(keyStr);
+            if (iter == mirror_.end()) {
+                return DistributedKv::Status::KEY_NOT_FOUND;
+            }
+            value = iter->second;
+            return DistributedKv::Status::SUCCESS;
+        }
+    }
+    return kvStorePtr_->Get(key, value);
+}
+
+std::vector<std::string> AppExitReasonDataManager::GetAppKeys(const std::string &bundleName, uint32_t accessTokenId)
+{
+    std::vector<std::string> keys;
+    std::lock_guard lock(mirrorMutex_);
+    std::string tokenKey = std::to_string(accessTokenId);
+    if (mirror_.count(tokenKey) > 0) {
+        keys.emplace_back(tokenKey);
+    }
+    auto bundleIter = bundleKeys_.find(bundleName);
+    if (bundleIter != bundleKeys_.end()) {
+        keys.insert(keys.end(), bundleIter->second.begin(), bundleIter->second.end());
+    }
+    std::string recoverKey = GetAbilityRecoverInfoKey(accessTokenId).ToString();
+    auto recoverIter = mirror_.find(recoverKey);
+    if (recoverIter == mirror_.end()) {
+        return keys;
+    }
+    keys.emplace_back(recoverKey);
+    std::vector<std::string> recoverInfoList;
+    std::vector<int> sessionIdList;
+    ConvertAbilityRecoverInfoFromValue(recoverIter->second, recoverInfoList, sessionIdList);
+    for (auto sessionId : sessionIdList) {
+        std::string sessionKey = GetSessionIdKey(sessionId).ToString();
+        if (sessionKey != recoverKey && mirror_.count(sessionKey) > 0) {
+            keys.emplace_back(sessionKey);
+        }
+    }
+    return keys;
 }
 } // namespace AbilityRuntime
 } // namespace OHOS
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "extension_record_index.h"
+
+#include <mutex>
+
+#include "want.h"
+
+namespace OHOS {
+namespace AAFwk {
+void ExtensionRecordIndex::Add(const std::shared_ptr<BaseExtensionRecord> &record)
+{
+    if (record == nullptr) {
+        return;
+    }
+    Entry entry;
+    entry.record = record;
+    entry.token = record->GetToken().GetRefPtr();
+    entry.assertSessionId = record->GetStringParam(Want::PARAM_ASSERT_FAULT_SESSION_ID);
+    auto recordId = record->GetAbilityRecordId();
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto iter = records_.find(recordId);
+    if (iter != records_.end() && iter->second.record.lock() == record) {
+        // the container may hold one record more than once
+        iter->second.refCount++;
+        return;
+    }
+    if (entry.token != nullptr) {
+        tokenIndex_[entry.token] = recordId;
+    }
+    if (!entry.assertSessionId.empty()) {
+        sessionIndex_[entry.assertSessionId] = recordId;
+    }
+    records_[recordId] = std::move(entry);
+}
+
+void ExtensionRecordIndex::Remove(const std::shared_ptr<BaseExtensionRecord> &record)
+{
+    if (record == nullptr) {
+        return;
+    }
+    auto recordId = record->GetAbilityRecordId();
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto iter = records_.find(recordId);
+    if (iter == records_.end()) {
+        return;
+    }
+    auto current = iter->second.record.lock();
+    if (current != nullptr && current != record) {
+        return;
+    }
+    if (--iter->second.refCount > 0) {
+        return;
+    }
+    auto tokenIter = tokenIndex_.find(iter->second.token);
+    if (tokenIter != tokenIndex_.end() && tokenIter->second == recordId) {
+        tokenIndex_.erase(tokenIter);
+    }
+    auto sessionIter = sessionIndex_.find(iter->second.assertSessionId);
+    if (sessionIter != sessionIndex_.end() && sessionIter->second == recordId) {
+        sessionIndex_.erase(sessionIter);
+    }
+    records_.erase(iter);
+}
+
+std::shared_ptr<BaseExtensionRecord> ExtensionRecordIndex::FindByIdLocked(int64_t recordId) const
+{
+    auto iter = records_.find(recordId);
+    if (iter == records_.end()) {
+        return nullptr;
+    }
+    return iter->second.record.lock();
+}
+
+std::shared_ptr<BaseExtensionRecord> ExtensionRecordIndex::FindByToken(const sptr<IRemoteObject> &token) const
+{
+    if (token == nullptr) {
+        return nullptr;
+    }
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto iter = tokenIndex_.find(token.GetRefPtr());
+    if (iter == tokenIndex_.end()) {
+        return nullptr;
+    }
+    auto record = FindByIdLocked(iter->second);
+    if (record == nullptr) {
+        return nullptr;
+    }
+    sptr<IRemoteObject> srcToken = record->GetToken();
+    return srcToken == token ? record : nullptr;
+}
+
+std::shared_ptr<BaseExtensionRecord> ExtensionRecordIndex::FindById(int64_t recordId) const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto record = FindByIdLocked(recordId);
+    if (record == nullptr || record->GetAbilityRecordId() != recordId) {
+        return nullptr;
+    }
+    return record;
+}
+
+std::shared_ptr<BaseExtensionRecord> ExtensionRecordIndex::FindBySessionId(const std::string &assertSessionId) const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto iter = sessionIndex_.find(assertSessionId);
+    if (iter == sessionIndex_.end()) {
+        return nullptr;
+    }
+    auto record = FindByIdLocked(iter->second);
+    if (record == nullptr || record->GetStringParam(Want::PARAM_ASSERT_FAULT_SESSION_ID) != assertSessionId) {
+        return nullptr;
+    }
+    return record;
+}
+
+bool ExtensionRecordIndex::Contains(int64_t recordId) const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return records_.find(recordId) != records_.end();
+}
+
+size_t ExtensionRecordIndex::Size() const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return records_.size();
+}
+
+void ExtensionRecordIndex::Clear()
+{
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    records_.clear();
+    tokenIndex_.clear();
+    sessionIndex_.clear();
+}
+}  // namespace AAFwk
+}  // namespace OHOS
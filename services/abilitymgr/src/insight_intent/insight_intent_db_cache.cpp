@@ -21,6 +21,10 @@
 
 namespace OHOS {
 namespace AbilityRuntime {
+namespace {
+constexpr size_t MAX_INTENT_CACHE_COST = 4096;
+}
+
 InsightIntentDbCache::InsightIntentDbCache()
 {}
 
@@ -43,6 +47,10 @@ int32_t InsightIntentDbCache::InitInsightIntentCache(const int32_t userId)
         return ERR_INVALID_VALUE;
     }
     userId_ = userId;
+    {
+        std::lock_guard<std::mutex> cacheLock(intentCacheMutex_);
+        ResetIntentCacheLocked(userId, totalInfos, configInfos);
+    }
 
     if (totalInfos.size() == 0) {
         TAG_LOGW(AAFwkTag::INTENT, "empty intent");
@@ -92,14 +100,24 @@ int32_t InsightIntentDbCache::SaveInsightIntentTotalInfo(const std::string &bund
         }
         bundleVersionMap_[bundleName] = std::to_string(versionCode);
     }
+    std::lock_guard<std::mutex> cacheLock(intentCacheMutex_);
     int32_t res = DelayedSingleton<InsightRdbStorageMgr>::GetInstance()->DeleteStorageInsightIntentData(bundleName,
         moduleName, userId);
     if (res != ERR_OK) {
         TAG_LOGW(AAFwkTag::INTENT, "Save before delete key error");
+    } else {
+        res = DelayedSingleton<InsightRdbStorageMgr>::GetInstance()->SaveStorageInsightIntentData(
+            bundleName, moduleName, userId, versionCode, profileInfos, configInfos);
+    }
+    if (userId != cacheUserId_) {
+        return res;
+    }
+    if (res != ERR_OK) {
+        DropBundleIntentCacheLocked(bundleName);
         return res;
     }
-    return DelayedSingleton<InsightRdbStorageMgr>::GetInstance()->SaveStorageInsightIntentData(
-        bundleName, moduleName, userId, versionCode, profileInfos, configInfos);
+    UpdateModuleIntentCacheLocked(bundleName, moduleName, profileInfos, configInfos);
+    return res;
 }
 
 int32_t InsightIntentDbCache::DeleteInsightIntentTotalInfo(const std::string &bundleName,
@@ -129,8 +147,18 @@ int32_t InsightIntentDbCache::DeleteInsightIntentTotalInfo(const std::string &bu
             }
         }
     }
-    return DelayedSingleton<InsightRdbStorageMgr>::GetInstance()->DeleteStorageInsightIntentData(bundleName,
+    std::lock_guard<std::mutex> cacheLock(intentCacheMutex_);
+    int32_t res = DelayedSingleton<InsightRdbStorageMgr>::GetInstance()->DeleteStorageInsightIntentData(bundleName,
         moduleName, userId);
+    if (userId != cacheUserId_) {
+        return res;
+    }
+    if (res != ERR_OK) {
+        DropBundleIntentCacheLocked(bundleName);
+        return res;
+    }
+    RemoveModuleIntentCacheLocked(bundleName, moduleName);
+    return res;
 }
 
 int32_t InsightIntentDbCache::DeleteInsightIntentByUserId(const int32_t userId)
@@ -261,12 +289,31 @@ void InsightIntentDbCache::GetInsightIntentGenericInfo(const std::string &bundle
 void InsightIntentDbCache::GetAllInsightIntentInfo(const int32_t userId, std::vector<ExtractInsightIntentInfo> &infos,
     std::vector<InsightIntentInfo> &configInfos)
 {
+    std::unique_lock<std::mutex> cacheLock(intentCacheMutex_);
+    bool isCacheUser = userId == cacheUserId_;
+    if (isCacheUser && allIntentsCached_) {
+        for (const auto &[bundleName, cache] : intentCache_) {
+            infos.insert(infos.end(), cache.infos.begin(), cache.infos.end());
+            configInfos.insert(configInfos.end(), cache.configInfos.begin(), cache.configInfos.end());
+        }
+        return;
+    }
+    if (!isCacheUser) {
+        cacheLock.unlock();
+    }
     std::map<std::string, std::string> bundleVersionMap;
+    std::vector<ExtractInsightIntentInfo> totalInfos;
+    std::vector<InsightIntentInfo> totalConfigInfos;
     if (DelayedSingleton<InsightRdbStorageMgr>::GetInstance()->LoadInsightIntentInfos(userId,
-        bundleVersionMap, infos, configInfos) != ERR_OK) {
+        bundleVersionMap, totalInfos, totalConfigInfos) != ERR_OK) {
         TAG_LOGE(AAFwkTag::INTENT, "LoadIntentData failed");
         return;
     }
+    if (isCacheUser) {
+        ResetIntentCacheLocked(userId, totalInfos, totalConfigInfos);
+    }
+    infos.insert(infos.end(), totalInfos.begin(), totalInfos.end());
+    configInfos.insert(configInfos.end(), totalConfigInfos.begin(), totalConfigInfos.end());
 }
 
 void InsightIntentDbCache::GetAllInsightIntentInfoForRegister(const int32_t userId,
@@ -281,6 +328,15 @@ void InsightIntentDbCache::GetAllInsightIntentInfoForRegister(const int32_t user
 void InsightIntentDbCache::GetAllConfigInsightIntentInfo(
     const int32_t userId, std::vector<InsightIntentInfo> &configInfos)
 {
+    {
+        std::lock_guard<std::mutex> cacheLock(intentCacheMutex_);
+        if (userId == cacheUserId_ && allIntentsCached_) {
+            for (const auto &[bundleName, cache] : intentCache_) {
+                configInfos.insert(configInfos.end(), cache.configInfos.begin(), cache.configInfos.end());
+            }
+            return;
+        }
+    }
     if (DelayedSingleton<InsightRdbStorageMgr>::GetInstance()->LoadConfigInsightIntentInfos(
         userId, configInfos) != ERR_OK) {
         TAG_LOGE(AAFwkTag::INTENT, "LoadIntentData failed");
@@ -291,6 +347,16 @@ void InsightIntentDbCache::GetAllConfigInsightIntentInfo(
 void InsightIntentDbCache::GetInsightIntentInfoByName(const std::string &bundleName, const int32_t userId,
     std::vector<ExtractInsightIntentInfo> &infos)
 {
+    {
+        std::lock_guard<std::mutex> cacheLock(intentCacheMutex_);
+        if (userId == cacheUserId_) {
+            auto cache = GetBundleIntentCacheLocked(bundleName);
+            if (cache != nullptr) {
+                infos.insert(infos.end(), cache->infos.begin(), cache->infos.end());
+            }
+            return;
+        }
+    }
     if (DelayedSingleton<InsightRdbStorageMgr>::GetInstance()->
         LoadInsightIntentInfoByName(bundleName, userId, infos) != ERR_OK) {
         TAG_LOGE(AAFwkTag::INTENT, "GetInsightIntentInfoByName failed");
@@ -301,6 +367,16 @@ void InsightIntentDbCache::GetInsightIntentInfoByName(const std::string &bundleN
 void InsightIntentDbCache::GetConfigInsightIntentInfoByName(const std::string &bundleName, const int32_t userId,
     std::vector<InsightIntentInfo> &infos)
 {
+    {
+        std::lock_guard<std::mutex> cacheLock(intentCacheMutex_);
+        if (userId == cacheUserId_) {
+            auto cache = GetBundleIntentCacheLocked(bundleName);
+            if (cache != nullptr) {
+                infos.insert(infos.end(), cache->configInfos.begin(), cache->configInfos.end());
+            }
+            return;
+        }
+    }
     if (DelayedSingleton<InsightRdbStorageMgr>::GetInstance()->
         LoadConfigInsightIntentInfoByName(bundleName, userId, infos) != ERR_OK) {
         TAG_LOGE(AAFwkTag::INTENT, "GetConfigInsightIntentInfoByName failed");
@@ -311,6 +387,20 @@ void InsightIntentDbCache::GetConfigInsightIntentInfoByName(const std::string &b
 void InsightIntentDbCache::GetInsightIntentInfo(const std::string &bundleName, const std::string &moduleName,
     const std::string &intentName, const int32_t userId, ExtractInsightIntentInfo &info)
 {
+    {
+        std::lock_guard<std::mutex> cacheLock(intentCacheMutex_);
+        if (userId == cacheUserId_) {
+            auto cache = GetBundleIntentCacheLocked(bundleName);
+            if (cache == nullptr) {
+                return;
+            }
+            auto iter = cache->infoIndex.find(std::make_pair(moduleName, intentName));
+            if (iter != cache->infoIndex.end()) {
+                info = cache->infos[iter->second];
+            }
+            return;
+        }
+    }
     if (DelayedSingleton<InsightRdbStorageMgr>::GetInstance()->
         LoadInsightIntentInfo(bundleName, moduleName, intentName, userId, info) != ERR_OK) {
         TAG_LOGW(AAFwkTag::INTENT, "GetInsightIntentInfo failed");
@@ -321,6 +411,20 @@ void InsightIntentDbCache::GetInsightIntentInfo(const std::string &bundleName, c
 void InsightIntentDbCache::GetConfigInsightIntentInfo(const std::string &bundleName, const std::string &moduleName,
     const std::string &intentName, const int32_t userId, InsightIntentInfo &info)
 {
+    {
+        std::lock_guard<std::mutex> cacheLock(intentCacheMutex_);
+        if (userId == cacheUserId_) {
+            auto cache = GetBundleIntentCacheLocked(bundleName);
+            if (cache == nullptr) {
+                return;
+            }
+            auto iter = cache->configIndex.find(std::make_pair(moduleName, intentName));
+            if (iter != cache->configIndex.end()) {
+                info = cache->configInfos[iter->second];
+            }
+            return;
+        }
+    }
     if (DelayedSingleton<InsightRdbStorageMgr>::GetInstance()->
         LoadConfigInsightIntentInfo(bundleName, moduleName, intentName, userId, info) != ERR_OK) {
         TAG_LOGW(AAFwkTag::INTENT, "GetConfigInsightIntentInfo failed");
@@ -332,5 +436,149 @@ void InsightIntentDbCache::BackupRdb()
 {
     DelayedSingleton<InsightRdbStorageMgr>::GetInstance()->BackupRdb();
 }
+
+void InsightIntentDbCache::BundleIntentCache::RebuildIndex()
+{
+    infoIndex.clear();
+    configIndex.clear();
+    for (size_t i = 0; i < infos.size(); i++) {
+        infoIndex[std::make_pair(infos[i].genericInfo.moduleName, infos[i].genericInfo.intentName)] = i;
+    }
+    for (size_t i = 0; i < configInfos.size(); i++) {
+        configIndex[std::make_pair(configInfos[i].moduleName, configInfos[i].intentName)] = i;
+    }
+}
+
+void InsightIntentDbCache::BundleIntentCache::RemoveModule(const std::string &moduleName)
+{
+    infos.erase(std::remove_if(infos.begin(), infos.end(),
+        [&moduleName](const auto &info) { return info.genericInfo.moduleName == moduleName; }), infos.end());
+    configInfos.erase(std::remove_if(configInfos.begin(), configInfos.end(),
+        [&moduleName](const auto &info) { return info.moduleName == moduleName; }), configInfos.end());
+}
+
+InsightIntentDbCache::BundleIntentCache *InsightIntentDbCache::GetBundleIntentCacheLocked(
+    const std::string &bundleName)
+{
+    auto iter = intentCache_.find(bundleName);
+    if (iter != intentCache_.end()) {
+        intentCacheLru_.splice(intentCacheLru_.begin(), intentCacheLru_, iter->second.lruIter);
+        return &iter->second;
+    }
+    if (allIntentsCached_) {
+        // the bundle has no intent
+        return nullptr;
+    }
+    BundleIntentCache cache;
+    auto storageMgr = DelayedSingleton<InsightRdbStorageMgr>::GetInstance();
+    if (storageMgr->LoadInsightIntentInfoByName(bundleName, cacheUserId_, cache.infos) != ERR_OK ||
+        storageMgr->LoadConfigInsightIntentInfoByName(bundleName, cacheUserId_, cache.configInfos) != ERR_OK) {
+        TAG_LOGE(AAFwkTag::INTENT, "load intents of %{public}s failed", bundleName.c_str());
+        return nullptr;
+    }
+    PutBundleIntentCacheLocked(bundleName, std::move(cache));
+    iter = intentCache_.find(bundleName);
+    return iter == intentCache_.end() ? nullptr : &iter->second;
+}
+
+void InsightIntentDbCache::PutBundleIntentCacheLocked(const std::string &bundleName, BundleIntentCache &&cache)
+{
+    EraseBundleIntentCacheLocked(bundleName);
+    cache.RebuildIndex();
+    intentCacheLru_.push_front(bundleName);
+    cache.lruIter = intentCacheLru_.begin();
+    intentCacheCost_ += cache.Cost();
+    intentCache_.emplace(bundleName, std::move(cache));
+    while (intentCacheCost_ > MAX_INTENT_CACHE_COST && intentCacheLru_.size() > 1) {
+        std::string coldBundleName = intentCacheLru_.back();
+        EraseBundleIntentCacheLocked(coldBundleName);
+        allIntentsCached_ = false;
+    }
+}
+
+void InsightIntentDbCache::EraseBundleIntentCacheLocked(const std::string &bundleName)
+{
+    auto iter = intentCache_.find(bundleName);
+    if (iter == intentCache_.end()) {
+        return;
+    }
+    intentCacheCost_ -= iter->second.Cost();
+    intentCacheLru_.erase(iter->second.lruIter);
+    intentCache_.erase(iter);
+}
+
+void InsightIntentDbCache::DropBundleIntentCacheLocked(const std::string &bundleName)
+{
+    // the stored intents of the bundle are unknown after a failed write, load them again on next use
+    EraseBundleIntentCacheLocked(bundleName);
+    allIntentsCached_ = false;
+}
+
+void InsightIntentDbCache::ResetIntentCacheLocked(int32_t userId, const std::vector<ExtractInsightIntentInfo> &infos,
+    const std::vector<InsightIntentInfo> &configInfos)
+{
+    intentCache_.clear();
+    intentCacheLru_.clear();
+    intentCacheCost_ = 0;
+    cacheUserId_ = userId;
+    std::map<std::string, BundleIntentCache> bundleCaches;
+    for (const auto &info : infos) {
+        bundleCaches[info.genericInfo.bundleName].infos.emplace_back(info);
+    }
+    for (const auto &configInfo : configInfos) {
+        bundleCaches[configInfo.bundleName].configInfos.emplace_back(configInfo);
+    }
+    allIntentsCached_ = true;
+    for (auto &[bundleName, cache] : bundleCaches) {
+        PutBundleIntentCacheLocked(bundleName, std::move(cache));
+    }
+    TAG_LOGD(AAFwkTag::INTENT, "cache %{public}zu bundles of user %{public}d, all cached: %{public}d",
+        intentCache_.size(), userId, allIntentsCached_);
+}
+
+void InsightIntentDbCache::UpdateModuleIntentCacheLocked(const std::string &bundleName, const std::string &moduleName,
+    const ExtractInsightIntentProfileInfoVec &profileInfos, const std::vector<InsightIntentInfo> &configInfos)
+{
+    auto iter = intentCache_.find(bundleName);
+    if (iter == intentCache_.end() && !allIntentsCached_) {
+        // loaded from storage on next use
+        return;
+    }
+    BundleIntentCache cache;
+    if (iter != intentCache_.end()) {
+        cache.infos = iter->second.infos;
+        cache.configInfos = iter->second.configInfos;
+    }
+    cache.RemoveModule(moduleName);
+    for (const auto &profileInfo : profileInfos.insightIntents) {
+        ExtractInsightIntentInfo info;
+        ExtractInsightIntentProfile::ProfileInfoFormat(profileInfo, info);
+        cache.infos.emplace_back(info);
+    }
+    for (auto configInfo : configInfos) {
+        // same as the fields written by the storage
+        configInfo.moduleName = moduleName;
+        configInfo.bundleName = bundleName;
+        cache.configInfos.emplace_back(configInfo);
+    }
+    PutBundleIntentCacheLocked(bundleName, std::move(cache));
+}
+
+void InsightIntentDbCache::RemoveModuleIntentCacheLocked(const std::string &bundleName, const std::string &moduleName)
+{
+    auto iter = intentCache_.find(bundleName);
+    if (iter == intentCache_.end()) {
+        return;
+    }
+    if (moduleName.empty()) {
+        EraseBundleIntentCacheLocked(bundleName);
+        return;
+    }
+    BundleIntentCache cache;
+    cache.infos = iter->second.infos;
+    cache.configInfos = iter->second.configInfos;
+    cache.RemoveModule(moduleName);
+    PutBundleIntentCacheLocked(bundleName, std::move(cache));
+}
 } // namespace AbilityRuntime
 } // namespace OHOS
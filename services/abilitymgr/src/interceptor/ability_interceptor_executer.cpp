@@ -14,18 +14,41 @@
  */
 
 #include "interceptor/ability_interceptor_executer.h"
+#include <algorithm>
 #include "hilog_tag_wrapper.h"
 #include "hitrace_meter.h"
 
 namespace OHOS {
 namespace AAFwk {
+namespace {
+constexpr const char* TRACE_NAME_PREFIX = "Interceptor:";
+}
+
 void AbilityInterceptorExecuter::AddInterceptor(std::string interceptorName,
     const std::shared_ptr<IAbilityInterceptor> &interceptor)
 {
     std::lock_guard lock(interceptorMapLock_);
-    if (interceptor != nullptr) {
-        interceptorMap_[interceptorName] = interceptor;
+    if (interceptor == nullptr) {
+        return;
+    }
+    interceptorMap_[interceptorName] = interceptor;
+    // The chain runs in registration order, so callers decide which check wins when several would block
+    // the same start. A replaced interceptor keeps its position.
+    auto entries = GetChain()->entries;
+    auto entry = std::make_shared<InterceptorEntry>();
+    entry->name = interceptorName;
+    entry->traceName = TRACE_NAME_PREFIX + interceptorName;
+    entry->interceptor = interceptor;
+    entry->requestTypes = interceptor->GetRequestTypes();
+    auto iter = std::find_if(entries.begin(), entries.end(), [&interceptorName](const auto &item) {
+        return item->name == interceptorName;
+    });
+    if (iter != entries.end()) {
+        *iter = entry;
+    } else {
+        entries.push_back(entry);
     }
+    PublishChain(std::move(entries));
 }
 
 void AbilityInterceptorExecuter::RemoveInterceptor(std::string interceptorName)
@@ -34,6 +57,11 @@ void AbilityInterceptorExecuter::RemoveInterceptor(std::string interceptorName)
     auto iter = interceptorMap_.find(interceptorName);
     if (iter != interceptorMap_.end()) {
         interceptorMap_.erase(interceptorName);
+        auto entries = GetChain()->entries;
+        entries.erase(std::remove_if(entries.begin(), entries.end(), [&interceptorName](const auto &item) {
+            return item->name == interceptorName;
+        }), entries.end());
+        PublishChain(std::move(entries));
     }
 }
 
@@ -48,28 +76,79 @@ ErrCode AbilityInterceptorExecuter::DoProcess(const AbilityInterceptorParam &par
 {
     HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
     int32_t result = ERR_OK;
-    auto interceptorMap = GetInterceptorMapCopy();
-    auto item = interceptorMap.begin();
-    while (item != interceptorMap.end()) {
-        if ((*item).second == nullptr) {
-            item++;
-            continue;
+    auto chain = GetChain();
+    for (auto entry : chain->chains[GetRequestTypeIndex(param)]) {
+        auto begin = std::chrono::steady_clock::now();
+        {
+            HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, entry->traceName);
+            result = entry->interceptor->DoProcess(param);
         }
-        result = (*item).second->DoProcess(param);
+        RecordLatency(*entry, begin);
         if (result != ERR_OK) {
-            TAG_LOGE(AAFwkTag::ABILITYMGR, "DoProcess err: %{public}s_%{public}d", (*item).first.c_str(), result);
+            TAG_LOGE(AAFwkTag::ABILITYMGR, "DoProcess err: %{public}s_%{public}d", entry->name.c_str(), result);
             break;
-        } else {
-            item++;
         }
     }
     return result;
 }
 
-InterceptorMap AbilityInterceptorExecuter::GetInterceptorMapCopy()
+void AbilityInterceptorExecuter::Dump(std::string &result) const
 {
-    std::lock_guard lock(interceptorMapLock_);
-    return interceptorMap_;
+    auto chain = GetChain();
+    result.append("interceptor    types  count    avg(us)  max(us)  histogram(<100us|<500us|<1ms|<5ms|<10ms|"
+        ">=10ms)\n");
+    for (const auto &entry : chain->entries) {
+        uint64_t count = entry->count.load(std::memory_order_relaxed);
+        uint64_t avg = (count == 0) ? 0 : entry->totalUs.load(std::memory_order_relaxed) / count;
+        result.append(entry->name).append("    ")
+            .append(std::to_string(entry->requestTypes)).append("    ")
+            .append(std::to_string(count)).append("    ")
+            .append(std::to_string(avg)).append("    ")
+            .append(std::to_string(entry->maxUs.load(std::memory_order_relaxed))).append("    ");
+        for (size_t i = 0; i < BUCKET_COUNT; i++) {
+            result.append(std::to_string(entry->buckets[i].load(std::memory_order_relaxed)))
+                .append(i + 1 == BUCKET_COUNT ? "\n" : "|");
+        }
+    }
+}
+
+std::shared_ptr<const AbilityInterceptorExecuter::InterceptorChain> AbilityInterceptorExecuter::GetChain() const
+{
+    return std::atomic_load(&chain_);
+}
+
+void AbilityInterceptorExecuter::PublishChain(std::vector<std::shared_ptr<InterceptorEntry>> entries)
+{
+    auto chain = std::make_shared<InterceptorChain>();
+    for (const auto &entry : entries) {
+        for (size_t i = 0; i < REQUEST_TYPE_COUNT; i++) {
+            if ((entry->requestTypes & (1u << i)) != 0) {
+                chain->chains[i].push_back(entry.get());
+            }
+        }
+    }
+    chain->entries = std::move(entries);
+    std::atomic_store(&chain_, std::shared_ptr<const InterceptorChain>(std::move(chain)));
+}
+
+size_t AbilityInterceptorExecuter::GetRequestTypeIndex(const AbilityInterceptorParam &param)
+{
+    // bit index of the request type in InterceptorRequestType
+    return param.callerToken == nullptr ? 0 : 1;
+}
+
+void AbilityInterceptorExecuter::RecordLatency(InterceptorEntry &entry, std::chrono::steady_clock::time_point begin)
+{
+    int64_t costUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+    size_t bucket = std::upper_bound(BUCKET_BOUNDS_US.begin(), BUCKET_BOUNDS_US.end(), costUs) -
+        BUCKET_BOUNDS_US.begin();
+    entry.count.fetch_add(1, std::memory_order_relaxed);
+    entry.totalUs.fetch_add(static_cast<uint64_t>(costUs), std::memory_order_relaxed);
+    entry.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    uint64_t maxUs = entry.maxUs.load(std::memory_order_relaxed);
+    while (static_cast<uint64_t>(costUs) > maxUs &&
+        !entry.maxUs.compare_exchange_weak(maxUs, static_cast<uint64_t>(costUs), std::memory_order_relaxed)) {}
 }
 } // namespace AAFwk
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
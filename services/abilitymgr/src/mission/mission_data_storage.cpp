@@ -14,7 +14,9 @@
  */
 
 #include "mission_data_storage.h"
+#include <chrono>
 #include <cstdio>
+#include <sstream>
 #include "directory_ex.h"
 #include "file_ex.h"
 #include "hilog_tag_wrapper.h"
@@ -33,6 +35,7 @@ namespace AAFwk {
 namespace {
 constexpr const char* IMAGE_FORMAT = "image/jpeg";
 constexpr uint8_t IMAGE_QUALITY = 75;
+constexpr size_t MAX_PRIVATE_PLACEHOLDER_COUNT = 8;
 }
 #ifdef SUPPORT_GRAPHICS
 constexpr int32_t RGB888_PIXEL_BYTES = 3;
@@ -49,89 +52,233 @@ MissionDataStorage::~MissionDataStorage()
 
 bool MissionDataStorage::LoadAllMissionInfo(std::list<InnerMissionInfo> &missionInfoList)
 {
-    std::vector<std::string> fileNameVec;
+    HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
     std::vector<int32_t> tempMissions;
-    std::string dirPath = GetMissionDataDirPath();
-    OHOS::GetDirFiles(dirPath, fileNameVec);
+    {
+        std::lock_guard<ffrt::mutex> lock(missionLogMutex_);
+        std::map<int32_t, std::string> records;
+        std::vector<std::string> legacyFiles;
+        LoadLegacyMissionFiles(records, legacyFiles);
+        std::map<int32_t, std::string> logRecords;
+        if (GetMissionLog().Load(logRecords)) {
+            // records already in the log are newer, legacy files are left over by an interrupted migration
+            for (auto &[missionId, content] : logRecords) {
+                records[missionId] = std::move(content);
+            }
+            MigrateLegacyMissionFiles(records, legacyFiles);
+        } else {
+            // the log may still hold missions, keep it and the legacy files untouched for the next load
+            TAG_LOGE(AAFwkTag::ABILITYMGR, "load mission log fail");
+        }
 
-    for (auto fileName : fileNameVec) {
+        for (const auto &[missionId, content] : records) {
+            InnerMissionInfo misssionInfo;
+            if (!misssionInfo.FromJsonStr(content)) {
+                TAG_LOGE(AAFwkTag::ABILITYMGR, "fail. mission: %{public}d", missionId);
+                continue;
+            }
+            if (misssionInfo.isTemporary) {
+                tempMissions.push_back(misssionInfo.missionInfo.id);
+                continue;
+            }
+            missionInfoList.push_back(misssionInfo);
+        }
+    }
+
+    for (auto missionId : tempMissions) {
+        DeleteMissionInfo(missionId);
+    }
+    return true;
+}
+
+void MissionDataStorage::LoadLegacyMissionFiles(std::map<int32_t, std::string> &records,
+    std::vector<std::string> &legacyFiles)
+{
+    std::vector<std::string> fileNameVec;
+    OHOS::GetDirFiles(GetMissionDataDirPath(), fileNameVec);
+    for (const auto &fileName : fileNameVec) {
         if (!CheckFileNameValid(fileName)) {
-            TAG_LOGE(AAFwkTag::ABILITYMGR, "file name %{public}s invalid", fileName.c_str());
             continue;
         }
-
         std::string content;
-        bool loadFile = OHOS::LoadStringFromFile(fileName, content);
-        if (!loadFile) {
+        if (!OHOS::LoadStringFromFile(fileName, content)) {
             TAG_LOGE(AAFwkTag::ABILITYMGR, "load %{public}s fail", fileName.c_str());
             continue;
         }
-
         InnerMissionInfo misssionInfo;
         if (!misssionInfo.FromJsonStr(content)) {
             TAG_LOGE(AAFwkTag::ABILITYMGR, "fail. file: %{public}s", fileName.c_str());
             continue;
         }
-        if (misssionInfo.isTemporary) {
-            tempMissions.push_back(misssionInfo.missionInfo.id);
-            continue;
-        }
-        missionInfoList.push_back(misssionInfo);
+        records.emplace(misssionInfo.missionInfo.id, std::move(content));
+        legacyFiles.push_back(fileName);
     }
+}
 
-    for (auto missionId : tempMissions) {
-        DeleteMissionInfo(missionId);
+void MissionDataStorage::MigrateLegacyMissionFiles(const std::map<int32_t, std::string> &records,
+    const std::vector<std::string> &legacyFiles)
+{
+    if (legacyFiles.empty()) {
+        return;
     }
-    return true;
+    if (!GetMissionLog().Reset(records)) {
+        TAG_LOGE(AAFwkTag::ABILITYMGR, "migrate %{public}zu mission files fail", legacyFiles.size());
+        return;
+    }
+    for (const auto &fileName : legacyFiles) {
+        if (!OHOS::RemoveFile(fileName)) {
+            TAG_LOGE(AAFwkTag::ABILITYMGR, "remove %{public}s fail", fileName.c_str());
+        }
+    }
+    TAG_LOGI(AAFwkTag::ABILITYMGR, "migrate %{public}zu mission files", legacyFiles.size());
 }
 
 void MissionDataStorage::SaveMissionInfo(const InnerMissionInfo &missionInfo)
 {
-    std::string filePath = GetMissionDataFilePath(missionInfo.missionInfo.id);
-    std::string dirPath = OHOS::ExtractFilePath(filePath);
-    if (!OHOS::FileExists(dirPath)) {
-        bool createDir = OHOS::ForceCreateDirectory(dirPath);
-        if (!createDir) {
-            TAG_LOGE(AAFwkTag::ABILITYMGR, "create dir %{public}s fail", dirPath.c_str());
-            return;
-        }
-#ifdef SUPPORT_GRAPHICS
-        chmod(dirPath.c_str(), MODE);
-#endif // SUPPORT_GRAPHICS
+    std::lock_guard<ffrt::mutex> lock(missionLogMutex_);
+    if (!EnsureMissionDataDir()) {
+        return;
     }
-
     std::string jsonStr = missionInfo.ToJsonStr();
-    bool saveMissionFile = OHOS::SaveStringToFile(filePath, jsonStr, true);
-    if (!saveMissionFile) {
-        TAG_LOGE(AAFwkTag::ABILITYMGR, "save %{public}s fail", filePath.c_str());
+    if (!GetMissionLog().Put(missionInfo.missionInfo.id, jsonStr)) {
+        TAG_LOGE(AAFwkTag::ABILITYMGR, "save mission %{public}d fail", missionInfo.missionInfo.id);
     }
 }
 
 void MissionDataStorage::DeleteMissionInfo(int missionId)
 {
-    std::string filePath = GetMissionDataFilePath(missionId);
-    bool removeMissionFile = OHOS::RemoveFile(filePath);
-    if (!removeMissionFile) {
-        TAG_LOGE(AAFwkTag::ABILITYMGR, "remove %{public}s fail", filePath.c_str());
-        return;
+    {
+        std::lock_guard<ffrt::mutex> lock(missionLogMutex_);
+        if (!GetMissionLog().Delete(missionId)) {
+            TAG_LOGE(AAFwkTag::ABILITYMGR, "remove mission %{public}d fail", missionId);
+            return;
+        }
     }
     DeleteMissionSnapshot(missionId);
 }
 
+MissionInfoLog &MissionDataStorage::GetMissionLog()
+{
+    if (missionLog_ == nullptr) {
+        missionLog_ = std::make_unique<MissionInfoLog>(GetMissionDataDirPath() + FILE_SEPARATOR +
+            MISSION_LOG_FILE_NAME);
+    }
+    return *missionLog_;
+}
+
+bool MissionDataStorage::EnsureMissionDataDir()
+{
+    std::string dirPath = GetMissionDataDirPath();
+    if (OHOS::FileExists(dirPath)) {
+        return true;
+    }
+    bool createDir = OHOS::ForceCreateDirectory(dirPath);
+    if (!createDir) {
+        TAG_LOGE(AAFwkTag::ABILITYMGR, "create dir %{public}s fail", dirPath.c_str());
+        return false;
+    }
+#ifdef SUPPORT_GRAPHICS
+    chmod(dirPath.c_str(), MODE);
+#endif // SUPPORT_GRAPHICS
+    return true;
+}
+
 void MissionDataStorage::SaveMissionSnapshot(int32_t missionId, const MissionSnapshot& missionSnapshot)
+{
+    SaveQueuedSnapshot(missionId, QueueMissionSnapshot(missionId, missionSnapshot));
+}
+
+uint64_t MissionDataStorage::QueueMissionSnapshot(int32_t missionId, const MissionSnapshot& missionSnapshot)
 {
 #ifdef SUPPORT_SCREEN
+    std::lock_guard<ffrt::mutex> lock(cachedPixelMapMutex_);
+    cachedPixelMap_.insert_or_assign(missionId, missionSnapshot.snapshot);
+    auto &queued = queuedSnapshots_[missionId];
+    queued.generation = ++snapshotGeneration_;
+    queued.isPrivate = missionSnapshot.isPrivate;
+    return queued.generation;
+#else
+    return 0;
+#endif
+}
+
+void MissionDataStorage::SaveQueuedSnapshot(int32_t missionId, uint64_t generation)
+{
+#ifdef SUPPORT_SCREEN
+    // a delete of the mission snapshot waits until the files are written, then removes them
+    std::lock_guard<ffrt::mutex> fileLock(GetSnapshotFileMutex(missionId));
+    MissionSnapshot missionSnapshot;
+    {
+        std::lock_guard<ffrt::mutex> lock(cachedPixelMapMutex_);
+        auto iter = queuedSnapshots_.find(missionId);
+        auto pixelMap = cachedPixelMap_.find(missionId);
+        if (iter == queuedSnapshots_.end() || iter->second.generation != generation ||
+            pixelMap == cachedPixelMap_.end()) {
+            droppedSnapshotCount_++;
+            TAG_LOGI(AAFwkTag::ABILITYMGR, "snapshot superseded, missionId = %{public}d", missionId);
+            DelayedSingleton<MissionInfoMgr>::GetInstance()->CompleteSaveSnapshot(missionId);
+            return;
+        }
+        missionSnapshot.snapshot = pixelMap->second;
+        missionSnapshot.isPrivate = iter->second.isPrivate;
+    }
     TAG_LOGI(AAFwkTag::ABILITYMGR, "snapshot: save snapshot from cache, missionId = %{public}d", missionId);
-    SaveCachedSnapshot(missionId, missionSnapshot);
-    SaveSnapshotFile(missionId, missionSnapshot);
-    TAG_LOGI(AAFwkTag::ABILITYMGR, "delete snapshot from cache, missionId = %{public}d", missionId);
-    DeleteCachedSnapshot(missionId);
+    auto begin = std::chrono::steady_clock::now();
+    SaveSnapshotFile(missionId, missionSnapshot.snapshot, missionSnapshot.isPrivate, false);
+    if (IsSnapshotSuperseded(missionId, generation)) {
+        // the newer snapshot writes both files again
+        droppedSnapshotCount_++;
+    } else {
+        if (missionSnapshot.isPrivate && missionSnapshot.snapshot) {
+            SavePrivateSnapshotFile(GetMissionSnapshotPath(missionId, true),
+                missionSnapshot.snapshot->GetWidth() / SCALE, missionSnapshot.snapshot->GetHeight() / SCALE);
+        } else {
+            SaveSnapshotFile(missionId, GetReducedPixelMap(missionSnapshot.snapshot), false, true);
+        }
+        uint64_t cost = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - begin).count());
+        encodedSnapshotCount_++;
+        totalEncodeTime_ += cost;
+        uint64_t maxCost = maxEncodeTime_.load();
+        while (cost > maxCost && !maxEncodeTime_.compare_exchange_weak(maxCost, cost)) {}
+    }
+    {
+        std::lock_guard<ffrt::mutex> lock(cachedPixelMapMutex_);
+        auto iter = queuedSnapshots_.find(missionId);
+        if (iter != queuedSnapshots_.end() && iter->second.generation == generation) {
+            TAG_LOGI(AAFwkTag::ABILITYMGR, "delete snapshot from cache, missionId = %{public}d", missionId);
+            queuedSnapshots_.erase(iter);
+            cachedPixelMap_.erase(missionId);
+        }
+    }
+    DelayedSingleton<MissionInfoMgr>::GetInstance()->CompleteSaveSnapshot(missionId);
 #endif
 }
 
+void MissionDataStorage::DumpSnapshotStats(std::vector<std::string> &info) const
+{
+    uint64_t encodedCount = encodedSnapshotCount_.load();
+    uint64_t averageTime = encodedCount == 0 ? 0 : totalEncodeTime_.load() / encodedCount;
+    std::string dumpInfo = "  snapshot encoded [" + std::to_string(encodedCount) + "] dropped [" +
+        std::to_string(droppedSnapshotCount_.load()) + "] placeholder hit [" +
+        std::to_string(placeholderHitCount_.load()) + "]";
+    info.push_back(dumpInfo);
+    dumpInfo = "  snapshot encode time avg [" + std::to_string(averageTime) + "us] max [" +
+        std::to_string(maxEncodeTime_.load()) + "us]";
+    info.push_back(dumpInfo);
+}
+
 void MissionDataStorage::DeleteMissionSnapshot(int32_t missionId)
 {
 #ifdef SUPPORT_SCREEN
+    {
+        // a queued snapshot must not bring the files back
+        std::lock_guard<ffrt::mutex> lock(cachedPixelMapMutex_);
+        if (queuedSnapshots_.erase(missionId) != 0) {
+            cachedPixelMap_.erase(missionId);
+        }
+    }
+    std::lock_guard<ffrt::mutex> fileLock(GetSnapshotFileMutex(missionId));
     DeleteMissionSnapshot(missionId, false);
     DeleteMissionSnapshot(missionId, true);
 #endif
@@ -210,11 +357,16 @@ bool MissionDataStorage::CheckFileNameValid(const std::string &fileName)
 }
 
 #ifdef SUPPORT_SCREEN
-void MissionDataStorage::SaveSnapshotFile(int32_t missionId, const MissionSnapshot& missionSnapshot)
+bool MissionDataStorage::IsSnapshotSuperseded(int32_t missionId, uint64_t generation)
 {
-    SaveSnapshotFile(missionId, missionSnapshot.snapshot, missionSnapshot.isPrivate, false);
-    SaveSnapshotFile(missionId, GetReducedPixelMap(missionSnapshot.snapshot), missionSnapshot.isPrivate, true);
-    DelayedSingleton<MissionInfoMgr>::GetInstance()->CompleteSaveSnapshot(missionId);
+    std::lock_guard<ffrt::mutex> lock(cachedPixelMapMutex_);
+    auto iter = queuedSnapshots_.find(missionId);
+    return iter == queuedSnapshots_.end() || iter->second.generation != generation;
+}
+
+ffrt::mutex &MissionDataStorage::GetSnapshotFileMutex(int32_t missionId)
+{
+    return snapshotFileMutexes_[static_cast<uint32_t>(missionId) % SNAPSHOT_FILE_MUTEX_COUNT];
 }
 
 void MissionDataStorage::SaveSnapshotFile(int32_t missionId, const std::shared_ptr<OHOS::Media::PixelMap>& snapshot,
@@ -237,24 +389,64 @@ void MissionDataStorage::SaveSnapshotFile(int32_t missionId, const std::shared_p
 
     if (isPrivate) {
         TAG_LOGD(AAFwkTag::ABILITYMGR, "snapshot: the param isPrivate is true.");
-        ssize_t dataLength = snapshot->GetWidth() * snapshot->GetHeight() * RGB888_PIXEL_BYTES;
-        uint8_t* data = (uint8_t*) malloc(dataLength);
-        if (data == nullptr) {
-            TAG_LOGE(AAFwkTag::ABILITYMGR, "malloc fail");
-            return;
-        }
-        if (memset_s(data, dataLength, 0xff, dataLength) == EOK) {
-            Media::SourceOptions sourceOptions;
-            uint32_t errCode = 0;
-            auto imageSource = Media::ImageSource::CreateImageSource(data, dataLength, sourceOptions, errCode);
-            WriteToJpeg(filePath, *imageSource);
-        }
-        free(data);
+        SavePrivateSnapshotFile(filePath, snapshot->GetWidth(), snapshot->GetHeight());
     } else {
         WriteToJpeg(filePath, *snapshot);
     }
 }
 
+void MissionDataStorage::SavePrivateSnapshotFile(const std::string &filePath, int32_t width, int32_t height)
+{
+    auto placeholder = GetPrivatePlaceholder(width, height);
+    if (placeholder == nullptr) {
+        return;
+    }
+    TAG_LOGI(AAFwkTag::ABILITYMGR, "file:%{public}s", filePath.c_str());
+    if (!OHOS::SaveStringToFile(filePath, *placeholder, true)) {
+        TAG_LOGE(AAFwkTag::ABILITYMGR, "write %{public}s fail", filePath.c_str());
+    }
+}
+
+std::shared_ptr<const std::string> MissionDataStorage::GetPrivatePlaceholder(int32_t width, int32_t height)
+{
+    std::lock_guard<ffrt::mutex> lock(privatePlaceholderMutex_);
+    auto key = std::make_pair(width, height);
+    auto iter = privatePlaceholders_.find(key);
+    if (iter != privatePlaceholders_.end()) {
+        placeholderHitCount_++;
+        return iter->second;
+    }
+    if (width <= 0 || height <= 0) {
+        TAG_LOGE(AAFwkTag::ABILITYMGR, "invalid size %{public}d*%{public}d", width, height);
+        return nullptr;
+    }
+    ssize_t dataLength = static_cast<ssize_t>(width) * height * RGB888_PIXEL_BYTES;
+    uint8_t* data = (uint8_t*) malloc(dataLength);
+    if (data == nullptr) {
+        TAG_LOGE(AAFwkTag::ABILITYMGR, "malloc fail");
+        return nullptr;
+    }
+    std::shared_ptr<const std::string> placeholder;
+    if (memset_s(data, dataLength, 0xff, dataLength) == EOK) {
+        Media::SourceOptions sourceOptions;
+        uint32_t errCode = 0;
+        auto imageSource = Media::ImageSource::CreateImageSource(data, dataLength, sourceOptions, errCode);
+        std::ostringstream stream;
+        if (imageSource != nullptr && PackJpeg(stream, *imageSource)) {
+            placeholder = std::make_shared<const std::string>(stream.str());
+        }
+    }
+    free(data);
+    if (placeholder == nullptr) {
+        return nullptr;
+    }
+    if (privatePlaceholders_.size() >= MAX_PRIVATE_PLACEHOLDER_COUNT) {
+        privatePlaceholders_.clear();
+    }
+    privatePlaceholders_.emplace(key, placeholder);
+    return placeholder;
+}
+
 std::shared_ptr<OHOS::Media::PixelMap> MissionDataStorage::GetReducedPixelMap(
     const std::shared_ptr<OHOS::Media::PixelMap>& snapshot)
 {
@@ -262,9 +454,12 @@ std::shared_ptr<OHOS::Media::PixelMap> MissionDataStorage::GetReducedPixelMap(
         return nullptr;
     }
 
+    // keep the format of source, so creating only scales the pixels
     OHOS::Media::InitializationOptions options;
     options.size.width = snapshot->GetWidth() / SCALE;
     options.size.height = snapshot->GetHeight() / SCALE;
+    options.pixelFormat = snapshot->GetPixelFormat();
+    options.alphaType = snapshot->GetAlphaType();
     std::unique_ptr<OHOS::Media::PixelMap> reducedPixelMap = OHOS::Media::PixelMap::Create(*snapshot, options);
     return std::shared_ptr<OHOS::Media::PixelMap>(reducedPixelMap.release());
 }
@@ -280,28 +475,6 @@ bool MissionDataStorage::GetCachedSnapshot(int32_t missionId, MissionSnapshot& m
     return false;
 }
 
-bool MissionDataStorage::SaveCachedSnapshot(int32_t missionId, const MissionSnapshot& missionSnapshot)
-{
-    std::lock_guard<ffrt::mutex> lock(cachedPixelMapMutex_);
-    auto result = cachedPixelMap_.insert_or_assign(missionId, missionSnapshot.snapshot);
-    if (!result.second) {
-        TAG_LOGE(AAFwkTag::ABILITYMGR, "save fail, missionId = %{public}d", missionId);
-        return false;
-    }
-    return true;
-}
-
-bool MissionDataStorage::DeleteCachedSnapshot(int32_t missionId)
-{
-    std::lock_guard<ffrt::mutex> lock(cachedPixelMapMutex_);
-    auto result = cachedPixelMap_.erase(missionId);
-    if (result != 1) {
-        TAG_LOGE(AAFwkTag::ABILITYMGR, "delete fail, missionId = %{public}d", missionId);
-        return false;
-    }
-    return true;
-}
-
 void MissionDataStorage::DeleteMissionSnapshot(int32_t missionId, bool isLowResolution)
 {
     std::string filePath = GetMissionSnapshotPath(missionId, isLowResolution);
@@ -410,22 +583,28 @@ template<typename T>
 void MissionDataStorage::WriteToJpeg(const std::string &filePath, T &snapshot) const
 {
     TAG_LOGI(AAFwkTag::ABILITYMGR, "file:%{public}s", filePath.c_str());
+    PackJpeg(filePath, snapshot);
+}
+
+template<typename Output, typename T>
+bool MissionDataStorage::PackJpeg(Output &output, T &image) const
+{
     OHOS::Media::PackOption option;
     option.format = IMAGE_FORMAT;
     option.quality = IMAGE_QUALITY;
     Media::ImagePacker imagePacker;
-    uint32_t err = imagePacker.StartPacking(filePath, option);
+    uint32_t err = imagePacker.StartPacking(output, option);
     if (err != ERR_OK) {
         TAG_LOGE(AAFwkTag::ABILITYMGR, "fail. %{public}d", err);
-        return;
+        return false;
     }
-    err = imagePacker.AddImage(snapshot);
+    err = imagePacker.AddImage(image);
     if (err != ERR_OK) {
         TAG_LOGE(AAFwkTag::ABILITYMGR, "fail. %{public}d", err);
-        return;
+        return false;
     }
     int64_t packedSize = 0;
-    imagePacker.FinalizePacking(packedSize);
+    return imagePacker.FinalizePacking(packedSize) == ERR_OK;
 }
 #endif
 }  // namespace AAFwk
@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mission_info_log.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "hilog_tag_wrapper.h"
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+constexpr uint32_t RECORD_MAGIC = 0x4D495346; // "MISF"
+constexpr uint32_t MAX_RECORD_LENGTH = 4 * 1024 * 1024;
+constexpr size_t COMPACT_MIN_FILE_SIZE = 256 * 1024;
+constexpr size_t COMPACT_DEAD_RATIO = 2;
+constexpr uint32_t FNV_OFFSET_BASIS = 2166136261u;
+constexpr uint32_t FNV_PRIME = 16777619u;
+constexpr const char* TMP_FILE_SUFFIX = ".tmp";
+constexpr mode_t LOG_FILE_MODE = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP;
+
+uint32_t FnvHash(uint32_t hash, const void *data, size_t length)
+{
+    auto bytes = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < length; i++) {
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+bool WriteAll(int fd, const std::string &data)
+{
+    size_t written = 0;
+    while (written < data.size()) {
+        ssize_t ret = write(fd, data.data() + written, data.size() - written);
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret <= 0) {
+            return false;
+        }
+        written += static_cast<size_t>(ret);
+    }
+    return true;
+}
+
+bool ReadAll(const std::string &filePath, std::string &data)
+{
+    int fd = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return errno == ENOENT;
+    }
+    struct stat fileStat = {};
+    if (fstat(fd, &fileStat) != 0) {
+        close(fd);
+        return false;
+    }
+    data.resize(static_cast<size_t>(fileStat.st_size));
+    size_t readSize = 0;
+    while (readSize < data.size()) {
+        ssize_t ret = read(fd, data.data() + readSize, data.size() - readSize);
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret <= 0) {
+            break;
+        }
+        readSize += static_cast<size_t>(ret);
+    }
+    close(fd);
+    data.resize(readSize);
+    return true;
+}
+
+bool SyncParentDir(const std::string &filePath)
+{
+    auto pos = filePath.rfind('/');
+    std::string dirPath = pos == std::string::npos ? "." : filePath.substr(0, pos == 0 ? 1 : pos);
+    int fd = open(dirPath.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    bool synced = fsync(fd) == 0;
+    close(fd);
+    return synced;
+}
+
+inline size_t RecordSize(size_t contentLength)
+{
+    return sizeof(uint32_t) * 5 + contentLength; // 5: fields of RecordHeader
+}
+}
+
+MissionInfoLog::MissionInfoLog(const std::string &filePath) : filePath_(filePath) {}
+
+MissionInfoLog::~MissionInfoLog()
+{
+    Close();
+}
+
+uint32_t MissionInfoLog::Checksum(const RecordHeader &header, const char *content, size_t length)
+{
+    uint32_t hash = FNV_OFFSET_BASIS;
+    hash = FnvHash(hash, &header.magic, sizeof(header.magic));
+    hash = FnvHash(hash, &header.type, sizeof(header.type));
+    hash = FnvHash(hash, &header.missionId, sizeof(header.missionId));
+    hash = FnvHash(hash, &header.length, sizeof(header.length));
+    return FnvHash(hash, content, length);
+}
+
+std::string MissionInfoLog::EncodeRecord(RecordType type, int32_t missionId, const std::string &content)
+{
+    RecordHeader header;
+    header.magic = RECORD_MAGIC;
+    header.type = type;
+    header.missionId = missionId;
+    header.length = static_cast<uint32_t>(content.size());
+    header.checksum = Checksum(header, content.data(), content.size());
+    std::string record;
+    record.reserve(RecordSize(content.size()));
+    record.append(reinterpret_cast<const char *>(&header.magic), sizeof(header.magic))
+        .append(reinterpret_cast<const char *>(&header.type), sizeof(header.type))
+        .append(reinterpret_cast<const char *>(&header.missionId), sizeof(header.missionId))
+        .append(reinterpret_cast<const char *>(&header.length), sizeof(header.length))
+        .append(reinterpret_cast<const char *>(&header.checksum), sizeof(header.checksum))
+        .append(content);
+    return record;
+}
+
+bool MissionInfoLog::EnsureLoaded()
+{
+    if (loaded_) {
+        return true;
+    }
+    std::string data;
+    if (!ReadAll(filePath_, data)) {
+        TAG_LOGE(AAFwkTag::ABILITYMGR, "read %{public}s fail, errno:%{public}d", filePath_.c_str(), errno);
+        return false;
+    }
+    size_t offset = 0;
+    while (data.size() - offset >= RecordSize(0)) {
+        RecordHeader header;
+        const char *cursor = data.data() + offset;
+        for (auto field : { &header.magic, &header.type, reinterpret_cast<uint32_t *>(&header.missionId),
+            &header.length, &header.checksum }) {
+            memcpy(field, cursor, sizeof(uint32_t));
+            cursor += sizeof(uint32_t);
+        }
+        if (header.magic != RECORD_MAGIC || header.length > MAX_RECORD_LENGTH ||
+            data.size() - offset < RecordSize(header.length) ||
+            Checksum(header, cursor, header.length) != header.checksum) {
+            break;
+        }
+        auto iter = records_.find(header.missionId);
+        if (iter != records_.end()) {
+            liveSize_ -= RecordSize(iter->second.size());
+            records_.erase(iter);
+        }
+        if (header.type == RECORD_PUT) {
+            records_.emplace(header.missionId, std::string(cursor, header.length));
+            liveSize_ += RecordSize(header.length);
+        }
+        offset += RecordSize(header.length);
+    }
+    if (offset != data.size()) {
+        // torn tail of an interrupted append
+        TAG_LOGW(AAFwkTag::ABILITYMGR, "drop %{public}zu bytes at %{public}zu of %{public}s",
+            data.size() - offset, offset, filePath_.c_str());
+        if (truncate(filePath_.c_str(), static_cast<off_t>(offset)) != 0) {
+            TAG_LOGE(AAFwkTag::ABILITYMGR, "truncate fail, errno:%{public}d", errno);
+            return false;
+        }
+    }
+    fileSize_ = offset;
+    loaded_ = true;
+    TAG_LOGI(AAFwkTag::ABILITYMGR, "load %{public}zu missions, %{public}zu bytes", records_.size(), fileSize_);
+    return true;
+}
+
+bool MissionInfoLog::Load(std::map<int32_t, std::string> &records)
+{
+    if (!EnsureLoaded()) {
+        return false;
+    }
+    records = records_;
+    return true;
+}
+
+bool MissionInfoLog::Put(int32_t missionId, const std::string &content)
+{
+    if (content.size() > MAX_RECORD_LENGTH) {
+        TAG_LOGE(AAFwkTag::ABILITYMGR, "mission %{public}d too large:%{public}zu", missionId, content.size());
+        return false;
+    }
+    return Append(RECORD_PUT, missionId, content);
+}
+
+bool MissionInfoLog::Delete(int32_t missionId)
+{
+    if (!EnsureLoaded() || records_.find(missionId) == records_.end()) {
+        return false;
+    }
+    return Append(RECORD_DELETE, missionId, "");
+}
+
+bool MissionInfoLog::OpenForAppend()
+{
+    if (fd_ >= 0) {
+        return true;
+    }
+    fd_ = open(filePath_.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, LOG_FILE_MODE);
+    if (fd_ < 0) {
+        TAG_LOGE(AAFwkTag::ABILITYMGR, "open %{public}s fail, errno:%{public}d", filePath_.c_str(), errno);
+        return false;
+    }
+    return true;
+}
+
+void MissionInfoLog::Close()
+{
+    if (fd_ >= 0) {
+        close(fd_);
+        fd_ = -1;
+    }
+}
+
+bool MissionInfoLog::Append(RecordType type, int32_t missionId, const std::string &content)
+{
+    if (!EnsureLoaded() || !OpenForAppend()) {
+        return false;
+    }
+    std::string record = EncodeRecord(type, missionId, content);
+    if (!WriteAll(fd_, record)) {
+        TAG_LOGE(AAFwkTag::ABILITYMGR, "append mission %{public}d fail, errno:%{public}d", missionId, errno);
+        // keep the file free of a partial record
+        if (ftruncate(fd_, static_cast<off_t>(fileSize_)) != 0) {
+            Close();
+            loaded_ = false;
+            records_.clear();
+            liveSize_ = 0;
+        }
+        return false;
+    }
+    fileSize_ += record.size();
+    auto iter = records_.find(missionId);
+    if (iter != records_.end()) {
+        liveSize_ -= RecordSize(iter->second.size());
+        records_.erase(iter);
+    }
+    if (type == RECORD_PUT) {
+        records_.emplace(missionId, content);
+        liveSize_ += record.size();
+    }
+    CompactIfNeeded();
+    return true;
+}
+
+void MissionInfoLog::CompactIfNeeded()
+{
+    if (fileSize_ < COMPACT_MIN_FILE_SIZE || fileSize_ < liveSize_ * COMPACT_DEAD_RATIO) {
+        return;
+    }
+    auto records = records_;
+    Reset(records);
+}
+
+bool MissionInfoLog::Reset(const std::map<int32_t, std::string> &records)
+{
+    std::string data;
+    for (const auto &[missionId, content] : records) {
+        data.append(EncodeRecord(RECORD_PUT, missionId, content));
+    }
+    std::string tmpPath = filePath_ + TMP_FILE_SUFFIX;
+    int fd = open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, LOG_FILE_MODE);
+    if (fd < 0) {
+        TAG_LOGE(AAFwkTag::ABILITYMGR, "open %{public}s fail, errno:%{public}d", tmpPath.c_str(), errno);
+        return false;
+    }
+    bool written = WriteAll(fd, data) && fsync(fd) == 0;
+    close(fd);
+    if (!written || rename(tmpPath.c_str(), filePath_.c_str()) != 0) {
+        TAG_LOGE(AAFwkTag::ABILITYMGR, "rewrite %{public}s fail, errno:%{public}d", filePath_.c_str(), errno);
+        unlink(tmpPath.c_str());
+        return false;
+    }
+    // the rename is durable only once the directory is synced, callers may remove the source of the records
+    bool synced = SyncParentDir(filePath_);
+    if (!synced) {
+        TAG_LOGE(AAFwkTag::ABILITYMGR, "sync dir of %{public}s fail, errno:%{public}d", filePath_.c_str(), errno);
+    }
+    Close();
+    records_ = records;
+    fileSize_ = data.size();
+    liveSize_ = data.size();
+    loaded_ = true;
+    TAG_LOGI(AAFwkTag::ABILITYMGR, "rewrite %{public}zu missions, %{public}zu bytes", records_.size(), fileSize_);
+    return synced;
+}
+}  // namespace AAFwk
+}  // namespace OHOS
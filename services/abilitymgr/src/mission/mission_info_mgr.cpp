@@ -458,6 +458,9 @@ void MissionInfoMgr::Dump(std::vector<std::string> &info)
     for (const auto& innerMissionInfo : missionInfoList_) {
         innerMissionInfo.Dump(info);
     }
+    if (taskDataPersistenceMgr_) {
+        taskDataPersistenceMgr_->DumpSnapshotStats(info);
+    }
 }
 
 void MissionInfoMgr::RegisterSnapshotHandler(const sptr<ISnapshotHandler>& handler)
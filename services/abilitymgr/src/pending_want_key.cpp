@@ -143,6 +143,28 @@ bool PendingWantKey::IsEqualsRequestWant(const Want &otherWant)
     return requestWant_.IsEquals(otherWant);
 }
 
+size_t PendingWantKey::GetHashCode()
+{
+    std::hash<std::string> stringHash;
+    std::hash<int32_t> intHash;
+    size_t hashCode = stringHash(bundleName_);
+    hashCode = hashCode * ODD_PRIME_NUMBER + stringHash(requestWho_);
+    hashCode = hashCode * ODD_PRIME_NUMBER + stringHash(requestResolvedType_);
+    hashCode = hashCode * ODD_PRIME_NUMBER + intHash(requestCode_);
+    hashCode = hashCode * ODD_PRIME_NUMBER + intHash(type_);
+    hashCode = hashCode * ODD_PRIME_NUMBER + intHash(userId_);
+    hashCode = hashCode * ODD_PRIME_NUMBER + intHash(appIndex_);
+    std::lock_guard<std::mutex> lock(requestWantMutex_);
+    hashCode = hashCode * ODD_PRIME_NUMBER + stringHash(requestWant_.GetBundleNameRef());
+    hashCode = hashCode * ODD_PRIME_NUMBER + stringHash(requestWant_.GetAbilityNameRef());
+    hashCode = hashCode * ODD_PRIME_NUMBER + stringHash(requestWant_.GetAction());
+    hashCode = hashCode * ODD_PRIME_NUMBER + stringHash(requestWant_.GetUriString());
+    for (const auto &key : requestWant_.GetParams().KeySet()) {
+        hashCode = hashCode * ODD_PRIME_NUMBER + stringHash(key);
+    }
+    return hashCode;
+}
+
 void PendingWantKey::GetAllBundleNames(std::vector<std::string> &bundleNames)
 {
     std::lock_guard<std::mutex> lock(wantsInfosMutex_);
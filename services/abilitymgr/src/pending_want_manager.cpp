@@ -208,7 +208,7 @@ sptr<IWantSender> PendingWantManager::GetWantSenderLocked(const int32_t callingU
         }
         MakeWantSenderCanceledLocked(*ref);
         ReduceWantAgentNumber(ref->GetKey());
-        wantRecords_.erase(ref->GetKey());
+        EraseWantRecordLocked(ref->GetKey());
     }
 
     if (!needCreate) {
@@ -224,6 +224,7 @@ sptr<IWantSender> PendingWantManager::GetWantSenderLocked(const int32_t callingU
         pendingKey->SetCode(PendingRecordIdCreate());
         AddWantAgentNumber(pendingKey);
         wantRecords_.insert(std::make_pair(pendingKey, rec));
+        wantRecordIndex_.emplace(pendingKey->GetHashCode(), pendingKey);
         TAG_LOGI(AAFwkTag::WANTAGENT,
             "wantRecords_ size %{public}zu, bundleName=%{public}s, flags=%{public}d, type=%{public}d, code=%{public}d",
             wantRecords_.size(), pendingKey->GetBundleName().c_str(), pendingKey->GetFlags(), pendingKey->GetType(),
@@ -250,16 +251,43 @@ sptr<PendingWantRecord> PendingWantManager::GetPendingWantRecordByKey(const std:
 {
     HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
     TAG_LOGD(AAFwkTag::WANTAGENT, "begin");
-    for (const auto &item : wantRecords_) {
-        const auto pendingKey = item.first;
-        const auto pendingRecord = item.second;
-        if ((pendingRecord != nullptr) && CheckPendingWantRecordByKey(pendingKey, key)) {
-            return pendingRecord;
+    if (key == nullptr) {
+        return nullptr;
+    }
+    auto range = wantRecordIndex_.equal_range(key->GetHashCode());
+    for (auto iter = range.first; iter != range.second; ++iter) {
+        const auto &pendingKey = iter->second;
+        if (!CheckPendingWantRecordByKey(pendingKey, key)) {
+            continue;
+        }
+        auto record = wantRecords_.find(pendingKey);
+        if (record != wantRecords_.end() && record->second != nullptr) {
+            return record->second;
         }
     }
     return nullptr;
 }
 
+void PendingWantManager::EraseWantRecordIndexLocked(const std::shared_ptr<PendingWantKey> &key)
+{
+    if (key == nullptr) {
+        return;
+    }
+    auto range = wantRecordIndex_.equal_range(key->GetHashCode());
+    for (auto iter = range.first; iter != range.second; ++iter) {
+        if (iter->second == key) {
+            wantRecordIndex_.erase(iter);
+            return;
+        }
+    }
+}
+
+void PendingWantManager::EraseWantRecordLocked(const std::shared_ptr<PendingWantKey> &key)
+{
+    EraseWantRecordIndexLocked(key);
+    wantRecords_.erase(key);
+}
+
 bool PendingWantManager::CheckPendingWantRecordByKey(
     const std::shared_ptr<PendingWantKey> &inputKey, const std::shared_ptr<PendingWantKey> &key)
 {
@@ -392,7 +420,7 @@ void PendingWantManager::CancelWantSenderLocked(PendingWantRecord &record, bool
     MakeWantSenderCanceledLocked(record);
     if (cleanAbility) {
         ReduceWantAgentNumber(record.GetKey());
-        wantRecords_.erase(record.GetKey());
+        EraseWantRecordLocked(record.GetKey());
     }
 }
 
@@ -808,6 +836,7 @@ void PendingWantManager::ClearPendingWantRecordTask(const std::string &bundleNam
             }
             if (hasBundle) {
                 ReduceWantAgentNumber(iter->first);
+                EraseWantRecordIndexLocked(iter->first);
                 iter = wantRecords_.erase(iter);
                 TAG_LOGI(AAFwkTag::WANTAGENT, "wantRecords_ size %{public}zu", wantRecords_.size());
             } else {
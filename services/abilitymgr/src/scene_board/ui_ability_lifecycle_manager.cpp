@@ -183,10 +183,11 @@ void UIAbilityLifecycleManager::RemoveStartingPid(pid_t pid)
 void UIAbilityLifecycleManager::RecordPidKilling(pid_t pid, const std::string &reason, bool isKillPrecedeStart)
 {
     std::lock_guard<ffrt::mutex> guard(sessionLock_);
-    for (const auto& [first, second] : sessionAbilityMap_) {
-        if (second && pid == second->GetPid()) {
-            second->SetKillReason(reason);
-            second->SetIsKillPrecedeStart(isKillPrecedeStart);
+    for (auto sessionId : GetSessionIdsByPid(pid)) {
+        auto abilityRecord = GetSessionRecord(sessionId);
+        if (abilityRecord && pid == abilityRecord->GetPid()) {
+            abilityRecord->SetKillReason(reason);
+            abilityRecord->SetIsKillPrecedeStart(isKillPrecedeStart);
         }
     }
 }
@@ -379,7 +380,7 @@ bool UIAbilityLifecycleManager::HandleRestartUIAbility(sptr<SessionInfo> session
         TAG_LOGI(AAFwkTag::ABILITYMGR, "restartApp reuse window");
         callerRecord->SetRestartAppFlag(true);
         reuseWindowRecords_.insert(callerRecord);
-        sessionAbilityMap_.erase(sessionInfo->persistentId);
+        EraseSessionRecord(sessionInfo->persistentId);
     }
     lock.unlock();
     auto result = DelayedSingleton<AbilityManagerService>::GetInstance()->SignRestartProcess(
@@ -491,10 +492,8 @@ UIAbilityRecordPtr UIAbilityLifecycleManager::GenerateAbilityRecord(AbilityReque
                 "replacing old record id=%{public}d, new record id=%{public}d",
                 iter->second->GetRecordId(), uiAbilityRecord->GetRecordId());
             lowMemKillAbilityMap_.emplace(sessionInfo->persistentId, iter->second);
-            sessionAbilityMap_[sessionInfo->persistentId] = uiAbilityRecord;
-        } else {
-            sessionAbilityMap_.emplace(sessionInfo->persistentId, uiAbilityRecord);
         }
+        AddSessionRecord(sessionInfo->persistentId, uiAbilityRecord);
         return uiAbilityRecord;
     }
     return HandleAbilityRecordReused(iter->second, *sessionInfo, abilityRequest);
@@ -609,6 +608,7 @@ int UIAbilityLifecycleManager::AttachAbilityThread(const sptr<IAbilityScheduler>
 
     std::lock_guard<ffrt::mutex> guard(sessionLock_);
     TAG_LOGI(AAFwkTag::ABILITYMGR, "lifecycle name: %{public}s", abilityRecord->GetAbilityInfo().name.c_str());
+    UpdateSessionPid(token, abilityRecord->GetPid());
     SyncLoadExitReasonTask(abilityRecord->GetRecordId());
     abilityRecord->EvaluateRecoveryLaunchReason();
 
@@ -867,7 +867,7 @@ bool UIAbilityLifecycleManager::CheckStartByOEExt(const AbilityRequest &abilityR
     }
 
     if (persistentId != 0) {
-        auto uiAbility = sessionAbilityMap_[persistentId];
+        auto uiAbility = GetSessionRecord(persistentId);
         auto extAbility = Token::GetAbilityRecordByToken(abilityRequest.callerToken);
         if (uiAbility != nullptr && extAbility != nullptr && uiAbility->GetPid() != extAbility->GetPid()) {
             TAG_LOGE(AAFwkTag::ABILITYMGR, "ByOEExt duplicate start: %{public}d", persistentId);
@@ -1415,10 +1415,9 @@ UIAbilityRecordPtr UIAbilityLifecycleManager::GetAbilityRecordByToken(const sptr
         }
     }
 
-    for (auto iter = sessionAbilityMap_.begin(); iter != sessionAbilityMap_.end(); iter++) {
-        if (iter->second != nullptr && iter->second->GetToken()->AsObject() == token) {
-            return iter->second;
-        }
+    int32_t sessionId = 0;
+    if (FindSessionIdByToken(token, sessionId)) {
+        return GetSessionRecord(sessionId);
     }
     return nullptr;
 }
@@ -1459,12 +1458,8 @@ bool UIAbilityLifecycleManager::IsContainsAbility(const sptr<IRemoteObject> &tok
 
 bool UIAbilityLifecycleManager::IsContainsAbilityInner(const sptr<IRemoteObject> &token) const
 {
-    for (auto iter = sessionAbilityMap_.begin(); iter != sessionAbilityMap_.end(); iter++) {
-        if (iter->second != nullptr && iter->second->GetToken()->AsObject() == token) {
-            return true;
-        }
-    }
-    return false;
+    int32_t sessionId = 0;
+    return FindSessionIdByToken(token, sessionId);
 }
 
 int32_t UIAbilityLifecycleManager::SetGamePreLaunchCompleteTime(int64_t completeTime)
@@ -1479,11 +1474,9 @@ void UIAbilityLifecycleManager::EraseAbilityRecord(const UIAbilityRecordPtr &abi
         return;
     }
 
-    for (auto iter = sessionAbilityMap_.begin(); iter != sessionAbilityMap_.end(); iter++) {
-        if (iter->second != nullptr && iter->second->GetToken()->AsObject() == abilityRecord->GetToken()->AsObject()) {
-            sessionAbilityMap_.erase(iter);
-            break;
-        }
+    int32_t sessionId = 0;
+    if (FindSessionIdByToken(abilityRecord->GetToken()->AsObject(), sessionId)) {
+        EraseSessionRecord(sessionId);
     }
     for (auto iter = lowMemKillAbilityMap_.begin(); iter != lowMemKillAbilityMap_.end(); iter++) {
         if (iter->second != nullptr && iter->second->GetToken()->AsObject() == abilityRecord->GetToken()->AsObject()) {
@@ -1494,6 +1487,142 @@ void UIAbilityLifecycleManager::EraseAbilityRecord(const UIAbilityRecordPtr &abi
     callRequestCache_.erase(abilityRecord);
 }
 
+void UIAbilityLifecycleManager::AddSessionRecord(int32_t sessionId, const UIAbilityRecordPtr &abilityRecord)
+{
+    RemoveSessionIndex(sessionId);
+    sessionAbilityMap_[sessionId] = abilityRecord;
+    AddSessionIndex(sessionId, abilityRecord);
+}
+
+void UIAbilityLifecycleManager::EraseSessionRecord(int32_t sessionId)
+{
+    RemoveSessionIndex(sessionId);
+    sessionAbilityMap_.erase(sessionId);
+}
+
+void UIAbilityLifecycleManager::UpdateSessionPid(const sptr<IRemoteObject> &token, pid_t pid)
+{
+    int32_t sessionId = 0;
+    if (!FindSessionIdByToken(token, sessionId)) {
+        return;
+    }
+    auto &entry = sessionIndexEntries_[sessionId];
+    if (entry.pid == pid) {
+        return;
+    }
+    auto pidIter = pidIndex_.find(entry.pid);
+    if (pidIter != pidIndex_.end()) {
+        pidIter->second.erase(sessionId);
+        if (pidIter->second.empty()) {
+            pidIndex_.erase(pidIter);
+        }
+    }
+    entry.pid = pid;
+    pidIndex_[pid].insert(sessionId);
+}
+
+void UIAbilityLifecycleManager::AddSessionIndex(int32_t sessionId, const UIAbilityRecordPtr &abilityRecord)
+{
+    auto &entry = sessionIndexEntries_[sessionId];
+    if (abilityRecord == nullptr) {
+        return;
+    }
+    auto token = abilityRecord->GetToken();
+    entry.token = token != nullptr ? token->AsObject().GetRefPtr() : nullptr;
+    entry.key = MakeSessionAbilityKey(abilityRecord);
+    entry.pid = abilityRecord->GetPid();
+    if (entry.token != nullptr) {
+        tokenIndex_[entry.token] = sessionId;
+    }
+    sessionKeyIndex_[entry.key].insert(sessionId);
+    pidIndex_[entry.pid].insert(sessionId);
+}
+
+void UIAbilityLifecycleManager::RemoveSessionIndex(int32_t sessionId)
+{
+    auto entryIter = sessionIndexEntries_.find(sessionId);
+    if (entryIter == sessionIndexEntries_.end()) {
+        return;
+    }
+    const auto &entry = entryIter->second;
+    auto tokenIter = tokenIndex_.find(entry.token);
+    if (tokenIter != tokenIndex_.end() && tokenIter->second == sessionId) {
+        tokenIndex_.erase(tokenIter);
+    }
+    auto keyIter = sessionKeyIndex_.find(entry.key);
+    if (keyIter != sessionKeyIndex_.end()) {
+        keyIter->second.erase(sessionId);
+        if (keyIter->second.empty()) {
+            sessionKeyIndex_.erase(keyIter);
+        }
+    }
+    auto pidIter = pidIndex_.find(entry.pid);
+    if (pidIter != pidIndex_.end()) {
+        pidIter->second.erase(sessionId);
+        if (pidIter->second.empty()) {
+            pidIndex_.erase(pidIter);
+        }
+    }
+    sessionIndexEntries_.erase(entryIter);
+}
+
+UIAbilityRecordPtr UIAbilityLifecycleManager::GetSessionRecord(int32_t sessionId) const
+{
+    auto iter = sessionAbilityMap_.find(sessionId);
+    return iter != sessionAbilityMap_.end() ? iter->second : nullptr;
+}
+
+bool UIAbilityLifecycleManager::FindSessionIdByToken(const sptr<IRemoteObject> &token, int32_t &sessionId) const
+{
+    if (token == nullptr) {
+        return false;
+    }
+    auto iter = tokenIndex_.find(token.GetRefPtr());
+    if (iter == tokenIndex_.end()) {
+        return false;
+    }
+    sessionId = iter->second;
+    return true;
+}
+
+std::vector<int32_t> UIAbilityLifecycleManager::GetSessionIdsByKey(const SessionAbilityKey &key) const
+{
+    auto iter = sessionKeyIndex_.find(key);
+    if (iter == sessionKeyIndex_.end()) {
+        return {};
+    }
+    return std::vector<int32_t>(iter->second.begin(), iter->second.end());
+}
+
+std::vector<int32_t> UIAbilityLifecycleManager::GetSessionIdsByPid(pid_t pid) const
+{
+    auto iter = pidIndex_.find(pid);
+    if (iter == pidIndex_.end()) {
+        return {};
+    }
+    return std::vector<int32_t>(iter->second.begin(), iter->second.end());
+}
+
+SessionAbilityKey UIAbilityLifecycleManager::MakeSessionAbilityKey(const UIAbilityRecordPtr &abilityRecord)
+{
+    const auto &abilityInfo = abilityRecord->GetAbilityInfo();
+    return { abilityInfo.bundleName, abilityInfo.moduleName, abilityRecord->GetAppIndex(),
+        abilityRecord->GetInstanceKey() };
+}
+
+SessionAbilityKey UIAbilityLifecycleManager::MakeSessionAbilityKey(const AbilityRequest &abilityRequest)
+{
+    // the same app index and instance key as CheckProperties
+    int32_t appIndex = 0;
+    if (abilityRequest.isWebSandBoxClone) {
+        appIndex = abilityRequest.abilityInfo.applicationInfo.appIndex;
+    } else {
+        (void)AbilityRuntime::StartupUtil::GetAppIndex(abilityRequest.want, appIndex);
+    }
+    return { abilityRequest.abilityInfo.bundleName, abilityRequest.abilityInfo.moduleName, appIndex,
+        abilityRequest.want.GetStringParam(Want::APP_INSTANCE_KEY) };
+}
+
 void UIAbilityLifecycleManager::UpdateAbilityRecordLaunchReason(
     const AbilityRequest &abilityRequest, UIAbilityRecordPtr &abilityRecord) const
 {
@@ -1935,7 +2064,7 @@ void UIAbilityLifecycleManager::CallUIAbilityBySCB(const sptr<SessionInfo> &sess
     MoreAbilityNumbersSendEventInfo(sessionInfo->userId, sessionInfo->want.GetBundleNameRef(),
         sessionInfo->want.GetAbilityNameRef(), sessionInfo->want.GetModuleNameRef());
 
-    sessionAbilityMap_.emplace(sessionInfo->persistentId, uiAbilityRecord);
+    AddSessionRecord(sessionInfo->persistentId, uiAbilityRecord);
     uiAbilityRecord->SetSessionInfo(sessionInfo);
     SetLastExitReasonAsync(uiAbilityRecord);
     if (sessionInfo->state == CallToState::BACKGROUND) {
@@ -2554,10 +2683,10 @@ int32_t UIAbilityLifecycleManager::GetPersistentIdByAbilityRequest(const Ability
     }
 
     reuse = true;
-    for (const auto& [first, second] : sessionAbilityMap_) {
-        if (CheckProperties(second, abilityRequest, AppExecFwk::LaunchMode::SINGLETON)) {
+    for (auto sessionId : GetSessionIdsByKey(MakeSessionAbilityKey(abilityRequest))) {
+        if (CheckProperties(GetSessionRecord(sessionId), abilityRequest, AppExecFwk::LaunchMode::SINGLETON)) {
             TAG_LOGD(AAFwkTag::ABILITYMGR, "SINGLETON: find.");
-            return first;
+            return sessionId;
         }
     }
 
@@ -2576,11 +2705,12 @@ int32_t UIAbilityLifecycleManager::GetReusedSpecifiedPersistentId(const AbilityR
 
     reuse = true;
     // specified ability name and bundle name and module name and appIndex format is same as singleton.
-    for (const auto& [first, second] : sessionAbilityMap_) {
-        if (second->GetSpecifiedFlag() == abilityRequest.specifiedFlag &&
-            CheckProperties(second, abilityRequest, AppExecFwk::LaunchMode::SPECIFIED)) {
+    for (auto sessionId : GetSessionIdsByKey(MakeSessionAbilityKey(abilityRequest))) {
+        auto abilityRecord = GetSessionRecord(sessionId);
+        if (abilityRecord && abilityRecord->GetSpecifiedFlag() == abilityRequest.specifiedFlag &&
+            CheckProperties(abilityRecord, abilityRequest, AppExecFwk::LaunchMode::SPECIFIED)) {
             TAG_LOGD(AAFwkTag::ABILITYMGR, "SPECIFIED: find.");
-            return first;
+            return sessionId;
         }
     }
     return 0;
@@ -2603,11 +2733,12 @@ int32_t UIAbilityLifecycleManager::GetReusedStandardPersistentId(const AbilityRe
     reuse = true;
     int64_t sessionTime = 0;
     int32_t persistentId = 0;
-    for (const auto& [first, second] : sessionAbilityMap_) {
-        if (CheckProperties(second, abilityRequest, AppExecFwk::LaunchMode::STANDARD) &&
-            second->GetRestartTime() >= sessionTime) {
-            persistentId = first;
-            sessionTime = second->GetRestartTime();
+    for (auto sessionId : GetSessionIdsByKey(MakeSessionAbilityKey(abilityRequest))) {
+        auto abilityRecord = GetSessionRecord(sessionId);
+        if (CheckProperties(abilityRecord, abilityRequest, AppExecFwk::LaunchMode::STANDARD) &&
+            abilityRecord->GetRestartTime() >= sessionTime) {
+            persistentId = sessionId;
+            sessionTime = abilityRecord->GetRestartTime();
         }
     }
     return persistentId;
@@ -3416,10 +3547,9 @@ int32_t UIAbilityLifecycleManager::GetSessionIdByAbilityToken(const sptr<IRemote
 {
     HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
     std::lock_guard<ffrt::mutex> guard(sessionLock_);
-    for (const auto& [first, second] : sessionAbilityMap_) {
-        if (second && second->GetToken()->AsObject() == token) {
-            return first;
-        }
+    int32_t sessionId = 0;
+    if (FindSessionIdByToken(token, sessionId)) {
+        return sessionId;
     }
     TAG_LOGE(AAFwkTag::ABILITYMGR, "not find");
     return 0;
@@ -3689,7 +3819,8 @@ void UIAbilityLifecycleManager::HandleColdStartState(const AppInfo &info)
 
 void UIAbilityLifecycleManager::HandleOtherAppState(const AppInfo &info)
 {
-    for (const auto &[sessionId, abilityRecord] : sessionAbilityMap_) {
+    for (auto sessionId : GetSessionIdsByPid(info.pid)) {
+        auto abilityRecord = GetSessionRecord(sessionId);
         if (abilityRecord == nullptr) {
             TAG_LOGW(AAFwkTag::ABILITYMGR, "null abilityRecord");
             continue;
@@ -4373,8 +4504,11 @@ void UIAbilityLifecycleManager::SignRestartAppFlag(int32_t uid, const std::strin
 void UIAbilityLifecycleManager::SignRestartProcess(int32_t pid)
 {
     std::lock_guard guard(sessionLock_);
-    auto tempSessionAbilityMap = sessionAbilityMap_;
-    for (auto &[sessionId, abilityRecord] : tempSessionAbilityMap) {
+    std::vector<UIAbilityRecordPtr> abilityRecords;
+    for (auto sessionId : GetSessionIdsByPid(pid)) {
+        abilityRecords.push_back(GetSessionRecord(sessionId));
+    }
+    for (auto &abilityRecord : abilityRecords) {
         if (abilityRecord == nullptr || abilityRecord->GetPid() != pid) {
             continue;
         }
@@ -4483,15 +4617,12 @@ UIAbilityRecordPtr UIAbilityLifecycleManager::FindRecordFromSessionMap(
     } else {
         appIndex = abilityRequest.abilityInfo.appIndex;
     }
-    auto instanceKey = abilityRequest.want.GetStringParam(Want::APP_INSTANCE_KEY);
-    for (const auto &[sessionId, abilityRecord] : sessionAbilityMap_) {
-        if (abilityRecord) {
-            const auto &info = abilityRecord->GetAbilityInfo();
-            if (info.bundleName == abilityRequest.abilityInfo.bundleName &&
-                info.moduleName == abilityRequest.abilityInfo.moduleName &&
-                appIndex == abilityRecord->GetAppIndex() && instanceKey == abilityRecord->GetInstanceKey()) {
-                return abilityRecord;
-            }
+    SessionAbilityKey key = { abilityRequest.abilityInfo.bundleName, abilityRequest.abilityInfo.moduleName,
+        appIndex, abilityRequest.want.GetStringParam(Want::APP_INSTANCE_KEY) };
+    for (auto sessionId : GetSessionIdsByKey(key)) {
+        auto abilityRecord = GetSessionRecord(sessionId);
+        if (abilityRecord && MakeSessionAbilityKey(abilityRecord) == key) {
+            return abilityRecord;
         }
     }
     return nullptr;
@@ -4942,7 +5073,8 @@ void UIAbilityLifecycleManager::SendAbilityEvent(const AppExecFwk::AbilityInfo &
 void UIAbilityLifecycleManager::HandleUIAbilityDiedByPid(pid_t pid)
 {
     std::lock_guard<ffrt::mutex> guard(sessionLock_);
-    for (const auto &[key, abilityRecord] : sessionAbilityMap_) {
+    for (auto sessionId : GetSessionIdsByPid(pid)) {
+        auto abilityRecord = GetSessionRecord(sessionId);
         if (abilityRecord && pid == abilityRecord->GetPid()) {
             abilityRecord->OnProcessDied(true);
         }
@@ -126,11 +126,13 @@ bool TaskDataPersistenceMgr::SaveMissionSnapshot(int missionId, const MissionSna
         return false;
     }
 
+    // queue before submit, so a snapshot still waiting for the handler is dropped when a newer one comes
+    uint64_t generation = currentMissionDataStorage_->QueueMissionSnapshot(missionId, snapshot);
     std::weak_ptr<MissionDataStorage> weakPtr(currentMissionDataStorage_);
-    std::function<void()> SaveMissionSnapshotFunc = [weakPtr, missionId, snapshot]() {
+    std::function<void()> SaveMissionSnapshotFunc = [weakPtr, missionId, generation]() {
         auto missionDataStorage = weakPtr.lock();
         if (missionDataStorage) {
-            missionDataStorage->SaveMissionSnapshot(missionId, snapshot);
+            missionDataStorage->SaveQueuedSnapshot(missionId, generation);
         }
     };
     handler_->SubmitTask(SaveMissionSnapshotFunc, SAVE_MISSION_SNAPSHOT);
@@ -148,6 +150,15 @@ std::shared_ptr<Media::PixelMap> TaskDataPersistenceMgr::GetSnapshot(int mission
 }
 #endif
 
+void TaskDataPersistenceMgr::DumpSnapshotStats(std::vector<std::string> &info)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (!currentMissionDataStorage_) {
+        return;
+    }
+    currentMissionDataStorage_->DumpSnapshotStats(info);
+}
+
 bool TaskDataPersistenceMgr::GetMissionSnapshot(int missionId, MissionSnapshot& snapshot, bool isLowResolution)
 {
     HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
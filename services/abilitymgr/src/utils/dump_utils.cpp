@@ -131,7 +131,11 @@ void DumpUtils::ShowHelp(std::string& result)
         .append("-r                          ")
         .append("dump all process in the system\n")
         .append("-d                          ")
-        .append("dump all data ability information in the system");
+        .append("dump all data ability information in the system\n")
+        .append("--ipc-dispatch              ")
+        .append("dump call count and latency of each ipc code\n")
+        .append("--interceptor               ")
+        .append("dump call count and latency of each start interceptor");
 }
 }  // namespace AAFwk
 }  // namespace OHOS
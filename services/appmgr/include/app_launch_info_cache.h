@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_RUNTIME_APP_LAUNCH_INFO_CACHE_H
+#define OHOS_ABILITY_RUNTIME_APP_LAUNCH_INFO_CACHE_H
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "app_spawn_client.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * Bundle manager query results used to build the start message of an application process.
+ * Overlay modules are not kept, they are enabled and disabled without any bundle change.
+ */
+struct AppLaunchInfo {
+    HspList hspList;
+    DataGroupInfoList dataGroupInfoList;
+};
+
+struct AppLaunchInfoKey {
+    std::string bundleName;
+    int32_t userId = 0;
+    int32_t appIndex = 0;
+    uint32_t versionCode = 0;
+
+    bool operator<(const AppLaunchInfoKey &other) const
+    {
+        return std::tie(bundleName, userId, appIndex, versionCode) <
+            std::tie(other.bundleName, other.userId, other.appIndex, other.versionCode);
+    }
+};
+
+/**
+ * @class AppLaunchInfoCache
+ * Launch info of the applications started before. Shared bundles and data groups may come from
+ * other bundles, so any bundle change drops the whole cache. A query that started before the drop is not
+ * stored, the generation it got on miss is out of date.
+ */
+class AppLaunchInfoCache {
+public:
+    AppLaunchInfoCache() = default;
+    ~AppLaunchInfoCache() = default;
+
+    /**
+     * @brief Look up the launch info, counted as a hit or a miss.
+     * @param generation Output, pass it to Put after a miss.
+     * @return Returns true on hit.
+     */
+    bool Get(const AppLaunchInfoKey &key, AppLaunchInfo &info, uint64_t &generation);
+
+    /**
+     * @brief Store the launch info queried after a miss.
+     * @param costUs Time spent on the queries, used to estimate the time saved by hits.
+     */
+    void Put(const AppLaunchInfoKey &key, const AppLaunchInfo &info, uint64_t generation, int64_t costUs);
+
+    void Clear();
+
+    void Dump(std::string &result);
+
+private:
+    std::mutex mutex_;
+    uint64_t generation_ = 0;
+    std::map<AppLaunchInfoKey, AppLaunchInfo> infos_;
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+    uint64_t measuredMisses_ = 0;
+    uint64_t totalMissCostUs_ = 0;
+    uint64_t clears_ = 0;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // OHOS_ABILITY_RUNTIME_APP_LAUNCH_INFO_CACHE_H
@@ -33,6 +33,7 @@
 #include "app_debug_listener_interface.h"
 #include "app_debug_manager.h"
 #include "app_foreground_state_observer_interface.h"
+#include "app_launch_info_cache.h"
 #include "app_malloc_info.h"
 #include "app_mgr_constants.h"
 #include "app_mgr_event.h"
@@ -72,6 +73,7 @@
 #include "istart_specified_ability_response.h"
 #include "kia_interceptor_interface.h"
 #include "kill_process_config.h"
+#include "overlay_module_info.h"
 #include "process_memory_state.h"
 #include "process_options.h"
 #include "process_util.h"
@@ -1667,6 +1669,11 @@ public:
 
     virtual int DumpIpcAllStat(std::string& result);
 
+    /**
+     * Dump hit rate and saved time of the launch info cache.
+     */
+    void DumpLaunchInfoCache(std::string& result);
+
     virtual int DumpIpcStart(const int32_t pid, std::string& result);
 
     virtual int DumpIpcStop(const int32_t pid, std::string& result);
@@ -2228,6 +2235,9 @@ private:
     void KillRenderProcess(const std::shared_ptr<AppRunningRecord> &appRecord);
 
     void SetOverlayInfo(const std::string& bundleName, const int32_t userId, AppSpawnStartMsg& startMsg);
+    static void SetOverlayInfo(const std::vector<OverlayModuleInfo>& overlayModuleInfos, AppSpawnStartMsg& startMsg);
+    void QueryOverlayModuleInfos(const std::string& bundleName, const int32_t userId,
+        std::vector<OverlayModuleInfo>& overlayModuleInfos);
     void SetAppEnvInfo(const BundleInfo &bundleInfo, AppSpawnStartMsg& startMsg);
 
     void TimeoutNotifyApp(int32_t pid, int32_t uid, const std::string& bundleName, const std::string& processName,
@@ -2310,6 +2320,18 @@ private:
      */
     int32_t CreateStartMsg(const CreateStartMsgParam &param, AppSpawnStartMsg &startMsg);
 
+    /**
+     * Get shared bundles and data groups of the bundle from the launch info cache, query them from bundle
+     * manager in parallel on miss. Overlays are not cached and are queried on every call.
+     */
+    int32_t GetLaunchInfo(const CreateStartMsgParam &param, int32_t userId, AppLaunchInfo &launchInfo,
+        std::vector<OverlayModuleInfo> &overlayModuleInfos);
+
+    /**
+     * Drop the spawn request templates of the bundle kept by the spawn clients.
+     */
+    void ClearSpawnMsgTemplates(const std::string &bundleName);
+
     void SetStartMsgStrictMode(AppSpawnStartMsg &startMsg, const CreateStartMsgParam &param);
 
     void SetAppRunningRecordStrictMode(std::shared_ptr<AppRunningRecord> appRecord,
@@ -2501,6 +2523,7 @@ private:
     void UnMarkTemplateProcess(int32_t templatePid);
 
     std::shared_ptr<RemoteClientManager> remoteClientManager_;
+    AppLaunchInfoCache launchInfoCache_;
     std::shared_ptr<AppRunningManager> appRunningManager_;
     std::shared_ptr<AAFwk::TaskHandlerWrap> taskHandler_;
     std::shared_ptr<AAFwk::TaskHandlerWrap> rssTaskHandler_;
@@ -20,6 +20,9 @@
 #include <mutex>
 #include <regex>
 #include <set>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "ability_info.h"
 #include "app_debug_listener_interface.h"
@@ -57,6 +60,8 @@ namespace AppExecFwk {
 
 class AppRunningManager : public std::enable_shared_from_this<AppRunningManager> {
 public:
+    using AppRunningRecordMap = std::map<const int32_t, const std::shared_ptr<AppRunningRecord>>;
+
     AppRunningManager();
     virtual ~AppRunningManager();
     /**
@@ -204,6 +209,24 @@ public:
      */
     std::shared_ptr<AppRunningRecord> GetAppRunningRecordByAbilityToken(const sptr<IRemoteObject> &abilityToken);
 
+    /**
+     * GetAppRunningRecordsByUid, Get process records by uid, ordered by record id.
+     *
+     * @param uid, the process uid.
+     *
+     * @return process records.
+     */
+    std::vector<std::shared_ptr<AppRunningRecord>> GetAppRunningRecordsByUid(int32_t uid);
+
+    /**
+     * GetAppRunningRecordsByBundleName, Get process records by main bundle name, ordered by record id.
+     *
+     * @param bundleName, the main bundle name of the process.
+     *
+     * @return process records.
+     */
+    std::vector<std::shared_ptr<AppRunningRecord>> GetAppRunningRecordsByBundleName(const std::string &bundleName);
+
     /**
      * OnRemoteDied, Equipment death notification.
      *
@@ -221,6 +244,32 @@ public:
      */
     std::map<const int32_t, const std::shared_ptr<AppRunningRecord>> GetAppRunningRecordMap();
 
+    /**
+     * GetAppRunningRecordSnapshot, Get an immutable snapshot of application record list.
+     * The snapshot is shared by all readers and only rebuilt after the record list changes.
+     *
+     * @return the application record list snapshot, never nullptr.
+     */
+    std::shared_ptr<const AppRunningRecordMap> GetAppRunningRecordSnapshot();
+
+    /**
+     * AddAppRunningRecord, Put an application record into the record list and index it.
+     * Records must be added and removed through the manager, lookups do not scan the record list.
+     *
+     * @param recordId, the application record id.
+     * @param appRecord, the application record.
+     * @return true if the record is added, false if the record id is in use.
+     */
+    bool AddAppRunningRecord(const int32_t recordId, const std::shared_ptr<AppRunningRecord> &appRecord);
+
+    /**
+     * SetAppRunningRecordPid, Set the pid of an application record and keep the pid index in step.
+     *
+     * @param appRecord, the application record.
+     * @param pid, the pid of the application process.
+     */
+    void SetAppRunningRecordPid(const std::shared_ptr<AppRunningRecord> &appRecord, const pid_t pid);
+
     /**
      * RemoveAppRunningRecordById, Remove application information through application id.
      *
@@ -501,10 +550,49 @@ private:
         Rosen::ConfigMode configMode, ConfigUpdateReason reason = ConfigUpdateReason::CONFIG_UPDATE_REASON_DEFAULT);
     bool IsSameAbilityType(
         const std::shared_ptr<AppRunningRecord> &appRecord, const AppExecFwk::AbilityInfo &abilityInfo);
+
+    // Secondary indexes of appRunningRecordMap_, caller must hold runningRecordMapMutex_.
+    void AddRecordIndexLocked(const int32_t recordId, const std::shared_ptr<AppRunningRecord> &appRecord);
+    void RemoveRecordIndexLocked(const int32_t recordId, const std::shared_ptr<AppRunningRecord> &appRecord);
+    void ClearRecordIndexLocked();
+    void WatchRecordChange(const std::shared_ptr<AppRunningRecord> &appRecord);
+    void OnAppRunningRecordUidChanged(int32_t recordId, int32_t newUid, const std::function<int32_t()> &exchangeUid);
+    void OnAppRunningRecordAbilityChanged(int32_t recordId, const sptr<IRemoteObject> &token, bool isAdded);
+    std::shared_ptr<AppRunningRecord> FindRecordByPidLocked(const pid_t pid);
+    std::shared_ptr<AppRunningRecord> FindRecordByAbilityTokenLocked(const sptr<IRemoteObject> &abilityToken);
+    std::vector<std::shared_ptr<AppRunningRecord>> FindRecordsByUidLocked(int32_t uid);
+    std::vector<std::shared_ptr<AppRunningRecord>> FindRecordsByBundleNameLocked(const std::string &bundleName);
+    void CollectRecordsLocked(const std::set<int32_t> &recordIds,
+        std::vector<std::shared_ptr<AppRunningRecord>> &records);
+    struct AppRunningRecordSnapshot {
+        uint64_t version = 0;
+        std::shared_ptr<const AppRunningRecordMap> records;
+    };
+    void BumpRecordVersionLocked();
+    bool IsRecordSnapshotValidLocked(const std::shared_ptr<const AppRunningRecordSnapshot> &snapshot) const;
 private:
-    std::mutex runningRecordMapMutex_;
+    std::shared_mutex runningRecordMapMutex_;
     std::map<const int32_t, const std::shared_ptr<AppRunningRecord>> appRunningRecordMap_;
 
+    // kept in step by the add and remove paths, SetAppRunningRecordPid and the uid and ability handlers of the
+    // records, a record missing from them is not found. Each entry keeps the keys of its record to erase on removal.
+    struct RecordIndexEntry {
+        pid_t pid = 0;
+        std::unordered_set<IRemoteObject *> abilityTokens;
+    };
+    std::mutex recordIndexLock_;
+    std::unordered_map<int32_t, RecordIndexEntry> recordIndexEntries_;
+    std::unordered_map<pid_t, int32_t> pidIndex_;
+    std::unordered_map<IRemoteObject *, int32_t> abilityTokenIndex_;
+    std::unordered_map<int32_t, std::set<int32_t>> uidIndex_;
+    std::unordered_map<std::string, std::set<int32_t>> bundleNameIndex_;
+
+    // increased by every change of appRunningRecordMap_, caller must hold runningRecordMapMutex_ exclusively.
+    uint64_t recordVersion_ = 0;
+    // copy-on-write snapshot of appRunningRecordMap_, rebuilt lazily by the first reader after a change.
+    // read and written with std::atomic_load and std::atomic_store under the shared runningRecordMapMutex_.
+    std::shared_ptr<const AppRunningRecordSnapshot> recordSnapshot_;
+
     std::mutex uiExtensionMapLock_;
     std::map<int32_t, std::pair<pid_t, pid_t>> uiExtensionLauncherMap_;
 
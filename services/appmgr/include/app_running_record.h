@@ -17,6 +17,7 @@
 #define OHOS_ABILITY_RUNTIME_APP_RUNNING_RECORD_H
 
 #include <atomic>
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
@@ -247,6 +248,26 @@ public:
      */
     void SetUid(const int32_t uid);
 
+    using UidChangedHandler = std::function<void(int32_t recordId, int32_t newUid,
+        const std::function<int32_t()> &exchangeUid)>;
+    /**
+     * @brief Set the handler applying application uid changes, used to keep uid indexes consistent.
+     * The handler calls exchangeUid, which sets the new uid and returns the old one, under the lock of its index.
+     *
+     * @param handler, the uid changed handler.
+     */
+    void SetUidChangedHandler(UidChangedHandler handler);
+
+    using AbilityChangedHandler = std::function<void(int32_t recordId, const sptr<IRemoteObject> &token,
+        bool isAdded)>;
+    /**
+     * @brief Set the handler told about abilities added to or terminated in the application, used to keep
+     * ability token indexes consistent.
+     *
+     * @param handler, the ability changed handler.
+     */
+    void SetAbilityChangedHandler(AbilityChangedHandler handler);
+
     /**
      * @brief Set preload attach timeout start time.
      */
@@ -1371,6 +1392,7 @@ private:
     void RemoveEvent(uint32_t msg);
 
     void RemoveModuleRecord(const std::shared_ptr<ModuleRunningRecord> &record, bool isExtensionDebug = false);
+    void NotifyAbilityChanged(const sptr<IRemoteObject> &token, bool isAdded);
     int32_t GetAddStageTimeout() const;
     void SetModuleLoaded(const std::string &moduleName) const;
 
@@ -1447,6 +1469,10 @@ private:
     std::atomic<bool> isPreForeground_ = false;
     std::atomic<bool> processCacheLocked_ = false;
     std::atomic<int32_t> mainUid_ = -1;
+    std::mutex uidChangedHandlerLock_;
+    UidChangedHandler uidChangedHandler_;
+    std::mutex abilityChangedHandlerLock_;
+    AbilityChangedHandler abilityChangedHandler_;
     std::atomic<int32_t> specifiedProcessRequestId_ = -1;
     ProcessType processType_ = ProcessType::NORMAL;
     ExtensionAbilityType extensionType_ = ExtensionAbilityType::UNSPECIFIED;
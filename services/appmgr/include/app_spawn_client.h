@@ -19,6 +19,7 @@
 #include <array>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <unistd.h>
@@ -100,6 +101,22 @@ struct AppSpawnStartMsg {
     bool isCustomSandboxFlag = false;
 };
 
+/**
+ * Serialized extension infos of a spawn request that only change with the bundle, with the inputs they are
+ * built from. A template is used for a request only if the request carries the same inputs.
+ */
+struct SpawnMsgTemplate {
+    HspList hspList;
+    DataGroupInfoList dataGroupInfoList;
+    bool isScreenLockDataProtect = false;
+    std::map<std::string, std::string> appEnv;
+    JITPermissionsMap jitPermissionsMap;
+    std::string hspListJson;
+    std::string dataGroupInfoListJson;
+    std::string appEnvJson;
+    std::string jitPermissionsJson;
+};
+
 constexpr auto LEN_PID = sizeof(pid_t);
 struct StartFlags {
     static const int COLD_START = 0;
@@ -283,10 +300,25 @@ public:
      */
     virtual int32_t GetRenderProcessTerminationStatus(const AppSpawnStartMsg &startMsg, int &status);
 
+    /**
+     * Drop the spawn request templates of a bundle, called when the bundle changes.
+     *
+     * @param bundleName, the bundle name.
+     */
+    void ClearSpawnMsgTemplates(const std::string &bundleName);
+
 private:
     std::string serviceName_ = APPSPAWN_SERVER_NAME;
     AppSpawnClientHandle handle_ = nullptr;
     SpawnConnectionState state_ = SpawnConnectionState::STATE_NOT_CONNECT;
+    std::mutex spawnMsgTemplateMutex_;
+    // bundle name and uid to the template of its last start
+    std::map<std::pair<std::string, int32_t>, std::shared_ptr<const SpawnMsgTemplate>> spawnMsgTemplates_;
+
+    /**
+     * Get the template matching the bundle infos of startMsg, build and keep a new one if there is none.
+     */
+    std::shared_ptr<const SpawnMsgTemplate> GetSpawnMsgTemplate(const AppSpawnStartMsg &startMsg);
 
 #ifdef SUPPORT_CHILD_PROCESS
     int32_t SetChildProcessTypeStartFlag(const AppSpawnReqMsgHandle &reqHandle, int32_t childProcessType);
@@ -16,8 +16,11 @@
 #ifndef OHOS_ABILITY_RUNTIME_APP_STATE_OBSERVER_MANAGER_H
 #define OHOS_ABILITY_RUNTIME_APP_STATE_OBSERVER_MANAGER_H
 
+#include <chrono>
+#include <functional>
 #include <map>
 #include <mutex>
+#include <set>
 #include <string>
 #include <unordered_map>
 
@@ -49,6 +52,12 @@ struct AppStateObserverInfo {
     AppStateFilter appStateFilter;
 };
 
+struct AppStateObserverTarget {
+    sptr<IApplicationStateObserver> observer;
+    int32_t uid = 0;
+    AppStateFilter appStateFilter;
+};
+
 using AppStateObserverMap = std::map<sptr<IApplicationStateObserver>, AppStateObserverInfo>;
 using AppForegroundStateObserverMap = std::map<sptr<IAppForegroundStateObserver>, int32_t>;
 using AbilityForegroundObserverMap = std::map<sptr<IAbilityForegroundStateObserver>, int32_t>;
@@ -105,6 +114,7 @@ public:
     void OnImageProcessStateChanged(std::shared_ptr<ForkImageInfo> imageInfo, ImageProcessState state);
     void OnForkAllWorkProcessFailed(std::shared_ptr<ForkImageInfo> imageInfo, int32_t errCode);
     void OnPreForkAllWorkProcess(std::shared_ptr<ForkImageInfo> imageInfo);
+    void DumpAppStateDeliveryStat(std::string &result);
 
 private:
     void HandleOnWindowShow(const std::shared_ptr<AppRunningRecord> &appRecord);
@@ -166,8 +176,52 @@ private:
     void HandleOnImageProcessStateChanged(std::shared_ptr<ImageProcessStateData> data);
     void HandleOnForkAllWorkProcessFailed(std::shared_ptr<ImageProcessStateData> data, int32_t errCode);
     void HandleOnPreForkAllWorkProcess(std::shared_ptr<ImageProcessStateData> data);
+    std::vector<AppStateObserverTarget> GetAppStateObserversByBundleName(const std::string &bundleName);
+    // caller must hold observerLock_, the bundle index changes together with appStateObserverMap_.
+    void AddAppStateObserverLocked(const sptr<IApplicationStateObserver> &observer, const AppStateObserverInfo &info);
+    void EraseAppStateObserverLocked(AppStateObserverMap::iterator iter);
 
 private:
+    // every callback of an application state observer goes through one queue per observer, so the observer
+    // sees them in the order they happened. Process, ability and other callbacks are kept as OBSERVER_CALLBACK.
+    enum class AppStateCallback : uint8_t {
+        APP_STARTED,
+        APP_STOPPED,
+        APPLICATION_STATE_CHANGED,
+        FOREGROUND_APPLICATION_CHANGED,
+        APP_STATE_CHANGED,
+        OBSERVER_CALLBACK,
+    };
+    using ObserverCallback = std::function<void(const sptr<IApplicationStateObserver> &observer)>;
+    struct PendingAppState {
+        AppStateCallback callback;
+        AppStateData data;
+        ObserverCallback deliver;
+        std::chrono::steady_clock::time_point enqueueTime;
+    };
+
+    void EnqueueAppStateCallback(const sptr<IApplicationStateObserver> &observer, AppStateCallback callback,
+        const AppStateData &data);
+    void EnqueueObserverCallback(const sptr<IApplicationStateObserver> &observer, ObserverCallback deliver);
+    void EnqueuePendingAppState(const sptr<IApplicationStateObserver> &observer, PendingAppState &&item);
+    void FlushAppStateQueue(const sptr<IApplicationStateObserver> &observer);
+    void RemoveAppStateQueue(const sptr<IApplicationStateObserver> &observer);
+    static void DeliverAppStateCallback(const sptr<IApplicationStateObserver> &observer,
+        const PendingAppState &item);
+
+    struct AppStateDeliveryQueue {
+        std::vector<PendingAppState> pending;
+        bool flushScheduled = false;
+    };
+    struct AppStateDeliveryStat {
+        uint64_t enqueued = 0;
+        uint64_t batches = 0;
+        uint64_t delivered = 0;
+        uint64_t totalLatencyUs = 0;
+        uint64_t maxLatencyUs = 0;
+        size_t maxQueueDepth = 0;
+    };
+
     std::shared_ptr<AAFwk::TaskHandlerWrap> handler_;
     AppStateObserverMap appStateObserverMap_;
     AppForegroundStateObserverMap appForegroundStateObserverMap_;
@@ -183,6 +237,14 @@ private:
 
     ffrt::mutex imageProcessObserverLock_;
     ImageProcessObserverMap imageProcessStateObserverMap_;
+
+    // guarded by observerLock_, kept in step by AddAppStateObserverLocked and EraseAppStateObserverLocked
+    std::unordered_map<std::string, std::set<sptr<IApplicationStateObserver>>> bundleObserverIndex_;
+    std::set<sptr<IApplicationStateObserver>> allBundleObservers_;
+
+    ffrt::mutex appStateDeliveryLock_;
+    std::map<sptr<IApplicationStateObserver>, AppStateDeliveryQueue> appStateDeliveryQueues_;
+    AppStateDeliveryStat appStateDeliveryStat_;
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "app_launch_info_cache.h"
+
+#include "hilog_tag_wrapper.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+constexpr size_t MAX_LAUNCH_INFO_COUNT = 256;
+}
+
+bool AppLaunchInfoCache::Get(const AppLaunchInfoKey &key, AppLaunchInfo &info, uint64_t &generation)
+{
+    std::lock_guard lock(mutex_);
+    generation = generation_;
+    auto iter = infos_.find(key);
+    if (iter == infos_.end()) {
+        misses_++;
+        return false;
+    }
+    hits_++;
+    info = iter->second;
+    return true;
+}
+
+void AppLaunchInfoCache::Put(const AppLaunchInfoKey &key, const AppLaunchInfo &info, uint64_t generation,
+    int64_t costUs)
+{
+    std::lock_guard lock(mutex_);
+    if (costUs >= 0) {
+        measuredMisses_++;
+        totalMissCostUs_ += static_cast<uint64_t>(costUs);
+    }
+    if (generation != generation_) {
+        TAG_LOGD(AAFwkTag::APPMGR, "%{public}s changed during query", key.bundleName.c_str());
+        return;
+    }
+    if (infos_.size() >= MAX_LAUNCH_INFO_COUNT && infos_.find(key) == infos_.end()) {
+        infos_.clear();
+    }
+    infos_[key] = info;
+}
+
+void AppLaunchInfoCache::Clear()
+{
+    std::lock_guard lock(mutex_);
+    generation_++;
+    if (!infos_.empty()) {
+        clears_++;
+        infos_.clear();
+    }
+}
+
+void AppLaunchInfoCache::Dump(std::string &result)
+{
+    std::lock_guard lock(mutex_);
+    uint64_t lookups = hits_ + misses_;
+    uint64_t hitRate = (lookups == 0) ? 0 : hits_ * 100 / lookups; // 100: percent
+    uint64_t avgMissCostUs = (measuredMisses_ == 0) ? 0 : totalMissCostUs_ / measuredMisses_;
+    result.append("launch info cache:\n")
+        .append("  entries: ").append(std::to_string(infos_.size())).append("\n")
+        .append("  hits: ").append(std::to_string(hits_)).append("\n")
+        .append("  misses: ").append(std::to_string(misses_)).append("\n")
+        .append("  hit rate(%): ").append(std::to_string(hitRate)).append("\n")
+        .append("  avg miss cost(us): ").append(std::to_string(avgMissCostUs)).append("\n")
+        .append("  saved time(us): ").append(std::to_string(avgMissCostUs * hits_)).append("\n")
+        .append("  invalidations: ").append(std::to_string(clears_)).append("\n");
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
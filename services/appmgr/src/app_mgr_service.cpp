@@ -25,6 +25,7 @@
 #include "ability_manager_xcollie.h"
 #include "app_death_recipient.h"
 #include "app_mgr_constants.h"
+#include "app_state_observer_manager.h"
 #include "app_utils.h"
 #include "application_state_filter.h"
 #include "datetime_ex.h"
@@ -54,6 +55,9 @@ constexpr const char* OPTION_KEY_HELP = "-h";
 constexpr const char* OPTION_KEY_DUMP_IPC = "--ipc";
 constexpr const char* OPTION_KEY_DUMP_FFRT = "--ffrt";
 constexpr const char* OPTION_KEY_DUMP_WEB = "--web";
+constexpr const char* OPTION_KEY_DUMP_IPC_DISPATCH = "--ipc-dispatch";
+constexpr const char* OPTION_KEY_DUMP_APP_STATE_DELIVERY = "--app-state-delivery";
+constexpr const char* OPTION_KEY_DUMP_LAUNCH_INFO_CACHE = "--launch-info-cache";
 const int32_t HIDUMPER_SERVICE_UID = 1212;
 constexpr int32_t RESOURCE_MANAGER_UID = 1096;
 constexpr const int INDEX_PID = 1;
@@ -964,6 +968,21 @@ int AppMgrService::Dump(const std::vector<std::u16string>& args, std::string& re
     if (optionKey == OPTION_KEY_DUMP_WEB) {
         return DumpArkWeb(args, result);
     }
+    if (optionKey == OPTION_KEY_DUMP_IPC_DISPATCH) {
+        DumpIpcDispatchStat(result);
+        return ERR_OK;
+    }
+    if (optionKey == OPTION_KEY_DUMP_APP_STATE_DELIVERY) {
+        DelayedSingleton<AppStateObserverManager>::GetInstance()->DumpAppStateDeliveryStat(result);
+        return ERR_OK;
+    }
+    if (optionKey == OPTION_KEY_DUMP_LAUNCH_INFO_CACHE) {
+        if (appMgrServiceInner_ == nullptr) {
+            return DumpErrorCode::ERR_INTERNAL_ERROR;
+        }
+        appMgrServiceInner_->DumpLaunchInfoCache(result);
+        return ERR_OK;
+    }
     result.append("error: unkown option.\n");
     TAG_LOGE(AAFwkTag::APPMGR, "option key %{public}s does not exist", optionKey.c_str());
     return DumpErrorCode::ERR_UNKNOWN_OPTION_ERROR;
@@ -980,7 +999,13 @@ int AppMgrService::ShowHelp(const std::vector<std::u16string>& args, std::string
         .append("ipc load statistic; pid must be specified or set to -a dump all processes. ARG must be one of "
             "--start-stat | --stop-stat | --stat\n")
         .append("--web pid1[,pid2,pid3] [ARG]    ")
-        .append("dump arkweb info, ARG must be one of (--all | --nweb | ...)\n");
+        .append("dump arkweb info, ARG must be one of (--all | --nweb | ...)\n")
+        .append("--ipc-dispatch              ")
+        .append("dump call count and latency of each ipc code handled by appmgr\n")
+        .append("--app-state-delivery        ")
+        .append("dump queue depth and delivery latency of app state observer callbacks\n")
+        .append("--launch-info-cache         ")
+        .append("dump hit rate and saved time of the launch info cache\n");
 
     return ERR_OK;
 }
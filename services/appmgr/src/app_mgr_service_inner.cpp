@@ -1466,7 +1466,7 @@ std::shared_ptr<AppRunningRecord> AppMgrServiceInner::CreateAppRunningRecordFrom
         appRecord->SetExtensionSandBoxFlag(imageAppRecord->GetExtensionSandBoxFlag());
         appRecord->SetMainProcess(imageAppRecord->IsMainProcess());
         appRecord->SetJITEnabled(imageAppRecord->IsJITEnabled());
-        appRecord->GetPriorityObject()->SetPid(imageAppRecord->GetPid());
+        appRunningManager_->SetAppRunningRecordPid(appRecord, imageAppRecord->GetPid());
         appRecord->SetUid(imageAppRecord->GetUid());
         appRecord->SetStartMsg(imageAppRecord->GetStartMsg());
         appRecord->SetAppMgrServiceInner(weak_from_this());
@@ -3295,10 +3295,12 @@ int32_t AppMgrServiceInner::UpdateApplicationInfoInstalled(
         return result;
     }
 
+    launchInfoCache_.Clear();
     if (remoteClientManager_ == nullptr) {
         TAG_LOGE(AAFwkTag::APPMGR, "remoteClientManager_ fail");
         return ERR_NO_INIT;
     }
+    ClearSpawnMsgTemplates(bundleName);
 
     auto bundleMgrHelper = remoteClientManager_->GetBundleManagerHelper();
     if (bundleMgrHelper == nullptr) {
@@ -3627,6 +3629,8 @@ int32_t AppMgrServiceInner::NotifyUninstallOrUpgradeApp(const std::string &bundl
         "bundleName: %{public}s, uid: %{public}d", bundleName.c_str(), uid);
     std::unique_lock lock(startProcessLock_);
     std::string killReason = isUpgrade ? "UpgradeApp" : "UninstallApp";
+    launchInfoCache_.Clear();
+    ClearSpawnMsgTemplates(bundleName);
     InsertUninstallOrUpgradeUidSet(uid);
     auto ret = KillApplicationByUid(bundleName, uid, killReason);
     DestroyImageForUninstallOrUpgrade(uid);
@@ -3636,6 +3640,7 @@ int32_t AppMgrServiceInner::NotifyUninstallOrUpgradeApp(const std::string &bundl
 void AppMgrServiceInner::NotifyUninstallOrUpgradeAppEnd(int32_t uid)
 {
     TAG_LOGD(AAFwkTag::APPMGR, "uid: %{public}d", uid);
+    launchInfoCache_.Clear();
     RemoveUninstallOrUpgradeUidSet(uid);
 }
 
@@ -3970,7 +3975,8 @@ int32_t AppMgrServiceInner::GetAllRunningProcesses(std::vector<RunningProcessInf
     HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
     auto isPerm = AAFwk::PermissionVerification::GetInstance()->VerifyRunningInfoPerm();
     // check permission
-    for (const auto &item : appRunningManager_->GetAppRunningRecordMap()) {
+    auto appRunningMap = appRunningManager_->GetAppRunningRecordSnapshot();
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (!appRecord || !appRecord->GetSpawned()) {
             continue;
@@ -4002,7 +4008,8 @@ int32_t AppMgrServiceInner::GetRunningProcessesByBundleType(BundleType bundleTyp
         return ERR_PERMISSION_DENIED;
     }
     int32_t userId = UserController::GetInstance().GetCallerUserId();
-    for (const auto &item : appRunningManager_->GetAppRunningRecordMap()) {
+    auto appRunningMap = appRunningManager_->GetAppRunningRecordSnapshot();
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (!appRecord || !appRecord->GetSpawned()) {
             continue;
@@ -4053,8 +4060,8 @@ int32_t AppMgrServiceInner::GetRunningMultiAppInfoByBundleName(const std::string
         TAG_LOGE(AAFwkTag::APPMGR, "appRunningManager null");
         return ERR_INVALID_VALUE;
     }
-    auto multiAppInfoMap = appRunningManager_->GetAppRunningRecordMap();
-    for (const auto &item : multiAppInfoMap) {
+    auto multiAppInfoMap = appRunningManager_->GetAppRunningRecordSnapshot();
+    for (const auto &item : *multiAppInfoMap) {
         const std::shared_ptr<AppRunningRecord> &appRecord = item.second;
         if (appRecord == nullptr || appRecord->GetBundleName() != bundleName) {
             continue;
@@ -4137,8 +4144,8 @@ int32_t AppMgrServiceInner::GetAllRunningInstanceKeysByBundleNameInner(const std
         TAG_LOGE(AAFwkTag::APPMGR, "appRunningManager null");
         return ERR_INVALID_VALUE;
     }
-    auto multiAppInfoMap = appRunningManager_->GetAppRunningRecordMap();
-    for (const auto &item : multiAppInfoMap) {
+    auto multiAppInfoMap = appRunningManager_->GetAppRunningRecordSnapshot();
+    for (const auto &item : *multiAppInfoMap) {
         const std::shared_ptr<AppRunningRecord> &appRecord = item.second;
         if (appRecord == nullptr || appRecord->GetBundleName() != bundleName) {
             continue;
@@ -4271,7 +4278,9 @@ int32_t AppMgrServiceInner::GetProcessRunningInfosByUserId(std::vector<RunningPr
         return ERR_PERMISSION_DENIED;
     }
 
-    for (const auto &item : appRunningManager_->GetAppRunningRecordMap()) {
+    auto appRunningMap = appRunningManager_->GetAppRunningRecordSnapshot();
+
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (!appRecord || !appRecord->GetSpawned()) {
             continue;
@@ -4287,7 +4296,8 @@ int32_t AppMgrServiceInner::GetProcessRunningInfosByUserId(std::vector<RunningPr
 int32_t AppMgrServiceInner::GetProcessRunningInfosByAccessTokenId(uint32_t accessTokenId,
     std::vector<RunningProcessInfo> &info)
 {
-    for (const auto &item : appRunningManager_->GetAppRunningRecordMap()) {
+    auto appRunningMap = appRunningManager_->GetAppRunningRecordSnapshot();
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (!appRecord || !appRecord->GetSpawned()) {
             continue;
@@ -4319,7 +4329,8 @@ int32_t AppMgrServiceInner::GetAllRenderProcesses(std::vector<RenderProcessInfo>
 {
     auto isPerm = AAFwk::PermissionVerification::GetInstance()->VerifyRunningInfoPerm();
     // check permission
-    for (const auto &item : appRunningManager_->GetAppRunningRecordMap()) {
+    auto appRunningMap = appRunningManager_->GetAppRunningRecordSnapshot();
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (isPerm) {
             GetRenderProcesses(appRecord, info);
@@ -4346,7 +4357,8 @@ int AppMgrServiceInner::GetAllChildrenProcesses(std::vector<ChildProcessInfo> &i
 {
     auto isPerm = AAFwk::PermissionVerification::GetInstance()->VerifyRunningInfoPerm();
     // check permission
-    for (const auto &item : appRunningManager_->GetAppRunningRecordMap()) {
+    auto appRunningMap = appRunningManager_->GetAppRunningRecordSnapshot();
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (isPerm) {
             GetChildrenProcesses(appRecord, info);
@@ -5435,9 +5447,9 @@ std::shared_ptr<AppRunningRecord> AppMgrServiceInner::GetAppRunningRecordByAppRe
         TAG_LOGE(AAFwkTag::APPMGR, "appRunningManager null");
         return nullptr;
     }
-    const auto&& appRunningRecordMap = appRunningManager_->GetAppRunningRecordMap();
-    const auto& iter = appRunningRecordMap.find(recordId);
-    return iter != appRunningRecordMap.end() ? iter->second : nullptr;
+    auto appRunningRecordMap = appRunningManager_->GetAppRunningRecordSnapshot();
+    const auto& iter = appRunningRecordMap->find(recordId);
+    return iter != appRunningRecordMap->end() ? iter->second : nullptr;
 }
 
 void AppMgrServiceInner::OnAppStateChanged(
@@ -5615,6 +5627,14 @@ int32_t AppMgrServiceInner::StartPerfProcess(const std::shared_ptr<AppRunningRec
 void AppMgrServiceInner::SetOverlayInfo(const std::string &bundleName,
                                         const int32_t userId,
                                         AppSpawnStartMsg &startMsg)
+{
+    std::vector<OverlayModuleInfo> overlayModuleInfos;
+    QueryOverlayModuleInfos(bundleName, userId, overlayModuleInfos);
+    SetOverlayInfo(overlayModuleInfos, startMsg);
+}
+
+void AppMgrServiceInner::QueryOverlayModuleInfos(const std::string &bundleName, const int32_t userId,
+    std::vector<OverlayModuleInfo> &overlayModuleInfos)
 {
     if (remoteClientManager_ == nullptr) {
         TAG_LOGE(AAFwkTag::APPMGR, "remoteClientManager_ null");
@@ -5627,23 +5647,31 @@ void AppMgrServiceInner::SetOverlayInfo(const std::string &bundleName,
     }
     auto overlayMgrProxy = bundleMgrHelper->GetOverlayManagerProxy();
     if (overlayMgrProxy !=  nullptr) {
-        std::vector<OverlayModuleInfo> overlayModuleInfo;
         TAG_LOGD(AAFwkTag::APPMGR, "Check overlay app begin.");
         HITRACE_METER_NAME(HITRACE_TAG_APP, "BMS->GetOverlayModuleInfoForTarget");
         auto targetRet = IN_PROCESS_CALL(overlayMgrProxy->GetOverlayModuleInfoForTarget(
-            bundleName, "", overlayModuleInfo, userId));
-        if (targetRet == ERR_OK && overlayModuleInfo.size() != 0) {
-            TAG_LOGD(AAFwkTag::APPMGR, "Start an overlay app process.");
-            startMsg.flags = startMsg.flags | APP_OVERLAY_FLAG;
-            std::string overlayInfoPaths;
-            for (auto it : overlayModuleInfo) {
-                overlayInfoPaths += (it.hapPath + "|");
-            }
-            startMsg.overlayInfo = overlayInfoPaths;
+            bundleName, "", overlayModuleInfos, userId));
+        if (targetRet != ERR_OK) {
+            overlayModuleInfos.clear();
         }
     }
 }
 
+void AppMgrServiceInner::SetOverlayInfo(const std::vector<OverlayModuleInfo> &overlayModuleInfos,
+    AppSpawnStartMsg &startMsg)
+{
+    if (overlayModuleInfos.empty()) {
+        return;
+    }
+    TAG_LOGD(AAFwkTag::APPMGR, "Start an overlay app process.");
+    startMsg.flags = startMsg.flags | APP_OVERLAY_FLAG;
+    std::string overlayInfoPaths;
+    for (const auto &it : overlayModuleInfos) {
+        overlayInfoPaths += (it.hapPath + "|");
+    }
+    startMsg.overlayInfo = overlayInfoPaths;
+}
+
 void AppMgrServiceInner::SetAppEnvInfo(const BundleInfo &bundleInfo, AppSpawnStartMsg& startMsg)
 {
     if (bundleInfo.applicationInfo.tsanEnabled) {
@@ -5920,22 +5948,16 @@ int32_t AppMgrServiceInner::CreateStartMsg(const CreateStartMsgParam &param, App
             .taskQos_ = AAFwk::TaskQoS::USER_INTERACTIVE
         }));
 
-    HspList hspList;
-    auto ret = bundleMgrHelper->GetBaseSharedBundleInfos(bundleInfo.name, hspList,
-        AppExecFwk::GetDependentBundleInfoFlag::GET_ALL_DEPENDENT_BUNDLE_INFO);
+    auto userId = GetUserIdByUid(param.uid);
+    AppLaunchInfo launchInfo;
+    std::vector<OverlayModuleInfo> overlayModuleInfos;
+    auto ret = GetLaunchInfo(param, userId, launchInfo, overlayModuleInfos);
     if (ret != ERR_OK) {
-        TAG_LOGE(AAFwkTag::APPMGR, "getBaseSharedBundleInfos fail: %{public}d", ret);
         return ret;
     }
-    startMsg.hspList = hspList;
-
-    auto userId = GetUserIdByUid(param.uid);
-    DataGroupInfoList dataGroupInfoList;
-    bool result = bundleMgrHelper->QueryDataGroupInfos(bundleInfo.name, userId, dataGroupInfoList);
-    if (!result || dataGroupInfoList.empty()) {
-        TAG_LOGD(AAFwkTag::APPMGR, "the bundle has no groupInfos.");
-    }
-    QueryExtensionSandBox(param.moduleName, param.abilityName, bundleInfo, startMsg, dataGroupInfoList, param.want);
+    startMsg.hspList = std::move(launchInfo.hspList);
+    QueryExtensionSandBox(param.moduleName, param.abilityName, bundleInfo, startMsg, launchInfo.dataGroupInfoList,
+        param.want);
     SetStartMsgStrictMode(startMsg, param);
     startMsg.bundleName = bundleInfo.name;
     startMsg.renderParam = RENDER_PARAM;
@@ -5943,7 +5965,7 @@ int32_t AppMgrServiceInner::CreateStartMsg(const CreateStartMsgParam &param, App
     startMsg.bundleIndex = param.bundleIndex;
     startMsg.procName = param.processName;
     SetAtomicServiceInfo(param.bundleType, startMsg);
-    SetOverlayInfo(bundleInfo.name, userId, startMsg);
+    SetOverlayInfo(overlayModuleInfos, startMsg);
     SetAppInfo(bundleInfo, startMsg);
     SetStartMsgCustomSandboxFlag(startMsg, bundleInfo.applicationInfo.accessTokenId);
     GetKernelPermissions(bundleInfo.applicationInfo.accessTokenId, startMsg.jitPermissionsMap);
@@ -5954,6 +5976,72 @@ int32_t AppMgrServiceInner::CreateStartMsg(const CreateStartMsgParam &param, App
     return ERR_OK;
 }
 
+int32_t AppMgrServiceInner::GetLaunchInfo(const CreateStartMsgParam &param, int32_t userId,
+    AppLaunchInfo &launchInfo, std::vector<OverlayModuleInfo> &overlayModuleInfos)
+{
+    auto &bundleInfo = param.bundleInfo;
+    AppLaunchInfoKey key { bundleInfo.name, userId, param.bundleIndex, bundleInfo.versionCode };
+    uint64_t generation = 0;
+    if (launchInfoCache_.Get(key, launchInfo, generation)) {
+        TAG_LOGD(AAFwkTag::APPMGR, "launch info of %{public}s cached", bundleInfo.name.c_str());
+        // overlays change state without a bundle event that would drop the cache
+        QueryOverlayModuleInfos(bundleInfo.name, userId, overlayModuleInfos);
+        return ERR_OK;
+    }
+    auto bundleMgrHelper = remoteClientManager_->GetBundleManagerHelper();
+    if (!bundleMgrHelper) {
+        TAG_LOGE(AAFwkTag::APPMGR, "get bundle manager helper fail");
+        return ERR_NO_INIT;
+    }
+    auto begin = std::chrono::steady_clock::now();
+    // the three queries are independent, run two of them while querying shared bundles here
+    AAFwk::AutoSyncTaskHandle dataGroupSync(AAFwk::TaskHandlerWrap::GetFfrtHandler()->SubmitTask([&]() {
+        bool result = bundleMgrHelper->QueryDataGroupInfos(bundleInfo.name, userId, launchInfo.dataGroupInfoList);
+        if (!result || launchInfo.dataGroupInfoList.empty()) {
+            TAG_LOGD(AAFwkTag::APPMGR, "the bundle has no groupInfos.");
+        }
+        }, AAFwk::TaskAttribute{
+            .taskName_ = "QueryDataGroupInfos",
+            .taskQos_ = AAFwk::TaskQoS::USER_INTERACTIVE
+        }));
+    AAFwk::AutoSyncTaskHandle overlaySync(AAFwk::TaskHandlerWrap::GetFfrtHandler()->SubmitTask([&]() {
+        QueryOverlayModuleInfos(bundleInfo.name, userId, overlayModuleInfos);
+        }, AAFwk::TaskAttribute{
+            .taskName_ = "QueryOverlayModuleInfos",
+            .taskQos_ = AAFwk::TaskQoS::USER_INTERACTIVE
+        }));
+    auto ret = bundleMgrHelper->GetBaseSharedBundleInfos(bundleInfo.name, launchInfo.hspList,
+        AppExecFwk::GetDependentBundleInfoFlag::GET_ALL_DEPENDENT_BUNDLE_INFO);
+    dataGroupSync.Sync();
+    overlaySync.Sync();
+    if (ret != ERR_OK) {
+        TAG_LOGE(AAFwkTag::APPMGR, "getBaseSharedBundleInfos fail: %{public}d", ret);
+        return ret;
+    }
+    auto costUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+    launchInfoCache_.Put(key, launchInfo, generation, costUs);
+    return ERR_OK;
+}
+
+void AppMgrServiceInner::DumpLaunchInfoCache(std::string &result)
+{
+    launchInfoCache_.Dump(result);
+}
+
+void AppMgrServiceInner::ClearSpawnMsgTemplates(const std::string &bundleName)
+{
+    if (remoteClientManager_ == nullptr) {
+        return;
+    }
+    for (const auto &spawnClient : { remoteClientManager_->GetSpawnClient(), remoteClientManager_->GetCJSpawnClient(),
+        remoteClientManager_->GetNativeSpawnClient(), remoteClientManager_->GetHybridSpawnClient() }) {
+        if (spawnClient != nullptr) {
+            spawnClient->ClearSpawnMsgTemplates(bundleName);
+        }
+    }
+}
+
 void AppMgrServiceInner::SetStartMsgCustomSandboxFlag(AppSpawnStartMsg &startMsg, uint32_t accessTokenId)
 {
     if (!AAFwk::AppUtils::GetInstance().IsStartOptionsWithAnimation()) {
@@ -6172,7 +6260,7 @@ int32_t AppMgrServiceInner::StartProcess(const std::string &appName, const std::
         processName.c_str(), pid, bundleIndex);
     SetRunningSharedBundleList(bundleName, startMsg.hspList);
     CHECK_POINTER_AND_RETURN_VALUE(appRecord->GetPriorityObject(), ERR_INVALID_VALUE);
-    appRecord->GetPriorityObject()->SetPid(pid);
+    appRunningManager_->SetAppRunningRecordPid(appRecord, pid);
     appRecord->SetUid(startMsg.uid);
     if (isPreload) {
         PostPreloadAttachTimeoutTask(appRecord);
@@ -10174,8 +10262,8 @@ int32_t AppMgrServiceInner::GetRunningProcessInformation(
         return ERR_NO_INIT;
     }
     TAG_LOGD(AAFwkTag::APPMGR, "uid value: %{public}d", userId);
-    const auto &appRunningRecordMap = appRunningManager_->GetAppRunningRecordMap();
-    for (const auto &item : appRunningRecordMap) {
+    auto appRunningRecordMap = appRunningManager_->GetAppRunningRecordSnapshot();
+    for (const auto &item : *appRunningRecordMap) {
         const auto &appRecord = item.second;
         if (appRecord == nullptr) {
             continue;
@@ -11857,7 +11945,9 @@ void AppMgrServiceInner::SetKeepAliveEnableState(const std::string &bundleName,
         return;
     }
 
-    for (const auto &item : appRunningManager_->GetAppRunningRecordMap()) {
+    auto appRunningMap = appRunningManager_->GetAppRunningRecordSnapshot();
+
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (appRecord != nullptr && appRecord->GetBundleName() == bundleName &&
             (uid == 0 || appRecord->GetUid() == uid)) {
@@ -11902,7 +11992,9 @@ void AppMgrServiceInner::SetKeepAliveDkv(const std::string &bundleName, bool ena
         return;
     }
 
-    for (const auto &item : appRunningManager_->GetAppRunningRecordMap()) {
+    auto appRunningMap = appRunningManager_->GetAppRunningRecordSnapshot();
+
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (appRecord != nullptr && appRecord->GetBundleName() == bundleName &&
             (uid == 0 || appRecord->GetUid() == uid) && appRecord->IsMainElementRunning()) {
@@ -11932,7 +12024,9 @@ void AppMgrServiceInner::SetKeepAliveAppService(const std::string& bundleName, b
         return;
     }
 
-    for (const auto& item : appRunningManager_->GetAppRunningRecordMap()) {
+    auto appRunningMap = appRunningManager_->GetAppRunningRecordSnapshot();
+
+    for (const auto& item : *appRunningMap) {
         const auto& appRecord = item.second;
         if (appRecord != nullptr && appRecord->GetBundleName() == bundleName &&
             appRecord->GetUid() == uid) {
@@ -12317,7 +12411,8 @@ void AppMgrServiceInner::KillProcessDependedOnWeb()
 {
     TAG_LOGI(AAFwkTag::APPMGR, "call");
     CHECK_POINTER_AND_RETURN_LOG(appRunningManager_, "appRunningManager_ is nullptr");
-    for (const auto &item : appRunningManager_->GetAppRunningRecordMap()) {
+    auto appRunningMap = appRunningManager_->GetAppRunningRecordSnapshot();
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (!appRecord || !appRecord->GetSpawned() ||
             !appRecord->GetPriorityObject() || !appRecord->IsDependedOnArkWeb()) {
@@ -12464,7 +12559,8 @@ int32_t AppMgrServiceInner::GetPidsByAccessTokenId(const uint32_t accessTokenId,
         return ERR_NO_INIT;
     }
     std::vector<pid_t> foregroundPids;
-    for (const auto &item : appRunningManager_->GetAppRunningRecordMap()) {
+    auto appRunningMap = appRunningManager_->GetAppRunningRecordSnapshot();
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (!appRecord || !appRecord->GetSpawned()) {
             continue;
@@ -12577,7 +12673,8 @@ int32_t AppMgrServiceInner::GetSupportedProcessCachePids(const std::string &bund
         return AAFwk::INNER_ERR;
     }
     TAG_LOGD(AAFwkTag::APPMGR, "callderUserId: %{public}d", callderUserId);
-    for (const auto &item : appRunningManager_->GetAppRunningRecordMap()) {
+    auto appRunningMap = appRunningManager_->GetAppRunningRecordSnapshot();
+    for (const auto &item : *appRunningMap) {
         auto appRecord = item.second;
         if (appRecord == nullptr) {
             continue;
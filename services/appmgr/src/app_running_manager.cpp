@@ -99,10 +99,7 @@ std::shared_ptr<AppRunningRecord> AppRunningManager::CreateAppRunningRecord(
     appRecord->SetAppIdentifier(bundleInfo.signatureInfo.appIdentifier);
     appRecord->SetInstanceKey(instanceKey);
     appRecord->SetCustomProcessFlag(customProcessFlag);
-    {
-        std::lock_guard guard(runningRecordMapMutex_);
-        appRunningRecordMap_.emplace(recordId, appRecord);
-    }
+    AddAppRunningRecord(recordId, appRecord);
     {
         std::lock_guard guard(updateConfigurationDelayedLock_);
         updateConfigurationDelayedMap_.emplace(recordId, false);
@@ -146,12 +143,12 @@ std::shared_ptr<AppRunningRecord> AppRunningManager::CheckAppRunningRecordIsExis
             !(pair.second->IsKilling()) && !(pair.second->GetRestartAppFlag()) &&
             !(pair.second->IsKillPrecedeStart());
     };
-    auto appRunningMap = GetAppRunningRecordMap();
+    auto appRunningMap = GetAppRunningRecordSnapshot();
     if (!jointUserId.empty()) {
-        auto iter = std::find_if(appRunningMap.begin(), appRunningMap.end(), findSameProcess);
-        return ((iter == appRunningMap.end()) ? nullptr : iter->second);
+        auto iter = std::find_if(appRunningMap->begin(), appRunningMap->end(), findSameProcess);
+        return ((iter == appRunningMap->end()) ? nullptr : iter->second);
     }
-    for (const auto &item : appRunningMap) {
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (appRecord && CheckAppProcessNameIsSame(appRecord, processName, isFromPreload) &&
             appRecord->GetInstanceKey() == instanceKey &&
@@ -196,9 +193,8 @@ std::shared_ptr<AppRunningRecord> AppRunningManager::CheckAppRunningRecordForSpe
 {
     HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
     TAG_LOGD(AAFwkTag::APPMGR, "uid: %{public}d: customProcessFlag: %{public}s", uid, customProcessFlag.c_str());
-    auto appRunningMap = GetAppRunningRecordMap();
-    for (const auto &item : appRunningMap) {
-        const auto &appRecord = item.second;
+    auto appRecords = GetAppRunningRecordsByUid(uid);
+    for (const auto &appRecord : appRecords) {
         if (appRecord->GetInstanceKey() == instanceKey && appRecord->GetUid() == uid &&
             appRecord->GetProcessType() == ProcessType::NORMAL &&
             (appRecord->GetCustomProcessFlag() == customProcessFlag) &&
@@ -273,7 +269,7 @@ std::shared_ptr<AppRunningRecord> AppRunningManager::FindMasterProcessAppRunning
 {
     HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
     TAG_LOGD(AAFwkTag::APPMGR, "uid: %{public}d: appName: %{public}s", uid, appName.c_str());
-    auto appRunningMap = GetAppRunningRecordMap();
+    auto appRunningMap = GetAppRunningRecordSnapshot();
     int64_t maxTimeStamp = INT64_MIN;
     int64_t minAppRecordId = INT32_MAX;
     std::shared_ptr<AppRunningRecord> maxAppRecord;
@@ -281,7 +277,7 @@ std::shared_ptr<AppRunningRecord> AppRunningManager::FindMasterProcessAppRunning
     std::shared_ptr<AppRunningRecord> resMasterRecord;
     bool isUIAbility = (abilityInfo.type == AppExecFwk::AbilityType::PAGE);
     bool isUIExtension = (abilityInfo.extensionAbilityType == AppExecFwk::ExtensionAbilityType::SYS_COMMON_UI);
-    for (const auto &item : appRunningMap) {
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (!(appRecord && appRecord->GetUid() == uid)) {
             continue;
@@ -318,9 +314,8 @@ std::shared_ptr<AppRunningRecord> AppRunningManager::FindMainProcessAppRunningRe
 {
     HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
     TAG_LOGD(AAFwkTag::APPMGR, "uid: %{public}d", uid);
-    auto appRunningMap = GetAppRunningRecordMap();
-    for (const auto &item : appRunningMap) {
-        const auto &appRecord = item.second;
+    auto appRecords = GetAppRunningRecordsByUid(uid);
+    for (const auto &appRecord : appRecords) {
         if (!(appRecord && appRecord->GetUid() == uid)) {
             continue;
         }
@@ -339,10 +334,10 @@ bool AppRunningManager::CheckMasterProcessAppRunningRecordIsExist(
 {
     HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
     TAG_LOGD(AAFwkTag::APPMGR, "uid: %{public}d: appName: %{public}s", uid, appName.c_str());
-    auto appRunningMap = GetAppRunningRecordMap();
+    auto appRunningMap = GetAppRunningRecordSnapshot();
     bool isUIAbility = (abilityInfo.type == AppExecFwk::AbilityType::PAGE);
     bool isUIExtension = (abilityInfo.extensionAbilityType == AppExecFwk::ExtensionAbilityType::SYS_COMMON_UI);
-    for (const auto &item : appRunningMap) {
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (appRecord && appRecord->GetUid() == uid && appRecord->IsMasterProcess() &&
             IsSameAbilityType(appRecord, abilityInfo)) {
@@ -376,12 +371,11 @@ bool AppRunningManager::IsAppExist(uint32_t accessTokenId)
 
 bool AppRunningManager::CheckAppRunningRecordIsExistByUid(int32_t uid)
 {
-    std::lock_guard guard(runningRecordMapMutex_);
+    std::shared_lock guard(runningRecordMapMutex_);
     if (appRunningRecordMap_.empty()) {
         return false;
     }
-    for (const auto &item : appRunningRecordMap_) {
-        const auto &appRecord = item.second;
+    for (const auto &appRecord : FindRecordsByUidLocked(uid)) {
         if (appRecord && appRecord->GetUid() == uid && !(appRecord->GetRestartAppFlag())) {
             return true;
         }
@@ -392,9 +386,8 @@ bool AppRunningManager::CheckAppRunningRecordIsExistByUid(int32_t uid)
 int32_t AppRunningManager::CheckAppCloneRunningRecordIsExistByBundleName(const std::string &bundleName,
     int32_t appCloneIndex, bool &isRunning)
 {
-    std::lock_guard guard(runningRecordMapMutex_);
-    for (const auto &item : appRunningRecordMap_) {
-        const auto &appRecord = item.second;
+    std::shared_lock guard(runningRecordMapMutex_);
+    for (const auto &appRecord : FindRecordsByBundleNameLocked(bundleName)) {
         if (appRecord && appRecord->GetBundleName() == bundleName && !(appRecord->GetRestartAppFlag()) &&
             appRecord->GetAppIndex() == appCloneIndex) {
             isRunning = true;
@@ -408,9 +401,8 @@ int32_t AppRunningManager::IsAppRunningByBundleName(const std::string &bundleNam
     int32_t userId, bool &isRunning)
 {
     isRunning = false;
-    std::lock_guard guard(runningRecordMapMutex_);
-    for (const auto &item : appRunningRecordMap_) {
-        const auto &appRecord = item.second;
+    std::shared_lock guard(runningRecordMapMutex_);
+    for (const auto &appRecord : FindRecordsByBundleNameLocked(bundleName)) {
         if (appRecord && appRecord->GetBundleName() == bundleName && !(appRecord->GetRestartAppFlag()) &&
             (appCloneIndex < 0 || appRecord->GetAppIndex() == appCloneIndex) &&
             (userId < 0 || appRecord->GetUserId() == userId)) {
@@ -424,9 +416,8 @@ int32_t AppRunningManager::IsAppRunningByBundleName(const std::string &bundleNam
 int32_t AppRunningManager::IsAppRunningByBundleNameAndUserId(const std::string &bundleName,
     int32_t userId, bool &isRunning)
 {
-    auto appRunningMap = GetAppRunningRecordMap();
-    for (const auto &item : appRunningMap) {
-        const auto &appRecord = item.second;
+    auto appRecords = GetAppRunningRecordsByBundleName(bundleName);
+    for (const auto &appRecord : appRecords) {
         if (appRecord && appRecord->GetBundleName() == bundleName && !(appRecord->GetRestartAppFlag()) &&
             appRecord->GetUid() / BASE_USER_RANGE == userId) {
             isRunning = true;
@@ -439,9 +430,8 @@ int32_t AppRunningManager::IsAppRunningByBundleNameAndUserId(const std::string &
 int32_t AppRunningManager::GetAllAppRunningRecordCountByBundleName(const std::string &bundleName)
 {
     int32_t count = 0;
-    std::lock_guard guard(runningRecordMapMutex_);
-    for (const auto &item : appRunningRecordMap_) {
-        const auto &appRecord = item.second;
+    std::shared_lock guard(runningRecordMapMutex_);
+    for (const auto &appRecord : FindRecordsByBundleNameLocked(bundleName)) {
         if (appRecord && appRecord->GetBundleName() == bundleName) {
             count++;
         }
@@ -452,11 +442,8 @@ int32_t AppRunningManager::GetAllAppRunningRecordCountByBundleName(const std::st
 
 std::shared_ptr<AppRunningRecord> AppRunningManager::GetAppRunningRecordByPid(const pid_t pid)
 {
-    std::lock_guard guard(runningRecordMapMutex_);
-    auto iter = std::find_if(appRunningRecordMap_.begin(), appRunningRecordMap_.end(), [&pid](const auto &pair) {
-        return pair.second->GetPid() == pid;
-    });
-    return ((iter == appRunningRecordMap_.end()) ? nullptr : iter->second);
+    std::shared_lock guard(runningRecordMapMutex_);
+    return FindRecordByPidLocked(pid);
 }
 
 std::shared_ptr<AppRunningRecord> AppRunningManager::GetValidAppRunningRecordByPid(const pid_t pid)
@@ -471,22 +458,240 @@ std::shared_ptr<AppRunningRecord> AppRunningManager::GetValidAppRunningRecordByP
 std::shared_ptr<AppRunningRecord> AppRunningManager::GetAppRunningRecordByAbilityToken(
     const sptr<IRemoteObject> &abilityToken)
 {
-    std::lock_guard guard(runningRecordMapMutex_);
+    std::shared_lock guard(runningRecordMapMutex_);
     HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
-    for (const auto &item : appRunningRecordMap_) {
-        const auto &appRecord = item.second;
-        if (appRecord && appRecord->GetAbilityRunningRecordByToken(abilityToken)) {
-            return appRecord;
+    return FindRecordByAbilityTokenLocked(abilityToken);
+}
+
+std::vector<std::shared_ptr<AppRunningRecord>> AppRunningManager::GetAppRunningRecordsByUid(int32_t uid)
+{
+    std::shared_lock guard(runningRecordMapMutex_);
+    return FindRecordsByUidLocked(uid);
+}
+
+std::vector<std::shared_ptr<AppRunningRecord>> AppRunningManager::GetAppRunningRecordsByBundleName(
+    const std::string &bundleName)
+{
+    std::shared_lock guard(runningRecordMapMutex_);
+    return FindRecordsByBundleNameLocked(bundleName);
+}
+
+void AppRunningManager::AddRecordIndexLocked(const int32_t recordId,
+    const std::shared_ptr<AppRunningRecord> &appRecord)
+{
+    {
+        std::lock_guard indexGuard(recordIndexLock_);
+        auto &entry = recordIndexEntries_[recordId];
+        if (appRecord == nullptr) {
+            return;
+        }
+        uidIndex_[appRecord->GetUid()].insert(recordId);
+        bundleNameIndex_[appRecord->GetBundleName()].insert(recordId);
+        entry.pid = appRecord->GetPid();
+        if (entry.pid > 0) {
+            pidIndex_[entry.pid] = recordId;
+        }
+    }
+    // abilities added from now on reach the index through the handler, pick up those the record already has.
+    auto abilities = appRecord->GetAbilities();
+    std::lock_guard indexGuard(recordIndexLock_);
+    auto &entry = recordIndexEntries_[recordId];
+    for (const auto &item : abilities) {
+        if (item.first != nullptr) {
+            abilityTokenIndex_[item.first.GetRefPtr()] = recordId;
+            entry.abilityTokens.insert(item.first.GetRefPtr());
+        }
+    }
+}
+
+void AppRunningManager::RemoveRecordIndexLocked(const int32_t recordId,
+    const std::shared_ptr<AppRunningRecord> &appRecord)
+{
+    std::lock_guard indexGuard(recordIndexLock_);
+    auto entryIter = recordIndexEntries_.find(recordId);
+    if (entryIter == recordIndexEntries_.end()) {
+        return;
+    }
+    auto eraseByRecordId = [recordId](auto &index, const auto &key) {
+        auto iter = index.find(key);
+        if (iter != index.end() && iter->second == recordId) {
+            index.erase(iter);
+        }
+    };
+    eraseByRecordId(pidIndex_, entryIter->second.pid);
+    for (auto token : entryIter->second.abilityTokens) {
+        eraseByRecordId(abilityTokenIndex_, token);
+    }
+    recordIndexEntries_.erase(entryIter);
+    if (appRecord == nullptr) {
+        return;
+    }
+    auto eraseFromIndex = [recordId](auto &index, const auto &key) {
+        auto iter = index.find(key);
+        if (iter == index.end()) {
+            return;
+        }
+        iter->second.erase(recordId);
+        if (iter->second.empty()) {
+            index.erase(iter);
+        }
+    };
+    eraseFromIndex(uidIndex_, appRecord->GetUid());
+    eraseFromIndex(bundleNameIndex_, appRecord->GetBundleName());
+}
+
+void AppRunningManager::ClearRecordIndexLocked()
+{
+    std::lock_guard indexGuard(recordIndexLock_);
+    recordIndexEntries_.clear();
+    pidIndex_.clear();
+    abilityTokenIndex_.clear();
+    uidIndex_.clear();
+    bundleNameIndex_.clear();
+}
+
+void AppRunningManager::WatchRecordChange(const std::shared_ptr<AppRunningRecord> &appRecord)
+{
+    appRecord->SetUidChangedHandler([weak = weak_from_this()](int32_t recordId, int32_t newUid,
+        const std::function<int32_t()> &exchangeUid) {
+        auto appRunningManager = weak.lock();
+        if (appRunningManager == nullptr) {
+            exchangeUid();
+            return;
+        }
+        appRunningManager->OnAppRunningRecordUidChanged(recordId, newUid, exchangeUid);
+    });
+    appRecord->SetAbilityChangedHandler([weak = weak_from_this()](int32_t recordId,
+        const sptr<IRemoteObject> &token, bool isAdded) {
+        auto appRunningManager = weak.lock();
+        if (appRunningManager != nullptr) {
+            appRunningManager->OnAppRunningRecordAbilityChanged(recordId, token, isAdded);
+        }
+    });
+}
+
+void AppRunningManager::OnAppRunningRecordUidChanged(int32_t recordId, int32_t newUid,
+    const std::function<int32_t()> &exchangeUid)
+{
+    // the uid of the record changes under the index lock, so the uid index never disagrees with GetUid.
+    std::lock_guard indexGuard(recordIndexLock_);
+    int32_t oldUid = exchangeUid();
+    if (oldUid == newUid) {
+        return;
+    }
+    auto iter = uidIndex_.find(oldUid);
+    if (iter == uidIndex_.end() || iter->second.erase(recordId) == 0) {
+        return;
+    }
+    if (iter->second.empty()) {
+        uidIndex_.erase(iter);
+    }
+    uidIndex_[newUid].insert(recordId);
+}
+
+void AppRunningManager::OnAppRunningRecordAbilityChanged(int32_t recordId, const sptr<IRemoteObject> &token,
+    bool isAdded)
+{
+    if (token == nullptr) {
+        return;
+    }
+    std::lock_guard indexGuard(recordIndexLock_);
+    auto entryIter = recordIndexEntries_.find(recordId);
+    if (entryIter == recordIndexEntries_.end()) {
+        // not in the record list, AddRecordIndexLocked picks up its abilities.
+        return;
+    }
+    auto key = token.GetRefPtr();
+    if (isAdded) {
+        abilityTokenIndex_[key] = recordId;
+        entryIter->second.abilityTokens.insert(key);
+        return;
+    }
+    entryIter->second.abilityTokens.erase(key);
+    auto iter = abilityTokenIndex_.find(key);
+    if (iter != abilityTokenIndex_.end() && iter->second == recordId) {
+        abilityTokenIndex_.erase(iter);
+    }
+}
+
+std::shared_ptr<AppRunningRecord> AppRunningManager::FindRecordByPidLocked(const pid_t pid)
+{
+    if (pid <= 0) {
+        return nullptr;
+    }
+    std::lock_guard indexGuard(recordIndexLock_);
+    auto indexIter = pidIndex_.find(pid);
+    if (indexIter == pidIndex_.end()) {
+        return nullptr;
+    }
+    auto iter = appRunningRecordMap_.find(indexIter->second);
+    return iter != appRunningRecordMap_.end() ? iter->second : nullptr;
+}
+
+std::shared_ptr<AppRunningRecord> AppRunningManager::FindRecordByAbilityTokenLocked(
+    const sptr<IRemoteObject> &abilityToken)
+{
+    if (abilityToken == nullptr) {
+        return nullptr;
+    }
+    int32_t recordId = 0;
+    {
+        std::lock_guard indexGuard(recordIndexLock_);
+        auto indexIter = abilityTokenIndex_.find(abilityToken.GetRefPtr());
+        if (indexIter == abilityTokenIndex_.end()) {
+            return nullptr;
+        }
+        recordId = indexIter->second;
+    }
+    // checked without the index lock, the record takes its module lock, which is held when it tells the handler.
+    auto iter = appRunningRecordMap_.find(recordId);
+    if (iter == appRunningRecordMap_.end() || iter->second == nullptr ||
+        iter->second->GetAbilityRunningRecordByToken(abilityToken) == nullptr) {
+        return nullptr;
+    }
+    return iter->second;
+}
+
+std::vector<std::shared_ptr<AppRunningRecord>> AppRunningManager::FindRecordsByUidLocked(int32_t uid)
+{
+    std::vector<std::shared_ptr<AppRunningRecord>> records;
+    std::lock_guard indexGuard(recordIndexLock_);
+    auto iter = uidIndex_.find(uid);
+    if (iter != uidIndex_.end()) {
+        CollectRecordsLocked(iter->second, records);
+    }
+    return records;
+}
+
+std::vector<std::shared_ptr<AppRunningRecord>> AppRunningManager::FindRecordsByBundleNameLocked(
+    const std::string &bundleName)
+{
+    std::vector<std::shared_ptr<AppRunningRecord>> records;
+    std::lock_guard indexGuard(recordIndexLock_);
+    auto iter = bundleNameIndex_.find(bundleName);
+    if (iter != bundleNameIndex_.end()) {
+        CollectRecordsLocked(iter->second, records);
+    }
+    return records;
+}
+
+void AppRunningManager::CollectRecordsLocked(const std::set<int32_t> &recordIds,
+    std::vector<std::shared_ptr<AppRunningRecord>> &records)
+{
+    records.reserve(recordIds.size());
+    for (auto recordId : recordIds) {
+        auto iter = appRunningRecordMap_.find(recordId);
+        if (iter != appRunningRecordMap_.end() && iter->second) {
+            records.push_back(iter->second);
         }
     }
-    return nullptr;
 }
 
 bool AppRunningManager::ProcessExitByBundleName(
     const std::string &bundleName, std::list<pid_t> &pids, const bool clearPageStack)
 {
-    auto appRunningMap = GetAppRunningRecordMap();
-    for (const auto &item : appRunningMap) {
+    auto appRunningMap = GetAppRunningRecordSnapshot();
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         // condition [!appRecord->IsKeepAliveApp()] Is to not kill the resident process.
         // Before using this method, consider whether you need.
@@ -514,8 +719,8 @@ bool AppRunningManager::ProcessExitByBundleName(
 
 bool AppRunningManager::GetPidsByUserId(int32_t userId, std::list<pid_t> &pids)
 {
-    auto appRunningMap = GetAppRunningRecordMap();
-    for (const auto &item : appRunningMap) {
+    auto appRunningMap = GetAppRunningRecordSnapshot();
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (appRecord) {
             int32_t id = -1;
@@ -536,8 +741,8 @@ bool AppRunningManager::GetPidsByUserId(int32_t userId, std::list<pid_t> &pids)
 
 bool AppRunningManager::GetProcessInfosByUserId(int32_t userId, std::list<SimpleProcessInfo> &processInfos)
 {
-    auto appRunningMap = GetAppRunningRecordMap();
-    for (const auto &item : appRunningMap) {
+    auto appRunningMap = GetAppRunningRecordSnapshot();
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (appRecord == nullptr) {
             continue;
@@ -565,9 +770,9 @@ bool AppRunningManager::GetProcessInfosByUserId(int32_t userId, std::list<Simple
 int32_t AppRunningManager::ProcessUpdateApplicationInfoInstalled(
     const ApplicationInfo& appInfo, const std::string& moduleName)
 {
-    auto appRunningMap = GetAppRunningRecordMap();
+    auto appRunningMap = GetAppRunningRecordSnapshot();
     int32_t result = ERR_OK;
-    for (const auto &item : appRunningMap) {
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (!appRecord) {
             continue;
@@ -593,8 +798,8 @@ int32_t AppRunningManager::ProcessUpdateApplicationInfoInstalled(
 bool AppRunningManager::ProcessExitByBundleNameAndUid(
     const std::string &bundleName, const int uid, std::list<pid_t> &pids, const KillProcessConfig &config)
 {
-    auto appRunningMap = GetAppRunningRecordMap();
-    for (const auto &item : appRunningMap) {
+    auto appRunningMap = GetAppRunningRecordSnapshot();
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (appRecord == nullptr) {
             continue;
@@ -626,8 +831,8 @@ bool AppRunningManager::ProcessExitByBundleNameAndUid(
 
 bool AppRunningManager::ProcessExitByPid(int32_t pid, const KillProcessConfig &config)
 {
-    auto appRunningMap = GetAppRunningRecordMap();
-    for (const auto &[id, appRecord] : appRunningMap) {
+    auto appRunningMap = GetAppRunningRecordSnapshot();
+    for (const auto &[id, appRecord] : *appRunningMap) {
         if (appRecord == nullptr || appRecord->GetPid() != pid) {
             continue;
         }
@@ -651,8 +856,8 @@ bool AppRunningManager::ProcessExitByPid(int32_t pid, const KillProcessConfig &c
 bool AppRunningManager::ProcessExitByBundleNameAndAppIndex(const std::string &bundleName, int32_t appIndex,
     std::list<pid_t> &pids, bool clearPageStack)
 {
-    auto appRunningMap = GetAppRunningRecordMap();
-    for (const auto &item : appRunningMap) {
+    auto appRunningMap = GetAppRunningRecordSnapshot();
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (appRecord == nullptr) {
             continue;
@@ -687,8 +892,8 @@ bool AppRunningManager::ProcessExitByBundleNameAndAppIndex(const std::string &bu
 bool AppRunningManager::ProcessExitByTokenIdAndInstance(uint32_t accessTokenId, const std::string &instanceKey,
     std::list<pid_t> &pids, bool clearPageStack)
 {
-    auto appRunningMap = GetAppRunningRecordMap();
-    for (const auto &item : appRunningMap) {
+    auto appRunningMap = GetAppRunningRecordSnapshot();
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (appRecord == nullptr) {
             continue;
@@ -728,8 +933,8 @@ bool AppRunningManager::ProcessExitByTokenIdAndInstance(uint32_t accessTokenId,
 bool AppRunningManager::GetPidsByBundleNameUserIdAndAppIndex(const std::string &bundleName,
     const int userId, const int appIndex, std::list<pid_t> &pids)
 {
-    auto appRunningMap = GetAppRunningRecordMap();
-    for (const auto &item : appRunningMap) {
+    auto appRunningMap = GetAppRunningRecordSnapshot();
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (appRecord == nullptr) {
             continue;
@@ -776,7 +981,9 @@ std::shared_ptr<AppRunningRecord> AppRunningManager::OnRemoteDied(const wptr<IRe
             return nullptr;
         }
         appRecord = iter->second;
+        RemoveRecordIndexLocked(iter->first, appRecord);
         appRunningRecordMap_.erase(iter);
+        BumpRecordVersionLocked();
     }
     if (appRecord != nullptr) {
         {
@@ -804,10 +1011,76 @@ std::shared_ptr<AppRunningRecord> AppRunningManager::OnRemoteDied(const wptr<IRe
 
 std::map<const int32_t, const std::shared_ptr<AppRunningRecord>> AppRunningManager::GetAppRunningRecordMap()
 {
-    std::lock_guard guard(runningRecordMapMutex_);
+    std::shared_lock guard(runningRecordMapMutex_);
     return appRunningRecordMap_;
 }
 
+std::shared_ptr<const AppRunningManager::AppRunningRecordMap> AppRunningManager::GetAppRunningRecordSnapshot()
+{
+    std::shared_lock guard(runningRecordMapMutex_);
+    auto snapshot = std::atomic_load(&recordSnapshot_);
+    if (IsRecordSnapshotValidLocked(snapshot)) {
+        return snapshot->records;
+    }
+    // readers racing after a change build equal copies, the record map can not change while they hold the lock.
+    auto newSnapshot = std::make_shared<AppRunningRecordSnapshot>();
+    newSnapshot->version = recordVersion_;
+    newSnapshot->records = std::make_shared<const AppRunningRecordMap>(appRunningRecordMap_);
+    std::atomic_store(&recordSnapshot_, std::shared_ptr<const AppRunningRecordSnapshot>(newSnapshot));
+    return newSnapshot->records;
+}
+
+void AppRunningManager::BumpRecordVersionLocked()
+{
+    recordVersion_++;
+}
+
+bool AppRunningManager::IsRecordSnapshotValidLocked(
+    const std::shared_ptr<const AppRunningRecordSnapshot> &snapshot) const
+{
+    return snapshot != nullptr && snapshot->version == recordVersion_;
+}
+
+bool AppRunningManager::AddAppRunningRecord(const int32_t recordId, const std::shared_ptr<AppRunningRecord> &appRecord)
+{
+    if (appRecord != nullptr) {
+        WatchRecordChange(appRecord);
+    }
+    std::lock_guard guard(runningRecordMapMutex_);
+    if (!appRunningRecordMap_.emplace(recordId, appRecord).second) {
+        TAG_LOGW(AAFwkTag::APPMGR, "record %{public}d exists", recordId);
+        return false;
+    }
+    AddRecordIndexLocked(recordId, appRecord);
+    BumpRecordVersionLocked();
+    return true;
+}
+
+void AppRunningManager::SetAppRunningRecordPid(const std::shared_ptr<AppRunningRecord> &appRecord, const pid_t pid)
+{
+    if (appRecord == nullptr || appRecord->GetPriorityObject() == nullptr) {
+        TAG_LOGE(AAFwkTag::APPMGR, "null appRecord or priorityObject");
+        return;
+    }
+    std::shared_lock guard(runningRecordMapMutex_);
+    std::lock_guard indexGuard(recordIndexLock_);
+    appRecord->GetPriorityObject()->SetPid(pid);
+    auto recordId = appRecord->GetRecordId();
+    auto entryIter = recordIndexEntries_.find(recordId);
+    if (entryIter == recordIndexEntries_.end()) {
+        // not in the record list, AddRecordIndexLocked picks up its pid.
+        return;
+    }
+    auto pidIter = pidIndex_.find(entryIter->second.pid);
+    if (pidIter != pidIndex_.end() && pidIter->second == recordId) {
+        pidIndex_.erase(pidIter);
+    }
+    entryIter->second.pid = pid;
+    if (pid > 0) {
+        pidIndex_[pid] = recordId;
+    }
+}
+
 void AppRunningManager::RemoveAppRunningRecordById(const int32_t recordId)
 {
     std::shared_ptr<AppRunningRecord> appRecord = nullptr;
@@ -816,7 +1089,9 @@ void AppRunningManager::RemoveAppRunningRecordById(const int32_t recordId)
         auto it = appRunningRecordMap_.find(recordId);
         if (it != appRunningRecordMap_.end()) {
             appRecord = it->second;
+            RemoveRecordIndexLocked(recordId, appRecord);
             appRunningRecordMap_.erase(it);
+            BumpRecordVersionLocked();
         }
     }
     {
@@ -839,6 +1114,8 @@ void AppRunningManager::ClearAppRunningRecordMap()
 {
     std::lock_guard guard(runningRecordMapMutex_);
     appRunningRecordMap_.clear();
+    ClearRecordIndexLocked();
+    BumpRecordVersionLocked();
 }
 
 void AppRunningManager::HandleTerminateTimeOut(int64_t eventId)
@@ -1210,8 +1487,8 @@ int32_t AppRunningManager::UpdateConfiguration(const Configuration& config, cons
 {
     HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
 
-    auto appRunningMap = GetAppRunningRecordMap();
-    TAG_LOGD(AAFwkTag::APPMGR, "current app size %{public}zu", appRunningMap.size());
+    auto appRunningMap = GetAppRunningRecordSnapshot();
+    TAG_LOGD(AAFwkTag::APPMGR, "current app size %{public}zu", appRunningMap->size());
 
     {
         std::lock_guard guard(appInfosLock_);
@@ -1222,7 +1499,7 @@ int32_t AppRunningManager::UpdateConfiguration(const Configuration& config, cons
         appInfos_.clear();
     }
 
-    for (const auto& item : appRunningMap) {
+    for (const auto& item : *appRunningMap) {
         const auto& appRecord = item.second;
         if (appRecord && appRecord->GetState() == ApplicationState::APP_STATE_CREATE) {
             TAG_LOGD(AAFwkTag::APPMGR, "app not ready, appName is %{public}s", appRecord->GetBundleName().c_str());
@@ -1294,13 +1571,13 @@ bool AppRunningManager::UpdateConfiguration(std::shared_ptr<AppRunningRecord>& a
 void AppRunningManager::ExecuteConfigurationTask(const BackgroundAppInfo& info, const int32_t userId,
     ConfigUpdateReason reason)
 {
-    auto appRunningMap = GetAppRunningRecordMap();
+    auto appRunningMap = GetAppRunningRecordSnapshot();
 
     std::lock_guard guard(updateConfigurationDelayedLock_);
     for (auto &item : updateConfigurationDelayedMap_) {
         std::shared_ptr<AppRunningRecord> appRecord = nullptr;
-        auto it = appRunningMap.find(item.first);
-        if (it != appRunningMap.end()) {
+        auto it = appRunningMap->find(item.first);
+        if (it != appRunningMap->end()) {
             appRecord = it->second;
         }
         if (appRecord == nullptr) {
@@ -1373,9 +1650,9 @@ int32_t AppRunningManager::UpdateConfigurationForBackgroundApp(const std::vector
 int32_t AppRunningManager::UpdateConfigurationByBundleName(const Configuration &config, const std::string &name,
     int32_t appIndex)
 {
-    auto appRunningMap = GetAppRunningRecordMap();
+    auto appRunningMap = GetAppRunningRecordSnapshot();
     int32_t result = ERR_OK;
-    for (const auto &item : appRunningMap) {
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (appRecord && appRecord->GetState() == ApplicationState::APP_STATE_CREATE) {
             TAG_LOGD(AAFwkTag::APPMGR, "app not ready, appName is %{public}s", appRecord->GetBundleName().c_str());
@@ -1393,8 +1670,8 @@ int32_t AppRunningManager::UpdateConfigurationByBundleName(const Configuration &
 
 int32_t AppRunningManager::NotifyMemoryLevel(int32_t level)
 {
-    auto appRunningMap = GetAppRunningRecordMap();
-    for (const auto &item : appRunningMap) {
+    auto appRunningMap = GetAppRunningRecordSnapshot();
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (!appRecord) {
             TAG_LOGE(AAFwkTag::APPMGR, "appRecord null");
@@ -1407,8 +1684,8 @@ int32_t AppRunningManager::NotifyMemoryLevel(int32_t level)
 
 int32_t AppRunningManager::NotifyProcMemoryLevel(const std::map<pid_t, MemoryLevel> &procLevelMap, bool isShellCall)
 {
-    auto appRunningMap = GetAppRunningRecordMap();
-    for (const auto &item : appRunningMap) {
+    auto appRunningMap = GetAppRunningRecordSnapshot();
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (!appRecord) {
             TAG_LOGE(AAFwkTag::APPMGR, "appRecord null");
@@ -1522,9 +1799,8 @@ bool AppRunningManager::GetAppRunningStateByBundleName(const std::string &bundle
 {
     HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
     TAG_LOGD(AAFwkTag::APPMGR, "called");
-    std::lock_guard guard(runningRecordMapMutex_);
-    for (const auto &item : appRunningRecordMap_) {
-        const auto &appRecord = item.second;
+    std::shared_lock guard(runningRecordMapMutex_);
+    for (const auto &appRecord : FindRecordsByBundleNameLocked(bundleName)) {
         if (appRecord && appRecord->GetBundleName() == bundleName) {
             TAG_LOGD(AAFwkTag::APPMGR, "Process of [%{public}s] is running, processName: %{public}s.",
                 bundleName.c_str(), appRecord->GetProcessName().c_str());
@@ -1549,8 +1825,8 @@ int32_t AppRunningManager::NotifyLoadRepairPatch(const std::string &bundleName,
         return ERR_INVALID_VALUE;
     }
 
-    auto appRunningMap = GetAppRunningRecordMap();
-    for (const auto &item : appRunningMap) {
+    auto appRunningMap = GetAppRunningRecordSnapshot();
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (appRecord && appRecord->GetBundleName() == bundleName) {
             auto recordId = appRecord->GetRecordId();
@@ -1580,8 +1856,8 @@ int32_t AppRunningManager::NotifyHotReloadPage(const std::string &bundleName, co
         return ERR_INVALID_VALUE;
     }
 
-    auto appRunningMap = GetAppRunningRecordMap();
-    for (const auto &item : appRunningMap) {
+    auto appRunningMap = GetAppRunningRecordSnapshot();
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (appRecord && appRecord->GetBundleName() == bundleName) {
             auto recordId = appRecord->GetRecordId();
@@ -1612,8 +1888,8 @@ int32_t AppRunningManager::NotifyUnLoadRepairPatch(const std::string &bundleName
         return ERR_INVALID_VALUE;
     }
 
-    auto appRunningMap = GetAppRunningRecordMap();
-    for (const auto &item : appRunningMap) {
+    auto appRunningMap = GetAppRunningRecordSnapshot();
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (appRecord && appRecord->GetBundleName() == bundleName) {
             auto recordId = appRecord->GetRecordId();
@@ -1762,9 +2038,8 @@ bool AppRunningManager::IsApplicationFirstFocused(const AppRunningRecord &focuse
 bool AppRunningManager::IsApplicationUnfocused(const int32_t uid)
 {
     TAG_LOGD(AAFwkTag::APPMGR, "check is application unfocused.");
-    std::lock_guard guard(runningRecordMapMutex_);
-    for (const auto &item : appRunningRecordMap_) {
-        const auto &appRecord = item.second;
+    std::shared_lock guard(runningRecordMapMutex_);
+    for (const auto &appRecord : FindRecordsByUidLocked(uid)) {
         if (appRecord && appRecord->GetUid() == uid && appRecord->GetFocusFlag()) {
             return false;
         }
@@ -1776,8 +2051,8 @@ void AppRunningManager::SetAttachAppDebug(const std::string &bundleName, const b
     bool isDebugFromLocal)
 {
     TAG_LOGD(AAFwkTag::APPMGR, "called");
-    auto appRunningMap = GetAppRunningRecordMap();
-    for (const auto &item : appRunningMap) {
+    auto appRunningMap = GetAppRunningRecordSnapshot();
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         if (appRecord == nullptr) {
             continue;
@@ -2079,7 +2354,8 @@ int AppRunningManager::DumpIpcAllStart(std::string& result)
 {
     TAG_LOGD(AAFwkTag::APPMGR, "called");
     int errCode = DumpErrorCode::ERR_OK;
-    for (const auto &item : GetAppRunningRecordMap()) {
+    auto appRunningMap = GetAppRunningRecordSnapshot();
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         TAG_LOGD(AAFwkTag::APPMGR, "AppRunningManager::DumpIpcAllStart::pid:%{public}d",
             appRecord->GetPid());
@@ -2097,7 +2373,8 @@ int AppRunningManager::DumpIpcAllStop(std::string& result)
 {
     TAG_LOGD(AAFwkTag::APPMGR, "called");
     int errCode = DumpErrorCode::ERR_OK;
-    for (const auto &item : GetAppRunningRecordMap()) {
+    auto appRunningMap = GetAppRunningRecordSnapshot();
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         TAG_LOGD(AAFwkTag::APPMGR, "AppRunningManager::DumpIpcAllStop::pid:%{public}d",
             appRecord->GetPid());
@@ -2115,7 +2392,8 @@ int AppRunningManager::DumpIpcAllStat(std::string& result)
 {
     TAG_LOGD(AAFwkTag::APPMGR, "called");
     int errCode = DumpErrorCode::ERR_OK;
-    for (const auto &item : GetAppRunningRecordMap()) {
+    auto appRunningMap = GetAppRunningRecordSnapshot();
+    for (const auto &item : *appRunningMap) {
         const auto &appRecord = item.second;
         TAG_LOGD(AAFwkTag::APPMGR, "AppRunningManager::DumpIpcAllStat::pid:%{public}d",
             appRecord->GetPid());
@@ -219,7 +219,43 @@ uint32_t AppRunningRecord::GetAccessTokenId() const
 
 void AppRunningRecord::SetUid(const int32_t uid)
 {
-    mainUid_ = uid;
+    UidChangedHandler handler;
+    {
+        std::lock_guard lock(uidChangedHandlerLock_);
+        handler = uidChangedHandler_;
+    }
+    auto exchangeUid = [this, uid]() {
+        return mainUid_.exchange(uid);
+    };
+    if (handler) {
+        handler(appRecordId_, uid, exchangeUid);
+        return;
+    }
+    exchangeUid();
+}
+
+void AppRunningRecord::SetUidChangedHandler(UidChangedHandler handler)
+{
+    std::lock_guard lock(uidChangedHandlerLock_);
+    uidChangedHandler_ = std::move(handler);
+}
+
+void AppRunningRecord::SetAbilityChangedHandler(AbilityChangedHandler handler)
+{
+    std::lock_guard lock(abilityChangedHandlerLock_);
+    abilityChangedHandler_ = std::move(handler);
+}
+
+void AppRunningRecord::NotifyAbilityChanged(const sptr<IRemoteObject> &token, bool isAdded)
+{
+    AbilityChangedHandler handler;
+    {
+        std::lock_guard lock(abilityChangedHandlerLock_);
+        handler = abilityChangedHandler_;
+    }
+    if (handler) {
+        handler(appRecordId_, token, isAdded);
+    }
 }
 
 void AppRunningRecord::SetPreloadAttachTimeoutStartTime(const std::chrono::system_clock::time_point &time)
@@ -775,6 +811,7 @@ void AppRunningRecord::AddModule(std::shared_ptr<ApplicationInfo> appInfo,
         return;
     }
     moduleRecord->AddAbility(token, abilityInfo, want, abilityRecordId);
+    NotifyAbilityChanged(token, true);
 
     return;
 }
@@ -1165,6 +1202,7 @@ void AppRunningRecord::TerminateAbility(const sptr<IRemoteObject> &token, const
             abilityRecord, static_cast<int32_t>(AbilityState::ABILITY_STATE_TERMINATED), true, false);
     }
     moduleRecord->TerminateAbility(shared_from_this(), token, isForce);
+    NotifyAbilityChanged(token, false);
 
     if (GetProcessType() == ProcessType::NORMAL && HasOnlyOneExtensionType()) {
         SetProcessType(ProcessType::EXTENSION);
@@ -14,6 +14,8 @@
  */
 #include "app_spawn_client.h"
 
+#include <algorithm>
+#include <limits>
 #include <unordered_set>
 
 #include "ability_manager_errors.h"
@@ -50,6 +52,7 @@ constexpr const char* JITPERMISSIONSLIST_NAME_VALUE = "Permissions";
 constexpr const char* JITPERMISSIONSLIST_COUNT = "ohos.encaps.count";
 constexpr const char* JITPERMISSIONSLIST_PERMISSIONS_NAME = "permissions";
 constexpr const char* UNINSTALL_BUNDLE_NAME = "uninstallDebugHapMsg";
+constexpr size_t MAX_SPAWN_MSG_TEMPLATE_COUNT = 128;
 }
 AppSpawnClient::AppSpawnClient(bool isNWebSpawn)
 {
@@ -199,6 +202,81 @@ static std::string DumpJITPermissionListToJson(const JITPermissionsMap &jitPermi
     return jitPermissionsListJson.dump();
 }
 
+static bool IsSameHspList(const HspList &lhs, const HspList &rhs)
+{
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](const auto &left, const auto &right) {
+        return left.versionCode == right.versionCode && left.bundleName == right.bundleName &&
+            left.moduleName == right.moduleName;
+    });
+}
+
+static bool IsSameDataGroupInfoList(const DataGroupInfoList &lhs, const DataGroupInfoList &rhs)
+{
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](const auto &left, const auto &right) {
+        return left.gid == right.gid && left.userId == right.userId && left.uuid == right.uuid &&
+            left.dataGroupId == right.dataGroupId;
+    });
+}
+
+// compare the fields that go into the serialized infos only
+static bool IsTemplateOf(const SpawnMsgTemplate &msgTemplate, const AppSpawnStartMsg &startMsg)
+{
+    return msgTemplate.isScreenLockDataProtect == startMsg.isScreenLockDataProtect &&
+        IsSameHspList(msgTemplate.hspList, startMsg.hspList) &&
+        IsSameDataGroupInfoList(msgTemplate.dataGroupInfoList, startMsg.dataGroupInfoList) &&
+        msgTemplate.appEnv == startMsg.appEnv && msgTemplate.jitPermissionsMap == startMsg.jitPermissionsMap;
+}
+
+std::shared_ptr<const SpawnMsgTemplate> AppSpawnClient::GetSpawnMsgTemplate(const AppSpawnStartMsg &startMsg)
+{
+    auto key = std::make_pair(startMsg.bundleName, startMsg.uid);
+    {
+        std::lock_guard lock(spawnMsgTemplateMutex_);
+        auto iter = spawnMsgTemplates_.find(key);
+        if (iter != spawnMsgTemplates_.end() && IsTemplateOf(*iter->second, startMsg)) {
+            return iter->second;
+        }
+    }
+    auto msgTemplate = std::make_shared<SpawnMsgTemplate>();
+    msgTemplate->hspList = startMsg.hspList;
+    msgTemplate->dataGroupInfoList = startMsg.dataGroupInfoList;
+    msgTemplate->isScreenLockDataProtect = startMsg.isScreenLockDataProtect;
+    msgTemplate->appEnv = startMsg.appEnv;
+    msgTemplate->jitPermissionsMap = startMsg.jitPermissionsMap;
+    if (!startMsg.hspList.empty()) {
+        msgTemplate->hspListJson = DumpHspListToJson(startMsg.hspList);
+    }
+    if (!startMsg.dataGroupInfoList.empty()) {
+        msgTemplate->dataGroupInfoListJson =
+            DumpDataGroupInfoListToJson(startMsg.dataGroupInfoList, startMsg.isScreenLockDataProtect);
+    }
+    if (!startMsg.appEnv.empty()) {
+        msgTemplate->appEnvJson = DumpAppEnvToJson(startMsg.appEnv);
+    }
+    if (!startMsg.jitPermissionsMap.empty()) {
+        msgTemplate->jitPermissionsJson = DumpJITPermissionListToJson(startMsg.jitPermissionsMap);
+    }
+    if (startMsg.bundleName.empty()) {
+        return msgTemplate;
+    }
+    std::lock_guard lock(spawnMsgTemplateMutex_);
+    if (spawnMsgTemplates_.size() >= MAX_SPAWN_MSG_TEMPLATE_COUNT &&
+        spawnMsgTemplates_.find(key) == spawnMsgTemplates_.end()) {
+        spawnMsgTemplates_.clear();
+    }
+    spawnMsgTemplates_[key] = msgTemplate;
+    return msgTemplate;
+}
+
+void AppSpawnClient::ClearSpawnMsgTemplates(const std::string &bundleName)
+{
+    std::lock_guard lock(spawnMsgTemplateMutex_);
+    auto iter = spawnMsgTemplates_.lower_bound(std::make_pair(bundleName, std::numeric_limits<int32_t>::min()));
+    while (iter != spawnMsgTemplates_.end() && iter->first.first == bundleName) {
+        iter = spawnMsgTemplates_.erase(iter);
+    }
+}
+
 int32_t AppSpawnClient::SetDacInfo(const AppSpawnStartMsg &startMsg, AppSpawnReqMsgHandle reqHandle)
 {
     int32_t ret = 0;
@@ -227,8 +305,7 @@ int32_t AppSpawnClient::SetDacInfo(const AppSpawnStartMsg &startMsg, AppSpawnReq
 int32_t AppSpawnClient::SetMountPermission(const AppSpawnStartMsg &startMsg, AppSpawnReqMsgHandle reqHandle)
 {
     int32_t ret = 0;
-    std::set<std::string> mountPermissionList = startMsg.permissions;
-    for (std::string permission : mountPermissionList) {
+    for (const auto &permission : startMsg.permissions) {
         ret = AppSpawnClientAddPermission(handle_, reqHandle, permission.c_str());
         if (ret != 0) {
             TAG_LOGE(AAFwkTag::APPMGR, "AppSpawnReqMsgAddPermission %{public}s failed", permission.c_str());
@@ -340,9 +417,13 @@ int32_t AppSpawnClient::AppspawnSetExtMsg(const AppSpawnStartMsg &startMsg, AppS
         return ret;
     }
 
+    std::shared_ptr<const SpawnMsgTemplate> msgTemplate;
+    if (!startMsg.hspList.empty() || !startMsg.dataGroupInfoList.empty() || !startMsg.appEnv.empty()) {
+        msgTemplate = GetSpawnMsgTemplate(startMsg);
+    }
+
     if (!startMsg.hspList.empty()) {
-        ret = AppSpawnReqMsgAddStringInfo(reqHandle, MSG_EXT_NAME_HSP_LIST,
-            DumpHspListToJson(startMsg.hspList).c_str());
+        ret = AppSpawnReqMsgAddStringInfo(reqHandle, MSG_EXT_NAME_HSP_LIST, msgTemplate->hspListJson.c_str());
         if (ret) {
             TAG_LOGE(AAFwkTag::APPMGR, "fail, ret: %{public}d", ret);
             return ret;
@@ -351,7 +432,7 @@ int32_t AppSpawnClient::AppspawnSetExtMsg(const AppSpawnStartMsg &startMsg, AppS
 
     if (!startMsg.dataGroupInfoList.empty()) {
         ret = AppSpawnReqMsgAddStringInfo(reqHandle, MSG_EXT_NAME_DATA_GROUP,
-            DumpDataGroupInfoListToJson(startMsg.dataGroupInfoList, startMsg.isScreenLockDataProtect).c_str());
+            msgTemplate->dataGroupInfoListJson.c_str());
         if (ret) {
             TAG_LOGE(AAFwkTag::APPMGR, "fail, ret: %{public}d", ret);
             return ret;
@@ -367,7 +448,7 @@ int32_t AppSpawnClient::AppspawnSetExtMsg(const AppSpawnStartMsg &startMsg, AppS
     }
 
     if (!startMsg.appEnv.empty()) {
-        std::string appEnv = DumpAppEnvToJson(startMsg.appEnv);
+        const std::string &appEnv = msgTemplate->appEnvJson;
         TAG_LOGD(AAFwkTag::APPMGR, "bundleName: %{public}s, appEnv: %{public}s",
             startMsg.bundleName.c_str(), appEnv.c_str());
         ret = AppSpawnReqMsgAddStringInfo(reqHandle, MSG_EXT_NAME_APP_ENV, appEnv.c_str());
@@ -452,7 +533,8 @@ int32_t AppSpawnClient::AppspawnSetExtMsgMore(const AppSpawnStartMsg &startMsg,
     }
 
     if (!startMsg.jitPermissionsMap.empty()) {
-        std::string jitPermissionsStr = DumpJITPermissionListToJson(startMsg.jitPermissionsMap);
+        auto msgTemplate = GetSpawnMsgTemplate(startMsg);
+        const std::string &jitPermissionsStr = msgTemplate->jitPermissionsJson;
         ret = AppSpawnReqMsgAddStringInfo(reqHandle, MSG_EXT_NAME_JIT_PERMISSIONS, jitPermissionsStr.c_str());
         if (ret) {
             TAG_LOGE(AAFwkTag::APPMGR, "fail, ret: %{public}d", ret);
@@ -36,6 +36,7 @@ constexpr int OBSERVER_SINGLE_STEP_LOG = 10;
 constexpr int OBSERVER_UID_COUNT_LOG = 3;
 constexpr int OBSERVER_AMOUNT_COUNT_LOG = 70;
 constexpr int32_t RESOURCE_MANAGER_UID = 1096;
+constexpr size_t MAX_APP_STATE_BATCH_SIZE = 128;
 constexpr const char* DEVELOPER_MODE_STATE = "const.security.developermode.state";
 } // namespace
 AppStateObserverManager::AppStateObserverManager()
@@ -77,7 +78,7 @@ int32_t AppStateObserverManager::RegisterApplicationStateObserver(const sptr<IAp
         return ERR_INVALID_VALUE;
     }
     std::lock_guard lockRegister(observerLock_);
-    appStateObserverMap_.emplace(observer, AppStateObserverInfo{IPCSkeleton::GetCallingUid(),
+    AddAppStateObserverLocked(observer, AppStateObserverInfo{IPCSkeleton::GetCallingUid(),
         bundleNameList, appStateFilter});
     if (appStateObserverMap_.size() >= OBSERVER_SINGLE_COUNT_LOG &&
         appStateObserverMap_.size() % OBSERVER_SINGLE_STEP_LOG == 0) {
@@ -105,7 +106,8 @@ int32_t AppStateObserverManager::UnregisterApplicationStateObserver(const sptr<I
     for (auto it = appStateObserverMap_.begin(); it != appStateObserverMap_.end(); ++it) {
         if (it->first->AsObject() == observer->AsObject()) {
             DecreaseObserverCount(it->second.uid);
-            appStateObserverMap_.erase(it);
+            RemoveAppStateQueue(it->first);
+            EraseAppStateObserverLocked(it);
             TAG_LOGD(AAFwkTag::APPMGR, "appStateObserverMap_ size:%{public}zu", appStateObserverMap_.size());
             RemoveObserverDeathRecipient(observer);
             return ERR_OK;
@@ -646,13 +648,10 @@ void AppStateObserverManager::HandleOnAppStarted(const std::shared_ptr<AppRunnin
         GetFilterTypeFromBundleType(bundleType),
         GetFilterTypeFromApplicationState(static_cast<ApplicationState>(data.state)),
         FilterProcessStateType::NONE, FilterAbilityStateType::NONE};
-    auto appStateObserverMapCopy = GetAppStateObserverMapCopy();
-    for (auto it = appStateObserverMapCopy.begin(); it != appStateObserverMapCopy.end(); ++it) {
-        const auto &bundleNames = it->second.bundleNames;
-        auto iter = std::find(bundleNames.begin(), bundleNames.end(), data.bundleName);
-        if ((bundleNames.empty() || iter != bundleNames.end()) && it->first != nullptr &&
-            it->second.appStateFilter.Match(appStateFilter)) {
-            it->first->OnAppStarted(data);
+    auto observers = GetAppStateObserversByBundleName(data.bundleName);
+    for (const auto &target : observers) {
+        if (target.appStateFilter.Match(appStateFilter)) {
+            EnqueueAppStateCallback(target.observer, AppStateCallback::APP_STARTED, data);
         }
     }
 }
@@ -674,13 +673,10 @@ void AppStateObserverManager::HandleOnAppStopped(const std::shared_ptr<AppRunnin
         GetFilterTypeFromBundleType(bundleType),
         GetFilterTypeFromApplicationState(static_cast<ApplicationState>(data.state)),
         FilterProcessStateType::NONE, FilterAbilityStateType::NONE};
-    auto appStateObserverMapCopy = GetAppStateObserverMapCopy();
-    for (auto it = appStateObserverMapCopy.begin(); it != appStateObserverMapCopy.end(); ++it) {
-        const auto &bundleNames = it->second.bundleNames;
-        auto iter = std::find(bundleNames.begin(), bundleNames.end(), data.bundleName);
-        if ((bundleNames.empty() || iter != bundleNames.end()) && it->first != nullptr &&
-            it->second.appStateFilter.Match(appStateFilter)) {
-            it->first->OnAppStopped(data);
+    auto observers = GetAppStateObserversByBundleName(data.bundleName);
+    for (const auto &target : observers) {
+        if (target.appStateFilter.Match(appStateFilter)) {
+            EnqueueAppStateCallback(target.observer, AppStateCallback::APP_STOPPED, data);
         }
     }
 }
@@ -718,21 +714,16 @@ void AppStateObserverManager::HandleAppStateChanged(const std::shared_ptr<AppRun
                 filterBundleType, filterAppStateType, FilterProcessStateType::NONE, FilterAbilityStateType::NONE};
             AppStateFilter appStateChangedFilter {FilterCallback::ON_APP_STATE_CHANGED,
                 filterBundleType, filterAppStateType, FilterProcessStateType::NONE, FilterAbilityStateType::NONE};
-            auto appStateObserverMapCopy = GetAppStateObserverMapCopy();
-            for (auto it = appStateObserverMapCopy.begin(); it != appStateObserverMapCopy.end(); ++it) {
-                const auto &bundleNames = it->second.bundleNames;
-                auto iter = std::find(bundleNames.begin(), bundleNames.end(), data.bundleName);
-                bool valid = (bundleNames.empty() || iter != bundleNames.end()) && it->first != nullptr;
-                valid = valid && !PreventNotify(state, it->second.uid, isByCall);
-                if (valid) {
-                    if (it->second.appStateFilter.Match(foregroundChangedFilter)) {
-                        it->first->OnForegroundApplicationChanged(data);
-                    }
+            auto observers = GetAppStateObserversByBundleName(data.bundleName);
+            for (const auto &target : observers) {
+                if (PreventNotify(state, target.uid, isByCall)) {
+                    continue;
+                }
+                if (target.appStateFilter.Match(foregroundChangedFilter)) {
+                    EnqueueAppStateCallback(target.observer, AppStateCallback::FOREGROUND_APPLICATION_CHANGED, data);
                 }
-                if (valid && needNotifyApp) {
-                    if (it->second.appStateFilter.Match(appStateChangedFilter)) {
-                        it->first->OnAppStateChanged(data);
-                    }
+                if (needNotifyApp && target.appStateFilter.Match(appStateChangedFilter)) {
+                    EnqueueAppStateCallback(target.observer, AppStateCallback::APP_STATE_CHANGED, data);
                 }
             }
         }
@@ -745,13 +736,10 @@ void AppStateObserverManager::HandleAppStateChanged(const std::shared_ptr<AppRun
             GetFilterTypeFromBundleType(bundleType),
             GetFilterTypeFromApplicationState(static_cast<ApplicationState>(data.state)),
             FilterProcessStateType::NONE, FilterAbilityStateType::NONE};
-        auto appStateObserverMapCopy = GetAppStateObserverMapCopy();
-        for (auto it = appStateObserverMapCopy.begin(); it != appStateObserverMapCopy.end(); ++it) {
-            const auto &bundleNames = it->second.bundleNames;
-            auto iter = std::find(bundleNames.begin(), bundleNames.end(), data.bundleName);
-            if ((bundleNames.empty() || iter != bundleNames.end()) && it->first != nullptr &&
-                it->second.appStateFilter.Match(appStateFilter)) {
-                it->first->OnApplicationStateChanged(data);
+        auto observers = GetAppStateObserversByBundleName(data.bundleName);
+        for (const auto &target : observers) {
+            if (target.appStateFilter.Match(appStateFilter)) {
+                EnqueueAppStateCallback(target.observer, AppStateCallback::APPLICATION_STATE_CHANGED, data);
             }
         }
     }
@@ -792,11 +780,15 @@ void AppStateObserverManager::HandleStateChangedNotifyObserver(
         }
         if (isAbility) {
             if (it->second.appStateFilter.Match(appStateFilter)) {
-                it->first->OnAbilityStateChanged(abilityStateData);
+                EnqueueObserverCallback(it->first, [abilityStateData](const sptr<IApplicationStateObserver> &observer) {
+                    observer->OnAbilityStateChanged(abilityStateData);
+                });
             }
         } else {
             if (it->second.appStateFilter.Match(appStateFilter)) {
-                it->first->OnExtensionStateChanged(abilityStateData);
+                EnqueueObserverCallback(it->first, [abilityStateData](const sptr<IApplicationStateObserver> &observer) {
+                    observer->OnExtensionStateChanged(abilityStateData);
+                });
             }
         }
     }
@@ -837,7 +829,9 @@ void AppStateObserverManager::HandleOnProcessResued(const std::shared_ptr<Proces
             FilterAbilityStateType::NONE};
         if ((bundleNames.empty() || iter != bundleNames.end()) && it->first != nullptr &&
             it->second.appStateFilter.Match(appStateFilter)) {
-            it->first->OnProcessReused(*data);
+            EnqueueObserverCallback(it->first, [data](const sptr<IApplicationStateObserver> &observer) {
+                observer->OnProcessReused(*data);
+            });
 }
     }
 }
@@ -908,7 +902,9 @@ void AppStateObserverManager::HandleOnProcessCreated(const std::shared_ptr<Proce
             FilterAbilityStateType::NONE};
         if ((bundleNames.empty() || iter != bundleNames.end()) && it->first != nullptr &&
             it->second.appStateFilter.Match(appStateFilter)) {
-            it->first->OnProcessCreated(*data);
+            EnqueueObserverCallback(it->first, [data](const sptr<IApplicationStateObserver> &observer) {
+                observer->OnProcessCreated(*data);
+            });
 }
     }
 }
@@ -937,7 +933,9 @@ void AppStateObserverManager::HandleOnProcessStateChanged(
         auto iter = std::find(bundleNames.begin(), bundleNames.end(), data->bundleName);
         if ((bundleNames.empty() || iter != bundleNames.end()) && it->first != nullptr &&
             it->second.appStateFilter.Match(appStateFilter) && !PreventNotify(state, it->second.uid, isByCall)) {
-            it->first->OnProcessStateChanged(*data);
+            EnqueueObserverCallback(it->first, [data](const sptr<IApplicationStateObserver> &observer) {
+                observer->OnProcessStateChanged(*data);
+            });
         }
     }
 }
@@ -970,7 +968,9 @@ void AppStateObserverManager::HandleOnWindowShow(const std::shared_ptr<AppRunnin
         auto iter = std::find(bundleNames.begin(), bundleNames.end(), data->bundleName);
         if ((bundleNames.empty() || iter != bundleNames.end()) && it->first != nullptr &&
             it->second.appStateFilter.Match(appStateFilter)) {
-            it->first->OnWindowShow(*data);
+            EnqueueObserverCallback(it->first, [data](const sptr<IApplicationStateObserver> &observer) {
+                observer->OnWindowShow(*data);
+            });
         }
     }
 }
@@ -1003,7 +1003,9 @@ void AppStateObserverManager::HandleOnWindowHidden(const std::shared_ptr<AppRunn
         auto iter = std::find(bundleNames.begin(), bundleNames.end(), data->bundleName);
         if ((bundleNames.empty() || iter != bundleNames.end()) && it->first != nullptr &&
             it->second.appStateFilter.Match(appStateFilter)) {
-            it->first->OnWindowHidden(*data);
+            EnqueueObserverCallback(it->first, [data](const sptr<IApplicationStateObserver> &observer) {
+                observer->OnWindowHidden(*data);
+            });
         }
     }
 }
@@ -1077,7 +1079,9 @@ void AppStateObserverManager::HandleOnProcessDied(const std::shared_ptr<ProcessD
             FilterAbilityStateType::NONE};
         if ((bundleNames.empty() || iter != bundleNames.end()) && it->first != nullptr &&
             it->second.appStateFilter.Match(appStateFilter)) {
-            it->first->OnProcessDied(*data);
+            EnqueueObserverCallback(it->first, [data](const sptr<IApplicationStateObserver> &observer) {
+                observer->OnProcessDied(*data);
+            });
 }
     }
 }
@@ -1328,6 +1332,212 @@ AppStateObserverMap AppStateObserverManager::GetAppStateObserverMapCopy()
     return appStateObserverMap_;
 }
 
+std::vector<AppStateObserverTarget> AppStateObserverManager::GetAppStateObserversByBundleName(
+    const std::string &bundleName)
+{
+    std::vector<AppStateObserverTarget> targets;
+    std::lock_guard lock(observerLock_);
+    auto appendTarget = [this, &targets](const sptr<IApplicationStateObserver> &observer) {
+        auto iter = appStateObserverMap_.find(observer);
+        if (iter != appStateObserverMap_.end()) {
+            targets.push_back({ observer, iter->second.uid, iter->second.appStateFilter });
+        }
+    };
+    for (const auto &observer : allBundleObservers_) {
+        appendTarget(observer);
+    }
+    auto iter = bundleObserverIndex_.find(bundleName);
+    if (iter != bundleObserverIndex_.end()) {
+        for (const auto &observer : iter->second) {
+            appendTarget(observer);
+        }
+    }
+    return targets;
+}
+
+void AppStateObserverManager::AddAppStateObserverLocked(const sptr<IApplicationStateObserver> &observer,
+    const AppStateObserverInfo &info)
+{
+    if (!appStateObserverMap_.emplace(observer, info).second || observer == nullptr) {
+        return;
+    }
+    if (info.bundleNames.empty()) {
+        allBundleObservers_.insert(observer);
+        return;
+    }
+    for (const auto &bundleName : info.bundleNames) {
+        bundleObserverIndex_[bundleName].insert(observer);
+    }
+}
+
+void AppStateObserverManager::EraseAppStateObserverLocked(AppStateObserverMap::iterator iter)
+{
+    if (iter == appStateObserverMap_.end()) {
+        return;
+    }
+    allBundleObservers_.erase(iter->first);
+    for (const auto &bundleName : iter->second.bundleNames) {
+        auto indexIter = bundleObserverIndex_.find(bundleName);
+        if (indexIter == bundleObserverIndex_.end()) {
+            continue;
+        }
+        indexIter->second.erase(iter->first);
+        if (indexIter->second.empty()) {
+            bundleObserverIndex_.erase(indexIter);
+        }
+    }
+    appStateObserverMap_.erase(iter);
+}
+
+void AppStateObserverManager::EnqueueAppStateCallback(const sptr<IApplicationStateObserver> &observer,
+    AppStateCallback callback, const AppStateData &data)
+{
+    EnqueuePendingAppState(observer, { callback, data, nullptr, std::chrono::steady_clock::now() });
+}
+
+void AppStateObserverManager::EnqueueObserverCallback(const sptr<IApplicationStateObserver> &observer,
+    ObserverCallback deliver)
+{
+    EnqueuePendingAppState(observer,
+        { AppStateCallback::OBSERVER_CALLBACK, {}, std::move(deliver), std::chrono::steady_clock::now() });
+}
+
+void AppStateObserverManager::EnqueuePendingAppState(const sptr<IApplicationStateObserver> &observer,
+    PendingAppState &&item)
+{
+    if (handler_ == nullptr) {
+        DeliverAppStateCallback(observer, item);
+        return;
+    }
+    {
+        std::lock_guard lock(appStateDeliveryLock_);
+        auto &queue = appStateDeliveryQueues_[observer];
+        appStateDeliveryStat_.enqueued++;
+        // every callback is kept, observers track transitions such as foreground to background of a process
+        queue.pending.push_back(std::move(item));
+        appStateDeliveryStat_.maxQueueDepth = std::max(appStateDeliveryStat_.maxQueueDepth, queue.pending.size());
+        if (queue.flushScheduled) {
+            return;
+        }
+        queue.flushScheduled = true;
+    }
+
+    auto task = [weak = weak_from_this(), observer]() {
+        auto self = weak.lock();
+        if (self == nullptr) {
+            TAG_LOGE(AAFwkTag::APPMGR, "null self");
+            return;
+        }
+        self->FlushAppStateQueue(observer);
+    };
+    AAFwk::TaskAttribute taskAttribute{ .taskName_ = "FlushAppState", .taskQos_ = AAFwk::TaskQoS::USER_INTERACTIVE };
+    handler_->SubmitTask(task, taskAttribute);
+}
+
+void AppStateObserverManager::DeliverAppStateCallback(const sptr<IApplicationStateObserver> &observer,
+    const PendingAppState &item)
+{
+    const auto &data = item.data;
+    switch (item.callback) {
+        case AppStateCallback::APP_STARTED:
+            observer->OnAppStarted(data);
+            break;
+        case AppStateCallback::APP_STOPPED:
+            observer->OnAppStopped(data);
+            break;
+        case AppStateCallback::APPLICATION_STATE_CHANGED:
+            observer->OnApplicationStateChanged(data);
+            break;
+        case AppStateCallback::FOREGROUND_APPLICATION_CHANGED:
+            observer->OnForegroundApplicationChanged(data);
+            break;
+        case AppStateCallback::APP_STATE_CHANGED:
+            observer->OnAppStateChanged(data);
+            break;
+        case AppStateCallback::OBSERVER_CALLBACK:
+            if (item.deliver) {
+                item.deliver(observer);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void AppStateObserverManager::FlushAppStateQueue(const sptr<IApplicationStateObserver> &observer)
+{
+    HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
+    std::vector<PendingAppState> pending;
+    {
+        std::lock_guard lock(appStateDeliveryLock_);
+        auto iter = appStateDeliveryQueues_.find(observer);
+        if (iter == appStateDeliveryQueues_.end()) {
+            TAG_LOGD(AAFwkTag::APPMGR, "observer unregistered");
+            return;
+        }
+        pending.swap(iter->second.pending);
+        iter->second.flushScheduled = false;
+        auto now = std::chrono::steady_clock::now();
+        for (const auto &item : pending) {
+            uint64_t latencyUs = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(now - item.enqueueTime).count());
+            appStateDeliveryStat_.totalLatencyUs += latencyUs;
+            appStateDeliveryStat_.maxLatencyUs = std::max(appStateDeliveryStat_.maxLatencyUs, latencyUs);
+        }
+        appStateDeliveryStat_.delivered += pending.size();
+    }
+    uint64_t batches = 0;
+    size_t begin = 0;
+    while (begin < pending.size()) {
+        // consecutive app state changes go in one call, any other callback in between keeps its place
+        size_t end = begin;
+        while (end < pending.size() && end - begin < MAX_APP_STATE_BATCH_SIZE &&
+            pending[end].callback == AppStateCallback::APP_STATE_CHANGED) {
+            end++;
+        }
+        if (end - begin > 1) {
+            std::vector<AppStateData> appStateDataList;
+            appStateDataList.reserve(end - begin);
+            for (size_t i = begin; i < end; i++) {
+                appStateDataList.emplace_back(std::move(pending[i].data));
+            }
+            observer->OnAppStatesChanged(appStateDataList);
+        } else {
+            DeliverAppStateCallback(observer, pending[begin]);
+            end = begin + 1;
+        }
+        batches++;
+        begin = end;
+    }
+    std::lock_guard lock(appStateDeliveryLock_);
+    appStateDeliveryStat_.batches += batches;
+}
+
+void AppStateObserverManager::RemoveAppStateQueue(const sptr<IApplicationStateObserver> &observer)
+{
+    std::lock_guard lock(appStateDeliveryLock_);
+    appStateDeliveryQueues_.erase(observer);
+}
+
+void AppStateObserverManager::DumpAppStateDeliveryStat(std::string &result)
+{
+    std::lock_guard lock(appStateDeliveryLock_);
+    const auto &stat = appStateDeliveryStat_;
+    size_t pendingCount = 0;
+    for (const auto &[observer, queue] : appStateDeliveryQueues_) {
+        pendingCount += queue.pending.size();
+    }
+    uint64_t avgLatencyUs = (stat.delivered == 0) ? 0 : stat.totalLatencyUs / stat.delivered;
+    result.append("app state delivery:\n")
+        .append("  enqueued: ").append(std::to_string(stat.enqueued)).append("\n")
+        .append("  delivered: ").append(std::to_string(stat.delivered)).append("\n")
+        .append("  batches: ").append(std::to_string(stat.batches)).append("\n")
+        .append("  avg latency(us): ").append(std::to_string(avgLatencyUs)).append("\n")
+        .append("  max latency(us): ").append(std::to_string(stat.maxLatencyUs)).append("\n")
+        .append("  max queue depth: ").append(std::to_string(stat.maxQueueDepth)).append("\n")
+        .append("  pending: ").append(std::to_string(pendingCount)).append("\n");
+}
+
 AppForegroundStateObserverMap AppStateObserverManager::GetAppForegroundStateObserverMapCopy()
 {
     std::lock_guard lock(appForegroundObserverLock_);
@@ -1471,7 +1681,9 @@ void AppStateObserverManager::HandleOnPageShow(const PageStateData pageStateData
             FilterAppStateType::ALL, FilterProcessStateType::ALL, FilterAbilityStateType::ALL};
         if ((bundleNames.empty() || iter != bundleNames.end()) && it->first != nullptr &&
             it->second.appStateFilter.Match(appStateFilter)) {
-            it->first->OnPageShow(pageStateData);
+            EnqueueObserverCallback(it->first, [pageStateData](const sptr<IApplicationStateObserver> &observer) {
+                observer->OnPageShow(pageStateData);
+            });
         }
     }
 }
@@ -1487,7 +1699,9 @@ void AppStateObserverManager::HandleOnPageHide(const PageStateData pageStateData
             FilterAppStateType::ALL, FilterProcessStateType::ALL, FilterAbilityStateType::ALL};
         if ((bundleNames.empty() || iter != bundleNames.end()) && it->first != nullptr &&
             it->second.appStateFilter.Match(appStateFilter)) {
-            it->first->OnPageHide(pageStateData);
+            EnqueueObserverCallback(it->first, [pageStateData](const sptr<IApplicationStateObserver> &observer) {
+                observer->OnPageHide(pageStateData);
+            });
         }
     }
 }
@@ -1537,7 +1751,9 @@ void AppStateObserverManager::HandleOnAppCacheStateChanged(const std::shared_ptr
         auto iter = std::find(bundleNames.begin(), bundleNames.end(), data.bundleName);
         if ((bundleNames.empty() || iter != bundleNames.end()) && it->first != nullptr &&
             it->second.appStateFilter.Match(appStateFilter)) {
-            it->first->OnAppCacheStateChanged(data);
+            EnqueueObserverCallback(it->first, [data](const sptr<IApplicationStateObserver> &observer) {
+                observer->OnAppCacheStateChanged(data);
+            });
         }
     }
 }
@@ -1609,7 +1825,9 @@ void AppStateObserverManager::HandleOnProcessBindingRelationChanged(
             FilterBundleType::ALL, FilterAppStateType::ALL, FilterProcessStateType::ALL, FilterAbilityStateType::ALL};
         if ((bundleNames.empty() || iter != bundleNames.end()) && it->first != nullptr &&
             it->second.appStateFilter.Match(appStateFilter)) {
-            it->first->OnProcessBindingRelationChanged(data);
+            EnqueueObserverCallback(it->first, [data](const sptr<IApplicationStateObserver> &observer) {
+                observer->OnProcessBindingRelationChanged(data);
+            });
         }
     }
 }
@@ -1665,7 +1883,9 @@ void AppStateObserverManager::HandleOnKeepAliveStateChanged(const std::shared_pt
         auto iter = std::find(bundleNames.begin(), bundleNames.end(), data->bundleName);
         if ((bundleNames.empty() || iter != bundleNames.end()) && it->first != nullptr &&
             it->second.appStateFilter.Match(appStateFilter)) {
-            it->first->OnKeepAliveStateChanged(*data);
+            EnqueueObserverCallback(it->first, [data](const sptr<IApplicationStateObserver> &observer) {
+                observer->OnKeepAliveStateChanged(*data);
+            });
         }
     }
 }
@@ -1724,7 +1944,9 @@ void AppStateObserverManager::HandleOnProcessPreForegroundChanged(std::shared_pt
         auto iter = std::find(bundleNames.begin(), bundleNames.end(), bundleName);
         if ((bundleNames.empty() || iter != bundleNames.end()) && it->first != nullptr &&
             it->second.appStateFilter.Match(appStateFilter)) {
-            it->first->OnProcessPreForegroundChanged(preloadProcessData);
+            EnqueueObserverCallback(it->first, [preloadProcessData](const sptr<IApplicationStateObserver> &observer) {
+                observer->OnProcessPreForegroundChanged(preloadProcessData);
+            });
         }
     }
 }
@@ -1782,7 +2004,9 @@ void AppStateObserverManager::HandleOnProcessTypeChanged(const std::shared_ptr<A
         auto iter = std::find(bundleNames.begin(), bundleNames.end(), data->bundleName);
         if ((bundleNames.empty() || iter != bundleNames.end()) && it->first != nullptr &&
             it->second.appStateFilter.Match(appStateFilter)) {
-            it->first->OnProcessTypeChanged(*data);
+            EnqueueObserverCallback(it->first, [data](const sptr<IApplicationStateObserver> &observer) {
+                observer->OnProcessTypeChanged(*data);
+            });
         }
     }
 }
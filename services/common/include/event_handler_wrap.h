@@ -16,10 +16,13 @@
 #ifndef OHOS_ABILITY_RUNTIME_EVENT_HANDLER_WRAP_H
 #define OHOS_ABILITY_RUNTIME_EVENT_HANDLER_WRAP_H
 
+#include <array>
 #include <string>
 #include <memory>
 #include <unordered_map>
 #include <functional>
+#include <optional>
+#include <vector>
 
 #include "task_handler_wrap.h"
 
@@ -84,6 +87,10 @@ public:
         }
         return std::to_string(eventId_) + "_" + taskName_;
     }
+    bool HasTaskName() const
+    {
+        return !taskName_.empty();
+    }
     bool IsSame(const EventWrap &other) const
     {
         return eventData_ == other.eventData_;
@@ -119,6 +126,91 @@ private:
     std::string taskName_;
 };
 
+/**
+ * @class EventTimerWheel
+ * Hierarchical timer wheel of the delayed events keyed by event id and param, arming and cancelling an event are
+ * O(1) and do not create any task. Not thread safe, guarded by the event mutex of EventHandlerWrap.
+ */
+class EventTimerWheel {
+public:
+    static constexpr int64_t DEFAULT_TICK_MILLIS = 10;
+
+    explicit EventTimerWheel(int64_t tickMillis = DEFAULT_TICK_MILLIS);
+
+    /**
+     * @brief Arm the event to expire after delayMillis.
+     * @param expireTime Output, the time the event expires at, rounded up to the tick.
+     * @return Returns false if an event of the same id and param is armed.
+     */
+    bool Arm(const EventWrap &event, int64_t nowMillis, int64_t delayMillis, int64_t &expireTime);
+
+    const EventWrap *Find(uint32_t eventId, int64_t param) const;
+
+    bool Cancel(uint32_t eventId, int64_t param);
+
+    /**
+     * @brief Advance the wheel to nowMillis and take out the expired events.
+     */
+    void Expire(int64_t nowMillis, std::vector<EventWrap> &events);
+
+    /**
+     * @brief Get the time the wheel needs to be advanced at, which is the expire time of the earliest event or
+     * the time it is cascaded to a lower level.
+     * @return Returns -1 if no event is armed.
+     */
+    int64_t GetNextExpireTime() const;
+
+    size_t GetSize() const
+    {
+        return index_.size();
+    }
+
+private:
+    static constexpr uint32_t LEVEL_COUNT = 4;
+
+    struct EventKey {
+        uint32_t eventId;
+        int64_t param;
+
+        bool operator==(const EventKey &other) const
+        {
+            return eventId == other.eventId && param == other.param;
+        }
+    };
+
+    struct EventKeyHash {
+        size_t operator()(const EventKey &key) const
+        {
+            return std::hash<int64_t>()(key.param) ^ (std::hash<uint32_t>()(key.eventId) << 1);
+        }
+    };
+
+    struct TimerNode {
+        std::optional<EventWrap> event;
+        int64_t expireTick = 0;
+        uint32_t level = 0;
+        uint32_t slot = 0;
+        uint32_t prev = 0;
+        uint32_t next = 0;
+    };
+
+    void Link(uint32_t node);
+    void Unlink(uint32_t node);
+    uint32_t DetachSlot(uint32_t slot);
+    uint32_t Cascade(uint32_t level);
+    void ExpireSlot(uint32_t slot, std::vector<EventWrap> &events);
+    void FreeNode(uint32_t node);
+
+    int64_t tickMillis_;
+    int64_t currentTick_ = 0;
+    std::vector<TimerNode> nodes_;
+    std::vector<uint32_t> freeNodes_;
+    // heads of the lists of the slots of all levels
+    std::vector<uint32_t> slots_;
+    std::array<size_t, LEVEL_COUNT> levelCounts_ = {};
+    std::unordered_map<EventKey, uint32_t, EventKeyHash> index_;
+};
+
 class EventHandlerWrap : public std::enable_shared_from_this<EventHandlerWrap> {
 public:
     EventHandlerWrap();
@@ -145,6 +237,17 @@ protected:
 
     std::unique_ptr<ffrt::mutex> eventMutex_;
     std::unordered_map<std::string, EventWrap> eventMap_;
+    // timeouts sent without force insert, the hot path of the lifecycle transitions
+    EventTimerWheel timerWheel_;
+    // time of the pending task advancing timerWheel_, 0 if none
+    int64_t timerWheelDriveTime_ = 0;
+
+private:
+    void SubmitEventTask(EventWrap &event, const std::string &eventStr, int64_t delayMillis);
+    bool SendTimerEvent(EventWrap &event, int64_t delayMillis);
+    void ScheduleTimerWheel(int64_t expireTime, int64_t nowMillis);
+    void DriveTimerWheel(int64_t driveTime);
+    bool CanRemoveEvent(const EventWrap &origin, const EventWrap &event, bool force);
 };
 }  // namespace AAFWK
 }  // namespace OHOS
@@ -15,6 +15,7 @@
 
 #include "event_handler_wrap.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <chrono>
 #include <mutex>
@@ -27,12 +28,208 @@ namespace AAFwk {
 namespace {
 constexpr int64_t EVENT_TIME_DIFF = 200;  // ms
 constexpr int64_t EVENT_TIME_CANCEL = 3000; // ms
+constexpr const char* TIMER_WHEEL_TASK_NAME = "EventTimerWheel";
+constexpr uint32_t WHEEL_LEVEL_SHIFTS[] = { 0, 8, 14, 20 };
+constexpr uint32_t WHEEL_LEVEL_SIZES[] = { 256, 64, 64, 64 };
+constexpr uint32_t WHEEL_LEVEL_OFFSETS[] = { 0, 256, 320, 384 };
+constexpr uint32_t WHEEL_SLOT_COUNT = 448;
+constexpr int64_t WHEEL_MAX_DELTA_TICKS = (1LL << 26) - 1;
+constexpr uint32_t INVALID_NODE = UINT32_MAX;
 inline int64_t GetCurrentTimeMillis()
 {
     return std::chrono::duration_cast<std::chrono::milliseconds>(
         std::chrono::steady_clock::now().time_since_epoch()).count();
 }
 }
+EventTimerWheel::EventTimerWheel(int64_t tickMillis)
+    : tickMillis_(tickMillis > 0 ? tickMillis : DEFAULT_TICK_MILLIS), slots_(WHEEL_SLOT_COUNT, INVALID_NODE)
+{}
+
+bool EventTimerWheel::Arm(const EventWrap &event, int64_t nowMillis, int64_t delayMillis, int64_t &expireTime)
+{
+    EventKey key = { event.GetEventId(), event.GetParam() };
+    if (index_.find(key) != index_.end()) {
+        return false;
+    }
+    int64_t nowTick = nowMillis / tickMillis_;
+    if (index_.empty() && nowTick > currentTick_) {
+        // nothing to expire or cascade in between
+        currentTick_ = nowTick;
+    }
+    int64_t expireTick = std::max((nowMillis + delayMillis + tickMillis_ - 1) / tickMillis_, currentTick_ + 1);
+    uint32_t node = 0;
+    if (!freeNodes_.empty()) {
+        node = freeNodes_.back();
+        freeNodes_.pop_back();
+    } else {
+        node = static_cast<uint32_t>(nodes_.size());
+        nodes_.emplace_back();
+    }
+    nodes_[node].event = event;
+    nodes_[node].expireTick = expireTick;
+    index_.emplace(key, node);
+    Link(node);
+    expireTime = expireTick * tickMillis_;
+    return true;
+}
+
+const EventWrap *EventTimerWheel::Find(uint32_t eventId, int64_t param) const
+{
+    auto iter = index_.find(EventKey { eventId, param });
+    if (iter == index_.end()) {
+        return nullptr;
+    }
+    return &nodes_[iter->second].event.value();
+}
+
+bool EventTimerWheel::Cancel(uint32_t eventId, int64_t param)
+{
+    auto iter = index_.find(EventKey { eventId, param });
+    if (iter == index_.end()) {
+        return false;
+    }
+    uint32_t node = iter->second;
+    index_.erase(iter);
+    Unlink(node);
+    FreeNode(node);
+    return true;
+}
+
+void EventTimerWheel::Expire(int64_t nowMillis, std::vector<EventWrap> &events)
+{
+    int64_t nowTick = nowMillis / tickMillis_;
+    while (currentTick_ < nowTick) {
+        if (index_.empty()) {
+            currentTick_ = nowTick;
+            return;
+        }
+        uint32_t lowestLevel = 0;
+        while (levelCounts_[lowestLevel] == 0) {
+            lowestLevel++;
+        }
+        if (lowestLevel > 0) {
+            // the lower levels are empty, nothing happens until the next cascade of the lowest level
+            int64_t boundary = ((currentTick_ >> WHEEL_LEVEL_SHIFTS[lowestLevel]) + 1) <<
+                WHEEL_LEVEL_SHIFTS[lowestLevel];
+            if (boundary > nowTick) {
+                currentTick_ = nowTick;
+                return;
+            }
+            currentTick_ = boundary - 1;
+        }
+        currentTick_++;
+        uint32_t index = static_cast<uint32_t>(currentTick_ & (WHEEL_LEVEL_SIZES[0] - 1));
+        if (index == 0) {
+            for (uint32_t level = 1; level < LEVEL_COUNT && Cascade(level) == 0; level++) {}
+        }
+        ExpireSlot(index, events);
+    }
+}
+
+int64_t EventTimerWheel::GetNextExpireTime() const
+{
+    if (index_.empty()) {
+        return -1;
+    }
+    int64_t nextTick = INT64_MAX;
+    for (uint32_t level = 0; level < LEVEL_COUNT; level++) {
+        if (levelCounts_[level] == 0) {
+            continue;
+        }
+        int64_t base = currentTick_ >> WHEEL_LEVEL_SHIFTS[level];
+        for (uint32_t step = 1; step <= WHEEL_LEVEL_SIZES[level]; step++) {
+            uint32_t slot = WHEEL_LEVEL_OFFSETS[level] +
+                static_cast<uint32_t>((base + step) & (WHEEL_LEVEL_SIZES[level] - 1));
+            if (slots_[slot] != INVALID_NODE) {
+                nextTick = std::min(nextTick, (base + step) << WHEEL_LEVEL_SHIFTS[level]);
+                break;
+            }
+        }
+    }
+    return nextTick * tickMillis_;
+}
+
+void EventTimerWheel::Link(uint32_t node)
+{
+    TimerNode &timer = nodes_[node];
+    int64_t delta = std::min(std::max(timer.expireTick - currentTick_, static_cast<int64_t>(0)),
+        WHEEL_MAX_DELTA_TICKS);
+    int64_t tick = currentTick_ + delta;
+    uint32_t level = 0;
+    while (level + 1 < LEVEL_COUNT && delta >= (static_cast<int64_t>(1) << WHEEL_LEVEL_SHIFTS[level + 1])) {
+        level++;
+    }
+    timer.level = level;
+    timer.slot = WHEEL_LEVEL_OFFSETS[level] +
+        static_cast<uint32_t>((tick >> WHEEL_LEVEL_SHIFTS[level]) & (WHEEL_LEVEL_SIZES[level] - 1));
+    timer.prev = INVALID_NODE;
+    timer.next = slots_[timer.slot];
+    if (timer.next != INVALID_NODE) {
+        nodes_[timer.next].prev = node;
+    }
+    slots_[timer.slot] = node;
+    levelCounts_[level]++;
+}
+
+void EventTimerWheel::Unlink(uint32_t node)
+{
+    TimerNode &timer = nodes_[node];
+    if (timer.prev != INVALID_NODE) {
+        nodes_[timer.prev].next = timer.next;
+    } else {
+        slots_[timer.slot] = timer.next;
+    }
+    if (timer.next != INVALID_NODE) {
+        nodes_[timer.next].prev = timer.prev;
+    }
+    levelCounts_[timer.level]--;
+}
+
+uint32_t EventTimerWheel::DetachSlot(uint32_t slot)
+{
+    uint32_t head = slots_[slot];
+    slots_[slot] = INVALID_NODE;
+    return head;
+}
+
+uint32_t EventTimerWheel::Cascade(uint32_t level)
+{
+    uint32_t index = static_cast<uint32_t>((currentTick_ >> WHEEL_LEVEL_SHIFTS[level]) &
+        (WHEEL_LEVEL_SIZES[level] - 1));
+    uint32_t node = DetachSlot(WHEEL_LEVEL_OFFSETS[level] + index);
+    while (node != INVALID_NODE) {
+        uint32_t next = nodes_[node].next;
+        levelCounts_[level]--;
+        Link(node);
+        node = next;
+    }
+    return index;
+}
+
+void EventTimerWheel::ExpireSlot(uint32_t slot, std::vector<EventWrap> &events)
+{
+    uint32_t node = DetachSlot(slot);
+    while (node != INVALID_NODE) {
+        TimerNode &timer = nodes_[node];
+        uint32_t next = timer.next;
+        levelCounts_[timer.level]--;
+        if (timer.expireTick > currentTick_) {
+            Link(node);
+        } else {
+            index_.erase(EventKey { timer.event->GetEventId(), timer.event->GetParam() });
+            events.emplace_back(std::move(timer.event.value()));
+            FreeNode(node);
+        }
+        node = next;
+    }
+}
+
+void EventTimerWheel::FreeNode(uint32_t node)
+{
+    nodes_[node].event.reset();
+    freeNodes_.push_back(node);
+}
+
 EventHandlerWrap::EventHandlerWrap() : taskHandler_(TaskHandlerWrap::GetFfrtHandler())
 {
     eventMutex_ = std::make_unique<ffrt::mutex>();
@@ -69,15 +266,34 @@ bool EventHandlerWrap::SendEvent(EventWrap event, int64_t delayMillis, bool forc
     if (!taskHandler_) {
         return false;
     }
+    if (!forceInsert && delayMillis > 0 && !event.HasTaskName()) {
+        return SendTimerEvent(event, delayMillis);
+    }
     auto eventStr = event.GetEventString();
     std::lock_guard<ffrt::mutex> guard(*eventMutex_);
     auto it  = eventMap_.find(eventStr);
     if (it != eventMap_.end() && !forceInsert) {
         return false;
     }
+    if (!forceInsert && !event.HasTaskName() && timerWheel_.Find(event.GetEventId(), event.GetParam()) != nullptr) {
+        return false;
+    }
 
     event.SetTimeout(delayMillis);
     event.SetCreateTime(GetCurrentTimeMillis());
+    SubmitEventTask(event, eventStr, delayMillis);
+
+    if (it != eventMap_.end()) {
+        it->second = event;
+    } else {
+        eventMap_.emplace(eventStr, event);
+    }
+
+    return true;
+}
+
+void EventHandlerWrap::SubmitEventTask(EventWrap &event, const std::string &eventStr, int64_t delayMillis)
+{
     event.SetEventTask(taskHandler_->SubmitTaskJust([wthis = weak_from_this(), event]() {
         auto timeCost = GetCurrentTimeMillis() - event.GetCreateTime();
         if (timeCost - event.GetTimeout() > EVENT_TIME_DIFF) {
@@ -90,16 +306,61 @@ bool EventHandlerWrap::SendEvent(EventWrap event, int64_t delayMillis, bool forc
             pthis->RemoveEvent(event, false);
         }
     }, eventStr, delayMillis));
+}
 
-    if (it != eventMap_.end()) {
-        it->second = event;
-    } else {
-        eventMap_.emplace(eventStr, event);
+bool EventHandlerWrap::SendTimerEvent(EventWrap &event, int64_t delayMillis)
+{
+    int64_t now = GetCurrentTimeMillis();
+    event.SetTimeout(delayMillis);
+    event.SetCreateTime(now);
+    std::lock_guard<ffrt::mutex> guard(*eventMutex_);
+    if (!eventMap_.empty() && eventMap_.find(event.GetEventString()) != eventMap_.end()) {
+        return false;
     }
-
+    int64_t expireTime = 0;
+    if (!timerWheel_.Arm(event, now, delayMillis, expireTime)) {
+        return false;
+    }
+    ScheduleTimerWheel(expireTime, now);
     return true;
 }
 
+void EventHandlerWrap::ScheduleTimerWheel(int64_t expireTime, int64_t nowMillis)
+{
+    if (timerWheelDriveTime_ != 0 && timerWheelDriveTime_ <= expireTime) {
+        return;
+    }
+    timerWheelDriveTime_ = expireTime;
+    taskHandler_->SubmitTaskJust([wthis = weak_from_this(), expireTime]() {
+        auto pthis = wthis.lock();
+        if (pthis) {
+            pthis->DriveTimerWheel(expireTime);
+        }
+    }, TIMER_WHEEL_TASK_NAME, std::max(expireTime - nowMillis, static_cast<int64_t>(0)));
+}
+
+void EventHandlerWrap::DriveTimerWheel(int64_t driveTime)
+{
+    std::vector<EventWrap> events;
+    std::lock_guard<ffrt::mutex> guard(*eventMutex_);
+    if (timerWheelDriveTime_ == driveTime) {
+        timerWheelDriveTime_ = 0;
+    }
+    int64_t now = GetCurrentTimeMillis();
+    timerWheel_.Expire(now, events);
+    int64_t nextTime = timerWheel_.GetNextExpireTime();
+    if (nextTime >= 0) {
+        ScheduleTimerWheel(nextTime, now);
+    }
+    // expired events move to eventMap_ with their task like the other events, so they can still be removed and
+    // block events of the same key until processed
+    for (auto &event : events) {
+        auto eventStr = event.GetEventString();
+        SubmitEventTask(event, eventStr, 0);
+        eventMap_.emplace(eventStr, event);
+    }
+}
+
 bool EventHandlerWrap::RemoveEvent(uint32_t eventId, int64_t param)
 {
     return RemoveEvent(EventWrap(eventId, param));
@@ -113,24 +374,41 @@ bool EventHandlerWrap::RemoveEvent(uint32_t eventId, const std::string &taskName
 bool EventHandlerWrap::RemoveEvent(EventWrap event, bool force)
 {
     std::lock_guard<ffrt::mutex> guard(*eventMutex_);
+    if (!event.HasTaskName()) {
+        const EventWrap *origin = timerWheel_.Find(event.GetEventId(), event.GetParam());
+        if (origin != nullptr) {
+            if (!CanRemoveEvent(*origin, event, force)) {
+                return false;
+            }
+            timerWheel_.Cancel(event.GetEventId(), event.GetParam());
+            return true;
+        }
+    }
     auto it = eventMap_.find(event.GetEventString());
     if (it == eventMap_.end()) {
         TAG_LOGW(AAFwkTag::DEFAULT, "can't find event: %{public}s ", event.GetEventString().c_str());
         return false;
     }
-    auto isSame = it->second.IsSame(event);
-    const auto &origin = it->second;
+    if (CanRemoveEvent(it->second, event, force)) {
+        auto result = it->second.GetEventTask().Cancel();
+        if (!result) {
+            TAG_LOGE(AAFwkTag::DEFAULT, "remove fail: %{public}s", event.GetEventString().c_str());
+        }
+        eventMap_.erase(it);
+        return true;
+    }
+    return false;
+}
+
+bool EventHandlerWrap::CanRemoveEvent(const EventWrap &origin, const EventWrap &event, bool force)
+{
+    auto isSame = origin.IsSame(event);
     auto timeCost = GetCurrentTimeMillis() - origin.GetCreateTime();
     if (force && timeCost > EVENT_TIME_CANCEL) {
         TAG_LOGW(AAFwkTag::DEFAULT, "event: %{public}s, timecost: %{public}" PRId64", delay: %{public}" PRId64,
             origin.GetEventString().c_str(), timeCost, origin.GetTimeout());
     }
     if (force || isSame) {
-        auto result = it->second.GetEventTask().Cancel();
-        if (!result) {
-            TAG_LOGE(AAFwkTag::DEFAULT, "remove fail: %{public}s", event.GetEventString().c_str());
-        }
-        eventMap_.erase(it);
         return true;
     }
     TAG_LOGD(AAFwkTag::DEFAULT, "force: %{public}d , IsSame: %{public}d", force, isSame);
@@ -16,13 +16,17 @@
 #ifndef OHOS_ABILITY_RUNTIME_DATAOBS_MGR_INNER_EXT_H
 #define OHOS_ABILITY_RUNTIME_DATAOBS_MGR_INNER_EXT_H
 
+#include <array>
 #include <atomic>
+#include <limits>
 #include <list>
 #include <string>
+#include <string_view>
 #include <memory>
 #include <map>
-#include <set>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 #include "cpp/mutex.h"
 
 #include "data_ability_observer_interface.h"
@@ -87,35 +91,82 @@ private:
     using ObsMap = std::map<sptr<IDataAbilityObserver>, ObsNotifyInfo>;
     using EntryList = std::list<Entry>;
 
-    class Node {
+    static constexpr uint32_t OBS_NUM_MAX = 50;
+    static constexpr uint32_t OBS_ALL_NUM_MAX = OBS_NUM_MAX * OBS_NUM_MAX;
+    static constexpr uint32_t MAX_URI_PATH_SIZE = 25;
+    static constexpr uint32_t INVALID_ID = std::numeric_limits<uint32_t>::max();
+    static constexpr uint32_t ROOT_NODE = 0;
+
+    /**
+     * Owns every distinct uri path segment once, trie nodes refer to segments by id.
+     * A segment is released when the last node using it is pruned.
+     */
+    class SegmentPool {
     public:
-        Node(const std::string &name);
-        void GetObs(const std::vector<std::string> &path, uint32_t index, NotifyInfo &info,
-            int32_t userId, ObsMap &obsMap, std::set<DataObsMgrInnerExt::Node *> &nodeLogSet);
-        bool AddObserver(const std::vector<std::string> &path, uint32_t index, const Entry &entry);
-        bool RemoveObserver(const std::vector<std::string> &path, uint32_t index,
-            sptr<IDataAbilityObserver> dataObserver);
-        inline bool RemoveObserver(sptr<IDataAbilityObserver> dataObserver);
-        bool RemoveObserver(sptr<IRemoteObject> dataObserver);
-        bool IsLimit(const Entry &entry);
+        uint32_t Find(std::string_view segment) const;
+        uint32_t Acquire(std::string_view segment);
+        void Release(uint32_t segmentId);
+        size_t Size() const;
 
     private:
-        std::string name_;
-        EntryList entrys_;
-        std::map<std::string, std::shared_ptr<Node>> childrens_;
+        struct Segment {
+            std::unique_ptr<std::string> value;
+            uint32_t ref = 0;
+        };
+        std::vector<Segment> segments_;
+        std::vector<uint32_t> freeIds_;
+        std::unordered_map<std::string_view, uint32_t> ids_;
+    };
+
+    struct Node {
+        uint32_t segmentId = INVALID_ID;
+        uint32_t parent = INVALID_ID;
+        // last notify that logged the entrys of this node
+        uint64_t logEpoch = 0;
+        // (segmentId, node index) sorted by segmentId
+        std::vector<std::pair<uint32_t, uint32_t>> children;
+        EntryList entrys;
+    };
+
+    /**
+     * Scheme, authority and path segments of an uri. Segments view into the strings held here, so it
+     * is neither copyable nor movable.
+     */
+    struct UriPath {
+        explicit UriPath(Uri &uri);
+        UriPath(const UriPath &) = delete;
+        UriPath &operator=(const UriPath &) = delete;
+        void Append(std::string_view segment);
+
+        std::string scheme;
+        std::string authority;
+        std::string path;
+        std::array<std::string_view, MAX_URI_PATH_SIZE> segments;
+        size_t size = 0;
+        bool truncated = false;
     };
 
+    uint32_t FindChild(uint32_t nodeId, uint32_t segmentId) const;
+    uint32_t AcquireChild(uint32_t nodeId, std::string_view segment);
+    void PruneNode(uint32_t nodeId);
+    bool IsLimit(const Node &node, const Entry &entry) const;
+    bool AddObserver(const UriPath &path, const Entry &entry);
+    void RemoveObserver(const UriPath &path, sptr<IDataAbilityObserver> dataObserver);
+    void RemoveObserver(sptr<IRemoteObject> dataObserver);
+    void GetObs(const UriPath &path, NotifyInfo &info, int32_t userId, ObsMap &obsRes);
+    void CollectObs(Node &node, bool descendantsOnly, NotifyInfo &info, int32_t userId, ObsMap &obsRes);
+
     std::shared_ptr<DeathRecipientRef> AddObsDeathRecipient(const sptr<IRemoteObject> &dataObserver);
     void RemoveObsDeathRecipient(const sptr<IRemoteObject> &dataObserver, bool isForce = false);
     void NotifyObserver(const ChangeInfo &changeInfo, sptr<IDataAbilityObserver> obs,
         ObsNotifyInfo &info);
 
-    static constexpr uint32_t OBS_NUM_MAX = 50;
-    static constexpr uint32_t OBS_ALL_NUM_MAX = OBS_NUM_MAX * OBS_NUM_MAX;
-    static constexpr uint32_t MAX_URI_PATH_SIZE = 25;
-
     ffrt::mutex nodeMutex_;
-    std::shared_ptr<Node> root_;
+    SegmentPool segmentPool_;
+    // nodes_[ROOT_NODE] is the root, freed slots are reused through freeNodes_
+    std::vector<Node> nodes_;
+    std::vector<uint32_t> freeNodes_;
+    uint64_t notifyEpoch_ = 0;
     std::map<sptr<IRemoteObject>, std::shared_ptr<DeathRecipientRef>> obsRecipientRefs;
 };
 }  // namespace AAFwk
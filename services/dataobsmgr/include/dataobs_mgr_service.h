@@ -21,6 +21,8 @@
 #include <shared_mutex>
 #include <singleton.h>
 #include <thread_ex.h>
+#include <unordered_set>
+#include "cpp/condition_variable.h"
 #include "cpp/mutex.h"
 
 #include "bundle_mgr_interface.h"
@@ -88,6 +90,22 @@ public:
     int Dump(int fd, const std::vector<std::u16string>& args) override;
 
 private:
+    struct PendingNotify {
+        Uri uri;
+        int32_t userId;
+        std::string readPermission;
+        bool isSilentUri;
+        uint32_t tokenId;
+    };
+    struct NotifyQueueStat {
+        uint64_t received = 0;
+        uint64_t coalesced = 0;
+        uint64_t flushes = 0;
+        uint64_t flushedUris = 0;
+        uint64_t backpressureWaits = 0;
+        uint64_t rejected = 0;
+        uint64_t unbudgetedFlushes = 0;
+    };
     struct FocusedAppInfo {
         int32_t left = 0;
         int32_t top = 0;
@@ -98,6 +116,7 @@ private:
     bool Init();
     void Dump(const std::vector<std::u16string>& args, std::string& result) const;
     void ShowHelp(std::string& result) const;
+    void DumpNotifyQueueStat(std::string& result) const;
     Status DeepCopyChangeInfo(const ChangeInfo &src, ChangeInfo &dst) const;
     FocusedAppInfo GetFocusedWindowInfo() const;
     sptr<IRemoteObject> GetAbilityManagerService() const;
@@ -121,17 +140,31 @@ private:
         DataObsOption opt, bool isExtension);
     void OnAddSystemAbility(int32_t systemAbilityId, const std::string &deviceId) override;
     int32_t CheckAndReportUriSizeFault(const Uri &uri, uint32_t tokenId, const std::string &callingFunc);
-    bool IsTaskOverLimit();
     std::pair<Status, std::vector<NotifyInfo>> MakeNotifyInfos(ChangeInfo &changes, DataObsOption opt,
         uint32_t tokenId, int32_t userId);
-    void SubmitNotifyChangeTask(Uri &uri, int32_t userId, std::string readPermission,
+    // Queues the uri for the coalesced flush. Only a full pending queue returns DATAOBS_SERVICE_TASK_LIMMIT,
+    // without a free task slot the flush is still submitted, outside the task budget.
+    int32_t SubmitNotifyChangeTask(Uri &uri, int32_t userId, std::string readPermission,
         ObserverInfo &info);
+    bool AcquireTaskSlot();
+    void FlushNotifyChanges(bool holdsTaskSlot = true);
     void ReduceTaskCount();
 private:
     static constexpr std::uint32_t TASK_COUNT_MAX = 50;
     static constexpr std::uint32_t URI_SIZE_THRESHOLD = 256;
+    static constexpr size_t NOTIFY_PENDING_MAX = 1000;
+    static constexpr int64_t NOTIFY_COALESCE_WINDOW_MS = 5;
+    static constexpr int64_t NOTIFY_BACKPRESSURE_TIMEOUT_MS = 100;
     ffrt::mutex taskCountMutex_;
+    ffrt::condition_variable taskCountCv_;
     std::uint32_t taskCount_ = 0;
+    // NotifyChange calls are merged here and delivered by one delayed flush task.
+    mutable ffrt::mutex notifyQueueMutex_;
+    ffrt::condition_variable notifyQueueCv_;
+    std::vector<PendingNotify> pendingNotifies_;
+    std::unordered_set<std::string> pendingNotifyKeys_;
+    bool notifyFlushScheduled_ = false;
+    NotifyQueueStat notifyQueueStat_;
     std::shared_ptr<TaskHandlerWrap> handler_;
     std::shared_ptr<DataShare::DataSharePermission> permission_;
     DataObsServiceRunningState state_;
@@ -14,6 +14,8 @@
  */
 #include "dataobs_mgr_inner_ext.h"
 
+#include <algorithm>
+
 #include "data_ability_observer_stub.h"
 #include "data_share_permission.h"
 #include "datashare_errno.h"
@@ -25,7 +27,16 @@
 namespace OHOS {
 namespace AAFwk {
 using namespace DataShare;
-DataObsMgrInnerExt::DataObsMgrInnerExt() : root_(std::make_shared<Node>("root")) {}
+namespace {
+constexpr char PATH_SEPARATOR = '/';
+
+bool LessSegment(const std::pair<uint32_t, uint32_t> &child, uint32_t segmentId)
+{
+    return child.first < segmentId;
+}
+} // namespace
+
+DataObsMgrInnerExt::DataObsMgrInnerExt() : nodes_(1) {}
 
 DataObsMgrInnerExt::~DataObsMgrInnerExt() {}
 
@@ -41,15 +52,14 @@ Status DataObsMgrInnerExt::HandleRegisterObserver(Uri &uri, sptr<IDataAbilityObs
         return DATAOBS_SERVICE_OBS_LIMMIT;
     }
 
-    std::vector<std::string> path = { uri.GetScheme(), uri.GetAuthority() };
-    uri.GetPathSegments(path);
-    if (path.size() >= MAX_URI_PATH_SIZE) {
-        TAG_LOGE(AAFwkTag::DBOBSMGR, "path size:%{public}zu invalid", path.size());
+    UriPath path(uri);
+    if (path.truncated || path.size >= MAX_URI_PATH_SIZE) {
+        TAG_LOGE(AAFwkTag::DBOBSMGR, "path size:%{public}zu invalid", path.size);
         return DATAOBS_INVALID_URI;
     }
     Entry entry = Entry(dataObserver, info.userId, info.tokenId, deathRecipientRef, isDescendants);
     entry.pid = info.pid;
-    if (root_ != nullptr && !root_->AddObserver(path, 0, entry)) {
+    if (!AddObserver(path, entry)) {
         TAG_LOGE(AAFwkTag::DBOBSMGR,
             "subscribers:%{public}s num maxed",
             CommonUtils::Anonymous(uri.ToString()).c_str());
@@ -69,15 +79,12 @@ Status DataObsMgrInnerExt::HandleUnregisterObserver(Uri &uri, sptr<IDataAbilityO
         return DATA_OBSERVER_IS_NULL;
     }
     std::lock_guard<ffrt::mutex> lock(nodeMutex_);
-    std::vector<std::string> path = { uri.GetScheme(), uri.GetAuthority() };
-    uri.GetPathSegments(path);
-    if (path.size() >= MAX_URI_PATH_SIZE) {
-        TAG_LOGE(AAFwkTag::DBOBSMGR, "path size:%{public}zu invalid", path.size());
+    UriPath path(uri);
+    if (path.truncated || path.size >= MAX_URI_PATH_SIZE) {
+        TAG_LOGE(AAFwkTag::DBOBSMGR, "path size:%{public}zu invalid", path.size);
         return DATAOBS_INVALID_URI;
     }
-    if (root_ != nullptr) {
-        root_->RemoveObserver(path, 0, dataObserver);
-    }
+    RemoveObserver(path, dataObserver);
     RemoveObsDeathRecipient(dataObserver->AsObject());
     return SUCCESS;
 }
@@ -89,9 +96,7 @@ Status DataObsMgrInnerExt::HandleUnregisterObserver(sptr<IDataAbilityObserver> d
         return DATA_OBSERVER_IS_NULL;
     }
     std::lock_guard<ffrt::mutex> lock(nodeMutex_);
-    if (root_ != nullptr) {
-        root_->RemoveObserver(dataObserver);
-    }
+    RemoveObserver(dataObserver->AsObject());
     RemoveObsDeathRecipient(dataObserver->AsObject(), true);
     return SUCCESS;
 }
@@ -129,18 +134,15 @@ Status DataObsMgrInnerExt::HandleNotifyChange(const ChangeInfo &changeInfo, int3
         return INVALID_PARAM;
     }
     ObsMap changeRes;
-    std::vector<std::string> path;
     {
         std::lock_guard<ffrt::mutex> lock(nodeMutex_);
-        std::set<DataObsMgrInnerExt::Node *> nodeLogSet;
+        // every node logs its entrys once per notify
+        notifyEpoch_++;
         int32_t count = 0;
         for (auto &uri : changeInfo.uris_) {
-            path.clear();
-            path.emplace_back(uri.GetScheme());
-            path.emplace_back(uri.GetAuthority());
-            uri.GetPathSegments(path);
+            UriPath path(uri);
             notifyInfo[count].uri = uri;
-            root_->GetObs(path, 0, notifyInfo[count], userId, changeRes, nodeLogSet);
+            GetObs(path, notifyInfo[count], userId, changeRes);
             count++;
         }
     }
@@ -210,75 +212,198 @@ void DataObsMgrInnerExt::OnCallBackDied(const wptr<IRemoteObject> &remote)
         return;
     }
     std::lock_guard<ffrt::mutex> lock(nodeMutex_);
-    if (root_ != nullptr) {
-        root_->RemoveObserver(dataObserver);
-    }
+    RemoveObserver(dataObserver);
     RemoveObsDeathRecipient(dataObserver, true);
 }
 
-DataObsMgrInnerExt::Node::Node(const std::string &name) : name_(name) {}
-
-void DataObsMgrInnerExt::Node::GetObs(const std::vector<std::string> &path, uint32_t index,
-    NotifyInfo &info, int32_t userId, ObsMap &obsRes, std::set<DataObsMgrInnerExt::Node *> &nodeLogSet)
+DataObsMgrInnerExt::UriPath::UriPath(Uri &uri)
+    : scheme(uri.GetScheme()), authority(uri.GetAuthority()), path(uri.GetPath())
 {
-    std::string obsStr = "";
-    bool logFlag = false;
-    auto nodeLogPair = nodeLogSet.insert(this);
-    if (path.size() == index) {
-        for (auto entry : entrys_) {
-            if (entry.userId != userId && entry.userId != 0 && userId != 0) {
-                TAG_LOGW(AAFwkTag::DBOBSMGR, "Not allow across user notify, uri:%{public}s, from %{public}d to"
-                    "%{public}d", CommonUtils::Anonymous(info.uri.ToString()).c_str(), userId, entry.userId);
-                continue;
-            }
-            ObsNotifyInfo &notifyInfo = obsRes.try_emplace(entry.observer, ObsNotifyInfo()).first->second;
-            notifyInfo.uriList.push_back(info);
-            notifyInfo.tokenId = entry.tokenId;
-            notifyInfo.pid = entry.pid;
-            obsStr += "p:" + std::to_string(entry.pid) + "Id:" + std::to_string(entry.entryId) + ",";
-            logFlag = nodeLogPair.second;
+    Append(scheme);
+    Append(authority);
+    // same split as Uri::GetPathSegments, empty segments are skipped
+    std::string_view rest(path);
+    while (!rest.empty()) {
+        size_t pos = rest.find(PATH_SEPARATOR);
+        if (pos != 0) {
+            Append(rest.substr(0, pos));
         }
-        if (logFlag) {
-            TAG_LOGI(AAFwkTag::DBOBSMGR, "uri:%{public}s entrys_:%{public}s",
-                CommonUtils::Anonymous(info.uri.ToString()).c_str(), obsStr.c_str());
+        if (pos == std::string_view::npos) {
+            break;
         }
+        rest.remove_prefix(pos + 1);
+    }
+}
+
+void DataObsMgrInnerExt::UriPath::Append(std::string_view segment)
+{
+    if (size < segments.size()) {
+        segments[size++] = segment;
         return;
     }
+    truncated = true;
+}
 
-    for (const auto &entry : entrys_) {
-        if (entry.isDescendants) {
-            if (entry.userId != userId && entry.userId != 0 && userId != 0) {
-                TAG_LOGW(AAFwkTag::DBOBSMGR, "Not allow across user notify, uri:%{public}s, from %{public}d to"
-                    "%{public}d", CommonUtils::Anonymous(info.uri.ToString()).c_str(), userId, entry.userId);
-                continue;
-            }
-            ObsNotifyInfo &notifyInfo = obsRes.try_emplace(entry.observer, ObsNotifyInfo()).first->second;
-            notifyInfo.uriList.push_back(info);
-            notifyInfo.tokenId = entry.tokenId;
-            notifyInfo.pid = entry.pid;
+uint32_t DataObsMgrInnerExt::SegmentPool::Find(std::string_view segment) const
+{
+    auto it = ids_.find(segment);
+    return it == ids_.end() ? INVALID_ID : it->second;
+}
+
+uint32_t DataObsMgrInnerExt::SegmentPool::Acquire(std::string_view segment)
+{
+    auto it = ids_.find(segment);
+    if (it != ids_.end()) {
+        segments_[it->second].ref++;
+        return it->second;
+    }
+    uint32_t segmentId = static_cast<uint32_t>(segments_.size());
+    if (!freeIds_.empty()) {
+        segmentId = freeIds_.back();
+        freeIds_.pop_back();
+    } else {
+        segments_.emplace_back();
+    }
+    // the map key views into the owned string, which never moves
+    auto &value = segments_[segmentId];
+    value.value = std::make_unique<std::string>(segment);
+    value.ref = 1;
+    ids_.emplace(*value.value, segmentId);
+    return segmentId;
+}
+
+void DataObsMgrInnerExt::SegmentPool::Release(uint32_t segmentId)
+{
+    if (segmentId >= segments_.size() || segments_[segmentId].value == nullptr) {
+        return;
+    }
+    auto &value = segments_[segmentId];
+    if (--value.ref > 0) {
+        return;
+    }
+    ids_.erase(*value.value);
+    value.value.reset();
+    freeIds_.push_back(segmentId);
+}
+
+size_t DataObsMgrInnerExt::SegmentPool::Size() const
+{
+    return ids_.size();
+}
+
+uint32_t DataObsMgrInnerExt::FindChild(uint32_t nodeId, uint32_t segmentId) const
+{
+    const auto &children = nodes_[nodeId].children;
+    auto it = std::lower_bound(children.begin(), children.end(), segmentId, LessSegment);
+    return (it != children.end() && it->first == segmentId) ? it->second : INVALID_ID;
+}
+
+uint32_t DataObsMgrInnerExt::AcquireChild(uint32_t nodeId, std::string_view segment)
+{
+    uint32_t segmentId = segmentPool_.Find(segment);
+    if (segmentId != INVALID_ID) {
+        uint32_t child = FindChild(nodeId, segmentId);
+        if (child != INVALID_ID) {
+            return child;
+        }
+    }
+    segmentId = segmentPool_.Acquire(segment);
+    uint32_t child = static_cast<uint32_t>(nodes_.size());
+    if (!freeNodes_.empty()) {
+        child = freeNodes_.back();
+        freeNodes_.pop_back();
+    } else {
+        nodes_.emplace_back();
+    }
+    nodes_[child].segmentId = segmentId;
+    nodes_[child].parent = nodeId;
+    auto &children = nodes_[nodeId].children;
+    children.emplace(std::lower_bound(children.begin(), children.end(), segmentId, LessSegment), segmentId, child);
+    return child;
+}
+
+void DataObsMgrInnerExt::PruneNode(uint32_t nodeId)
+{
+    while (nodeId != ROOT_NODE) {
+        Node &node = nodes_[nodeId];
+        // freed already, or still in use
+        if (node.parent == INVALID_ID || !node.entrys.empty() || !node.children.empty()) {
+            return;
+        }
+        uint32_t parent = node.parent;
+        auto &siblings = nodes_[parent].children;
+        auto it = std::lower_bound(siblings.begin(), siblings.end(), node.segmentId, LessSegment);
+        if (it != siblings.end() && it->first == node.segmentId) {
+            siblings.erase(it);
+        }
+        segmentPool_.Release(node.segmentId);
+        node.segmentId = INVALID_ID;
+        node.parent = INVALID_ID;
+        node.logEpoch = 0;
+        freeNodes_.push_back(nodeId);
+        nodeId = parent;
+    }
+}
+
+void DataObsMgrInnerExt::GetObs(const UriPath &path, NotifyInfo &info, int32_t userId, ObsMap &obsRes)
+{
+    uint32_t nodeId = ROOT_NODE;
+    for (size_t i = 0; i < path.size; i++) {
+        CollectObs(nodes_[nodeId], true, info, userId, obsRes);
+        uint32_t segmentId = segmentPool_.Find(path.segments[i]);
+        if (segmentId == INVALID_ID) {
+            return;
+        }
+        nodeId = FindChild(nodeId, segmentId);
+        if (nodeId == INVALID_ID) {
+            return;
+        }
+    }
+    // a truncated path is deeper than any registered uri, the last node is one of its ancestors
+    CollectObs(nodes_[nodeId], path.truncated, info, userId, obsRes);
+}
+
+void DataObsMgrInnerExt::CollectObs(Node &node, bool descendantsOnly, NotifyInfo &info, int32_t userId,
+    ObsMap &obsRes)
+{
+    if (node.entrys.empty()) {
+        return;
+    }
+    std::string obsStr = "";
+    bool logFlag = false;
+    bool firstVisit = node.logEpoch != notifyEpoch_;
+    node.logEpoch = notifyEpoch_;
+    for (const auto &entry : node.entrys) {
+        if (descendantsOnly && !entry.isDescendants) {
+            continue;
+        }
+        if (entry.userId != userId && entry.userId != 0 && userId != 0) {
+            TAG_LOGW(AAFwkTag::DBOBSMGR, "Not allow across user notify, uri:%{public}s, from %{public}d to"
+                "%{public}d", CommonUtils::Anonymous(info.uri.ToString()).c_str(), userId, entry.userId);
+            continue;
+        }
+        ObsNotifyInfo &notifyInfo = obsRes.try_emplace(entry.observer, ObsNotifyInfo()).first->second;
+        notifyInfo.uriList.push_back(info);
+        notifyInfo.tokenId = entry.tokenId;
+        notifyInfo.pid = entry.pid;
+        if (firstVisit) {
             obsStr += "p:" + std::to_string(entry.pid) + "Id:" + std::to_string(entry.entryId) + ",";
-            logFlag = nodeLogPair.second;
+            logFlag = true;
         }
     }
     if (logFlag) {
         TAG_LOGI(AAFwkTag::DBOBSMGR, "uri:%{public}s entrys_:%{public}s",
             CommonUtils::Anonymous(info.uri.ToString()).c_str(), obsStr.c_str());
     }
-
-    auto it = childrens_.find(path[index]);
-    if (it == childrens_.end()) {
-        return;
-    }
-    it->second->GetObs(path, ++index, info, userId, obsRes, nodeLogSet);
 }
 
-bool DataObsMgrInnerExt::Node::IsLimit(const Entry &entry)
+bool DataObsMgrInnerExt::IsLimit(const Node &node, const Entry &entry) const
 {
-    if (entrys_.size() >= OBS_ALL_NUM_MAX) {
+    if (node.entrys.size() >= OBS_ALL_NUM_MAX) {
         return true;
     }
     uint32_t count = 0;
-    for (Entry& existEntry : entrys_) {
+    for (const Entry &existEntry : node.entrys) {
         if (existEntry.tokenId == entry.tokenId) {
             count++;
             if (count > OBS_NUM_MAX) {
@@ -290,68 +415,73 @@ bool DataObsMgrInnerExt::Node::IsLimit(const Entry &entry)
     return false;
 }
 
-bool DataObsMgrInnerExt::Node::AddObserver(const std::vector<std::string> &path, uint32_t index, const Entry &entry)
-{
-    if (path.size() == index) {
-        if (IsLimit(entry)) {
-            TAG_LOGE(AAFwkTag::DBOBSMGR, "subscribers num maxed, token:%{public}d", entry.tokenId);
-            return false;
-        }
-        entry.deathRecipientRef->ref++;
-        entrys_.emplace_back(entry);
-        TAG_LOGI(AAFwkTag::DBOBSMGR, "p:%{public}d Id:%{public}" PRId64, entry.pid, entry.entryId);
-        return true;
-    }
-    auto it = childrens_.try_emplace(path[index], std::make_shared<Node>(path[index])).first;
-    return it->second->AddObserver(path, ++index, entry);
-}
-
-bool DataObsMgrInnerExt::Node::RemoveObserver(const std::vector<std::string> &path, uint32_t index,
-    sptr<IDataAbilityObserver> dataObserver)
+bool DataObsMgrInnerExt::AddObserver(const UriPath &path, const Entry &entry)
 {
-    if (index == path.size()) {
-        entrys_.remove_if([dataObserver](const Entry &entry) {
-            if (entry.observer->AsObject() != dataObserver->AsObject()) {
-                return false;
-            }
-            entry.deathRecipientRef->ref--;
-            TAG_LOGI(AAFwkTag::DBOBSMGR, "p:%{public}d Id:%{public}" PRId64, entry.pid, entry.entryId);
-            return true;
-        });
-        return entrys_.empty() && childrens_.empty();
+    uint32_t nodeId = ROOT_NODE;
+    for (size_t i = 0; i < path.size; i++) {
+        nodeId = AcquireChild(nodeId, path.segments[i]);
     }
-    auto child = childrens_.find(path[index]);
-    if (child != childrens_.end() && child->second->RemoveObserver(path, ++index, dataObserver)) {
-        childrens_.erase(child);
+    Node &node = nodes_[nodeId];
+    if (IsLimit(node, entry)) {
+        TAG_LOGE(AAFwkTag::DBOBSMGR, "subscribers num maxed, token:%{public}d", entry.tokenId);
+        PruneNode(nodeId);
+        return false;
     }
-    return entrys_.empty() && childrens_.empty();
+    entry.deathRecipientRef->ref++;
+    node.entrys.emplace_back(entry);
+    TAG_LOGI(AAFwkTag::DBOBSMGR, "p:%{public}d Id:%{public}" PRId64, entry.pid, entry.entryId);
+    return true;
 }
 
-// remove observer of all users
-bool DataObsMgrInnerExt::Node::RemoveObserver(sptr<IRemoteObject> dataObserver)
+void DataObsMgrInnerExt::RemoveObserver(const UriPath &path, sptr<IDataAbilityObserver> dataObserver)
 {
-    for (auto child = childrens_.begin(); child != childrens_.end();) {
-        if (child->second->RemoveObserver(dataObserver)) {
-            child = childrens_.erase(child);
-        } else {
-            child++;
+    uint32_t nodeId = ROOT_NODE;
+    for (size_t i = 0; i < path.size; i++) {
+        uint32_t segmentId = segmentPool_.Find(path.segments[i]);
+        if (segmentId == INVALID_ID) {
+            return;
+        }
+        nodeId = FindChild(nodeId, segmentId);
+        if (nodeId == INVALID_ID) {
+            return;
         }
     }
-    entrys_.remove_if([dataObserver](const Entry &entry) {
-        if (entry.observer->AsObject() != dataObserver) {
+    nodes_[nodeId].entrys.remove_if([dataObserver](const Entry &entry) {
+        if (entry.observer->AsObject() != dataObserver->AsObject()) {
             return false;
         }
         entry.deathRecipientRef->ref--;
         TAG_LOGI(AAFwkTag::DBOBSMGR, "p:%{public}d Id:%{public}" PRId64, entry.pid, entry.entryId);
         return true;
     });
-    return entrys_.empty() && childrens_.empty();
+    PruneNode(nodeId);
 }
 
-inline bool DataObsMgrInnerExt::Node::RemoveObserver(sptr<IDataAbilityObserver> dataObserver)
+// remove observer of all users
+void DataObsMgrInnerExt::RemoveObserver(sptr<IRemoteObject> dataObserver)
 {
-    auto obs = dataObserver->AsObject();
-    return obs != nullptr && RemoveObserver(obs);
+    if (dataObserver == nullptr) {
+        return;
+    }
+    std::vector<uint32_t> emptyNodes;
+    for (uint32_t nodeId = ROOT_NODE + 1; nodeId < nodes_.size(); nodeId++) {
+        auto &entrys = nodes_[nodeId].entrys;
+        size_t oldSize = entrys.size();
+        entrys.remove_if([dataObserver](const Entry &entry) {
+            if (entry.observer->AsObject() != dataObserver) {
+                return false;
+            }
+            entry.deathRecipientRef->ref--;
+            TAG_LOGI(AAFwkTag::DBOBSMGR, "p:%{public}d Id:%{public}" PRId64, entry.pid, entry.entryId);
+            return true;
+        });
+        if (oldSize != entrys.size() && entrys.empty()) {
+            emptyNodes.push_back(nodeId);
+        }
+    }
+    for (uint32_t nodeId : emptyNodes) {
+        PruneNode(nodeId);
+    }
 }
 
 } // namespace AAFwk
@@ -14,7 +14,10 @@
  */
 #include "dataobs_mgr_service.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cstdint>
+#include <map>
 #include <memory>
 
 #include "ability_connect_callback_stub.h"
@@ -522,38 +525,115 @@ int DataObsMgrService::NotifyChange(const Uri &uri, int32_t userId, DataObsOptio
     return NotifyChangeInner(innerUri, userId, opt, false);
 }
 
-bool DataObsMgrService::IsTaskOverLimit()
+void DataObsMgrService::ReduceTaskCount()
+{
+    {
+        std::lock_guard<ffrt::mutex> lck(taskCountMutex_);
+        --taskCount_;
+    }
+    taskCountCv_.notify_one();
+}
+
+bool DataObsMgrService::AcquireTaskSlot()
 {
-    std::lock_guard<ffrt::mutex> lck(taskCountMutex_);
-    if (taskCount_ >= TASK_COUNT_MAX) {
+    std::unique_lock<ffrt::mutex> lck(taskCountMutex_);
+    if (!taskCountCv_.wait_for(lck, std::chrono::milliseconds(NOTIFY_BACKPRESSURE_TIMEOUT_MS),
+        [this]() { return taskCount_ < TASK_COUNT_MAX; })) {
         LOG_ERROR("task num reached limit, count %{public}d", taskCount_);
-        return true;
+        return false;
     }
     ++taskCount_;
-    return false;
+    return true;
 }
 
-void DataObsMgrService::ReduceTaskCount()
+int32_t DataObsMgrService::SubmitNotifyChangeTask(Uri &uri, int32_t userId, std::string readPermission,
+    ObserverInfo &info)
 {
-    std::lock_guard<ffrt::mutex> lck(taskCountMutex_);
-    --taskCount_;
+    std::string key = std::to_string(userId) + "|" + std::to_string(info.tokenId) + "|" + uri.ToString();
+    {
+        std::unique_lock<ffrt::mutex> lock(notifyQueueMutex_);
+        notifyQueueStat_.received++;
+        if (pendingNotifyKeys_.count(key) != 0) {
+            notifyQueueStat_.coalesced++;
+            return NO_ERROR;
+        }
+        if (pendingNotifies_.size() >= NOTIFY_PENDING_MAX) {
+            // slow the caller down until the flush task drains the queue instead of dropping at once
+            notifyQueueStat_.backpressureWaits++;
+            if (!notifyQueueCv_.wait_for(lock, std::chrono::milliseconds(NOTIFY_BACKPRESSURE_TIMEOUT_MS),
+                [this]() { return pendingNotifies_.size() < NOTIFY_PENDING_MAX; })) {
+                notifyQueueStat_.rejected++;
+                LOG_ERROR("notify queue full, pending %{public}zu", pendingNotifies_.size());
+                return DATAOBS_SERVICE_TASK_LIMMIT;
+            }
+            if (pendingNotifyKeys_.count(key) != 0) {
+                notifyQueueStat_.coalesced++;
+                return NO_ERROR;
+            }
+        }
+        pendingNotifies_.push_back({ uri, userId, readPermission, info.isSilentUri, info.tokenId });
+        pendingNotifyKeys_.insert(key);
+        if (notifyFlushScheduled_) {
+            return NO_ERROR;
+        }
+        notifyFlushScheduled_ = true;
+    }
+
+    if (AcquireTaskSlot()) {
+        handler_->SubmitTask([this]() { FlushNotifyChanges(); }, NOTIFY_COALESCE_WINDOW_MS);
+        return NO_ERROR;
+    }
+    // the uri is already queued and other callers may have queued theirs behind this flush, so it is submitted
+    // outside the task budget. notifyFlushScheduled_ keeps this to one flush at a time, the pending queue bound
+    // above is what limits the callers.
+    {
+        std::lock_guard<ffrt::mutex> lock(notifyQueueMutex_);
+        notifyQueueStat_.unbudgetedFlushes++;
+    }
+    handler_->SubmitTask([this]() { FlushNotifyChanges(false); }, NOTIFY_COALESCE_WINDOW_MS);
+    return NO_ERROR;
 }
 
-void DataObsMgrService::SubmitNotifyChangeTask(Uri &uri, int32_t userId, std::string readPermission, ObserverInfo &info)
+void DataObsMgrService::FlushNotifyChanges(bool holdsTaskSlot)
 {
-    ChangeInfo changeInfo = { ChangeInfo::ChangeType::OTHER, { uri } };
-    handler_->SubmitTask([this, uri, changeInfo, userId, readPermission,
-        isSilentUri = info.isSilentUri, tokenId = info.tokenId]() {
-        if (const_cast<Uri &>(uri).GetScheme() == SHARE_PREFERENCES) {
-            dataObsMgrInnerPref_->HandleNotifyChange(uri, userId, tokenId);
-        } else {
-            dataObsMgrInner_->HandleNotifyChange(uri, userId, readPermission, isSilentUri, tokenId);
-            std::vector<NotifyInfo> verifyInfo = {NotifyInfo(uri, readPermission, isSilentUri)};
-            dataObsMgrInnerExt_->HandleNotifyChange(changeInfo, userId, verifyInfo);
+    std::vector<PendingNotify> pending;
+    {
+        std::lock_guard<ffrt::mutex> lock(notifyQueueMutex_);
+        pending.swap(pendingNotifies_);
+        pendingNotifyKeys_.clear();
+        notifyFlushScheduled_ = false;
+        notifyQueueStat_.flushes++;
+        notifyQueueStat_.flushedUris += pending.size();
+    }
+    notifyQueueCv_.notify_all();
+
+    // uris of one user go to the ext observers as one ChangeInfo, so each observer wakes up once
+    std::map<int32_t, std::pair<ChangeInfo, std::vector<NotifyInfo>>> batches;
+    for (auto &item : pending) {
+        if (item.uri.GetScheme() == SHARE_PREFERENCES) {
+            dataObsMgrInnerPref_->HandleNotifyChange(item.uri, item.userId, item.tokenId);
+            continue;
         }
-        std::lock_guard<ffrt::mutex> lck(taskCountMutex_);
-        --taskCount_;
-    });
+        dataObsMgrInner_->HandleNotifyChange(item.uri, item.userId, item.readPermission, item.isSilentUri,
+            item.tokenId);
+        auto &batch = batches[item.userId];
+        if (batch.first.uris_.size() >= static_cast<size_t>(ChangeInfo::LIST_MAX_COUNT)) {
+            dataObsMgrInnerExt_->HandleNotifyChange(batch.first, item.userId, batch.second);
+            batch.first.uris_.clear();
+            batch.second.clear();
+        }
+        batch.first.changeType_ = ChangeInfo::ChangeType::OTHER;
+        batch.first.uris_.push_back(item.uri);
+        batch.second.emplace_back(item.uri, item.readPermission, item.isSilentUri);
+    }
+    for (auto &[userId, batch] : batches) {
+        if (!batch.first.uris_.empty()) {
+            dataObsMgrInnerExt_->HandleNotifyChange(batch.first, userId, batch.second);
+        }
+    }
+    if (holdsTaskSlot) {
+        ReduceTaskCount();
+    }
 }
 
 int32_t DataObsMgrService::NotifyChangeInner(Uri &uri, int32_t userId, DataObsOption opt, bool isExtension)
@@ -603,11 +683,7 @@ int32_t DataObsMgrService::NotifyChangeInner(Uri &uri, int32_t userId, DataObsOp
             return DATAOBS_INVALID_URI;
         }
     }
-    if (IsTaskOverLimit()) {
-        return DATAOBS_SERVICE_TASK_LIMMIT;
-    }
-    SubmitNotifyChangeTask(uri, userId, readPermission, info);
-    return NO_ERROR;
+    return SubmitNotifyChangeTask(uri, userId, readPermission, info);
 }
 
 Status DataObsMgrService::RegisterObserverExt(const Uri &uri, sptr<IDataAbilityObserver> dataObserver,
@@ -781,7 +857,7 @@ Status DataObsMgrService::NotifyChangeExt(const ChangeInfo &changeInfo, DataObsO
         LOG_ERROR("GetCallingUserId fail, type:%{public}d, userId:%{public}d", changeInfo.changeType_, userId);
         return DATAOBS_INVALID_USERID;
     }
-    if (IsTaskOverLimit()) {
+    if (!AcquireTaskSlot()) {
         return DATAOBS_SERVICE_TASK_LIMMIT;
     }
     ChangeInfo changes;
@@ -975,6 +1051,10 @@ void DataObsMgrService::Dump(const std::vector<std::u16string>& args, std::strin
     }
 
     std::string optionKey = Str16ToStr8(args[0]);
+    if (optionKey == "--notify-stat") {
+        DumpNotifyQueueStat(result);
+        return;
+    }
     if (optionKey != "-h") {
         result.append("error: unkown option.\n");
     }
@@ -985,7 +1065,22 @@ void DataObsMgrService::ShowHelp(std::string& result) const
 {
     result.append("Usage:\n")
         .append("-h                          ")
-        .append("help text for the tool\n");
+        .append("help text for the tool\n")
+        .append("--notify-stat               ")
+        .append("dump coalescing statistics of NotifyChange\n");
+}
+
+void DataObsMgrService::DumpNotifyQueueStat(std::string& result) const
+{
+    std::lock_guard<ffrt::mutex> lock(notifyQueueMutex_);
+    result.append("received: ").append(std::to_string(notifyQueueStat_.received)).append("\n")
+        .append("coalesced: ").append(std::to_string(notifyQueueStat_.coalesced)).append("\n")
+        .append("flushes: ").append(std::to_string(notifyQueueStat_.flushes)).append("\n")
+        .append("flushed uris: ").append(std::to_string(notifyQueueStat_.flushedUris)).append("\n")
+        .append("backpressure waits: ").append(std::to_string(notifyQueueStat_.backpressureWaits)).append("\n")
+        .append("rejected: ").append(std::to_string(notifyQueueStat_.rejected)).append("\n")
+        .append("unbudgeted flushes: ").append(std::to_string(notifyQueueStat_.unbudgetedFlushes)).append("\n")
+        .append("pending: ").append(std::to_string(pendingNotifies_.size())).append("\n");
 }
 }  // namespace AAFwk
 }  // namespace OHOS
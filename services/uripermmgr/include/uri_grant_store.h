@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_RUNTIME_URI_GRANT_STORE_H
+#define OHOS_ABILITY_RUNTIME_URI_GRANT_STORE_H
+
+#include <array>
+#include <list>
+#include <map>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace OHOS {
+namespace AAFwk {
+struct GrantInfo {
+    uint32_t flag;
+    uint32_t fromTokenId;
+    uint32_t targetTokenId;
+};
+
+/**
+ * @class UriGrantStore
+ * Temporary uri grants of distributed docs uris, keyed by uri string.
+ * Uris are spread over shards by hash, each shard has its own lock and indexes the uris of every
+ * granting and granted token and of every uri authority, so revoking by token touches only its records.
+ */
+class UriGrantStore {
+public:
+    UriGrantStore() = default;
+    ~UriGrantStore() = default;
+
+    /**
+     * Add a grant record, or merge the flag into the record of the same from and target token.
+     */
+    void Add(const std::string &uri, uint32_t flag, uint32_t fromTokenId, uint32_t targetTokenId);
+
+    /**
+     * Whether tokenId is granted uri itself or, for distributed docs uri, one of its parent directories.
+     *
+     * @param flag FLAG_READ_URI or FLAG_WRITE_URI.
+     */
+    bool Verify(const std::string &uri, uint32_t flag, uint32_t tokenId) const;
+
+    /**
+     * Verify a batch of uris, each shard is locked once for the whole batch.
+     */
+    std::vector<bool> VerifyBatch(const std::vector<std::string> &uris, uint32_t flag, uint32_t tokenId) const;
+
+    /**
+     * Whether tokenId is granted a parent directory of distributed docs uri. Only the parent whose record
+     * sorts last by uri string is checked, that is the shallowest one.
+     */
+    bool VerifySubDir(const std::string &uri, uint32_t flag, uint32_t tokenId) const;
+
+    /**
+     * Remove the records granted to tokenId.
+     *
+     * @param uriList The uris that lost a record.
+     * @return The number of removed records.
+     */
+    int32_t RevokeByTarget(uint32_t tokenId, std::vector<std::string> &uriList);
+
+    /**
+     * Remove the uris of authority and the records granted to or by tokenId.
+     *
+     * @param uriLists The uris that lost a record, grouped by target token.
+     */
+    void RevokeAll(uint32_t tokenId, const std::string &authority,
+        std::map<uint32_t, std::vector<std::string>> &uriLists);
+
+    /**
+     * Remove one record of uri granted to targetTokenId by callerTokenId, or by anyone if isRevokeSelfUri.
+     *
+     * @return Whether uri has any record.
+     */
+    bool RevokeOne(const std::string &uri, uint32_t callerTokenId, uint32_t targetTokenId, bool isRevokeSelfUri,
+        std::vector<std::string> &uriList);
+
+    bool Contains(const std::string &uri) const;
+
+    size_t Size() const;
+
+    void Clear();
+
+private:
+    static constexpr size_t SHARD_COUNT = 16;
+
+    struct UriGrants {
+        std::string authority;
+        std::list<GrantInfo> grants;
+    };
+
+    // index values view into the keys of grants, which stay in place until erased
+    struct Shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<std::string, UriGrants> grants;
+        std::unordered_map<uint32_t, std::unordered_set<std::string_view>> tokenIndex;
+        std::unordered_map<std::string, std::unordered_set<std::string_view>> authorityIndex;
+    };
+
+    static size_t GetShardIndex(std::string_view uri);
+    static bool VerifyLocked(const Shard &shard, const std::string &uri, uint32_t flag, uint32_t tokenId);
+    static void UnindexToken(Shard &shard, uint32_t tokenId, std::string_view uri, const std::list<GrantInfo> &grants);
+    static void EraseUri(Shard &shard, std::unordered_map<std::string, UriGrants>::iterator iter);
+
+    std::array<Shard, SHARD_COUNT> shards_;
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // OHOS_ABILITY_RUNTIME_URI_GRANT_STORE_H
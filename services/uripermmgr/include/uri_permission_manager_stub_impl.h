@@ -26,6 +26,7 @@
 #include "file_uri_distribution_utils.h"
 #include "tokenid_permission.h"
 #include "uri.h"
+#include "uri_grant_store.h"
 #include "uri_permission_manager_stub.h"
 #include "uri_permission_raw_data.h"
 #include "access_token.h"
@@ -46,12 +47,6 @@ using namespace AccessControl::SandboxManager;
 #endif // ABILITY_RUNTIME_FEATURE_SANDBOXMANAGER
 }
 
-struct GrantInfo {
-    uint32_t flag;
-    uint32_t fromTokenId;
-    uint32_t targetTokenId;
-};
-
 struct GrantPolicyInfo {
     uint32_t callerTokenId;
     uint32_t targetTokenId;
@@ -235,10 +230,6 @@ private:
 
     int32_t CheckCalledBySandBox();
 
-    bool VerifySubDirUriPermission(const std::string &uriStr, uint32_t newFlag, uint32_t tokenId);
-
-    bool IsDistributedSubDirUri(const std::string &inputUri, const std::string &cachedUri);
-
     ErrCode ClearPermissionTokenByMap(uint32_t tokenId, int32_t& funcResult) override;
 
     void BoolVecToCharVec(const std::vector<bool>& boolVector, std::vector<char>& charVector);
@@ -284,9 +275,8 @@ private:
     };
 
 private:
-    std::map<std::string, std::list<GrantInfo>> uriMap_;
+    UriGrantStore grantStore_;
     std::map<std::string, std::list<GrantPolicyInfo>> policyMap_;
-    std::mutex mutex_;
     std::mutex mgrMutex_;
     std::mutex policyMapMutex_;
     sptr<AppExecFwk::IAppMgr> appMgr_ = nullptr;
@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "uri_grant_store.h"
+
+#include <mutex>
+
+#include "hilog_tag_wrapper.h"
+#include "uri.h"
+#include "want.h"
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+constexpr uint32_t FLAG_READ_URI = Want::FLAG_AUTH_READ_URI_PERMISSION;
+constexpr const char* DISTRIBUTED_DOCS_URI_MARK = "?networkid=";
+constexpr char PATH_SEPARATOR = '/';
+}
+
+size_t UriGrantStore::GetShardIndex(std::string_view uri)
+{
+    return std::hash<std::string_view>()(uri) % SHARD_COUNT;
+}
+
+void UriGrantStore::Add(const std::string &uri, uint32_t flag, uint32_t fromTokenId, uint32_t targetTokenId)
+{
+    auto &shard = shards_[GetShardIndex(uri)];
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto iter = shard.grants.find(uri);
+    if (iter == shard.grants.end()) {
+        iter = shard.grants.emplace(uri, UriGrants { Uri(uri).GetAuthority(), {} }).first;
+        shard.authorityIndex[iter->second.authority].insert(iter->first);
+    }
+    auto &grants = iter->second.grants;
+    for (auto &item : grants) {
+        if (item.fromTokenId == fromTokenId && item.targetTokenId == targetTokenId) {
+            TAG_LOGD(AAFwkTag::URIPERMMGR, "Item: flag:%{public}u", item.flag);
+            item.flag |= flag;
+            return;
+        }
+    }
+    grants.push_back({ flag, fromTokenId, targetTokenId });
+    shard.tokenIndex[fromTokenId].insert(iter->first);
+    shard.tokenIndex[targetTokenId].insert(iter->first);
+}
+
+bool UriGrantStore::VerifyLocked(const Shard &shard, const std::string &uri, uint32_t flag, uint32_t tokenId)
+{
+    auto iter = shard.grants.find(uri);
+    if (iter == shard.grants.end()) {
+        return false;
+    }
+    for (const auto &item : iter->second.grants) {
+        if (item.targetTokenId == tokenId && ((item.flag | FLAG_READ_URI) & flag) != 0) {
+            TAG_LOGD(AAFwkTag::URIPERMMGR, "have uri permission");
+            return true;
+        }
+    }
+    return false;
+}
+
+bool UriGrantStore::Verify(const std::string &uri, uint32_t flag, uint32_t tokenId) const
+{
+    {
+        auto &shard = shards_[GetShardIndex(uri)];
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        if (VerifyLocked(shard, uri, flag, tokenId)) {
+            return true;
+        }
+    }
+    return VerifySubDir(uri, flag, tokenId);
+}
+
+std::vector<bool> UriGrantStore::VerifyBatch(const std::vector<std::string> &uris, uint32_t flag,
+    uint32_t tokenId) const
+{
+    std::vector<bool> result(uris.size(), false);
+    std::array<std::vector<size_t>, SHARD_COUNT> shardUris;
+    for (size_t i = 0; i < uris.size(); i++) {
+        shardUris[GetShardIndex(uris[i])].push_back(i);
+    }
+    for (size_t shardIndex = 0; shardIndex < SHARD_COUNT; shardIndex++) {
+        if (shardUris[shardIndex].empty()) {
+            continue;
+        }
+        auto &shard = shards_[shardIndex];
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        for (auto i : shardUris[shardIndex]) {
+            result[i] = VerifyLocked(shard, uris[i], flag, tokenId);
+        }
+    }
+    for (size_t i = 0; i < uris.size(); i++) {
+        if (!result[i]) {
+            result[i] = VerifySubDir(uris[i], flag, tokenId);
+        }
+    }
+    return result;
+}
+
+bool UriGrantStore::VerifySubDir(const std::string &uri, uint32_t flag, uint32_t tokenId) const
+{
+    auto markPos = uri.find(DISTRIBUTED_DOCS_URI_MARK);
+    if (markPos == std::string::npos) {
+        TAG_LOGI(AAFwkTag::URIPERMMGR, "Local uri not support to verify sub directory uri permission");
+        return false;
+    }
+    // a parent record is the uri cut at a separator plus the same network id, the shorter sorts after.
+    std::string_view networkId = std::string_view(uri).substr(markPos);
+    std::string parentUri;
+    for (auto pos = uri.find(PATH_SEPARATOR); pos < markPos; pos = uri.find(PATH_SEPARATOR, pos + 1)) {
+        parentUri.assign(uri, 0, pos).append(networkId);
+        auto &shard = shards_[GetShardIndex(parentUri)];
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        if (shard.grants.find(parentUri) == shard.grants.end()) {
+            continue;
+        }
+        if (VerifyLocked(shard, parentUri, flag, tokenId)) {
+            return true;
+        }
+        break;
+    }
+    TAG_LOGI(AAFwkTag::URIPERMMGR, "Uri permission not exists");
+    return false;
+}
+
+void UriGrantStore::UnindexToken(Shard &shard, uint32_t tokenId, std::string_view uri,
+    const std::list<GrantInfo> &grants)
+{
+    for (const auto &item : grants) {
+        if (item.fromTokenId == tokenId || item.targetTokenId == tokenId) {
+            return;
+        }
+    }
+    auto tokenIter = shard.tokenIndex.find(tokenId);
+    if (tokenIter == shard.tokenIndex.end()) {
+        return;
+    }
+    tokenIter->second.erase(uri);
+    if (tokenIter->second.empty()) {
+        shard.tokenIndex.erase(tokenIter);
+    }
+}
+
+void UriGrantStore::EraseUri(Shard &shard, std::unordered_map<std::string, UriGrants>::iterator iter)
+{
+    std::string_view uri = iter->first;
+    auto grants = std::move(iter->second.grants);
+    iter->second.grants.clear();
+    for (const auto &item : grants) {
+        UnindexToken(shard, item.fromTokenId, uri, iter->second.grants);
+        UnindexToken(shard, item.targetTokenId, uri, iter->second.grants);
+    }
+    auto authorityIter = shard.authorityIndex.find(iter->second.authority);
+    if (authorityIter != shard.authorityIndex.end()) {
+        authorityIter->second.erase(uri);
+        if (authorityIter->second.empty()) {
+            shard.authorityIndex.erase(authorityIter);
+        }
+    }
+    shard.grants.erase(iter);
+}
+
+int32_t UriGrantStore::RevokeByTarget(uint32_t tokenId, std::vector<std::string> &uriList)
+{
+    int32_t deleteCount = 0;
+    for (auto &shard : shards_) {
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        auto tokenIter = shard.tokenIndex.find(tokenId);
+        if (tokenIter == shard.tokenIndex.end()) {
+            continue;
+        }
+        // the index changes while records are removed
+        std::vector<std::string> uris(tokenIter->second.begin(), tokenIter->second.end());
+        for (const auto &uri : uris) {
+            auto iter = shard.grants.find(uri);
+            if (iter == shard.grants.end()) {
+                continue;
+            }
+            auto &grants = iter->second.grants;
+            std::vector<uint32_t> fromTokenIds;
+            for (auto it = grants.begin(); it != grants.end();) {
+                if (it->targetTokenId == tokenId) {
+                    fromTokenIds.push_back(it->fromTokenId);
+                    it = grants.erase(it);
+                    continue;
+                }
+                it++;
+            }
+            if (fromTokenIds.empty()) {
+                continue;
+            }
+            deleteCount += static_cast<int32_t>(fromTokenIds.size());
+            uriList.emplace_back(uri);
+            if (grants.empty()) {
+                EraseUri(shard, iter);
+                continue;
+            }
+            UnindexToken(shard, tokenId, iter->first, grants);
+            for (auto fromTokenId : fromTokenIds) {
+                UnindexToken(shard, fromTokenId, iter->first, grants);
+            }
+        }
+    }
+    return deleteCount;
+}
+
+void UriGrantStore::RevokeAll(uint32_t tokenId, const std::string &authority,
+    std::map<uint32_t, std::vector<std::string>> &uriLists)
+{
+    for (auto &shard : shards_) {
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        // uri belong to target tokenId.
+        auto authorityIter = shard.authorityIndex.find(authority);
+        if (authorityIter != shard.authorityIndex.end()) {
+            std::vector<std::string> uris(authorityIter->second.begin(), authorityIter->second.end());
+            for (const auto &uri : uris) {
+                auto iter = shard.grants.find(uri);
+                if (iter == shard.grants.end()) {
+                    continue;
+                }
+                for (const auto &record : iter->second.grants) {
+                    uriLists[record.targetTokenId].emplace_back(uri);
+                }
+                EraseUri(shard, iter);
+            }
+        }
+        auto tokenIter = shard.tokenIndex.find(tokenId);
+        if (tokenIter == shard.tokenIndex.end()) {
+            continue;
+        }
+        std::vector<std::string> uris(tokenIter->second.begin(), tokenIter->second.end());
+        for (const auto &uri : uris) {
+            auto iter = shard.grants.find(uri);
+            if (iter == shard.grants.end()) {
+                continue;
+            }
+            auto &grants = iter->second.grants;
+            std::vector<uint32_t> otherTokenIds;
+            for (auto it = grants.begin(); it != grants.end();) {
+                if (it->targetTokenId == tokenId || it->fromTokenId == tokenId) {
+                    TAG_LOGI(AAFwkTag::URIPERMMGR, "Erase an uri permission record");
+                    uriLists[it->targetTokenId].emplace_back(uri);
+                    otherTokenIds.push_back(it->targetTokenId == tokenId ? it->fromTokenId : it->targetTokenId);
+                    it = grants.erase(it);
+                    continue;
+                }
+                it++;
+            }
+            if (grants.empty()) {
+                EraseUri(shard, iter);
+                continue;
+            }
+            UnindexToken(shard, tokenId, iter->first, grants);
+            for (auto otherTokenId : otherTokenIds) {
+                UnindexToken(shard, otherTokenId, iter->first, grants);
+            }
+        }
+    }
+}
+
+bool UriGrantStore::RevokeOne(const std::string &uri, uint32_t callerTokenId, uint32_t targetTokenId,
+    bool isRevokeSelfUri, std::vector<std::string> &uriList)
+{
+    auto &shard = shards_[GetShardIndex(uri)];
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto iter = shard.grants.find(uri);
+    if (iter == shard.grants.end()) {
+        return false;
+    }
+    auto &grants = iter->second.grants;
+    for (auto it = grants.begin(); it != grants.end(); it++) {
+        if (it->targetTokenId == targetTokenId && (callerTokenId == it->fromTokenId || isRevokeSelfUri)) {
+            uriList.emplace_back(uri);
+            TAG_LOGD(AAFwkTag::URIPERMMGR, "revoke uri permission record");
+            uint32_t fromTokenId = it->fromTokenId;
+            grants.erase(it);
+            UnindexToken(shard, fromTokenId, iter->first, grants);
+            UnindexToken(shard, targetTokenId, iter->first, grants);
+            break;
+        }
+    }
+    if (grants.empty()) {
+        EraseUri(shard, iter);
+    }
+    return true;
+}
+
+bool UriGrantStore::Contains(const std::string &uri) const
+{
+    auto &shard = shards_[GetShardIndex(uri)];
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.grants.find(uri) != shard.grants.end();
+}
+
+size_t UriGrantStore::Size() const
+{
+    size_t size = 0;
+    for (auto &shard : shards_) {
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        size += shard.grants.size();
+    }
+    return size;
+}
+
+void UriGrantStore::Clear()
+{
+    for (auto &shard : shards_) {
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        shard.tokenIndex.clear();
+        shard.authorityIndex.clear();
+        shard.grants.clear();
+    }
+}
+}  // namespace AAFwk
+}  // namespace OHOS
@@ -54,7 +54,6 @@ constexpr uint32_t FLAG_READ_WRITE_URI = Want::FLAG_AUTH_READ_URI_PERMISSION | W
 constexpr uint32_t FLAG_WRITE_URI = Want::FLAG_AUTH_WRITE_URI_PERMISSION;
 constexpr uint32_t FLAG_READ_URI = Want::FLAG_AUTH_READ_URI_PERMISSION;
 constexpr uint32_t FLAG_PERSIST_URI = Want::FLAG_AUTH_PERSISTABLE_URI_PERMISSION;
-constexpr const char* DISTRIBUTED_DOCS_URI_MARK = "?networkid=";
 constexpr size_t MAX_IPC_RAW_DATA_SIZE = 128 * 1024 * 1024; // 128M
 const int MAX_URI_COUNT = 200000;
 constexpr int32_t DEFAULT_HIDE_SENSITIVE_TYPE = 4;
@@ -155,70 +154,18 @@ std::vector<bool> UriPermissionManagerStubImpl::VerifyUriPermissionByMap(std::ve
     if ((flag & FLAG_WRITE_URI) != 0) {
         newFlag = FLAG_WRITE_URI;
     }
-    std::vector<bool> result(uriVec.size(), false);
-    for (size_t i = 0; i < uriVec.size(); i++) {
-        auto uriStr = uriVec[i].ToString();
-        result[i] = VerifySingleUriPermissionByMap(uriStr, newFlag, tokenId);
+    std::vector<std::string> uriStrVec;
+    uriStrVec.reserve(uriVec.size());
+    for (auto &uri : uriVec) {
+        uriStrVec.emplace_back(uri.ToString());
     }
-    return result;
+    return grantStore_.VerifyBatch(uriStrVec, newFlag, tokenId);
 }
 
 bool UriPermissionManagerStubImpl::VerifySingleUriPermissionByMap(const std::string &uri,
     uint32_t flag, uint32_t tokenId)
 {
-    std::lock_guard<std::mutex> guard(mutex_);
-    auto search = uriMap_.find(uri);
-    if (search != uriMap_.end()) {
-        auto& list = search->second;
-        for (auto it = list.begin(); it != list.end(); it++) {
-            if ((it->targetTokenId == tokenId) && ((it->flag | FLAG_READ_URI) & flag) != 0) {
-                TAG_LOGD(AAFwkTag::URIPERMMGR, "have uri permission");
-                return true;
-            }
-        }
-    }
-    return VerifySubDirUriPermission(uri, flag, tokenId);
-}
-
-bool UriPermissionManagerStubImpl::VerifySubDirUriPermission(const std::string &uriStr,
-                                                             uint32_t newFlag, uint32_t tokenId)
-{
-    auto iPos = uriStr.find(DISTRIBUTED_DOCS_URI_MARK);
-    if (iPos == std::string::npos) {
-        TAG_LOGI(AAFwkTag::URIPERMMGR, "Local uri not support to verify sub directory uri permission");
-        return false;
-    }
-
-    for (auto search = uriMap_.rbegin(); search != uriMap_.rend(); ++search) {
-        if (!IsDistributedSubDirUri(uriStr, search->first)) {
-            continue;
-        }
-        auto& list = search->second;
-        for (auto it = list.begin(); it != list.end(); it++) {
-            if ((it->targetTokenId == tokenId) && ((it->flag | FLAG_READ_URI) & newFlag) != 0) {
-                TAG_LOGD(AAFwkTag::URIPERMMGR, "have uri permission");
-                return true;
-            }
-        }
-        break;
-    }
-    TAG_LOGI(AAFwkTag::URIPERMMGR, "Uri permission not exists");
-    return false;
-}
-
-bool UriPermissionManagerStubImpl::IsDistributedSubDirUri(const std::string &inputUri, const std::string &cachedUri)
-{
-    auto iPos = inputUri.find(DISTRIBUTED_DOCS_URI_MARK);
-    auto cPos = cachedUri.find(DISTRIBUTED_DOCS_URI_MARK);
-    if ((iPos == std::string::npos) || (cPos == std::string::npos)) {
-        TAG_LOGI(AAFwkTag::URIPERMMGR, "not distributed file uri");
-        return false;
-    }
-    std::string iTempUri = inputUri.substr(0, iPos);
-    std::string cTempUri = cachedUri.substr(0, cPos);
-    std::string iTempNetworkId = inputUri.substr(iPos);
-    std::string cTempNetworkId = cachedUri.substr(cPos);
-    return (iTempUri.find(cTempUri + "/") == 0 && iTempNetworkId.compare(cTempNetworkId) == 0);
+    return grantStore_.Verify(uri, flag, tokenId);
 }
 
 ErrCode UriPermissionManagerStubImpl::GrantUriPermission(const Uri& uri, uint32_t flag,
@@ -749,26 +696,7 @@ int32_t UriPermissionManagerStubImpl::GrantBatchUriPermissionImpl(const std::vec
 int32_t UriPermissionManagerStubImpl::AddTempUriPermission(const std::string &uri, uint32_t flag,
     TokenId fromTokenId, TokenId targetTokenId)
 {
-    std::lock_guard<std::mutex> guard(mutex_);
-    auto search = uriMap_.find(uri);
-    GrantInfo info = { flag, fromTokenId, targetTokenId };
-    if (search == uriMap_.end()) {
-        std::list<GrantInfo> infoList = { info };
-        uriMap_.emplace(uri, infoList);
-        return ERR_OK;
-    }
-    auto& infoList = search->second;
-    for (auto& item : infoList) {
-        if (item.fromTokenId == fromTokenId && item.targetTokenId == targetTokenId) {
-            TAG_LOGD(AAFwkTag::URIPERMMGR, "Item: flag:%{public}u", item.flag);
-            if ((item.flag & flag) != flag) {
-                item.flag |= flag;
-                return ERR_OK;
-            }
-            return ERR_OK;
-        }
-    }
-    infoList.emplace_back(info);
+    grantStore_.Add(uri, flag, fromTokenId, targetTokenId);
     return ERR_OK;
 }
 
@@ -1348,30 +1276,8 @@ void UriPermissionManagerStubImpl::RevokeMapUriPermission(uint32_t tokenId)
     HITRACE_METER_NAME(HITRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
     // revoke uri permission record cache of tokenId when application exit
     TAG_LOGD(AAFwkTag::URIPERMMGR, "RevokeMapUriPermission call");
-    std::lock_guard<std::mutex> guard(mutex_);
     std::vector<std::string> uriList;
-    int32_t deleteCount = 0;
-    for (auto iter = uriMap_.begin(); iter != uriMap_.end();) {
-        auto& list = iter->second;
-        bool findUriRecord = false;
-        for (auto it = list.begin(); it != list.end();) {
-            if (it->targetTokenId == tokenId) {
-                deleteCount++;
-                it = list.erase(it);
-                findUriRecord = true;
-                continue;
-            }
-            it++;
-        }
-        if (findUriRecord) {
-            uriList.emplace_back(iter->first);
-        }
-        if (list.empty()) {
-            iter = uriMap_.erase(iter);
-            continue;
-        }
-        ++iter;
-    }
+    int32_t deleteCount = grantStore_.RevokeByTarget(tokenId, uriList);
     if (!uriList.empty()) {
         DeleteShareFile(tokenId, uriList);
     }
@@ -1427,35 +1333,7 @@ int32_t UriPermissionManagerStubImpl::RevokeAllMapUriPermissions(uint32_t tokenI
     std::string callerAuthority = "";
     FUDUtils::GetAlterableBundleNameByTokenId(tokenId, callerAuthority);
     std::map<uint32_t, std::vector<std::string>> uriLists;
-    {
-        std::lock_guard<std::mutex> guard(mutex_);
-        for (auto iter = uriMap_.begin(); iter != uriMap_.end();) {
-            auto uriAuthority = Uri(iter->first).GetAuthority();
-            // uri belong to target tokenId.
-            if (callerAuthority == uriAuthority) {
-                for (const auto &record : iter->second) {
-                    uriLists[record.targetTokenId].emplace_back(iter->first);
-                }
-                iter = uriMap_.erase(iter);
-                continue;
-            }
-            auto& list = iter->second;
-            for (auto it = list.begin(); it != list.end();) {
-                if (it->targetTokenId == tokenId || it->fromTokenId == tokenId) {
-                    TAG_LOGI(AAFwkTag::URIPERMMGR, "Erase an uri permission record");
-                    uriLists[it->targetTokenId].emplace_back(iter->first);
-                    it = list.erase(it);
-                    continue;
-                }
-                it++;
-            }
-            if (list.empty()) {
-                iter = uriMap_.erase(iter);
-                continue;
-            }
-            iter++;
-        }
-    }
+    grantStore_.RevokeAll(tokenId, callerAuthority, uriLists);
 
     for (auto iter = uriLists.begin(); iter != uriLists.end(); iter++) {
         if (DeleteShareFile(iter->first, iter->second) != ERR_OK) {
@@ -1546,25 +1424,9 @@ int32_t UriPermissionManagerStubImpl::RevokeMapUriPermissionManually(uint32_t ca
     FUDUtils::GetAlterableBundleNameByTokenId(callerTokenId, callerAuthority);
     bool isRevokeSelfUri = (callerTokenId == targetTokenId || callerAuthority == uriAuthority);
     std::vector<std::string> uriList;
-    {
-        std::lock_guard<std::mutex> guard(mutex_);
-        auto search = uriMap_.find(uriStr);
-        if (search == uriMap_.end()) {
-            TAG_LOGI(AAFwkTag::URIPERMMGR, "URI not exist on uri map");
-            return ERR_OK;
-        }
-        auto& list = search->second;
-        for (auto it = list.begin(); it != list.end(); it++) {
-            if (it->targetTokenId == targetTokenId && (callerTokenId == it->fromTokenId || isRevokeSelfUri)) {
-                uriList.emplace_back(search->first);
-                TAG_LOGD(AAFwkTag::URIPERMMGR, "revoke uri permission record");
-                list.erase(it);
-                break;
-            }
-        }
-        if (list.empty()) {
-            uriMap_.erase(search);
-        }
+    if (!grantStore_.RevokeOne(uriStr, callerTokenId, targetTokenId, isRevokeSelfUri, uriList)) {
+        TAG_LOGI(AAFwkTag::URIPERMMGR, "URI not exist on uri map");
+        return ERR_OK;
     }
     return DeleteShareFile(targetTokenId, uriList);
 }
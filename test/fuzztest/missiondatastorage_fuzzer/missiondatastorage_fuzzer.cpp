@@ -81,12 +81,11 @@ bool DoSomethingInterestingWithMyAPI(const char* data, size_t size)
     size_t bufferSize;
     missionDataStorage->ReadFileToBuffer(stringParam, bufferSize);
     missionDataStorage->GetCachedSnapshot(int32Param, missionSnapshot);
-    missionDataStorage->SaveSnapshotFile(int32Param, missionSnapshot);
+    missionDataStorage->SaveSnapshotFile(int32Param, missionSnapshot.snapshot, boolParam, false);
     missionSnapshot.snapshot = std::make_shared<Media::PixelMap>();
-    missionDataStorage->SaveCachedSnapshot(int32Param, missionSnapshot);
-    missionDataStorage->DeleteCachedSnapshot(int32Param);
+    missionDataStorage->QueueMissionSnapshot(int32Param, missionSnapshot);
     missionDataStorage->DeleteMissionSnapshot(int32Param);
-    missionDataStorage->SaveSnapshotFile(int32Param, missionSnapshot);
+    missionDataStorage->SaveSnapshotFile(int32Param, missionSnapshot.snapshot, boolParam, false);
 #endif
 
     return true;
@@ -140,7 +140,7 @@ TestApplicationPreRunningRecord AmsAppServiceFlowModuleTest::TestCreateApplicati
         loadParam->token = token;
         appRecord = serviceInner_->CreateAppRunningRecord(
             loadParam, appInfo, abilityInfo, appName, bundleInfo, hapModuleInfo, nullptr);
-        appRecord->GetPriorityObject()->SetPid(TestApplicationPreRunningRecord::g_pid++);
+        serviceInner_->appRunningManager_->SetAppRunningRecordPid(appRecord, TestApplicationPreRunningRecord::g_pid++);
     } else {
         serviceInner_->StartAbility(token, nullptr, abilityInfo, appRecord, hapModuleInfo, nullptr, 0);
     }
@@ -1499,5 +1499,75 @@ HWTEST_F(AbilityCacheManagerTest, DeleteInvalidServiceRecord_002, TestSize.Level
     EXPECT_NE(result, nullptr);
     cacheMgr.Remove(rec);
 }
+/**
+ * @tc.name: AbilityCacheManagerTest_ExtensionRecordIndex_001
+ * @tc.desc: Records are found by token, id and session id until the last reference is removed
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(AbilityCacheManagerTest, ExtensionRecordIndex_001, TestSize.Level1)
+{
+    AppExecFwk::AbilityInfo abilityInfo;
+    AppExecFwk::ApplicationInfo appInfo;
+    Want want;
+    want.SetParam(Want::PARAM_ASSERT_FAULT_SESSION_ID, std::string("IndexSessionId"));
+    auto rec = std::make_shared<BaseExtensionRecord>(want, abilityInfo, appInfo);
+    rec->Init(AbilityRequest());
+    auto other = std::make_shared<BaseExtensionRecord>(Want(), abilityInfo, appInfo);
+    other->Init(AbilityRequest());
+
+    ExtensionRecordIndex index;
+    index.Add(rec);
+    index.Add(rec);
+    index.Add(other);
+    index.Add(nullptr);
+    EXPECT_EQ(index.Size(), 2);
+    EXPECT_EQ(index.FindByToken(rec->GetToken()), rec);
+    EXPECT_EQ(index.FindById(rec->GetAbilityRecordId()), rec);
+    EXPECT_EQ(index.FindBySessionId("IndexSessionId"), rec);
+    EXPECT_EQ(index.FindBySessionId(""), nullptr);
+    EXPECT_EQ(index.FindByToken(nullptr), nullptr);
+
+    index.Remove(rec);
+    EXPECT_EQ(index.FindByToken(rec->GetToken()), rec);
+    index.Remove(rec);
+    EXPECT_EQ(index.FindByToken(rec->GetToken()), nullptr);
+    EXPECT_EQ(index.FindById(rec->GetAbilityRecordId()), nullptr);
+    EXPECT_EQ(index.FindBySessionId("IndexSessionId"), nullptr);
+    EXPECT_EQ(index.FindByToken(other->GetToken()), other);
+    EXPECT_TRUE(index.Contains(other->GetAbilityRecordId()));
+    EXPECT_FALSE(index.Contains(rec->GetAbilityRecordId()));
+}
+
+/**
+ * @tc.name: AbilityCacheManagerTest_FindRecordByToken_003
+ * @tc.desc: Records eliminated from the cache are no longer found by token
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(AbilityCacheManagerTest, FindRecordByToken_003, TestSize.Level1)
+{
+    AbilityCacheManager cacheMgr;
+    cacheMgr.Init(1, 1);
+    AppExecFwk::AbilityInfo abilityInfo;
+    AppExecFwk::ApplicationInfo appInfo;
+    Want want;
+    auto rec1 = std::make_shared<BaseExtensionRecord>(want, abilityInfo, appInfo);
+    rec1->Init(AbilityRequest());
+    auto rec2 = std::make_shared<BaseExtensionRecord>(want, abilityInfo, appInfo);
+    rec2->Init(AbilityRequest());
+
+    EXPECT_EQ(cacheMgr.Put(rec1), nullptr);
+    EXPECT_EQ(cacheMgr.Put(rec2), rec1);
+    EXPECT_EQ(cacheMgr.FindRecordByToken(rec1->GetToken()), nullptr);
+    EXPECT_EQ(cacheMgr.FindRecordByToken(rec2->GetToken()), rec2);
+
+    cacheMgr.Remove(rec1);
+    EXPECT_EQ(cacheMgr.devRecLru_.size(), 1);
+    cacheMgr.Remove(rec2);
+    EXPECT_EQ(cacheMgr.FindRecordByToken(rec2->GetToken()), nullptr);
+    EXPECT_EQ(cacheMgr.devRecIndex_.Size(), 0);
+}
+
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -813,7 +813,7 @@ HWTEST_F(AbilityConnectManagerFourthTest, SignRestartProcess_001, TestSize.Level
     abilityRequest.appInfo.bundleName = "com.example.unittest";
     abilityRequest.abilityInfo.name = "MainAbility";
     auto abilityRecord = BaseExtensionRecord::CreateBaseExtensionRecord(abilityRequest);
-    connectManager->serviceMap_.emplace("TestKey", abilityRecord);
+    connectManager->AddToServiceMap("TestKey", abilityRecord);
     connectManager->SignRestartProcess(pid);
     EXPECT_FALSE(abilityRecord->GetRestartAppFlag());
 
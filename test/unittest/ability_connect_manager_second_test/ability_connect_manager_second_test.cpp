@@ -194,7 +194,7 @@ HWTEST_F(AbilityConnectManagerSecondTest, UpdateKeepAliveEnableState_001, TestSi
     EXPECT_EQ(res, ERR_OK);
 
     std::string key = "testKey";
-    connectManager->serviceMap_.emplace(key, serviceRecord_);
+    connectManager->AddToServiceMap(key, serviceRecord_);
     res = connectManager->UpdateKeepAliveEnableState(bundleName, moduleName, mainElement, updateEnable);
     EXPECT_EQ(res, ERR_OK);
 
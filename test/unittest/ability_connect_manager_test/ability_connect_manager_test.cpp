@@ -1548,7 +1548,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_StartAbilityLocked_001, Test
         abilityRequest.abilityInfo.name, abilityRequest.abilityInfo.moduleName);
     EXPECT_EQ(element.GetURI(), stringUri);
     abilityRecord->currentState_ = AbilityState::ACTIVE;
-    connectManager->serviceMap_.emplace(stringUri, abilityRecord);
+    connectManager->AddToServiceMap(stringUri, abilityRecord);
     int res = connectManager->StartAbilityLocked(abilityRequest);
     EXPECT_EQ(res, ERR_OK);
 }
@@ -1584,7 +1584,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ConnectAbilityLocked_001, Te
     std::string stringUri = "id/bundle/name/module";
     abilityRecord->currentState_ = AbilityState::ACTIVE;
     abilityRecord->AddConnectRecordToList(connection1);
-    connectManager->serviceMap_.emplace(stringUri, abilityRecord);
+    connectManager->AddToServiceMap(stringUri, abilityRecord);
     connectManager->connectMap_.clear();
     connectManager->ConnectAbilityLocked(abilityRequest, connect, callerToken);
     abilityRecord->AddConnectRecordToList(connection2);
@@ -1607,7 +1607,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_AttachAbilityThreadLocked_00
     std::shared_ptr<BaseExtensionRecord> abilityRecord = serviceRecord_;
     sptr<IAbilityScheduler> scheduler = nullptr;
     sptr<IRemoteObject> token = abilityRecord->GetToken();
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     connectManager->eventHandler_ = nullptr;
     connectManager->taskHandler_ = nullptr;
     int res = connectManager->AttachAbilityThreadLocked(scheduler, token);
@@ -1636,7 +1636,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_OnAppStateChanged_001, TestS
     abilityRecord->abilityInfo_.applicationInfo.name = name;
     abilityRecord->abilityInfo_.uid = uid;
     info.appData.push_back({name, uid});
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     connectManager->OnAppStateChanged(info);
 }
 
@@ -1662,7 +1662,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_OnAppStateChanged_002, TestS
     abilityRecord->abilityInfo_.applicationInfo.name = name;
     abilityRecord->abilityInfo_.uid = uid;
     info.appData.push_back({name, uid});
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     connectManager->serviceMap_.emplace("first", nullptr);
     connectManager->OnAppStateChanged(info);
 }
@@ -1683,7 +1683,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_AbilityTransitionDone_001, T
     int state = AbilityState::INACTIVE;
     abilityRecord->abilityInfo_.type = AbilityType::PAGE;
     abilityRecord->SetAbilityState(AbilityState::ACTIVE);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res1 = connectManager->AbilityTransitionDone(token, state);
     EXPECT_EQ(res1, ERR_INVALID_VALUE);
     state = AbilityState::INITIAL;
@@ -1818,7 +1818,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_TerminateOrCacheAbility_001,
     abilityRecord->abilityInfo_.bundleName = AbilityConfig::SCENEBOARD_BUNDLE_NAME;
     abilityRecord->abilityInfo_.name = AbilityConfig::SCENEBOARD_ABILITY_NAME;
 
-    connectManager->serviceMap_.emplace("sceneBoard", abilityRecord);
+    connectManager->AddToServiceMap("sceneBoard", abilityRecord);
     connectManager->TerminateOrCacheAbility(abilityRecord);
     EXPECT_EQ(connectManager->serviceMap_.count("sceneBoard"), 1u);
 }
@@ -1839,7 +1839,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleConnectAbilityDoneLo
     sptr<IRemoteObject> remoteObject = nullptr;
     abilityRecord->abilityInfo_.type = AbilityType::PAGE;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res = connectManager->ScheduleConnectAbilityDoneLocked(token, remoteObject);
     EXPECT_EQ(res, ERR_OK);
 }
@@ -1864,12 +1864,12 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleDisconnectAbilityDon
     abilityRecord->abilityInfo_.type = AbilityType::PAGE;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
     abilityRecord->connRecordList_.push_back(connection);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res = connectManager->ScheduleDisconnectAbilityDoneLocked(token);
     EXPECT_EQ(res, INVALID_CONNECTION_STATE);
     abilityRecord->AddStartId();
     abilityRecord->SetAbilityState(AbilityState::ACTIVE);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     res = connectManager->ScheduleDisconnectAbilityDoneLocked(token);
     EXPECT_EQ(res, ERR_OK);
 }
@@ -1890,7 +1890,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleCommandAbilityDoneLo
     abilityRecord->abilityInfo_.type = AbilityType::PAGE;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
     abilityRecord->connRecordList_.clear();
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res = connectManager->ScheduleCommandAbilityDoneLocked(token);
     EXPECT_EQ(res, ERR_OK);
 }
@@ -1925,7 +1925,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_GetServiceRecordByElementNam
     std::shared_ptr<AbilityConnectManager> connectManager = std::make_shared<AbilityConnectManager>(0);
     std::shared_ptr<BaseExtensionRecord> abilityRecord = serviceRecord_;
     std::string element = "first";
-    connectManager->serviceMap_.emplace(element, abilityRecord);
+    connectManager->AddToServiceMap(element, abilityRecord);
     auto res = connectManager->GetServiceRecordByElementName(element);
     EXPECT_NE(res, nullptr);
 }
@@ -1979,7 +1979,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_GetAbilityRecordById_001, Te
     std::shared_ptr<AbilityConnectManager> connectManager = std::make_shared<AbilityConnectManager>(0);
     std::shared_ptr<BaseExtensionRecord> abilityRecord = serviceRecord_;
     int64_t abilityRecordId = abilityRecord->GetRecordId();
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     connectManager->serviceMap_.emplace("second", nullptr);
     auto res = connectManager->GetExtensionByIdFromServiceMap(abilityRecordId);
     EXPECT_NE(res, nullptr);
@@ -2324,7 +2324,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_OnTimeOut_001, TestSize.Leve
     ASSERT_NE(connectManager, nullptr);
     std::shared_ptr<BaseExtensionRecord> abilityRecord = serviceRecord_;
     uint32_t msgId = 2;
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int64_t abilityRecordId = 1;
     connectManager->OnTimeOut(msgId, abilityRecordId);
     msgId = 0;
@@ -2397,7 +2397,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_DisconnectBeforeCleanup_001,
     abilityRecord->currentState_ = AbilityState::ACTIVE;
     abilityRecord->AddConnectRecordToList(connection1);
     connectManager->AddConnectObjectToMap(callback1->AsObject(), abilityRecord->GetConnectRecordList(), false);
-    connectManager->serviceMap_.emplace(stringUri, abilityRecord);
+    connectManager->AddToServiceMap(stringUri, abilityRecord);
     connectManager->DisconnectBeforeCleanup();
     ASSERT_EQ(abilityRecord->GetConnectRecordList().empty(), true);
     ASSERT_EQ(connectManager->GetConnectRecordListByCallback(callback1).empty(), true);
@@ -2638,7 +2638,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_StartAbilityLocked_With_Sess
         abilityRequest.abilityInfo.name, abilityRequest.abilityInfo.moduleName);
     EXPECT_EQ(element.GetURI(), stringUri);
     abilityRecord->currentState_ = AbilityState::ACTIVE;
-    connectManager->serviceMap_.emplace(stringUri, abilityRecord);
+    connectManager->AddToServiceMap(stringUri, abilityRecord);
     abilityRequest.sessionInfo = MockSessionInfo(0);
     int res = connectManager->StartAbilityLocked(abilityRequest);
     EXPECT_EQ(res, ERR_OK);
@@ -3185,7 +3185,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleConnectAbilityDoneLo
     sptr<IRemoteObject> remoteObject = nullptr;
     abilityRecord->abilityInfo_.type = AbilityType::EXTENSION;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res = connectManager->ScheduleConnectAbilityDoneLocked(token, remoteObject);
     EXPECT_EQ(res, ERR_OK);
 }
@@ -3206,7 +3206,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleConnectAbilityDoneLo
     sptr<IRemoteObject> remoteObject = nullptr;
     abilityRecord->abilityInfo_.type = AbilityType::SERVICE;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res = connectManager->ScheduleConnectAbilityDoneLocked(token, remoteObject);
     EXPECT_EQ(res, ERR_OK);
 }
@@ -3227,7 +3227,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleConnectAbilityDoneLo
     sptr<IRemoteObject> remoteObject = nullptr;
     abilityRecord->abilityInfo_.type = AbilityType::DATA;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res = connectManager->ScheduleConnectAbilityDoneLocked(token, remoteObject);
     EXPECT_EQ(res, ERR_OK);
 }
@@ -3248,7 +3248,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleConnectAbilityDoneLo
     sptr<IRemoteObject> remoteObject = nullptr;
     abilityRecord->abilityInfo_.type = AbilityType::FORM;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res = connectManager->ScheduleConnectAbilityDoneLocked(token, remoteObject);
     EXPECT_EQ(res, ERR_OK);
 }
@@ -3269,7 +3269,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleConnectAbilityDoneLo
     sptr<IRemoteObject> remoteObject = nullptr;
     abilityRecord->abilityInfo_.type = AbilityType::UNKNOWN;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res = connectManager->ScheduleConnectAbilityDoneLocked(token, remoteObject);
     EXPECT_EQ(res, ERR_OK);
 }
@@ -3290,7 +3290,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleConnectAbilityDoneLo
     sptr<IRemoteObject> remoteObject = nullptr;
     abilityRecord->abilityInfo_.type = AbilityType::PAGE;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res = connectManager->ScheduleConnectAbilityDoneLocked(nullptr, remoteObject);
     EXPECT_EQ(res, ERR_INVALID_VALUE);
 }
@@ -3311,7 +3311,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleConnectAbilityDoneLo
     sptr<IRemoteObject> remoteObject = nullptr;
     abilityRecord->abilityInfo_.type = AbilityType::EXTENSION;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res = connectManager->ScheduleConnectAbilityDoneLocked(nullptr, remoteObject);
     EXPECT_EQ(res, ERR_INVALID_VALUE);
 }
@@ -3332,7 +3332,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleConnectAbilityDoneLo
     sptr<IRemoteObject> remoteObject = nullptr;
     abilityRecord->abilityInfo_.type = AbilityType::SERVICE;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res = connectManager->ScheduleConnectAbilityDoneLocked(nullptr, remoteObject);
     EXPECT_EQ(res, ERR_INVALID_VALUE);
 }
@@ -3353,7 +3353,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleConnectAbilityDoneLo
     sptr<IRemoteObject> remoteObject = nullptr;
     abilityRecord->abilityInfo_.type = AbilityType::DATA;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res = connectManager->ScheduleConnectAbilityDoneLocked(nullptr, remoteObject);
     EXPECT_EQ(res, ERR_INVALID_VALUE);
 }
@@ -3374,7 +3374,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleConnectAbilityDoneLo
     sptr<IRemoteObject> remoteObject = nullptr;
     abilityRecord->abilityInfo_.type = AbilityType::FORM;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res = connectManager->ScheduleConnectAbilityDoneLocked(nullptr, remoteObject);
     EXPECT_EQ(res, ERR_INVALID_VALUE);
 }
@@ -3395,7 +3395,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleConnectAbilityDoneLo
     sptr<IRemoteObject> remoteObject = nullptr;
     abilityRecord->abilityInfo_.type = AbilityType::UNKNOWN;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res = connectManager->ScheduleConnectAbilityDoneLocked(nullptr, remoteObject);
     EXPECT_EQ(res, ERR_INVALID_VALUE);
 }
@@ -3420,12 +3420,12 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleDisconnectAbilityDon
     abilityRecord->abilityInfo_.type = AbilityType::EXTENSION;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
     abilityRecord->connRecordList_.push_back(connection);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res = connectManager->ScheduleDisconnectAbilityDoneLocked(token);
     EXPECT_EQ(res, INVALID_CONNECTION_STATE);
     abilityRecord->AddStartId();
     abilityRecord->SetAbilityState(AbilityState::ACTIVE);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     res = connectManager->ScheduleDisconnectAbilityDoneLocked(token);
     EXPECT_EQ(res, ERR_OK);
 }
@@ -3450,12 +3450,12 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleDisconnectAbilityDon
     abilityRecord->abilityInfo_.type = AbilityType::SERVICE;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
     abilityRecord->connRecordList_.push_back(connection);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res = connectManager->ScheduleDisconnectAbilityDoneLocked(token);
     EXPECT_EQ(res, INVALID_CONNECTION_STATE);
     abilityRecord->AddStartId();
     abilityRecord->SetAbilityState(AbilityState::ACTIVE);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     res = connectManager->ScheduleDisconnectAbilityDoneLocked(token);
     EXPECT_EQ(res, ERR_OK);
 }
@@ -3480,12 +3480,12 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleDisconnectAbilityDon
     abilityRecord->abilityInfo_.type = AbilityType::DATA;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
     abilityRecord->connRecordList_.push_back(connection);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res = connectManager->ScheduleDisconnectAbilityDoneLocked(token);
     EXPECT_EQ(res, INVALID_CONNECTION_STATE);
     abilityRecord->AddStartId();
     abilityRecord->SetAbilityState(AbilityState::ACTIVE);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     res = connectManager->ScheduleDisconnectAbilityDoneLocked(token);
     EXPECT_EQ(res, ERR_OK);
 }
@@ -3510,12 +3510,12 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleDisconnectAbilityDon
     abilityRecord->abilityInfo_.type = AbilityType::FORM;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
     abilityRecord->connRecordList_.push_back(connection);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res = connectManager->ScheduleDisconnectAbilityDoneLocked(token);
     EXPECT_EQ(res, INVALID_CONNECTION_STATE);
     abilityRecord->AddStartId();
     abilityRecord->SetAbilityState(AbilityState::ACTIVE);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     res = connectManager->ScheduleDisconnectAbilityDoneLocked(token);
     EXPECT_EQ(res, ERR_OK);
 }
@@ -3540,12 +3540,12 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleDisconnectAbilityDon
     abilityRecord->abilityInfo_.type = AbilityType::UNKNOWN;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
     abilityRecord->connRecordList_.push_back(connection);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res = connectManager->ScheduleDisconnectAbilityDoneLocked(token);
     EXPECT_EQ(res, INVALID_CONNECTION_STATE);
     abilityRecord->AddStartId();
     abilityRecord->SetAbilityState(AbilityState::ACTIVE);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     res = connectManager->ScheduleDisconnectAbilityDoneLocked(token);
     EXPECT_EQ(res, ERR_OK);
 }
@@ -3570,12 +3570,12 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleDisconnectAbilityDon
     abilityRecord->abilityInfo_.type = AbilityType::PAGE;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
     abilityRecord->connRecordList_.push_back(connection);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res = connectManager->ScheduleDisconnectAbilityDoneLocked(token);
     EXPECT_EQ(res, INVALID_CONNECTION_STATE);
     abilityRecord->AddStartId();
     abilityRecord->SetAbilityState(AbilityState::ACTIVE);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     res = connectManager->ScheduleDisconnectAbilityDoneLocked(nullptr);
     EXPECT_EQ(res, CONNECTION_NOT_EXIST);
 }
@@ -3600,12 +3600,12 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleDisconnectAbilityDon
     abilityRecord->abilityInfo_.type = AbilityType::EXTENSION;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
     abilityRecord->connRecordList_.push_back(connection);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res = connectManager->ScheduleDisconnectAbilityDoneLocked(token);
     EXPECT_EQ(res, INVALID_CONNECTION_STATE);
     abilityRecord->AddStartId();
     abilityRecord->SetAbilityState(AbilityState::ACTIVE);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     res = connectManager->ScheduleDisconnectAbilityDoneLocked(nullptr);
     EXPECT_EQ(res, CONNECTION_NOT_EXIST);
 }
@@ -3630,12 +3630,12 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleDisconnectAbilityDon
     abilityRecord->abilityInfo_.type = AbilityType::SERVICE;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
     abilityRecord->connRecordList_.push_back(connection);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res = connectManager->ScheduleDisconnectAbilityDoneLocked(token);
     EXPECT_EQ(res, INVALID_CONNECTION_STATE);
     abilityRecord->AddStartId();
     abilityRecord->SetAbilityState(AbilityState::ACTIVE);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     res = connectManager->ScheduleDisconnectAbilityDoneLocked(nullptr);
     EXPECT_EQ(res, CONNECTION_NOT_EXIST);
 }
@@ -3660,12 +3660,12 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleDisconnectAbilityDon
     abilityRecord->abilityInfo_.type = AbilityType::DATA;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
     abilityRecord->connRecordList_.push_back(connection);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res = connectManager->ScheduleDisconnectAbilityDoneLocked(token);
     EXPECT_EQ(res, INVALID_CONNECTION_STATE);
     abilityRecord->AddStartId();
     abilityRecord->SetAbilityState(AbilityState::ACTIVE);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     res = connectManager->ScheduleDisconnectAbilityDoneLocked(nullptr);
     EXPECT_EQ(res, CONNECTION_NOT_EXIST);
 }
@@ -3690,12 +3690,12 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleDisconnectAbilityDon
     abilityRecord->abilityInfo_.type = AbilityType::FORM;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
     abilityRecord->connRecordList_.push_back(connection);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res = connectManager->ScheduleDisconnectAbilityDoneLocked(token);
     EXPECT_EQ(res, INVALID_CONNECTION_STATE);
     abilityRecord->AddStartId();
     abilityRecord->SetAbilityState(AbilityState::ACTIVE);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     res = connectManager->ScheduleDisconnectAbilityDoneLocked(nullptr);
     EXPECT_EQ(res, CONNECTION_NOT_EXIST);
 }
@@ -3720,12 +3720,12 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleDisconnectAbilityDon
     abilityRecord->abilityInfo_.type = AbilityType::UNKNOWN;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
     abilityRecord->connRecordList_.push_back(connection);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     int res = connectManager->ScheduleDisconnectAbilityDoneLocked(token);
     EXPECT_EQ(res, INVALID_CONNECTION_STATE);
     abilityRecord->AddStartId();
     abilityRecord->SetAbilityState(AbilityState::ACTIVE);
-    connectManager->serviceMap_.emplace("first", abilityRecord);
+    connectManager->AddToServiceMap("first", abilityRecord);
     res = connectManager->ScheduleDisconnectAbilityDoneLocked(nullptr);
     EXPECT_EQ(res, CONNECTION_NOT_EXIST);
 }
@@ -3751,7 +3751,7 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_ScheduleDisconnectAbilityDon
     abilityRecord->abilityInfo_.extensionAbilityType = ExtensionAbilityType::AGENT;
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
     abilityRecord->connRecordList_.push_back(connection);
-    connectManager->serviceMap_.emplace(AbilityConnectManager::GetServiceKey(abilityRecord), abilityRecord);
+    connectManager->AddToServiceMap(AbilityConnectManager::GetServiceKey(abilityRecord), abilityRecord);
 
     int res = connectManager->ScheduleDisconnectAbilityDoneLocked(token);
     EXPECT_EQ(res, ERR_OK);
@@ -3877,7 +3877,7 @@ HWTEST_F(AbilityConnectManagerTest, Agent_TerminatingRecord_ShouldBeRecreatedFor
     ASSERT_NE(staleRecord, nullptr);
     staleRecord->SetAbilityState(AbilityState::TERMINATING);
     auto serviceKey = AbilityConnectManager::GetServiceKey(abilityRequest);
-    connectManager->serviceMap_.emplace(serviceKey, staleRecord);
+    connectManager->AddToServiceMap(serviceKey, staleRecord);
 
     std::shared_ptr<BaseExtensionRecord> targetService = nullptr;
     bool isLoadedAbility = true;
@@ -4019,5 +4019,75 @@ HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_OnStartSpecifiedProcessTimeo
     EXPECT_TRUE(connectManager->loadAbilityQueue_.empty());
 }
 
+/*
+ * Feature: AbilityConnectManager
+ * Function: GetExtensionByTokenFromServiceMap/GetExtensionByIdFromServiceMap
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Verify records are found by token and id only while they are in serviceMap_.
+ */
+HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_GetExtensionFromServiceMap_Index_001, TestSize.Level1)
+{
+    auto connectManager = std::make_shared<AbilityConnectManager>(0);
+    ASSERT_NE(connectManager, nullptr);
+    AbilityRequest abilityRequest;
+    abilityRequest.appInfo.bundleName = "com.example.unittest";
+    abilityRequest.abilityInfo.name = "IndexAbility";
+    auto abilityRecord = BaseExtensionRecord::CreateBaseExtensionRecord(abilityRequest);
+    ASSERT_NE(abilityRecord, nullptr);
+    sptr<IRemoteObject> token = abilityRecord->GetToken();
+    EXPECT_EQ(connectManager->GetExtensionByTokenFromServiceMap(token), nullptr);
+
+    EXPECT_TRUE(connectManager->AddToServiceMap("first", abilityRecord));
+    EXPECT_FALSE(connectManager->AddToServiceMap("first", serviceRecord_));
+    EXPECT_EQ(connectManager->GetExtensionByTokenFromServiceMap(token), abilityRecord);
+    EXPECT_EQ(connectManager->GetExtensionByIdFromServiceMap(abilityRecord->GetAbilityRecordId()), abilityRecord);
+    EXPECT_EQ(connectManager->GetExtensionByTokenFromServiceMap(serviceRecord_->GetToken()), nullptr);
+
+    connectManager->RemoveServiceFromMapSafe("first");
+    EXPECT_EQ(connectManager->GetExtensionByTokenFromServiceMap(token), nullptr);
+    EXPECT_EQ(connectManager->GetExtensionByIdFromServiceMap(abilityRecord->GetAbilityRecordId()), nullptr);
+    EXPECT_EQ(connectManager->serviceIndex_.Size(), 0);
+}
+
+/*
+ * Feature: AbilityConnectManager
+ * Function: AddToServiceMap/GetExtensionByTokenFromServiceMap/RemoveServiceFromMapSafe
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Verify the token and id index follows serviceMap_ with many running services.
+ */
+HWTEST_F(AbilityConnectManagerTest, AAFwk_AbilityMS_GetExtensionFromServiceMap_Index_002, TestSize.Level1)
+{
+    for (int32_t serviceCount : { 100, 1000, 5000 }) {
+        auto connectManager = std::make_shared<AbilityConnectManager>(0);
+        ASSERT_NE(connectManager, nullptr);
+        std::vector<std::shared_ptr<BaseExtensionRecord>> records;
+        AbilityRequest abilityRequest;
+        abilityRequest.appInfo.bundleName = "com.example.unittest";
+        for (int32_t i = 0; i < serviceCount; i++) {
+            abilityRequest.abilityInfo.name = "ServiceAbility" + std::to_string(i);
+            records.push_back(BaseExtensionRecord::CreateBaseExtensionRecord(abilityRequest));
+            ASSERT_NE(records.back(), nullptr);
+            EXPECT_TRUE(connectManager->AddToServiceMap(records.back()->GetURI(), records.back()));
+        }
+        EXPECT_EQ(connectManager->serviceIndex_.Size(), static_cast<size_t>(serviceCount));
+
+        // disconnect every other service
+        for (int32_t i = 0; i < serviceCount; i += 2) {
+            connectManager->RemoveServiceFromMapSafe(records[i]->GetURI());
+        }
+        for (int32_t i = 0; i < serviceCount; i++) {
+            auto expected = (i % 2 == 0) ? nullptr : records[i];
+            EXPECT_EQ(connectManager->GetExtensionByTokenFromServiceMap(records[i]->GetToken()), expected);
+            EXPECT_EQ(connectManager->GetExtensionByIdFromServiceMap(records[i]->GetAbilityRecordId()), expected);
+        }
+        EXPECT_EQ(connectManager->serviceMap_.size(), static_cast<size_t>(serviceCount / 2));
+        EXPECT_EQ(connectManager->serviceIndex_.Size(), static_cast<size_t>(serviceCount / 2));
+    }
+}
+
 }  // namespace AAFwk
 }  // namespace OHOS
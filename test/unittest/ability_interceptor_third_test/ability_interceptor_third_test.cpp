@@ -21,6 +21,7 @@
 #undef protected
 
 #include "interceptor/crowd_test_interceptor.h"
+#include "ipc_object_stub.h"
 
 using namespace testing;
 using namespace testing::ext;
@@ -28,6 +29,31 @@ using namespace OHOS::AppExecFwk;
 
 namespace OHOS {
 namespace AAFwk {
+namespace {
+class RecordInterceptor : public IAbilityInterceptor {
+public:
+    RecordInterceptor(std::vector<std::string> &records, const std::string &name, uint32_t requestTypes,
+        ErrCode result = ERR_OK) : records_(records), name_(name), requestTypes_(requestTypes), result_(result) {}
+
+    ErrCode DoProcess(const AbilityInterceptorParam &param) override
+    {
+        records_.push_back(name_);
+        return result_;
+    }
+
+    uint32_t GetRequestTypes() const override
+    {
+        return requestTypes_;
+    }
+
+private:
+    std::vector<std::string> &records_;
+    std::string name_;
+    uint32_t requestTypes_;
+    ErrCode result_;
+};
+}
+
 class AbilityInterceptorThirdTest : public testing::Test {
 public:
     static void SetUpTestCase();
@@ -60,12 +86,75 @@ HWTEST_F(AbilityInterceptorThirdTest, RemoveInterceptor_001, TestSize.Level1)
 {
     std::shared_ptr<AbilityInterceptorExecuter> executer = std::make_shared<AbilityInterceptorExecuter>();
     executer->AddInterceptor("CrowdTest", std::make_shared<CrowdTestInterceptor>());
-    auto resMap = executer->GetInterceptorMapCopy();
-    EXPECT_EQ(resMap.size(), 1);
+    EXPECT_EQ(executer->interceptorMap_.size(), 1);
+    EXPECT_EQ(executer->GetChain()->entries.size(), 1);
     executer->RemoveInterceptor("CrowdTest");
-    auto resMap2 = executer->GetInterceptorMapCopy();
-    EXPECT_EQ(resMap2.size(), 0);
+    EXPECT_EQ(executer->interceptorMap_.size(), 0);
+    EXPECT_TRUE(executer->GetChain()->entries.empty());
+}
+
+/**
+ * @tc.name: AbilityInterceptorThirdTest_DoProcess_001
+ * @tc.desc: Interceptors run in the order they are added, only for the request types they apply to
+ * @tc.type: FUNC
+ * @tc.require: No
+ */
+HWTEST_F(AbilityInterceptorThirdTest, DoProcess_001, TestSize.Level1)
+{
+    std::vector<std::string> records;
+    auto executer = std::make_shared<AbilityInterceptorExecuter>();
+    executer->AddInterceptor("C", std::make_shared<RecordInterceptor>(records, "C", INTERCEPTOR_REQUEST_ALL));
+    executer->AddInterceptor("A", std::make_shared<RecordInterceptor>(records, "A",
+        INTERCEPTOR_REQUEST_WITH_CALLER));
+    executer->AddInterceptor("B", std::make_shared<RecordInterceptor>(records, "B", INTERCEPTOR_REQUEST_ALL));
+
+    Want want;
+    auto shouldBlockFunc = []() { return false; };
+    sptr<IRemoteObject> callerToken = new (std::nothrow) IPCObjectStub(u"caller");
+    AbilityInterceptorParam paramWithCaller(want, 0, 0, false, callerToken, shouldBlockFunc);
+    EXPECT_EQ(executer->DoProcess(paramWithCaller), ERR_OK);
+    EXPECT_EQ(records, std::vector<std::string>({ "C", "A", "B" }));
+
+    records.clear();
+    AbilityInterceptorParam paramWithoutCaller(want, 0, 0, false, nullptr, shouldBlockFunc);
+    EXPECT_EQ(executer->DoProcess(paramWithoutCaller), ERR_OK);
+    EXPECT_EQ(records, std::vector<std::string>({ "C", "B" }));
+
+    // replacing keeps the position, a failing interceptor stops the chain
+    records.clear();
+    executer->AddInterceptor("C", std::make_shared<RecordInterceptor>(records, "C", INTERCEPTOR_REQUEST_ALL,
+        ERR_INVALID_VALUE));
+    EXPECT_EQ(executer->DoProcess(paramWithCaller), ERR_INVALID_VALUE);
+    EXPECT_EQ(records, std::vector<std::string>({ "C" }));
+
+    records.clear();
+    executer->RemoveInterceptor("C");
+    EXPECT_EQ(executer->DoProcess(paramWithCaller), ERR_OK);
+    EXPECT_EQ(records, std::vector<std::string>({ "A", "B" }));
+    EXPECT_EQ(executer->GetChain()->entries.size(), 2);
 }
 
+/**
+ * @tc.name: AbilityInterceptorThirdTest_Dump_001
+ * @tc.desc: Dump shows the call count of every interceptor
+ * @tc.type: FUNC
+ * @tc.require: No
+ */
+HWTEST_F(AbilityInterceptorThirdTest, Dump_001, TestSize.Level1)
+{
+    std::vector<std::string> records;
+    auto executer = std::make_shared<AbilityInterceptorExecuter>();
+    executer->AddInterceptor("Record", std::make_shared<RecordInterceptor>(records, "Record",
+        INTERCEPTOR_REQUEST_ALL));
+    Want want;
+    auto shouldBlockFunc = []() { return false; };
+    AbilityInterceptorParam param(want, 0, 0, false, nullptr, shouldBlockFunc);
+    executer->DoProcess(param);
+    executer->DoProcess(param);
+    EXPECT_EQ(executer->GetChain()->entries.front()->count.load(), 2);
+    std::string result;
+    executer->Dump(result);
+    EXPECT_NE(result.find("Record    3    2    "), std::string::npos);
+}
 } // namespace AAFwk
 } // namespace OHOS
@@ -424,7 +424,7 @@ HWTEST_F(AbilityManagerServiceEighthTest, StartUIAbilityBySCB_001, TestSize.Leve
     auto abilityRecord = std::make_shared<UIAbilityRecord>(want, abilityInfo, applicationInfo, -1);
     abilityRecord->Init(AbilityRequest());
     sessionInfo->persistentId = TWO;
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(TWO, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(TWO, abilityRecord);
     abilityMs_->subManagersHelper_->uiAbilityManagers_.emplace(TWO, uiAbilityLifecycleManager);
     ret = abilityMs_->StartUIAbilityBySCB(sessionInfo, params, isColdStart);
     EXPECT_NE(ret, ERR_OK);
@@ -694,7 +694,7 @@ HWTEST_F(AbilityManagerServiceEighthTest, TerminateUIServiceExtensionAbility_001
     token = abilityRecord->GetToken();
     auto connectManager = std::make_shared<CommonExtensionManager>(1);
     connectManager->sceneBoardTokenId_ = 1;
-    connectManager->serviceMap_.emplace(bundleName, abilityRecord);
+    connectManager->AddToServiceMap(bundleName, abilityRecord);
     abilityMs_->subManagersHelper_->commonExtensionManagers_.insert(std::make_pair(1, connectManager));
     IPCSkeleton::SetCallingTokenID(0);
     EXPECT_CALL(Rosen::SceneBoardJudgement::GetInstance(), MockIsSceneBoardEnabled())
@@ -194,7 +194,7 @@ HWTEST_F(AbilityManagerServiceTwelfthTest, CloseUIExtensionAbilityBySCB_001, Tes
         auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
         callerToken = abilityRecord->GetToken();
         auto uiAbilityLifecycleManager = std::make_shared<UIAbilityLifecycleManager>();
-        uiAbilityLifecycleManager->sessionAbilityMap_.emplace(TWO, abilityRecord);
+        uiAbilityLifecycleManager->AddSessionRecord(TWO, abilityRecord);
         abilityMs_->subManagersHelper_->uiAbilityManagers_.emplace(TWO, uiAbilityLifecycleManager);
         EXPECT_EQ(abilityMs_->CloseUIExtensionAbilityBySCB(callerToken), ERR_INVALID_VALUE);
     }
@@ -234,7 +234,7 @@ HWTEST_F(AbilityManagerServiceTwelfthTest, CloseUIExtensionAbilityBySCB_002, Tes
         auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
         callerToken = abilityRecord->GetToken();
         auto uiAbilityLifecycleManager = std::make_shared<UIAbilityLifecycleManager>();
-        uiAbilityLifecycleManager->sessionAbilityMap_.emplace(TWO, abilityRecord);
+        uiAbilityLifecycleManager->AddSessionRecord(TWO, abilityRecord);
         abilityMs_->subManagersHelper_->uiAbilityManagers_.emplace(TWO, uiAbilityLifecycleManager);
         EXPECT_EQ(abilityMs_->CloseUIExtensionAbilityBySCB(callerToken), ERR_INVALID_VALUE);
 
@@ -294,7 +294,7 @@ HWTEST_F(AbilityManagerServiceTwelfthTest, CloseUIAbilityBySCB_001, TestSize.Lev
         abilityRequest = GenerateAbilityRequest(deviceName, abilityName, appName, bundleName, moduleName);
         auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
         sessionInfo->persistentId = TWO;
-        uiAbilityLifecycleManager->sessionAbilityMap_.emplace(TWO, abilityRecord);
+        uiAbilityLifecycleManager->AddSessionRecord(TWO, abilityRecord);
         EXPECT_EQ(abilityMs_->CloseUIAbilityBySCB(sessionInfo, isUserRequestedExit, sceneFlag), ERR_INVALID_VALUE);
 
         isUserRequestedExit = false;
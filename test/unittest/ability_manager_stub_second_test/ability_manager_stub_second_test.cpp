@@ -824,13 +824,13 @@ HWTEST_F(AbilityManagerStubSecondTest, OnRemoteRequestInner_0100, TestSize.Level
 }
 
 /**
- * @tc.name: HandleOnRemoteRequestInnerFirst_0100
- * @tc.desc: Test HandleOnRemoteRequestInnerFirst
+ * @tc.name: DispatchTable_0100
+ * @tc.desc: Test GetDispatchTable, codes of every chunk are dispatched, unknown codes are not found
  * @tc.type: FUNC
  */
-HWTEST_F(AbilityManagerStubSecondTest, HandleOnRemoteRequestInnerFirst_0100, TestSize.Level1)
+HWTEST_F(AbilityManagerStubSecondTest, DispatchTable_0100, TestSize.Level1)
 {
-    TAG_LOGI(AAFwkTag::TEST, "HandleOnRemoteRequestInnerFirst_0100 begin");
+    TAG_LOGI(AAFwkTag::TEST, "DispatchTable_0100 begin");
 
     MessageParcel data;
     MessageParcel reply;
@@ -845,34 +845,7 @@ HWTEST_F(AbilityManagerStubSecondTest, HandleOnRemoteRequestInnerFirst_0100, Tes
         static_cast<uint32_t>(AbilityManagerInterfaceCode::GET_PENDING_WANT_SENDER),
         static_cast<uint32_t>(AbilityManagerInterfaceCode::GET_PENDING_REQUEST_WANT),
         static_cast<uint32_t>(AbilityManagerInterfaceCode::GET_MISSION_INFOS),
-        static_cast<uint32_t>(AbilityManagerInterfaceCode::RELEASE_CALL_ABILITY)
-    };
-
-    int i = 0;
-    while (i < sizeof(code) / sizeof(uint32_t)) {
-        stub_->HandleOnRemoteRequestInnerFirst(code[i++], data, reply, option);
-    }
-    
-    uint32_t code_ = 0;
-    auto ret = stub_->HandleOnRemoteRequestInnerFirst(code_, data, reply, option);
-    EXPECT_EQ(ret, ERR_CODE_NOT_EXIST);
-
-    TAG_LOGI(AAFwkTag::TEST, "HandleOnRemoteRequestInnerFirst_0100 end");
-}
-
-/**
- * @tc.name: HandleOnRemoteRequestInnerSecond_0100
- * @tc.desc: Test HandleOnRemoteRequestInnerSecond
- * @tc.type: FUNC
- */
-HWTEST_F(AbilityManagerStubSecondTest, HandleOnRemoteRequestInnerSecond_0100, TestSize.Level1)
-{
-    TAG_LOGI(AAFwkTag::TEST, "HandleOnRemoteRequestInnerSecond_0100 begin");
-
-    MessageParcel data;
-    MessageParcel reply;
-    MessageOption option;
-    uint32_t code[] = {
+        static_cast<uint32_t>(AbilityManagerInterfaceCode::RELEASE_CALL_ABILITY),
         static_cast<uint32_t>(AbilityManagerInterfaceCode::ACQUIRE_SHARE_DATA),
         static_cast<uint32_t>(AbilityManagerInterfaceCode::START_USER_TEST),
         static_cast<uint32_t>(AbilityManagerInterfaceCode::GET_ELEMENT_NAME_BY_TOKEN),
@@ -881,50 +854,23 @@ HWTEST_F(AbilityManagerStubSecondTest, HandleOnRemoteRequestInnerSecond_0100, Te
         static_cast<uint32_t>(AbilityManagerInterfaceCode::COMPLETE_FIRST_FRAME_DRAWING_BY_SCB),
         static_cast<uint32_t>(AbilityManagerInterfaceCode::NOTIFY_SAVE_AS_RESULT),
         static_cast<uint32_t>(AbilityManagerInterfaceCode::GET_CONNECTION_DATA),
-        static_cast<uint32_t>(AbilityManagerInterfaceCode::NOTIFY_DEBUG_ASSERT_RESULT)
-    };
-
-    int i = 0;
-    while (i < sizeof(code) / sizeof(uint32_t)) {
-        stub_->HandleOnRemoteRequestInnerSecond(code[i++], data, reply, option);
-    }
-    
-    uint32_t code_ = 0;
-    auto ret = stub_->HandleOnRemoteRequestInnerSecond(code_, data, reply, option);
-    EXPECT_EQ(ret, ERR_CODE_NOT_EXIST);
-
-    TAG_LOGI(AAFwkTag::TEST, "HandleOnRemoteRequestInnerSecond_0100 end");
-}
-
-/**
- * @tc.name: HandleOnRemoteRequestInnerThird_0100
- * @tc.desc: Test HandleOnRemoteRequestInnerThird
- * @tc.type: FUNC
- */
-HWTEST_F(AbilityManagerStubSecondTest, HandleOnRemoteRequestInnerThird_0100, TestSize.Level1)
-{
-    TAG_LOGI(AAFwkTag::TEST, "HandleOnRemoteRequestInnerThird_0100 begin");
-
-    MessageParcel data;
-    MessageParcel reply;
-    MessageOption option;
-    uint32_t code[] = {
+        static_cast<uint32_t>(AbilityManagerInterfaceCode::NOTIFY_DEBUG_ASSERT_RESULT),
         static_cast<uint32_t>(AbilityManagerInterfaceCode::SET_APP_SERVICE_EXTENSION_KEEP_ALIVE),
         static_cast<uint32_t>(AbilityManagerInterfaceCode::GET_APP_SERVICE_EXTENSIONS_KEEP_ALIVE),
         static_cast<uint32_t>(AbilityManagerInterfaceCode::SUSPEND_EXTENSION_ABILITY),
         static_cast<uint32_t>(AbilityManagerInterfaceCode::RESUME_EXTENSION_ABILITY)
     };
 
-    int i = 0;
-    while (i < sizeof(code) / sizeof(uint32_t)) {
-        stub_->HandleOnRemoteRequestInnerThird(code[i++], data, reply, option);
+    auto &dispatchTable = AbilityManagerStub::GetDispatchTable();
+    for (auto item : code) {
+        dispatchTable.Dispatch(stub_.GetRefPtr(), item, data, reply, option);
     }
-    
+
     uint32_t code_ = 0;
-    auto ret = stub_->HandleOnRemoteRequestInnerThird(code_, data, reply, option);
+    auto ret = dispatchTable.Dispatch(stub_.GetRefPtr(), code_, data, reply, option);
     EXPECT_EQ(ret, ERR_CODE_NOT_EXIST);
 
-    TAG_LOGI(AAFwkTag::TEST, "HandleOnRemoteRequestInnerThird_0100 end");
+    TAG_LOGI(AAFwkTag::TEST, "DispatchTable_0100 end");
 }
 
 /*
@@ -67,6 +67,20 @@ const std::string SHOW_ON_LOCK_SCREEN = "ShowOnLockScreen";
 const std::string URI_PERMISSION_TABLE_NAME = "uri_permission";
 constexpr const char* UIEXTENSION_LAUNCH_TIMESTAMP_HIGH = "ohos.ability.params.uiExtensionLaunchTimestampHigh";
 constexpr pid_t pid_ = 2000;
+constexpr int32_t TOKEN_RECORD_COUNT = 100;
+
+// the resolution by descriptor used before the token registry, the registry must agree with it
+std::shared_ptr<AbilityRecord> GetAbilityRecordByDescriptor(sptr<IRemoteObject> token)
+{
+    if (token == nullptr || Str16ToStr8(token->GetObjectDescriptor()) != "ohos.aafwk.AbilityToken") {
+        return nullptr;
+    }
+    sptr<IAbilityToken> theToken = iface_cast<IAbilityToken>(token);
+    if (!theToken || theToken->GetDescriptor() != u"ohos.aafwk.AbilityToken") {
+        return nullptr;
+    }
+    return (static_cast<Token *>(token.GetRefPtr()))->GetAbilityRecord();
+}
 }
 class AbilityRecordTest : public testing::TestWithParam<OHOS::AAFwk::AbilityState> {
 public:
@@ -506,6 +520,58 @@ HWTEST_F(AbilityRecordTest, AaFwk_AbilityMS_GetAbilityRecordByToken_001, TestSiz
     EXPECT_EQ(Token::GetAbilityRecordByToken(nullptr), nullptr);
 }
 
+/*
+ * Feature: AbilityRecord
+ * Function: GetAbilityRecordByToken
+ * SubFunction: GetAbilityRecordByToken
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Verify GetAbilityRecordByToken rejects objects other than tokens
+ */
+HWTEST_F(AbilityRecordTest, AaFwk_AbilityMS_GetAbilityRecordByToken_002, TestSize.Level1)
+{
+    sptr<IAbilityScheduler> scheduler = new AbilityScheduler();
+    EXPECT_EQ(Token::GetAbilityRecordByToken(scheduler->AsObject()), nullptr);
+
+    sptr<Token> token = new Token(std::weak_ptr<AbilityRecord>());
+    EXPECT_TRUE(Token::IsLocalToken(token.GetRefPtr()));
+    EXPECT_EQ(Token::GetAbilityRecordByToken(token), nullptr);
+    const IRemoteObject *address = token.GetRefPtr();
+    token = nullptr;
+    EXPECT_FALSE(Token::IsLocalToken(address));
+}
+
+/*
+ * Feature: AbilityRecord
+ * Function: GetAbilityRecordByToken
+ * SubFunction: GetAbilityRecordByToken
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Verify the token registry resolves the same records as the descriptor, also after release
+ */
+HWTEST_F(AbilityRecordTest, AaFwk_AbilityMS_GetAbilityRecordByToken_003, TestSize.Level1)
+{
+    std::vector<std::shared_ptr<AbilityRecord>> records;
+    std::vector<sptr<IRemoteObject>> tokens;
+    for (int32_t i = 0; i < TOKEN_RECORD_COUNT; i++) {
+        auto abilityRecord = AbilityRecord::CreateAbilityRecord(CreateValidAbilityRequest());
+        ASSERT_NE(abilityRecord, nullptr);
+        records.push_back(abilityRecord);
+        tokens.push_back(abilityRecord->GetToken());
+    }
+    for (int32_t i = 0; i < TOKEN_RECORD_COUNT; i++) {
+        EXPECT_EQ(Token::GetAbilityRecordByToken(tokens[i]), records[i]);
+        EXPECT_EQ(GetAbilityRecordByDescriptor(tokens[i]), records[i]);
+    }
+
+    std::vector<std::weak_ptr<AbilityRecord>> weakRecords(records.begin(), records.end());
+    records.clear();
+    for (int32_t i = 0; i < TOKEN_RECORD_COUNT; i++) {
+        EXPECT_EQ(Token::GetAbilityRecordByToken(tokens[i]), weakRecords[i].lock());
+        EXPECT_EQ(GetAbilityRecordByDescriptor(tokens[i]), weakRecords[i].lock());
+    }
+}
+
 /*
  * Feature: AbilityRecord
  * Function: CreateAbilityRecord
@@ -24,6 +24,7 @@
 #include "mock_my_flag.h"
 #undef private
 #undef protected
+#include "ipc_skeleton.h"
 
 using namespace OHOS;
 using namespace testing;
@@ -1756,5 +1757,59 @@ HWTEST_F(AgentCardMgrTest, HandlePreInstallBackfill_008, TestSize.Level1)
     ASSERT_EQ(MyFlag::insertDataCallNames.size(), 1);
     EXPECT_EQ(MyFlag::insertDataCallNames[0], "keep.bundle");
 }
+
+/**
+ * @tc.name: CardCache_001
+ * @tc.desc: GetAgentCardByAgentId is served from the cache until the bundle is removed
+ * @tc.type: FUNC
+ */
+HWTEST_F(AgentCardMgrTest, CardCache_001, TestSize.Level1)
+{
+    AgentCardMgr agentCardMgr;
+    int32_t userId = IPCSkeleton::GetCallingUid() / BASE_USER_RANGE;
+    MyFlag::queryDataCards = { BuildCard("agentA", "1.0.0"), BuildCard("agentB", "1.0.0") };
+    AgentCard card;
+    EXPECT_EQ(agentCardMgr.GetAgentCardByAgentId("test.bundle", "agentB", card), ERR_OK);
+    EXPECT_EQ(card.agentId, "agentB");
+
+    MyFlag::queryDataCards.clear();
+    MyFlag::retQueryData = -1;
+    AgentCard cachedCard;
+    EXPECT_EQ(agentCardMgr.GetAgentCardByAgentId("test.bundle", "agentA", cachedCard), ERR_OK);
+    EXPECT_EQ(cachedCard.agentId, "agentA");
+    EXPECT_EQ(agentCardMgr.GetAgentCardByAgentId("test.bundle", "agentC", cachedCard), ERR_NAME_NOT_FOUND);
+
+    uint64_t generation = agentCardMgr.GetCardsGeneration();
+    EXPECT_EQ(agentCardMgr.GetAgentCardByAgentId("test.bundle", "agentA", cachedCard), ERR_OK);
+    EXPECT_EQ(agentCardMgr.GetCardsGeneration(), generation);
+    EXPECT_EQ(agentCardMgr.HandleBundleRemove("test.bundle", userId), ERR_OK);
+    EXPECT_NE(agentCardMgr.GetCardsGeneration(), generation);
+    EXPECT_EQ(agentCardMgr.GetAgentCardByAgentId("test.bundle", "agentA", cachedCard), -1);
+}
+
+/**
+ * @tc.name: CardCache_002
+ * @tc.desc: GetAllAgentCards reuses the serialized buffer until a card is written
+ * @tc.type: FUNC
+ */
+HWTEST_F(AgentCardMgrTest, CardCache_002, TestSize.Level1)
+{
+    AgentCardMgr agentCardMgr;
+    MyFlag::queryAllDataCards = { BuildCard("agentA", "1.0.0"), BuildCard("agentB", "1.0.0") };
+    AgentCardsRawData cards;
+    EXPECT_EQ(agentCardMgr.GetAllAgentCards(cards), ERR_OK);
+    std::string expected = cards.ownedData;
+    EXPECT_FALSE(expected.empty());
+
+    MyFlag::retQueryAllData = -1;
+    AgentCardsRawData cachedCards;
+    EXPECT_EQ(agentCardMgr.GetAllAgentCards(cachedCards), ERR_OK);
+    EXPECT_EQ(cachedCards.ownedData, expected);
+    EXPECT_EQ(cachedCards.size, expected.size());
+
+    EXPECT_EQ(agentCardMgr.HandleBundleRemove("test.bundle", 100), ERR_OK);
+    AgentCardsRawData newCards;
+    EXPECT_EQ(agentCardMgr.GetAllAgentCards(newCards), -1);
+}
 } // namespace AgentRuntime
 } // namespace OHOS
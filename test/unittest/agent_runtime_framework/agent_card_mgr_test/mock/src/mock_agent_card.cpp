@@ -190,7 +190,12 @@ bool AgentCard::FromJson(nlohmann::json jsonObject, AgentCard &agentCard)
 
 void AgentCardsRawData::FromAgentCardVec(const std::vector<AgentCard> &cards, AgentCardsRawData &rawData)
 {
-    rawData.size = cards.size();
+    rawData.ownedData.clear();
+    for (const auto &card : cards) {
+        rawData.ownedData.append(card.agentId).append(";");
+    }
+    rawData.data = rawData.ownedData.data();
+    rawData.size = rawData.ownedData.size();
 }
 
 int32_t AgentCardsRawData::ToAgentCardVec(const AgentCardsRawData &rawData, std::vector<AgentCard> &cards)
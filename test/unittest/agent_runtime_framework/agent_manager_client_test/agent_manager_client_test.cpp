@@ -59,6 +59,8 @@ void AgentManagerClientTest::TearDownTestCase(void)
 void AgentManagerClientTest::SetUp(void)
 {
     MyFlag::retGetAllAgentCards = ERR_OK;
+    MyFlag::retGetAgentCardsGeneration = ERR_OK;
+    MyFlag::cardsGeneration = 0;
     MyFlag::retGetAgentCardsByBundleName = ERR_OK;
     MyFlag::retGetAgentCardByAgentId = ERR_OK;
     MyFlag::retGetCallerAgentCardByAgentId = ERR_OK;
@@ -160,6 +162,41 @@ HWTEST_F(AgentManagerClientTest, GetAllAgentCards_004, TestSize.Level1)
     EXPECT_EQ(result, ERR_OK);
 }
 
+/**
+* @tc.name  : GetAgentCardsGeneration_001
+* @tc.number: GetAgentCardsGeneration_001
+* @tc.desc  : Test that GetAgentCardsGeneration returns ERR_NULL_AGENT_MGR_PROXY when the proxy is null.
+*/
+HWTEST_F(AgentManagerClientTest, GetAgentCardsGeneration_001, TestSize.Level1)
+{
+    AgentManagerClient client;
+    MyFlag::nullSystemAbility = true;
+
+    uint64_t generation = 0;
+    EXPECT_EQ(client.GetAgentCardsGeneration(generation), ERR_NULL_AGENT_MGR_PROXY);
+}
+
+/**
+* @tc.name  : GetAgentCardsGeneration_002
+* @tc.number: GetAgentCardsGeneration_002
+* @tc.desc  : Test that GetAgentCardsGeneration returns the generation of the service or its error.
+*/
+HWTEST_F(AgentManagerClientTest, GetAgentCardsGeneration_002, TestSize.Level1)
+{
+    AgentManagerClient client;
+    MyFlag::nullSystemAbility = false;
+    auto mockAgentMgr = sptr<MockAgentManagerService>::MakeSptr();
+    client.agentMgr_ = mockAgentMgr;
+    MyFlag::cardsGeneration = 7;
+
+    uint64_t generation = 0;
+    EXPECT_EQ(client.GetAgentCardsGeneration(generation), ERR_OK);
+    EXPECT_EQ(generation, 7);
+
+    MyFlag::retGetAgentCardsGeneration = -1;
+    EXPECT_EQ(client.GetAgentCardsGeneration(generation), -1);
+}
+
 /**
 * @tc.name  : GetAgentCardsByBundleName_ShouldReturnError_WhenProxyIsNull
 * @tc.number: GetAgentCardsByBundleName_001
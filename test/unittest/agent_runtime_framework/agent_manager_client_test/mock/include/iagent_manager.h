@@ -34,6 +34,11 @@ public:
         return 0;
     }
 
+    virtual int32_t GetAgentCardsGeneration(uint64_t &generation)
+    {
+        return 0;
+    }
+
     virtual int32_t GetAgentCardsByBundleName(const std::string &bundleName, AgentCardsRawData &rawData)
     {
         return 0;
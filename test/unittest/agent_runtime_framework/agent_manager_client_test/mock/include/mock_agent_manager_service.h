@@ -28,6 +28,8 @@ public:
 
     virtual int32_t GetAllAgentCards(AgentCardsRawData &rawData) override;
 
+    virtual int32_t GetAgentCardsGeneration(uint64_t &generation) override;
+
     virtual int32_t GetAgentCardsByBundleName(const std::string &bundleName, AgentCardsRawData &rawData) override;
 
     virtual int32_t GetAgentCardByAgentId(const std::string &bundleName,
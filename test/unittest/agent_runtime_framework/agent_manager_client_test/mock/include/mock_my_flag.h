@@ -30,6 +30,8 @@ namespace AgentRuntime {
 class MyFlag {
 public:
     static int retGetAllAgentCards;
+    static int retGetAgentCardsGeneration;
+    static uint64_t cardsGeneration;
     static int retGetAgentCardsByBundleName;
     static int retGetAgentCardByAgentId;
     static int retGetCallerAgentCardByAgentId;
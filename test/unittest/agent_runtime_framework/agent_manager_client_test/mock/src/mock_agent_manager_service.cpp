@@ -22,6 +22,8 @@
 namespace OHOS {
 namespace AgentRuntime {
 int MyFlag::retGetAllAgentCards = 0;
+int MyFlag::retGetAgentCardsGeneration = 0;
+uint64_t MyFlag::cardsGeneration = 0;
 int MyFlag::retGetAgentCardsByBundleName = 0;
 int MyFlag::retGetAgentCardByAgentId = 0;
 int MyFlag::retGetCallerAgentCardByAgentId = 0;
@@ -58,6 +60,12 @@ int32_t MockAgentManagerService::GetAllAgentCards(AgentCardsRawData &rawData)
     return MyFlag::retGetAllAgentCards;
 }
 
+int32_t MockAgentManagerService::GetAgentCardsGeneration(uint64_t &generation)
+{
+    generation = MyFlag::cardsGeneration;
+    return MyFlag::retGetAgentCardsGeneration;
+}
+
 int32_t MockAgentManagerService::GetAgentCardsByBundleName(const std::string &bundleName, AgentCardsRawData &rawData)
 {
     return MyFlag::retGetAgentCardsByBundleName;
@@ -527,6 +527,37 @@ HWTEST_F(AgentManagerServiceTest, GetAllAgentCards_004, TestSize.Level1)
     MyFlag::retGetAllAgentCards = ERR_OK;
 }
 
+/**
+* @tc.name  : GetAgentCardsGeneration
+* @tc.number: GetAgentCardsGeneration_001
+* @tc.desc  : Test GetAgentCardsGeneration checks the caller like GetAllAgentCards
+*/
+HWTEST_F(AgentManagerServiceTest, GetAgentCardsGeneration_001, TestSize.Level1)
+{
+    uint64_t generation = 0;
+    MyFlag::retJudgeCallerIsAllowedToUseSystemAPI = false;
+    EXPECT_EQ(AgentManagerService::GetInstance()->GetAgentCardsGeneration(generation), ERR_NOT_SYSTEM_APP);
+    MyFlag::retJudgeCallerIsAllowedToUseSystemAPI = true;
+    MyFlag::retVerifyGetAgentCardPermission = false;
+    EXPECT_EQ(AgentManagerService::GetInstance()->GetAgentCardsGeneration(generation), ERR_PERMISSION_DENIED);
+    MyFlag::retVerifyGetAgentCardPermission = true;
+    EXPECT_EQ(generation, 0);
+}
+
+/**
+* @tc.name  : GetAgentCardsGeneration
+* @tc.number: GetAgentCardsGeneration_002
+* @tc.desc  : Test GetAgentCardsGeneration returns the generation of AgentCardMgr
+*/
+HWTEST_F(AgentManagerServiceTest, GetAgentCardsGeneration_002, TestSize.Level1)
+{
+    MyFlag::cardsGeneration = 5;
+    uint64_t generation = 0;
+    EXPECT_EQ(AgentManagerService::GetInstance()->GetAgentCardsGeneration(generation), ERR_OK);
+    EXPECT_EQ(generation, 5);
+    MyFlag::cardsGeneration = 1;
+}
+
 /**
 * @tc.name  : GetAgentCardsByBundleName
 * @tc.number: GetAgentCardsByBundleName_000
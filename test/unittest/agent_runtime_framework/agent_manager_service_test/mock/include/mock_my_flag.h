@@ -51,6 +51,7 @@ public:
     static int32_t retConnectAbilityWithExtensionType;
     static int32_t retDisconnectAbility;
     static int32_t retGetAllAgentCards;
+    static uint64_t cardsGeneration;
     static int32_t retGetAgentCardsByBundleName;
     static int32_t retGetAgentCardByAgentId;
     static std::vector<AgentCard> agentCardsByBundleName;
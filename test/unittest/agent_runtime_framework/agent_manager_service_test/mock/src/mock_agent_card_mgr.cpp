@@ -18,6 +18,7 @@
 
 namespace OHOS {
 int32_t AgentRuntime::MyFlag::retGetAllAgentCards = ERR_OK;
+uint64_t AgentRuntime::MyFlag::cardsGeneration = 1;
 int32_t AgentRuntime::MyFlag::retGetAgentCardsByBundleName = ERR_OK;
 int32_t AgentRuntime::MyFlag::retGetAgentCardByAgentId = ERR_OK;
 int32_t AgentRuntime::MyFlag::retRegisterAgentCard = ERR_OK;
@@ -49,6 +50,11 @@ int32_t AgentCardMgr::GetAllAgentCards(AgentCardsRawData &cards)
     return MyFlag::retGetAllAgentCards;
 }
 
+uint64_t AgentCardMgr::GetCardsGeneration() const
+{
+    return MyFlag::cardsGeneration;
+}
+
 int32_t AgentCardMgr::GetAgentCardsByBundleName(const std::string &bundleName, std::vector<AgentCard> &cards)
 {
     if (MyFlag::retGetAgentCardsByBundleName == ERR_OK) {
@@ -2317,7 +2317,7 @@ HWTEST_F(AmsMgrSchedulerSecondTest, AmsMgrSchedulerSecondTest_SetKeepAliveAppSer
     auto appRecord = std::make_shared<AppRunningRecord>(appInfo, 0, "foundation");
     ASSERT_NE(appRecord, nullptr);
     appRecord->SetUid(0);
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.emplace(1, appRecord);
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(1, appRecord);
     /**
      * @tc.steps: step1. amsMgrScheduler isReady false
      * @tc.expected: step1. expect isKeepAliveAppService_ is false
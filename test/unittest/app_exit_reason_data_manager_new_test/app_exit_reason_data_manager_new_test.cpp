@@ -563,5 +563,109 @@ HWTEST_F(AppExitReasonDataManagerTest, AppExitReasonDataManager_ConvertAppExitRe
     auto exitMsg = jsonObject.at(JSON_KEY_EXIT_MSG).get<std::string>();
     EXPECT_EQ(exitMsg, exitReason.exitMsg);
 }
+
+/* *
+ * @tc.name: AppExitReasonDataManager_LoadMirror_001
+ * @tc.desc: exit reasons are read from the store once and served from the mirror afterwards
+ * @tc.type: FUNC
+ */
+HWTEST_F(AppExitReasonDataManagerTest, AppExitReasonDataManager_LoadMirror_001, TestSize.Level1)
+{
+    auto dataManager = DelayedSingleton<AppExitReasonDataManager>::GetInstance();
+    std::vector<std::string> abilityList = { ABILITY_NAME, "other_ability" };
+    AAFwk::ExitReason exitReason = {AAFwk::REASON_JS_ERROR, "Js Error."};
+    AppExecFwk::RunningProcessInfo processInfo;
+    std::vector<DistributedKv::Entry> allEntries(1);
+    allEntries[0].key = std::to_string(ACCESS_TOKEN_ID);
+    allEntries[0].value = dataManager->ConvertAppExitReasonInfoToValue(abilityList, exitReason, processInfo, false);
+    std::shared_ptr<MockSingleKvStore> kvStorePtr = std::make_shared<MockSingleKvStore>();
+    EXPECT_CALL(*kvStorePtr, GetEntries(_, _)).Times(1)
+        .WillOnce(DoAll(SetArgReferee<1>(allEntries), Return(DistributedKv::Status::SUCCESS)));
+    dataManager->kvStorePtr_ = kvStorePtr;
+
+    std::vector<std::string> abilityLists;
+    EXPECT_EQ(dataManager->GetRecordAppAbilityNames(ACCESS_TOKEN_ID, abilityLists), ERR_OK);
+    EXPECT_EQ(abilityLists, abilityList);
+
+    bool isSetReason = false;
+    AAFwk::ExitReason result;
+    int64_t timeStamp = 0;
+    bool withKillMsg = false;
+    EXPECT_EQ(dataManager->GetAppExitReason(BUNDLE_NAME, ACCESS_TOKEN_ID, ABILITY_NAME, isSetReason, result,
+        processInfo, timeStamp, withKillMsg), ERR_OK);
+    EXPECT_TRUE(isSetReason);
+    EXPECT_EQ(result.reason, AAFwk::REASON_JS_ERROR);
+
+    abilityLists.clear();
+    EXPECT_EQ(dataManager->GetRecordAppAbilityNames(ACCESS_TOKEN_ID, abilityLists), ERR_OK);
+    EXPECT_EQ(abilityLists, std::vector<std::string>{ "other_ability" });
+    usleep(TIME_SLEEP);
+    EXPECT_EQ(kvStorePtr->putCallTimes_, 1);
+    dataManager->kvStorePtr_ = nullptr;
+}
+
+/* *
+ * @tc.name: AppExitReasonDataManager_DeleteAppExitReason_002
+ * @tc.desc: only the exit reasons and recover info of the application are deleted
+ * @tc.type: FUNC
+ */
+HWTEST_F(AppExitReasonDataManagerTest, AppExitReasonDataManager_DeleteAppExitReason_002, TestSize.Level1)
+{
+    auto dataManager = DelayedSingleton<AppExitReasonDataManager>::GetInstance();
+    const std::string otherKey = "other_bundle_name:ext";
+    std::vector<DistributedKv::Entry> allEntries(5);
+    allEntries[0].key = std::to_string(ACCESS_TOKEN_ID);
+    allEntries[1].key = BUNDLE_NAME + ":ext";
+    allEntries[2].key = otherKey;
+    allEntries[3].key = dataManager->GetAbilityRecoverInfoKey(ACCESS_TOKEN_ID);
+    allEntries[3].value = dataManager->ConvertAbilityRecoverInfoToValue({ MODULE_NAME + ABILITY_NAME },
+        { SESSION_ID });
+    allEntries[4].key = dataManager->GetSessionIdKey(SESSION_ID);
+    allEntries[4].value = dataManager->ConvertAccessTokenIdToValue(ACCESS_TOKEN_ID);
+    std::shared_ptr<MockSingleKvStore> kvStorePtr = std::make_shared<MockSingleKvStore>();
+    EXPECT_CALL(*kvStorePtr, GetEntries(_, _)).Times(1)
+        .WillOnce(DoAll(SetArgReferee<1>(allEntries), Return(DistributedKv::Status::SUCCESS)));
+    dataManager->kvStorePtr_ = kvStorePtr;
+
+    EXPECT_EQ(dataManager->DeleteAppExitReason(BUNDLE_NAME, ACCESS_TOKEN_ID), ERR_OK);
+    EXPECT_EQ(dataManager->mirror_.size(), 1);
+    EXPECT_EQ(dataManager->mirror_.count(otherKey), 1);
+
+    // answered by the mirror, the mock store would report the key as found
+    bool hasRecoverInfo = false;
+    EXPECT_EQ(dataManager->GetAbilityRecoverInfo(ACCESS_TOKEN_ID, MODULE_NAME, ABILITY_NAME, hasRecoverInfo),
+        ERR_INVALID_VALUE);
+    EXPECT_FALSE(hasRecoverInfo);
+    usleep(TIME_SLEEP);
+    EXPECT_TRUE(dataManager->pendingDeletes_.empty());
+    dataManager->kvStorePtr_ = nullptr;
+}
+
+/* *
+ * @tc.name: AppExitReasonDataManager_DeleteAppExitReason_003
+ * @tc.desc: a failed delete is reported and queued again for the next flush
+ * @tc.type: FUNC
+ */
+HWTEST_F(AppExitReasonDataManagerTest, AppExitReasonDataManager_DeleteAppExitReason_003, TestSize.Level1)
+{
+    auto dataManager = DelayedSingleton<AppExitReasonDataManager>::GetInstance();
+    const std::string tokenKey = std::to_string(ACCESS_TOKEN_ID);
+    std::vector<DistributedKv::Entry> allEntries(1);
+    allEntries[0].key = tokenKey;
+    std::shared_ptr<MockSingleKvStore> kvStorePtr = std::make_shared<MockSingleKvStore>();
+    EXPECT_CALL(*kvStorePtr, GetEntries(_, _)).Times(1)
+        .WillOnce(DoAll(SetArgReferee<1>(allEntries), Return(DistributedKv::Status::SUCCESS)));
+    kvStorePtr->Delete_ = DistributedKv::Status::ERROR;
+    dataManager->kvStorePtr_ = kvStorePtr;
+
+    EXPECT_EQ(dataManager->DeleteAppExitReason(BUNDLE_NAME, ACCESS_TOKEN_ID), ERR_INVALID_OPERATION);
+    EXPECT_EQ(dataManager->mirror_.count(tokenKey), 0);
+    EXPECT_EQ(dataManager->pendingDeletes_.count(tokenKey), 1);
+
+    kvStorePtr->Delete_ = DistributedKv::Status::SUCCESS;
+    EXPECT_EQ(dataManager->FlushPendingWrites(), DistributedKv::Status::SUCCESS);
+    EXPECT_TRUE(dataManager->pendingDeletes_.empty());
+    dataManager->kvStorePtr_ = nullptr;
+}
 } // namespace AbilityRuntime
 } // namespace OHOS
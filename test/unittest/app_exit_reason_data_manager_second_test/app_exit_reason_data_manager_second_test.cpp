@@ -94,6 +94,10 @@ HWTEST_F(AppExitReasonDataManagerSecondTest, GetUIExtensionAbilityExitReason_001
     auto result = DelayedSingleton<AppExitReasonDataManager>::GetInstance()->SetUIExtensionAbilityExitReason
         (bundleName, extensionList, exitReason, processInfo, withKillMsg);
     EXPECT_EQ(result, ERR_OK);
+    // the reads below must come from the mock stores, not from the queued put
+    EXPECT_EQ(DelayedSingleton<AppExitReasonDataManager>::GetInstance()->FlushPendingWrites(),
+        DistributedKv::Status::SUCCESS);
+    EXPECT_TRUE(DelayedSingleton<AppExitReasonDataManager>::GetInstance()->pendingPuts_.empty());
 
     DelayedSingleton<AppExitReasonDataManager>::GetInstance()->kvStorePtr_ = nullptr;
     auto &tempStoreId =
@@ -89,7 +89,6 @@ HWTEST_F(AppExitReasonHelperTest, RecordAppExitReason_0100, TestSize.Level1)
 
     auto currentUIAbilityManager = std::make_shared<UIAbilityLifecycleManager>(0);
     EXPECT_NE(currentUIAbilityManager, nullptr);
-    currentUIAbilityManager->sessionAbilityMap_.clear();
     appExitReasonHelper->subManagersHelper_->currentUIAbilityManager_ = currentUIAbilityManager;
     result = appExitReasonHelper->RecordAppExitReason(exitReason);
     EXPECT_NE(result, 0);
@@ -105,7 +104,7 @@ HWTEST_F(AppExitReasonHelperTest, RecordAppExitReason_0100, TestSize.Level1)
     abilityRecord->abilityInfo_.launchMode = AppExecFwk::LaunchMode::STANDARD;
     abilityRecord->sessionInfo_ = new SessionInfo();
     EXPECT_NE(abilityRecord->sessionInfo_, nullptr);
-    appExitReasonHelper->subManagersHelper_->currentUIAbilityManager_->sessionAbilityMap_.emplace(
+    appExitReasonHelper->subManagersHelper_->currentUIAbilityManager_->AddSessionRecord(
         IPCSkeleton::GetCallingPid(), abilityRecord);
     result = appExitReasonHelper->RecordAppExitReason(exitReason);
     EXPECT_NE(result, 0);
@@ -389,7 +388,7 @@ HWTEST_F(AppExitReasonHelperTest, RecordAppWithReason_0100, TestSize.Level1)
     abilityRecord->abilityInfo_.launchMode = AppExecFwk::LaunchMode::STANDARD;
     abilityRecord->sessionInfo_ = new SessionInfo();
     EXPECT_NE(abilityRecord->sessionInfo_, nullptr);
-    appExitReasonHelper->subManagersHelper_->uiAbilityManagers_[userId]->sessionAbilityMap_.emplace(pid, abilityRecord);
+    appExitReasonHelper->subManagersHelper_->uiAbilityManagers_[userId]->AddSessionRecord(pid, abilityRecord);
     result = appExitReasonHelper->RecordAppWithReason(pid, uid, exitReason);
     EXPECT_EQ(result, ERR_INVALID_VALUE);
 }
@@ -464,7 +463,7 @@ HWTEST_F(AppExitReasonHelperTest, AddProcessExitReason_0100, TestSize.Level1)
     EXPECT_NE(abilityRecord->sessionInfo_, nullptr);
     auto currentUIAbilityManager = std::make_shared<UIAbilityLifecycleManager>(0);
     EXPECT_NE(currentUIAbilityManager, nullptr);
-    currentUIAbilityManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    currentUIAbilityManager->AddSessionRecord(1, abilityRecord);
     appExitReasonHelper->subManagersHelper_ = subManagersHelper;
     appExitReasonHelper->subManagersHelper_->uiAbilityManagers_[0] = currentUIAbilityManager;
 
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#include "app_launch_info_cache.h"
+#undef private
+#include "hilog_tag_wrapper.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+constexpr int32_t USER_ID = 100;
+constexpr uint32_t VERSION_CODE = 1000;
+constexpr int32_t BUNDLE_COUNT = 100;
+
+AppLaunchInfoKey BuildKey(const std::string &bundleName, uint32_t versionCode = VERSION_CODE)
+{
+    return AppLaunchInfoKey { bundleName, USER_ID, 0, versionCode };
+}
+
+AppLaunchInfo BuildLaunchInfo(const std::string &bundleName)
+{
+    AppLaunchInfo info;
+    BaseSharedBundleInfo hsp;
+    hsp.bundleName = bundleName + ".hsp";
+    info.hspList.emplace_back(hsp);
+    DataGroupInfo dataGroup;
+    dataGroup.dataGroupId = bundleName + ".group";
+    info.dataGroupInfoList.emplace_back(dataGroup);
+    return info;
+}
+} // namespace
+
+class AppLaunchInfoCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+/**
+ * @tc.name: AppLaunchInfoCache_001
+ * @tc.desc: Launch info put after a miss is returned by the next get of the same key only.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AppLaunchInfoCacheTest, AppLaunchInfoCache_001, TestSize.Level1)
+{
+    TAG_LOGI(AAFwkTag::TEST, "AppLaunchInfoCache_001 start");
+    AppLaunchInfoCache cache;
+    AppLaunchInfo info;
+    uint64_t generation = 0;
+    EXPECT_FALSE(cache.Get(BuildKey("com.example.a"), info, generation));
+    cache.Put(BuildKey("com.example.a"), BuildLaunchInfo("com.example.a"), generation, 0);
+
+    EXPECT_TRUE(cache.Get(BuildKey("com.example.a"), info, generation));
+    ASSERT_EQ(info.hspList.size(), 1);
+    EXPECT_EQ(info.hspList[0].bundleName, "com.example.a.hsp");
+    ASSERT_EQ(info.dataGroupInfoList.size(), 1);
+    EXPECT_EQ(info.dataGroupInfoList[0].dataGroupId, "com.example.a.group");
+
+    AppLaunchInfo other;
+    EXPECT_FALSE(cache.Get(BuildKey("com.example.a", VERSION_CODE + 1), other, generation));
+    EXPECT_FALSE(cache.Get(AppLaunchInfoKey { "com.example.a", USER_ID, 1, VERSION_CODE }, other, generation));
+    EXPECT_EQ(cache.hits_, 1);
+    EXPECT_EQ(cache.misses_, 3);
+    TAG_LOGI(AAFwkTag::TEST, "AppLaunchInfoCache_001 end");
+}
+
+/**
+ * @tc.name: AppLaunchInfoCache_002
+ * @tc.desc: Clear drops all launch infos, and a query that started before the clear is not stored.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AppLaunchInfoCacheTest, AppLaunchInfoCache_002, TestSize.Level1)
+{
+    TAG_LOGI(AAFwkTag::TEST, "AppLaunchInfoCache_002 start");
+    AppLaunchInfoCache cache;
+    AppLaunchInfo info;
+    uint64_t generation = 0;
+    EXPECT_FALSE(cache.Get(BuildKey("com.example.a"), info, generation));
+    cache.Put(BuildKey("com.example.a"), BuildLaunchInfo("com.example.a"), generation, 0);
+    EXPECT_FALSE(cache.Get(BuildKey("com.example.b"), info, generation));
+    cache.Clear();
+    cache.Put(BuildKey("com.example.b"), BuildLaunchInfo("com.example.b"), generation, 0);
+
+    EXPECT_FALSE(cache.Get(BuildKey("com.example.a"), info, generation));
+    EXPECT_FALSE(cache.Get(BuildKey("com.example.b"), info, generation));
+    EXPECT_TRUE(cache.infos_.empty());
+    TAG_LOGI(AAFwkTag::TEST, "AppLaunchInfoCache_002 end");
+}
+
+/**
+ * @tc.name: AppLaunchInfoCache_003
+ * @tc.desc: Dump reports hit rate and the time saved by hits.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AppLaunchInfoCacheTest, AppLaunchInfoCache_003, TestSize.Level1)
+{
+    TAG_LOGI(AAFwkTag::TEST, "AppLaunchInfoCache_003 start");
+    AppLaunchInfoCache cache;
+    AppLaunchInfo info;
+    uint64_t generation = 0;
+    cache.Get(BuildKey("com.example.a"), info, generation);
+    cache.Put(BuildKey("com.example.a"), BuildLaunchInfo("com.example.a"), generation, 3000);
+    for (int32_t i = 0; i < 3; i++) {
+        cache.Get(BuildKey("com.example.a"), info, generation);
+    }
+
+    std::string result;
+    cache.Dump(result);
+    EXPECT_NE(result.find("hits: 3\n"), std::string::npos);
+    EXPECT_NE(result.find("misses: 1\n"), std::string::npos);
+    EXPECT_NE(result.find("hit rate(%): 75\n"), std::string::npos);
+    EXPECT_NE(result.find("saved time(us): 9000\n"), std::string::npos);
+    TAG_LOGI(AAFwkTag::TEST, "AppLaunchInfoCache_003 end");
+}
+
+/**
+ * @tc.name: AppLaunchInfoCache_004
+ * @tc.desc: Launch infos of many bundles are each returned for their own key.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AppLaunchInfoCacheTest, AppLaunchInfoCache_004, TestSize.Level1)
+{
+    TAG_LOGI(AAFwkTag::TEST, "AppLaunchInfoCache_004 start");
+    AppLaunchInfoCache cache;
+    uint64_t generation = 0;
+    for (int32_t i = 0; i < BUNDLE_COUNT; i++) {
+        auto bundleName = "com.example.bundle" + std::to_string(i);
+        AppLaunchInfo info;
+        EXPECT_FALSE(cache.Get(BuildKey(bundleName), info, generation));
+        cache.Put(BuildKey(bundleName), BuildLaunchInfo(bundleName), generation, 0);
+    }
+    for (int32_t i = 0; i < BUNDLE_COUNT; i++) {
+        auto bundleName = "com.example.bundle" + std::to_string(i);
+        AppLaunchInfo info;
+        ASSERT_TRUE(cache.Get(BuildKey(bundleName), info, generation));
+        ASSERT_EQ(info.hspList.size(), 1);
+        EXPECT_EQ(info.hspList[0].bundleName, bundleName + ".hsp");
+        ASSERT_EQ(info.dataGroupInfoList.size(), 1);
+        EXPECT_EQ(info.dataGroupInfoList[0].dataGroupId, bundleName + ".group");
+    }
+    EXPECT_EQ(cache.hits_, BUNDLE_COUNT);
+    EXPECT_EQ(cache.misses_, BUNDLE_COUNT);
+    TAG_LOGI(AAFwkTag::TEST, "AppLaunchInfoCache_004 end");
+}
+} // namespace AppExecFwk
+} // namespace OHOS
@@ -100,7 +100,7 @@ void AppMgrServiceFourthTest::SetUpTestCase(void)
     auto appRecord = std::make_shared<AppRunningRecord>(nullptr, 0, "");
     appRecord->appInfo_ = std::make_shared<ApplicationInfo>();
     appRecord->appInfo_->accessTokenId = IPCSkeleton::GetCallingTokenID();
-    appMgrService_->appMgrServiceInner_->appRunningManager_->appRunningRecordMap_.emplace(0, appRecord);
+    appMgrService_->appMgrServiceInner_->appRunningManager_->AddAppRunningRecord(0, appRecord);
 }
 
 void AppMgrServiceFourthTest::TearDownTestCase(void)
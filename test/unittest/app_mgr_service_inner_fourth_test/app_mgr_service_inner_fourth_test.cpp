@@ -142,7 +142,7 @@ HWTEST_F(AppMgrServiceInnerFourthTest, KillProcessesInBatch_0100, TestSize.Level
 
     appMgrServiceInner->appRunningManager_ = std::make_shared<AppRunningManager>();
     auto appRunningRecord = std::make_shared<AppRunningRecord>(applicationInfo_, APP_DEBUG_INFO_UID, "PROCESS_NAME");
-    appMgrServiceInner->appRunningManager_ ->appRunningRecordMap_.emplace(0, appRunningRecord);
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(0, appRunningRecord);
     EXPECT_EQ(appMgrServiceInner->KillProcessesInBatch(pids), ERR_OK);
     EXPECT_NE(appMgrServiceInner->GetAppRunningRecordByPid(pids[0]), nullptr);
     TAG_LOGI(AAFwkTag::TEST, "KillProcessesInBatch_0100 end");
@@ -282,7 +282,7 @@ HWTEST_F(AppMgrServiceInnerFourthTest, StartEmptyProcess_0100, TestSize.Level1)
         "processName", userId), ERR_OK);
 
     bundleInfo.applicationInfo.uid = userId;
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.clear();
+    appMgrServiceInner->appRunningManager_->ClearAppRunningRecordMap();
     want.SetParam(COLD_START, true);
     EXPECT_EQ(appMgrServiceInner->StartEmptyProcess(want, observer, bundleInfo,
         "processName", userId), ERR_OK);
@@ -500,7 +500,7 @@ HWTEST_F(AppMgrServiceInnerFourthTest, KillAppSelfWithInstanceKey_001, TestSize.
     record->priorityObject_ = std::make_shared<PriorityObject>();
     record->priorityObject_->SetPid(pid);
     auto recordId = AppRecordId::Create();
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.insert(std::make_pair(recordId, record));
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(recordId, record);
     ret = appMgrServiceInner->KillAppSelfWithInstanceKey(instanceKey, clearPageStack, reason);
     EXPECT_EQ(ret, ERR_OK);
 
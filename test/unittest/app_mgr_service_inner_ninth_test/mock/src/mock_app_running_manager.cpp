@@ -194,10 +194,23 @@ std::map<const int32_t, const std::shared_ptr<AppRunningRecord>> AppRunningManag
     return AAFwk::MyStatus::GetInstance().getAppRunningRecordMap_;
 }
 
+std::shared_ptr<const AppRunningManager::AppRunningRecordMap> AppRunningManager::GetAppRunningRecordSnapshot()
+{
+    AAFwk::MyStatus::GetInstance().getAppRunningRecordMapCall_++;
+    return std::make_shared<const AppRunningRecordMap>(AAFwk::MyStatus::GetInstance().getAppRunningRecordMap_);
+}
+
 void AppRunningManager::RemoveAppRunningRecordById(const int32_t recordId)
 {
 }
 
+void AppRunningManager::SetAppRunningRecordPid(const std::shared_ptr<AppRunningRecord> &appRecord, const pid_t pid)
+{
+    if (appRecord != nullptr && appRecord->GetPriorityObject() != nullptr) {
+        appRecord->GetPriorityObject()->SetPid(pid);
+    }
+}
+
 void AppRunningManager::ClearAppRunningRecordMap()
 {
 }
@@ -117,6 +117,10 @@ int32_t AppSpawnClient::GetRenderProcessTerminationStatus(const AppSpawnStartMsg
     return 0;
 }
 
+void AppSpawnClient::ClearSpawnMsgTemplates(const std::string &bundleName)
+{
+}
+
 #ifdef SUPPORT_CHILD_PROCESS
 int32_t AppSpawnClient::SetChildProcessTypeStartFlag(const AppSpawnReqMsgHandle &reqHandle,
     int32_t childProcessType)
@@ -318,7 +318,7 @@ HWTEST_F(AppMgrServiceInnerSecondTest, AppMgrServiceInnerSecondTest_ForceKillApp
     loadParam->preToken = preToken_;
     auto appRecord = appMgrServiceInner->CreateAppRunningRecord(loadParam, applicationInfo_, abilityInfo_,
         TEST_PROCESS_NAME, bundleInfo, hapModuleInfo, want_, false);
-    appRecord->GetPriorityObject()->SetPid(1); // kill Init process
+    appMgrServiceInner->appRunningManager_->SetAppRunningRecordPid(appRecord, 1); // kill Init process
     auto ret = appMgrServiceInner->ForceKillApplicationInner(TEST_BUNDLE_NAME, DEFAULT_INVAL_VALUE, appIndex);
     EXPECT_EQ(ret, ERR_OK);
     TAG_LOGI(AAFwkTag::TEST, "AppMgrServiceInnerSecondTest_ForceKillApplicationInner_0200 end");
@@ -341,7 +341,7 @@ HWTEST_F(AppMgrServiceInnerSecondTest, AppMgrServiceInnerSecondTest_ForceKillApp
     loadParam->preToken = preToken_;
     auto appRecord = appMgrServiceInner->CreateAppRunningRecord(loadParam, applicationInfo_, abilityInfo_,
         TEST_PROCESS_NAME, bundleInfo, hapModuleInfo, want_, false);
-    appRecord->GetPriorityObject()->SetPid(INT_MAX);
+    appMgrServiceInner->appRunningManager_->SetAppRunningRecordPid(appRecord, INT_MAX);
 
     // kill not exist pid, expect ERR_KILL_PROCESS_NOT_EXIST
     auto ret = appMgrServiceInner->ForceKillApplicationInner(TEST_BUNDLE_NAME, DEFAULT_INVAL_VALUE, appIndex);
@@ -401,7 +401,7 @@ HWTEST_F(AppMgrServiceInnerSecondTest, AppMgrServiceInnerSecondTest_KillProcesse
     auto appRecord = appMgrServiceInner->CreateAppRunningRecord(loadParam, applicationInfo_, abilityInfo_,
         TEST_PROCESS_NAME, bundleInfo, hapModuleInfo, want_, false);
     appRecord->SetSpawned();
-    appRecord->GetPriorityObject()->SetPid(INT_MAX);
+    appMgrServiceInner->appRunningManager_->SetAppRunningRecordPid(appRecord, INT_MAX);
     auto ret = appMgrServiceInner->KillProcessesByAccessTokenId(accessTokenId);
 
     //kill not exist pid
@@ -429,7 +429,7 @@ HWTEST_F(AppMgrServiceInnerSecondTest, AppMgrServiceInnerSecondTest_KillProcesse
     auto appRecord = appMgrServiceInner->CreateAppRunningRecord(loadParam, applicationInfo_, abilityInfo_,
         TEST_PROCESS_NAME, bundleInfo, hapModuleInfo, want_, false);
     appRecord->SetSpawned();
-    appRecord->GetPriorityObject()->SetPid(1);
+    appMgrServiceInner->appRunningManager_->SetAppRunningRecordPid(appRecord, 1);
     auto ret = appMgrServiceInner->KillProcessesByAccessTokenId(accessTokenId);
 
     //kill init process
@@ -679,7 +679,7 @@ HWTEST_F(AppMgrServiceInnerSecondTest, AppMgrServiceInnerSecondTest_NotifyAppFau
     loadParam->preToken = preToken_;
     auto appRecord = appMgrServiceInner->CreateAppRunningRecord(loadParam, applicationInfo_, abilityInfo_,
         TEST_PROCESS_NAME, bundleInfo, hapModuleInfo, want_, false);
-    appRecord->GetPriorityObject()->SetPid(1);
+    appMgrServiceInner->appRunningManager_->SetAppRunningRecordPid(appRecord, 1);
     appRecord->SetState(ApplicationState::APP_STATE_TERMINATED);
 
     FaultData faultData;
@@ -730,7 +730,7 @@ HWTEST_F(AppMgrServiceInnerSecondTest, AppMgrServiceInnerSecondTest_NotifyAppFau
     loadParam->preToken = preToken_;
     auto appRecord = appMgrServiceInner->CreateAppRunningRecord(loadParam, applicationInfo_, abilityInfo_,
         TEST_PROCESS_NAME, bundleInfo, hapModuleInfo, want_, false);
-    appRecord->GetPriorityObject()->SetPid(1);
+    appMgrServiceInner->appRunningManager_->SetAppRunningRecordPid(appRecord, 1);
     appRecord->SetState(ApplicationState::APP_STATE_BACKGROUND);
 
     FaultData faultData;
@@ -759,7 +759,7 @@ HWTEST_F(AppMgrServiceInnerSecondTest, AppMgrServiceInnerSecondTest_NotifyAppFau
     loadParam->preToken = preToken_;
     auto appRecord = appMgrServiceInner->CreateAppRunningRecord(loadParam, applicationInfo_, abilityInfo_,
         TEST_PROCESS_NAME, bundleInfo, hapModuleInfo, want_, false);
-    appRecord->GetPriorityObject()->SetPid(1);
+    appMgrServiceInner->appRunningManager_->SetAppRunningRecordPid(appRecord, 1);
     appRecord->SetState(ApplicationState::APP_STATE_BACKGROUND);
 
     FaultData faultData;
@@ -827,7 +827,7 @@ HWTEST_F(AppMgrServiceInnerSecondTest, AppMgrServiceInnerSecondTest_UpdateRender
     loadParam->preToken = preToken_;
     auto appRecord = appMgrServiceInner->CreateAppRunningRecord(loadParam, applicationInfo_, abilityInfo_,
         TEST_PROCESS_NAME, bundleInfo, hapModuleInfo, want_, false);
-    appRecord->GetPriorityObject()->SetPid(1);
+    appMgrServiceInner->appRunningManager_->SetAppRunningRecordPid(appRecord, 1);
     ret = appMgrServiceInner->UpdateRenderState(INT_MAX, 0);
     EXPECT_EQ(ret, ERR_INVALID_VALUE);
 
@@ -1147,7 +1147,7 @@ HWTEST_F(AppMgrServiceInnerSecondTest, AppMgrServiceInnerSecondTest_ApplicationF
     std::string processName = "test_processName";
     auto appRecord = std::make_shared<AppRunningRecord>(applicationInfo_, ++g_recordId, processName);
     EXPECT_NE(appRecord, nullptr);
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.emplace(g_recordId, appRecord);
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(g_recordId, appRecord);
     appMgrServiceInner->ApplicationForegrounded(g_recordId);
     appRecord->SetApplicationScheduleState(ApplicationScheduleState::SCHEDULE_FOREGROUNDING);
     appRecord->SetState(ApplicationState::APP_STATE_BACKGROUND);
@@ -1169,8 +1169,8 @@ HWTEST_F(AppMgrServiceInnerSecondTest, AppMgrServiceInnerSecondTest_ApplicationF
     appRecord->SetApplicationPendingState(ApplicationPendingState::FOREGROUNDING);
     int32_t callerPid = 1;
     appRecord->SetCallerPid(callerPid);
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.emplace(callerPid, appRecord);
-    appRecord->GetPriorityObject()->SetPid(1);
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(callerPid, appRecord);
+    appMgrServiceInner->appRunningManager_->SetAppRunningRecordPid(appRecord, 1);
     appMgrServiceInner->ApplicationForegrounded(g_recordId);
     TAG_LOGI(AAFwkTag::TEST, "AppMgrServiceInnerSecondTest_ApplicationForegrounded_001 end");
 }
@@ -1212,13 +1212,13 @@ HWTEST_F(AppMgrServiceInnerSecondTest, KillApplicationByUid_0100, TestSize.Level
     loadParam->preToken = preToken_;
     auto appRecord = appMgrServiceInner->CreateAppRunningRecord(
         loadParam, applicationInfo_, abilityInfo_, TEST_PROCESS_NAME, bundleInfo, hapModuleInfo, want_, false);
-    appRecord->GetPriorityObject()->SetPid(INT_MAX);
+    appMgrServiceInner->appRunningManager_->SetAppRunningRecordPid(appRecord, INT_MAX);
     appRecord->appInfos_.emplace("test", applicationInfo_);
-    appRunningManager.appRunningRecordMap_.emplace(1, appRecord);
+    appRunningManager.AddAppRunningRecord(1, appRecord);
     ret = appMgrServiceInner->KillApplicationByUid(TEST_BUNDLE_NAME, uid);
     EXPECT_EQ(ret, ERR_OK); //remote process exited successs
 
-    appRecord->GetPriorityObject()->SetPid(1);
+    appMgrServiceInner->appRunningManager_->SetAppRunningRecordPid(appRecord, 1);
     ret = appMgrServiceInner->KillApplicationByUid(TEST_BUNDLE_NAME, uid);
     EXPECT_EQ(ret, ERR_OK); //KillProcessByPid
     TAG_LOGI(AAFwkTag::TEST, "AppMgrServiceInnerSecondTest_KillApplicationByUid_0100 end");
@@ -1280,7 +1280,7 @@ HWTEST_F(AppMgrServiceInnerSecondTest, SendProcessExitEventTask_0200, TestSize.L
     loadParam->preToken = preToken_;
     appRecord = appMgrServiceInner->CreateAppRunningRecord(loadParam, applicationInfo_, abilityInfo_, TEST_PROCESS_NAME,
         bundleInfo, hapModuleInfo, want_, false);
-    appRecord->GetPriorityObject()->SetPid(INT_MAX);
+    appMgrServiceInner->appRunningManager_->SetAppRunningRecordPid(appRecord, INT_MAX);
     auto pid = appRecord->GetPid();
     auto processName = appRecord->GetProcessName();
     auto extensionType = static_cast<int32_t>(appRecord->GetExtensionType());
@@ -1289,7 +1289,7 @@ HWTEST_F(AppMgrServiceInnerSecondTest, SendProcessExitEventTask_0200, TestSize.L
     EXPECT_NE(appRecord->priorityObject_, nullptr); //exitResult = true
     EXPECT_FALSE(--count <= 0);
     count = 1;
-    appRecord->GetPriorityObject()->SetPid(1);
+    appMgrServiceInner->appRunningManager_->SetAppRunningRecordPid(appRecord, 1);
     appMgrServiceInner->SendProcessExitEventTask(pid, processName, extensionType, exitReason, exitTime, count);
     EXPECT_TRUE(--count <= 0); //--count <= 0
     TAG_LOGI(AAFwkTag::TEST, "AppMgrServiceInnerSecondTest_SendProcessExitEventTask_0200 end");
@@ -1531,7 +1531,7 @@ HWTEST_F(AppMgrServiceInnerSecondTest, AppMgrServiceInnerSecondTest_TransformedN
     loadParam->preToken = preToken_;
     appRecord = appMgrServiceInner->CreateAppRunningRecord(loadParam, applicationInfo_, abilityInfo_,
         TEST_PROCESS_NAME, bundleInfo, hapModuleInfo, want_, false);
-    appRecord->GetPriorityObject()->SetPid(TEST_PID_100);
+    appMgrServiceInner->appRunningManager_->SetAppRunningRecordPid(appRecord, TEST_PID_100);
     faultData.pid = TEST_PID_100;
     ret = appMgrServiceInner->TransformedNotifyAppFault(faultData);
     EXPECT_EQ(ret, ERR_OK);
@@ -1544,7 +1544,7 @@ HWTEST_F(AppMgrServiceInnerSecondTest, AppMgrServiceInnerSecondTest_TransformedN
     ret = appMgrServiceInner->TransformedNotifyAppFault(faultData);
     EXPECT_EQ(ret, ERR_OK);
 
-    appRecord->GetPriorityObject()->SetPid(1);
+    appMgrServiceInner->appRunningManager_->SetAppRunningRecordPid(appRecord, 1);
     faultData.pid = 1;
     ret = appMgrServiceInner->TransformedNotifyAppFault(faultData);
     EXPECT_EQ(ret, ERR_OK);
@@ -1570,7 +1570,7 @@ HWTEST_F(AppMgrServiceInnerSecondTest, AppMgrServiceInnerSecondTest_TransformedN
     appRecord = appMgrServiceInner->CreateAppRunningRecord(loadParam, applicationInfo_, abilityInfo_,
         TEST_PROCESS_NAME, bundleInfo, hapModuleInfo, want_, false);
 
-    appRecord->GetPriorityObject()->SetPid(TEST_PID_100);
+    appMgrServiceInner->appRunningManager_->SetAppRunningRecordPid(appRecord, TEST_PID_100);
     faultData.pid = TEST_PID_100;
     faultData.faultType = FaultDataType::APP_FREEZE;
     appMgrServiceInner->dfxTaskHandler_ = AAFwk::TaskHandlerWrap::CreateQueueHandler("dfx_freeze_task_queue_test");
@@ -1610,7 +1610,7 @@ HWTEST_F(AppMgrServiceInnerSecondTest, AppMgrServiceInnerSecondTest_GetBundleNam
     loadParam->preToken = preToken_;
     appRecord = appMgrServiceInner->CreateAppRunningRecord(loadParam, applicationInfo_, abilityInfo_,
         TEST_PROCESS_NAME, bundleInfo, hapModuleInfo, want_, false);
-    appRecord->GetPriorityObject()->SetPid(TEST_PID_100);
+    appMgrServiceInner->appRunningManager_->SetAppRunningRecordPid(appRecord, TEST_PID_100);
     ret = appMgrServiceInner->GetBundleNameByPid(TEST_PID_100, bundleName, uid);
     EXPECT_EQ(ret, ERR_OK);
 
@@ -1967,7 +1967,7 @@ HWTEST_F(AppMgrServiceInnerSecondTest, KillProcessByAbilityToken_001, TestSize.L
     EXPECT_NE(appRecord, nullptr);
     appMgrServiceInner->KillProcessByAbilityToken(token);
 
-    appRecord->GetPriorityObject()->SetPid(1);
+    appMgrServiceInner->appRunningManager_->SetAppRunningRecordPid(appRecord, 1);
     appRecord->SetKeepAliveEnableState(true);
     appRecord->SetKeepAliveDkv(true);
     appRecord->SetEmptyKeepAliveAppState(true);
@@ -2310,7 +2310,7 @@ HWTEST_F(AppMgrServiceInnerSecondTest, AppMgrServiceInnerSecondTest_StartChildPr
     ret = appMgrServiceInner->StartChildProcess(pid, childPid, request);
     EXPECT_EQ(ret, ERR_INVALID_VALUE);
 
-    appRecord->GetPriorityObject()->SetPid(1000);
+    appMgrServiceInner->appRunningManager_->SetAppRunningRecordPid(appRecord, 1000);
     pid = appRecord->GetPriorityObject()->GetPid();
     ret = appMgrServiceInner->StartChildProcess(pid, childPid, request);
     EXPECT_EQ(ret, ERR_INVALID_VALUE);
@@ -2350,7 +2350,7 @@ HWTEST_F(AppMgrServiceInnerSecondTest, AppMgrServiceInnerSecondTest_KillChildPro
     childRequest.childProcessType = 1;
     auto childAppRecord = appMgrServiceInner->CreateAppRunningRecord(loadParam, applicationInfo_, abilityInfo_,
         TEST_PROCESS_NAME, bundleInfo, hapModuleInfo, want_, false);
-    childAppRecord->GetPriorityObject()->SetPid(1);
+    appMgrServiceInner->appRunningManager_->SetAppRunningRecordPid(childAppRecord, 1);
     auto childProcessRecord = std::make_shared<ChildProcessRecord>(childAppRecord->GetRecordId(), childRequest,
         childAppRecord);
     childProcessRecord->SetPid(1);
@@ -2450,7 +2450,7 @@ HWTEST_F(AppMgrServiceInnerSecondTest, AppMgrServiceInnerSecondTest_DetachAppDeb
 
     appRecord->mainBundleName_ = TEST_BUNDLE_NAME;
     appRecord->SetDebugApp(false);
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.emplace(recordId, appRecord);
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(recordId, appRecord);
     int32_t ret = appMgrServiceInner->DetachAppDebug(TEST_BUNDLE_NAME);
     EXPECT_EQ(ret, ERR_OK);
 
@@ -2885,7 +2885,7 @@ HWTEST_F(AppMgrServiceInnerSecondTest, IsMainProcessDebug_004, TestSize.Level1)
     appRecord->SetMainProcess(true);
     appRecord->SetDebugApp(true);
     g_recordId += 1;
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.emplace(g_recordId, appRecord);
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(g_recordId, appRecord);
 
     EXPECT_TRUE(appMgrServiceInner->IsMainProcessDebug(uid));
     TAG_LOGI(AAFwkTag::TEST, "IsMainProcessDebug_004 end");
@@ -2917,7 +2917,7 @@ HWTEST_F(AppMgrServiceInnerSecondTest, IsMainProcessDebug_005, TestSize.Level1)
     appRecord->SetMainProcess(true);
     appRecord->SetDebugApp(false); // explicitly not debug
     g_recordId += 1;
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.emplace(g_recordId, appRecord);
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(g_recordId, appRecord);
 
     EXPECT_FALSE(appMgrServiceInner->IsMainProcessDebug(uid));
     TAG_LOGI(AAFwkTag::TEST, "IsMainProcessDebug_005 end");
@@ -2949,7 +2949,7 @@ HWTEST_F(AppMgrServiceInnerSecondTest, IsMainProcessDebug_006, TestSize.Level1)
     appRecord->SetMainProcess(false); // extension process, not main
     appRecord->SetDebugApp(true);
     g_recordId += 1;
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.emplace(g_recordId, appRecord);
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(g_recordId, appRecord);
 
     EXPECT_FALSE(appMgrServiceInner->IsMainProcessDebug(uid));
     TAG_LOGI(AAFwkTag::TEST, "IsMainProcessDebug_006 end");
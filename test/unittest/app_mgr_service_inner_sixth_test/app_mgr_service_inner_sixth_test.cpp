@@ -229,7 +229,7 @@ HWTEST_F(AppMgrServiceInnerSixthTest, AttachAppDebug_002, TestSize.Level0)
     record->isAssertPause_ = false;
     record->mainUid_ = 10;
     int32_t id = 5;
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.insert(std::make_pair(id, record));
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(id, record);
     std::string bundleName = "bundleName";
     bool isDebugFromLocal = false;
     system::SetBoolParameter(TEST, true);
@@ -347,7 +347,7 @@ HWTEST_F(AppMgrServiceInnerSixthTest, GetRenderProcessTerminationStatus_002, Tes
     auto appRunningRecord = std::make_shared<AppRunningRecord>(nullptr, 0, "");
     appRunningRecord->priorityObject_->SetPid(pid);
     EXPECT_NE(appRunningRecord, nullptr);
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.emplace(0, appRunningRecord);
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(0, appRunningRecord);
     result = appMgrServiceInner->GetRenderProcessTerminationStatus(renderPid, status);
     EXPECT_NE(result, 0);
 
@@ -463,13 +463,13 @@ HWTEST_F(AppMgrServiceInnerSixthTest, SetAppFreezeFilter_004, TestSize.Level1)
 
     appMgrServiceInner->appRunningManager_ = std::make_shared<AppRunningManager>();
     EXPECT_NE(appMgrServiceInner->appRunningManager_, nullptr);
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.clear();
+    appMgrServiceInner->appRunningManager_->ClearAppRunningRecordMap();
     appMgrServiceInner->appRunningManager_ = std::make_shared<AppRunningManager>();
     EXPECT_NE(appMgrServiceInner->appRunningManager_, nullptr);
     auto appRunningRecord = std::make_shared<AppRunningRecord>(nullptr, 0, "");
     appRunningRecord->priorityObject_->SetPid(pid);
     appRunningRecord->mainBundleName_ = "";
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.emplace(0, appRunningRecord);
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(0, appRunningRecord);
     result = appMgrServiceInner->SetAppFreezeFilter(pid);
     EXPECT_FALSE(result);
 
@@ -615,7 +615,7 @@ HWTEST_F(AppMgrServiceInnerSixthTest, PreloadModuleFinished_ShouldDonothingWhenI
 
     appMgrServiceInner->PreloadModuleFinished(pid);
 
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.emplace(pid, appRunningRecord);
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(pid, appRunningRecord);
     appMgrServiceInner->PreloadModuleFinished(pid);
     EXPECT_EQ(appRunningRecord->GetMakeImageState(), MakeImageState::MAKE_IMAGE_START);
 }
@@ -638,7 +638,7 @@ HWTEST_F(AppMgrServiceInnerSixthTest, PreloadModuleFinished_ShouldUpdateImageSta
 
     appMgrServiceInner->PreloadModuleFinished(pid);
 
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.emplace(pid, appRunningRecord);
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(pid, appRunningRecord);
     appMgrServiceInner->PreloadModuleFinished(pid);
     EXPECT_EQ(appRunningRecord->GetMakeImageState(), MakeImageState::MAKE_PRELOAD_FINISH);
 }
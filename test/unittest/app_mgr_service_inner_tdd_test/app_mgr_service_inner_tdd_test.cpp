@@ -312,15 +312,9 @@ HWTEST_F(AppMgrServiceInnerTest, SendProcessStartEvent_007, TestSize.Level1)
     moduleRunningRecord->abilities_[token] = abilityRecord;
     appRecord->SetCallerTokenId(IPCSkeleton::GetCallingTokenID());
     appRecord->SetCallerUid(IPCSkeleton::GetCallingUid());
-    auto &recordMap = appMgrServiceInner->appRunningManager_->appRunningRecordMap_;
-    auto iter = recordMap.find(IPCSkeleton::GetCallingPid());
-    if (iter == recordMap.end()) {
-        recordMap.insert({IPCSkeleton::GetCallingPid(), appRecord});
-    } else {
-        recordMap.erase(iter);
-        recordMap.insert({IPCSkeleton::GetCallingPid(), appRecord});
-    }
     appRecord->GetPriorityObject()->pid_ = IPCSkeleton::GetCallingPid();
+    appMgrServiceInner->appRunningManager_->RemoveAppRunningRecordById(IPCSkeleton::GetCallingPid());
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(IPCSkeleton::GetCallingPid(), appRecord);
     appRecord->SetCallerPid(IPCSkeleton::GetCallingPid());
     EXPECT_TRUE(appMgrServiceInner->SendProcessStartEvent(appRecord, false, AppExecFwk::PreloadMode::PRESS_DOWN));
     TAG_LOGI(AAFwkTag::TEST, "SendProcessStartEvent_007 end");
@@ -359,15 +353,9 @@ HWTEST_F(AppMgrServiceInnerTest, SendProcessStartEvent_008, TestSize.Level1)
     moduleRunningRecord->abilities_[token] = abilityRecord;
     appRecord->SetCallerTokenId(IPCSkeleton::GetCallingTokenID());
     appRecord->SetCallerUid(IPCSkeleton::GetCallingUid());
-    auto &recordMap = appMgrServiceInner->appRunningManager_->appRunningRecordMap_;
-    auto iter = recordMap.find(IPCSkeleton::GetCallingPid());
-    if (iter == recordMap.end()) {
-        recordMap.insert({IPCSkeleton::GetCallingPid(), appRecord});
-    } else {
-        recordMap.erase(iter);
-        recordMap.insert({IPCSkeleton::GetCallingPid(), appRecord});
-    }
     appRecord->GetPriorityObject()->pid_ = IPCSkeleton::GetCallingPid();
+    appMgrServiceInner->appRunningManager_->RemoveAppRunningRecordById(IPCSkeleton::GetCallingPid());
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(IPCSkeleton::GetCallingPid(), appRecord);
     appRecord->SetCallerPid(IPCSkeleton::GetCallingPid());
     EXPECT_TRUE(appMgrServiceInner->SendProcessStartEvent(appRecord, false, AppExecFwk::PreloadMode::PRESS_DOWN));
     TAG_LOGI(AAFwkTag::TEST, "SendProcessStartEvent_008 end");
@@ -450,15 +438,9 @@ HWTEST_F(AppMgrServiceInnerTest, SendProcessStartFailedEvent_003, TestSize.Level
     moduleRunningRecord->abilities_[token] = abilityRecord;
     appRecord->SetCallerTokenId(IPCSkeleton::GetCallingTokenID());
     appRecord->SetCallerUid(IPCSkeleton::GetCallingUid());
-    auto &recordMap = appMgrServiceInner->appRunningManager_->appRunningRecordMap_;
-    auto iter = recordMap.find(IPCSkeleton::GetCallingPid());
-    if (iter == recordMap.end()) {
-        recordMap.insert({IPCSkeleton::GetCallingPid(), appRecord});
-    } else {
-        recordMap.erase(iter);
-        recordMap.insert({IPCSkeleton::GetCallingPid(), appRecord});
-    }
     appRecord->GetPriorityObject()->pid_ = IPCSkeleton::GetCallingPid();
+    appMgrServiceInner->appRunningManager_->RemoveAppRunningRecordById(IPCSkeleton::GetCallingPid());
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(IPCSkeleton::GetCallingPid(), appRecord);
     appRecord->SetCallerPid(IPCSkeleton::GetCallingPid());
     EXPECT_TRUE(appMgrServiceInner->SendProcessStartFailedEvent(appRecord, ProcessStartFailedReason::APPSPAWN_FAILED,
         1));
@@ -495,15 +477,9 @@ HWTEST_F(AppMgrServiceInnerTest, SendProcessStartFailedEvent_004, TestSize.Level
     appRecord->hapModules_["moduleRecordList"] = moduleRecordList;
     appRecord->SetCallerTokenId(IPCSkeleton::GetCallingTokenID());
     appRecord->SetCallerUid(IPCSkeleton::GetCallingUid());
-    auto &recordMap = appMgrServiceInner->appRunningManager_->appRunningRecordMap_;
-    auto iter = recordMap.find(IPCSkeleton::GetCallingPid());
-    if (iter == recordMap.end()) {
-        recordMap.insert({IPCSkeleton::GetCallingPid(), appRecord});
-    } else {
-        recordMap.erase(iter);
-        recordMap.insert({IPCSkeleton::GetCallingPid(), appRecord});
-    }
     appRecord->GetPriorityObject()->pid_ = IPCSkeleton::GetCallingPid();
+    appMgrServiceInner->appRunningManager_->RemoveAppRunningRecordById(IPCSkeleton::GetCallingPid());
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(IPCSkeleton::GetCallingPid(), appRecord);
     appRecord->SetCallerPid(IPCSkeleton::GetCallingPid());
     EXPECT_TRUE(appMgrServiceInner->SendProcessStartFailedEvent(appRecord, ProcessStartFailedReason::APPSPAWN_FAILED,
         1));
@@ -541,15 +517,9 @@ HWTEST_F(AppMgrServiceInnerTest, SendProcessStartFailedEvent_005, TestSize.Level
     moduleRunningRecord->abilities_[token] = abilityRecord;
     appRecord->SetCallerTokenId(IPCSkeleton::GetCallingTokenID());
     appRecord->SetCallerUid(IPCSkeleton::GetCallingUid());
-    auto &recordMap = appMgrServiceInner->appRunningManager_->appRunningRecordMap_;
-    auto iter = recordMap.find(IPCSkeleton::GetCallingPid());
-    if (iter == recordMap.end()) {
-        recordMap.insert({IPCSkeleton::GetCallingPid(), appRecord});
-    } else {
-        recordMap.erase(iter);
-        recordMap.insert({IPCSkeleton::GetCallingPid(), appRecord});
-    }
     appRecord->GetPriorityObject()->pid_ = IPCSkeleton::GetCallingPid();
+    appMgrServiceInner->appRunningManager_->RemoveAppRunningRecordById(IPCSkeleton::GetCallingPid());
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(IPCSkeleton::GetCallingPid(), appRecord);
     appRecord->SetCallerPid(IPCSkeleton::GetCallingPid());
     EXPECT_TRUE(appMgrServiceInner->SendProcessStartFailedEvent(appRecord, ProcessStartFailedReason::APPSPAWN_FAILED,
         1));
@@ -587,15 +557,9 @@ HWTEST_F(AppMgrServiceInnerTest, SendProcessStartFailedEvent_006, TestSize.Level
     moduleRunningRecord->abilities_[token] = abilityRecord;
     appRecord->SetCallerTokenId(IPCSkeleton::GetCallingTokenID());
     appRecord->SetCallerUid(IPCSkeleton::GetCallingUid());
-    auto &recordMap = appMgrServiceInner->appRunningManager_->appRunningRecordMap_;
-    auto iter = recordMap.find(IPCSkeleton::GetCallingPid());
-    if (iter == recordMap.end()) {
-        recordMap.insert({IPCSkeleton::GetCallingPid(), appRecord});
-    } else {
-        recordMap.erase(iter);
-        recordMap.insert({IPCSkeleton::GetCallingPid(), appRecord});
-    }
     appRecord->GetPriorityObject()->pid_ = IPCSkeleton::GetCallingPid();
+    appMgrServiceInner->appRunningManager_->RemoveAppRunningRecordById(IPCSkeleton::GetCallingPid());
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(IPCSkeleton::GetCallingPid(), appRecord);
     appRecord->SetCallerPid(IPCSkeleton::GetCallingPid());
     EXPECT_TRUE(appMgrServiceInner->SendProcessStartFailedEvent(appRecord, ProcessStartFailedReason::APPSPAWN_FAILED,
         1));
@@ -633,15 +597,9 @@ HWTEST_F(AppMgrServiceInnerTest, SendProcessStartFailedEvent_007, TestSize.Level
     moduleRunningRecord->abilities_[token] = abilityRecord;
     appRecord->SetCallerTokenId(IPCSkeleton::GetCallingTokenID());
     appRecord->SetCallerUid(IPCSkeleton::GetCallingUid());
-    auto &recordMap = appMgrServiceInner->appRunningManager_->appRunningRecordMap_;
-    auto iter = recordMap.find(IPCSkeleton::GetCallingPid());
-    if (iter == recordMap.end()) {
-        recordMap.insert({IPCSkeleton::GetCallingPid(), appRecord});
-    } else {
-        recordMap.erase(iter);
-        recordMap.insert({IPCSkeleton::GetCallingPid(), appRecord});
-    }
     appRecord->GetPriorityObject()->pid_ = IPCSkeleton::GetCallingPid();
+    appMgrServiceInner->appRunningManager_->RemoveAppRunningRecordById(IPCSkeleton::GetCallingPid());
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(IPCSkeleton::GetCallingPid(), appRecord);
     appRecord->SetCallerPid(IPCSkeleton::GetCallingPid());
     EXPECT_TRUE(appMgrServiceInner->SendProcessStartFailedEvent(appRecord, ProcessStartFailedReason::APPSPAWN_FAILED,
         1));
@@ -681,15 +639,9 @@ HWTEST_F(AppMgrServiceInnerTest, SendProcessStartFailedEvent_008, TestSize.Level
     moduleRunningRecord->abilities_[token] = abilityRecord;
     appRecord->SetCallerTokenId(IPCSkeleton::GetCallingTokenID());
     appRecord->SetCallerUid(IPCSkeleton::GetCallingUid());
-    auto &recordMap = appMgrServiceInner->appRunningManager_->appRunningRecordMap_;
-    auto iter = recordMap.find(IPCSkeleton::GetCallingPid());
-    if (iter == recordMap.end()) {
-        recordMap.insert({IPCSkeleton::GetCallingPid(), appRecord});
-    } else {
-        recordMap.erase(iter);
-        recordMap.insert({IPCSkeleton::GetCallingPid(), appRecord});
-    }
     appRecord->GetPriorityObject()->pid_ = IPCSkeleton::GetCallingPid();
+    appMgrServiceInner->appRunningManager_->RemoveAppRunningRecordById(IPCSkeleton::GetCallingPid());
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(IPCSkeleton::GetCallingPid(), appRecord);
     appRecord->SetCallerPid(IPCSkeleton::GetCallingPid());
     EXPECT_TRUE(appMgrServiceInner->SendProcessStartFailedEvent(appRecord, ProcessStartFailedReason::APPSPAWN_FAILED,
         1));
@@ -729,15 +681,9 @@ HWTEST_F(AppMgrServiceInnerTest, SendProcessStartFailedEvent_009, TestSize.Level
     moduleRunningRecord->abilities_[token] = abilityRecord;
     appRecord->SetCallerTokenId(IPCSkeleton::GetCallingTokenID());
     appRecord->SetCallerUid(IPCSkeleton::GetCallingUid());
-    auto &recordMap = appMgrServiceInner->appRunningManager_->appRunningRecordMap_;
-    auto iter = recordMap.find(IPCSkeleton::GetCallingPid());
-    if (iter == recordMap.end()) {
-        recordMap.insert({IPCSkeleton::GetCallingPid(), appRecord});
-    } else {
-        recordMap.erase(iter);
-        recordMap.insert({IPCSkeleton::GetCallingPid(), appRecord});
-    }
     appRecord->GetPriorityObject()->pid_ = IPCSkeleton::GetCallingPid();
+    appMgrServiceInner->appRunningManager_->RemoveAppRunningRecordById(IPCSkeleton::GetCallingPid());
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(IPCSkeleton::GetCallingPid(), appRecord);
     appRecord->SetCallerPid(IPCSkeleton::GetCallingPid());
     EXPECT_TRUE(appMgrServiceInner->SendProcessStartFailedEvent(appRecord, ProcessStartFailedReason::APPSPAWN_FAILED,
         1));
@@ -775,15 +721,9 @@ HWTEST_F(AppMgrServiceInnerTest, SendProcessStartFailedEvent_010, TestSize.Level
     moduleRunningRecord->abilities_[token] = abilityRecord;
     appRecord->SetCallerTokenId(IPCSkeleton::GetCallingTokenID());
     appRecord->SetCallerUid(IPCSkeleton::GetCallingUid());
-    auto &recordMap = appMgrServiceInner->appRunningManager_->appRunningRecordMap_;
-    auto iter = recordMap.find(IPCSkeleton::GetCallingPid());
-    if (iter == recordMap.end()) {
-        recordMap.insert({IPCSkeleton::GetCallingPid(), appRecord});
-    } else {
-        recordMap.erase(iter);
-        recordMap.insert({IPCSkeleton::GetCallingPid(), appRecord});
-    }
     appRecord->GetPriorityObject()->pid_ = IPCSkeleton::GetCallingPid();
+    appMgrServiceInner->appRunningManager_->RemoveAppRunningRecordById(IPCSkeleton::GetCallingPid());
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(IPCSkeleton::GetCallingPid(), appRecord);
     appRecord->SetCallerPid(IPCSkeleton::GetCallingPid());
     EXPECT_TRUE(appMgrServiceInner->SendProcessStartFailedEvent(appRecord, ProcessStartFailedReason::APPSPAWN_FAILED,
         1));
@@ -1425,7 +1365,7 @@ HWTEST_F(AppMgrServiceInnerTest, KillSubProcessBypid_002, TestSize.Level1)
     renderRecordMap.emplace(uid, renderRecord);
     appRecord->renderRecordMap_ = renderRecordMap;
 
-    appRunningManager->appRunningRecordMap_.emplace(recordId, appRecord);
+    appRunningManager->AddAppRunningRecord(recordId, appRecord);
 
     appMgrServiceInner->appRunningManager_ = appRunningManager;
     ret = appMgrServiceInner->KillSubProcessBypid(pid, reason);
@@ -1467,7 +1407,7 @@ HWTEST_F(AppMgrServiceInnerTest, KillSubProcessBypid_003, TestSize.Level1)
     childProcessRecordMap.emplace(pid, childProcessRecord);
     appRecord->childProcessRecordMap_ = childProcessRecordMap;
 
-    appRunningManager->appRunningRecordMap_.emplace(recordId, appRecord);
+    appRunningManager->AddAppRunningRecord(recordId, appRecord);
     appMgrServiceInner->appRunningManager_ = appRunningManager;
     ret = appMgrServiceInner->KillSubProcessBypid(pid, reason);
     EXPECT_EQ(ret, 0);
@@ -1505,7 +1445,7 @@ HWTEST_F(AppMgrServiceInnerTest, KillSubProcessBypid_004, TestSize.Level1)
     childAppRecordMap.emplace(pid, subAppRecord);
     appRecord->childAppRecordMap_ = childAppRecordMap;
 
-    appRunningManager->appRunningRecordMap_.emplace(recordId, appRecord);
+    appRunningManager->AddAppRunningRecord(recordId, appRecord);
     appMgrServiceInner->appRunningManager_ = appRunningManager;
     ret = appMgrServiceInner->KillSubProcessBypid(pid, reason);
     EXPECT_EQ(ret, 0);
@@ -1543,7 +1483,7 @@ HWTEST_F(AppMgrServiceInnerTest, KillSubProcessBypid_005, TestSize.Level1)
     childAppRecordMap.emplace(pid, subAppRecord);
     appRecord->childAppRecordMap_ = childAppRecordMap;
 
-    appRunningManager->appRunningRecordMap_.emplace(recordId, appRecord);
+    appRunningManager->AddAppRunningRecord(recordId, appRecord);
     appMgrServiceInner->appRunningManager_ = appRunningManager;
     ret = appMgrServiceInner->KillSubProcessBypid(pid, reason);
     EXPECT_EQ(ret, 0);
@@ -799,7 +799,7 @@ HWTEST_F(AppMgrServiceInnerTest, ReportUIExtensionProcColdStartToRss_001, TestSi
     auto appRunningRecordHost = std::make_shared<AppRunningRecord>(infoHost, recordIdHost, processNameHost);
     ASSERT_NE(appRunningRecordHost, nullptr);
     appRunningRecordHost->priorityObject_->pid_ = hostPid;
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.emplace(recordIdHost, appRunningRecordHost);
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(recordIdHost, appRunningRecordHost);
 
     // fill abilityInfo_
     abilityInfo_->extensionAbilityType = AppExecFwk::ExtensionAbilityType::SYSPICKER_PHOTOPICKER; // 404
@@ -1568,7 +1568,7 @@ HWTEST_F(AppMgrServiceInnerTest, KillProcessByPid_002, TestSize.Level2)
     auto priorityObject = std::make_shared<PriorityObject>();
     priorityObject->SetPid(0);
     appRecord->priorityObject_ = priorityObject;
-    appRunningManager->appRunningRecordMap_.emplace(recordId_, appRecord);
+    appRunningManager->AddAppRunningRecord(recordId_, appRecord);
 
     int result = appMgrServiceInner->KillProcessByPid(pid, "KillProcessByPid_002");
     EXPECT_EQ(result, AAFwk::ERR_KILL_PROCESS_NOT_EXIST);
@@ -4902,13 +4902,13 @@ HWTEST_F(AppMgrServiceInnerTest, NotifyAppFault_002, TestSize.Level1)
     EXPECT_NE(appRecord, nullptr);
     int32_t pid = IPCSkeleton::GetCallingPid();
     appRecord->priorityObject_->pid_ = pid;
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.emplace(recordId, appRecord);
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(recordId, appRecord);
     FaultData faultData;
     faultData.errorObject.name = AppFreezeType::THREAD_BLOCK_6S;
     faultData.faultType = FaultDataType::APP_FREEZE;
     int32_t ret = appMgrServiceInner->NotifyAppFault(faultData);
     EXPECT_EQ(ret, ERR_OK);
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.erase(recordId);
+    appMgrServiceInner->appRunningManager_->RemoveAppRunningRecordById(recordId);
     TAG_LOGI(AAFwkTag::TEST, "NotifyAppFault_002 end");
 }
 
@@ -4934,14 +4934,14 @@ HWTEST_F(AppMgrServiceInnerTest, TransformedNotifyAppFault_002, TestSize.Level1)
     EXPECT_NE(appRecord, nullptr);
     int32_t pid = 12346;
     appRecord->priorityObject_->pid_ = pid;
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.emplace(recordId, appRecord);
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(recordId, appRecord);
     AppFaultDataBySA faultData;
     faultData.pid = pid;
     faultData.errorObject.name = AppFreezeType::THREAD_BLOCK_6S;
     faultData.faultType = FaultDataType::APP_FREEZE;
     int32_t ret = appMgrServiceInner->TransformedNotifyAppFault(faultData);
     EXPECT_EQ(ret, ERR_OK);
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.erase(recordId);
+    appMgrServiceInner->appRunningManager_->RemoveAppRunningRecordById(recordId);
     TAG_LOGI(AAFwkTag::TEST, "TransformedNotifyAppFault_002 end");
 }
 
@@ -5503,7 +5503,7 @@ HWTEST_F(AppMgrServiceInnerTest, IsApplicationRunning_001, TestSize.Level1)
     auto appRecord = std::make_shared<AppRunningRecord>(applicationInfo_, ++recordId_, processName);
     EXPECT_NE(appRecord, nullptr);
     appRecord->mainBundleName_ = "com.is.hiserice";
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.emplace(recordId_, appRecord);
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(recordId_, appRecord);
     int32_t ret = appMgrServiceInner->IsApplicationRunning(bundleName, isRunning);
     EXPECT_EQ(ret, ERR_OK);
     EXPECT_TRUE(isRunning);
@@ -5524,7 +5524,7 @@ HWTEST_F(AppMgrServiceInnerTest, IsApplicationRunning_002, TestSize.Level1)
     bool isRunning = false;
     auto appRecord = std::make_shared<AppRunningRecord>(applicationInfo_, ++recordId_, processName);
     EXPECT_NE(appRecord, nullptr);
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.emplace(recordId_, appRecord);
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(recordId_, appRecord);
     int32_t ret = appMgrServiceInner->IsApplicationRunning(bundleName, isRunning);
     EXPECT_EQ(ret, ERR_OK);
     EXPECT_FALSE(isRunning);
@@ -5654,7 +5654,7 @@ HWTEST_F(AppMgrServiceInnerTest, IsAppRunning_001, TestSize.Level1)
     auto appRecord = std::make_shared<AppRunningRecord>(applicationInfo_, ++recordId_, processName);
     EXPECT_NE(appRecord, nullptr);
     appRecord->mainBundleName_ = "com.is.hiserice";
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.emplace(recordId_, appRecord);
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(recordId_, appRecord);
     int32_t ret = appMgrServiceInner->IsAppRunning(bundleName, appCloneIndex, isRunning);
     EXPECT_EQ(ret, AAFwk::ERR_APP_CLONE_INDEX_INVALID);
     EXPECT_FALSE(isRunning);
@@ -5676,7 +5676,7 @@ HWTEST_F(AppMgrServiceInnerTest, IsAppRunning_002, TestSize.Level1)
     bool isRunning = false;
     auto appRecord = std::make_shared<AppRunningRecord>(applicationInfo_, ++recordId_, processName);
     EXPECT_NE(appRecord, nullptr);
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.emplace(recordId_, appRecord);
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(recordId_, appRecord);
     int32_t ret = appMgrServiceInner->IsAppRunning(bundleName, appCloneIndex, isRunning);
     EXPECT_EQ(ret, AAFwk::ERR_APP_CLONE_INDEX_INVALID);
     EXPECT_FALSE(isRunning);
@@ -7012,10 +7012,10 @@ HWTEST_F(AppMgrServiceInnerTest, LoadAbility_ReusePidFound_001, TestSize.Level1)
     auto record = appMgrServiceInner->appRunningManager_->CreateAppRunningRecord(
         applicationInfo_, "testReuseProcess", bundleInfo, "");
     ASSERT_NE(record, nullptr);
-    record->GetPriorityObject()->SetPid(testPid);
+    appMgrServiceInner->appRunningManager_->SetAppRunningRecordPid(record, testPid);
     record->appInfos_.insert(std::make_pair("test", applicationInfo_));
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.clear();
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.insert(std::make_pair(1, record));
+    appMgrServiceInner->appRunningManager_->ClearAppRunningRecordMap();
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(1, record);
 
     AbilityRuntime::LoadParam loadParam;
     loadParam.token = token;
@@ -7041,7 +7041,7 @@ HWTEST_F(AppMgrServiceInnerTest, LoadAbility_ReusePidNotFound_001, TestSize.Leve
     auto appMgrServiceInner = std::make_shared<AppMgrServiceInner>();
     ASSERT_NE(appMgrServiceInner, nullptr);
 
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.clear();
+    appMgrServiceInner->appRunningManager_->ClearAppRunningRecordMap();
 
     AbilityRuntime::LoadParam loadParam;
     loadParam.token = token;
@@ -7071,10 +7071,10 @@ HWTEST_F(AppMgrServiceInnerTest, LoadAbility_ReusePidInvalid_001, TestSize.Level
     auto record = appMgrServiceInner->appRunningManager_->CreateAppRunningRecord(
         applicationInfo_, "testInvalidProcess", bundleInfo, "");
     ASSERT_NE(record, nullptr);
-    record->GetPriorityObject()->SetPid(testPid);
+    appMgrServiceInner->appRunningManager_->SetAppRunningRecordPid(record, testPid);
     record->SetTerminating();
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.clear();
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.insert(std::make_pair(1, record));
+    appMgrServiceInner->appRunningManager_->ClearAppRunningRecordMap();
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(1, record);
 
     AbilityRuntime::LoadParam loadParam;
     loadParam.token = token;
@@ -7100,7 +7100,7 @@ HWTEST_F(AppMgrServiceInnerTest, LoadAbility_ReusePidDefault_001, TestSize.Level
     auto appMgrServiceInner = std::make_shared<AppMgrServiceInner>();
     ASSERT_NE(appMgrServiceInner, nullptr);
 
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.clear();
+    appMgrServiceInner->appRunningManager_->ClearAppRunningRecordMap();
 
     AbilityRuntime::LoadParam loadParam;
     loadParam.token = token;
@@ -624,7 +624,7 @@ HWTEST_F(AppMgrServiceSecondTest, IsChildProcessSupported_0300, TestSize.Level1)
     appInfo->bundleName = BUNDLE_NAME;
     auto appRecord = std::make_shared<AppRunningRecord>(appInfo, 1, "test_process");
     appRecord->GetPriorityObject()->SetPid(PID);
-    appMgrService->appMgrServiceInner_->appRunningManager_->appRunningRecordMap_.emplace(1, appRecord);
+    appMgrService->appMgrServiceInner_->appRunningManager_->AddAppRunningRecord(1, appRecord);
 
     AAFwk::AppUtils::GetInstance().isMultiProcessModel_.isLoaded = true;
     AAFwk::AppUtils::GetInstance().isMultiProcessModel_.value = true;
@@ -651,7 +651,7 @@ HWTEST_F(AppMgrServiceSecondTest, IsChildProcessSupported_0400, TestSize.Level1)
     appInfo->bundleName = BUNDLE_NAME;
     auto appRecord = std::make_shared<AppRunningRecord>(appInfo, 2, "test_process");
     appRecord->GetPriorityObject()->SetPid(PID);
-    appMgrService->appMgrServiceInner_->appRunningManager_->appRunningRecordMap_.emplace(2, appRecord);
+    appMgrService->appMgrServiceInner_->appRunningManager_->AddAppRunningRecord(2, appRecord);
 
     AAFwk::AppUtils::GetInstance().isMultiProcessModel_.isLoaded = true;
     AAFwk::AppUtils::GetInstance().isMultiProcessModel_.value = true;
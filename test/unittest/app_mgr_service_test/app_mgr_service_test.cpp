@@ -1871,14 +1871,8 @@ HWTEST_F(AppMgrServiceTest, SetSupportedProcessCacheSelf_002, TestSize.Level2)
     appRecord->SetCallerUid(IPCSkeleton::GetCallingUid());
     appRecord->GetPriorityObject()->pid_ = IPCSkeleton::GetCallingPid();
     appRecord->SetCallerPid(IPCSkeleton::GetCallingPid());
-    auto &recordMap = appRunningMgr->appRunningRecordMap_;
-    auto iter = recordMap.find(IPCSkeleton::GetCallingPid());
-    if (iter == recordMap.end()) {
-        recordMap.insert({IPCSkeleton::GetCallingPid(), appRecord});
-    } else {
-        recordMap.erase(iter);
-        recordMap.insert({IPCSkeleton::GetCallingPid(), appRecord});
-    }
+    appRunningMgr->RemoveAppRunningRecordById(IPCSkeleton::GetCallingPid());
+    appRunningMgr->AddAppRunningRecord(IPCSkeleton::GetCallingPid(), appRecord);
     appMgrService->SetSupportedProcessCacheSelf(false);
     EXPECT_TRUE(appMgrService != nullptr);
 }
@@ -161,7 +161,7 @@ HWTEST_F(AppMgrServiceThirdTest, IsTerminatingByPid_001, TestSize.Level1)
     std::shared_ptr<AppRunningRecord> appRecord =
         appMgrServiceInner->appRunningManager_->CreateAppRunningRecord(applicationInfo_, processName, bundleInfo, "");
     EXPECT_NE(appRecord, nullptr);
-    appMgrServiceInner->appRunningManager_->appRunningRecordMap_.emplace(static_cast<int32_t>(pid), appRecord);
+    appMgrServiceInner->appRunningManager_->AddAppRunningRecord(static_cast<int32_t>(pid), appRecord);
     appMgrService->SetInnerService(appMgrServiceInner);
     appMgrService->eventHandler_ = std::make_shared<AMSEventHandler>(taskHandler_, appMgrService->appMgrServiceInner_);
     res = appMgrService->IsTerminatingByPid(pid, isTerminating);
@@ -497,7 +497,10 @@ HWTEST_F(AppMgrServiceThirdTest, ShowHelp_001, TestSize.Level1)
         "--ipc pid ARG               ipc load statistic; pid must be specified or set to -a dump all processes. "
         "ARG must be one of --start-stat | --stop-stat | --stat\n"
         "--web pid1[,pid2,pid3] [ARG]    "
-        "dump arkweb info, ARG must be one of (--all | --nweb | ...)\n";
+        "dump arkweb info, ARG must be one of (--all | --nweb | ...)\n"
+        "--ipc-dispatch              dump call count and latency of each ipc code handled by appmgr\n"
+        "--app-state-delivery        dump queue depth and delivery latency of app state observer callbacks\n"
+        "--launch-info-cache         dump hit rate and saved time of the launch info cache\n";
     int res = appMgrService->ShowHelp(dummyArgs, resultBuffer);
     EXPECT_EQ(resultBuffer, expectedOutput);
     EXPECT_EQ(res, ERR_OK);
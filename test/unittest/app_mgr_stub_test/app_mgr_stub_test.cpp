@@ -465,6 +465,39 @@ HWTEST_F(AppMgrStubTest, IsAppRunning_0100, TestSize.Level1)
     EXPECT_EQ(result, NO_ERROR);
 }
 
+/**
+ * @tc.name: DumpIpcDispatchStat_0100
+ * @tc.desc: Dispatched codes are bound in the dispatch table and listed in dump, unknown codes are not.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AppMgrStubTest, DumpIpcDispatchStat_0100, TestSize.Level1)
+{
+    uint32_t code = static_cast<uint32_t>(AppMgrInterfaceCode::IS_APP_RUNNING);
+    EXPECT_CALL(*mockAppMgrService_, IsAppRunning(_, _, _)).Times(2);
+    for (int i = 0; i < 2; i++) {
+        MessageParcel data;
+        MessageParcel reply;
+        MessageOption option;
+        WriteInterfaceToken(data);
+        data.WriteString("testBundleName");
+        data.WriteInt32(0);
+        data.WriteBool(false);
+        EXPECT_EQ(mockAppMgrService_->OnRemoteRequest(code, data, reply, option), NO_ERROR);
+    }
+
+    uint32_t unknownCode = 250;
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+    WriteInterfaceToken(data);
+    EXPECT_NE(mockAppMgrService_->OnRemoteRequest(unknownCode, data, reply, option), NO_ERROR);
+
+    std::string result;
+    mockAppMgrService_->DumpIpcDispatchStat(result);
+    EXPECT_NE(result.find("\n" + std::to_string(code) + " "), std::string::npos);
+    EXPECT_EQ(result.find("\n" + std::to_string(unknownCode) + " "), std::string::npos);
+}
+
 /**
  * @tc.name: IsApplicationRunning_001
  * @tc.desc: On remote request to query the running status of the application.
@@ -129,30 +129,30 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_CheckAppRunningRecordIsE
 
     std::shared_ptr<AppRunningRecord> record =
         appRunningManager_->CreateAppRunningRecord(appInfo_, processName, bundleInfo, "");
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->CheckAppRunningRecordIsExist(APP_NAME_EMPTY, PROCESS_NAME,
         uid, bundleInfo, specifiedProcessFlag, isProCache, instanceKey, customProcessFlag);
     EXPECT_EQ(ret, nullptr);
 
     record = appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->CheckAppRunningRecordIsExist(APP_NAME_EMPTY, processName,
         uid, bundleInfo, specifiedProcessFlag, isProCache, instanceKey, customProcessFlag);
     EXPECT_EQ(ret, nullptr);
 
     record = appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->CheckAppRunningRecordIsExist(APP_NAME_EMPTY, PROCESS_NAME,
         uid, bundleInfo, specifiedProcessFlag, isProCache, instanceKey, customProcessFlag);
     EXPECT_EQ(ret, nullptr);
 
     record = appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->SetInstanceKey(instanceKey);
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->CheckAppRunningRecordIsExist(APP_NAME_EMPTY, PROCESS_NAME,
         uid, bundleInfo, specifiedProcessFlag, isProCache, instanceKey, customProcessFlag);
     EXPECT_EQ(ret, nullptr);
@@ -174,43 +174,43 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_CheckAppRunningRecordIsE
 
     std::shared_ptr<AppRunningRecord> record =
         appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->SetSpecifiedProcessFlag(specifiedProcessFlag);
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     auto ret = appRunningManager_->CheckAppRunningRecordIsExist(APP_NAME_EMPTY, PROCESS_NAME,
         uid, bundleInfo, specifiedProcessFlag, isProCache, instanceKey, customProcessFlag);
     EXPECT_EQ(ret, nullptr);
 
     record = appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->SetSpecifiedProcessFlag(specifiedProcessFlag);
     record->SetCustomProcessFlag("customProcessFlag");
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     std::string specifiedProcessFlag1 = "";
     ret = appRunningManager_->CheckAppRunningRecordIsExist(APP_NAME_EMPTY, PROCESS_NAME,
         uid, bundleInfo, specifiedProcessFlag1, isProCache, instanceKey, customProcessFlag);
     EXPECT_EQ(ret, nullptr);
 
     record = appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->SetTerminating();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->CheckAppRunningRecordIsExist(APP_NAME_EMPTY, PROCESS_NAME,
         uid, bundleInfo, specifiedProcessFlag1, isProCache, instanceKey, customProcessFlag);
     EXPECT_EQ(ret, nullptr);
 
     record = appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->SetKilling();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->CheckAppRunningRecordIsExist(APP_NAME_EMPTY, PROCESS_NAME,
         uid, bundleInfo, specifiedProcessFlag1, isProCache, instanceKey, customProcessFlag);
     EXPECT_EQ(ret, nullptr);
 
     record = appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->SetRestartAppFlag(true);
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->CheckAppRunningRecordIsExist(APP_NAME_EMPTY, PROCESS_NAME,
         uid, bundleInfo, specifiedProcessFlag1, isProCache, instanceKey, customProcessFlag);
     EXPECT_EQ(ret, nullptr);
@@ -232,41 +232,41 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_CheckAppRunningRecordIsE
 
     std::shared_ptr<AppRunningRecord> record =
         appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->SetUserRequestCleaning();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     auto ret = appRunningManager_->CheckAppRunningRecordIsExist(APP_NAME_EMPTY, PROCESS_NAME,
         uid, bundleInfo, specifiedProcessFlag, isProCache, instanceKey, customProcessFlag);
     EXPECT_EQ(ret, nullptr);
 
     record = appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->SetProcessCaching(true);
     record->SetProcessCacheBlocked(true);
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->CheckAppRunningRecordIsExist(APP_NAME_EMPTY, PROCESS_NAME,
         uid, bundleInfo, specifiedProcessFlag, isProCache, instanceKey, customProcessFlag);
     EXPECT_EQ(ret, nullptr);
 
     record = appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->SetProcessCaching(true);
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->CheckAppRunningRecordIsExist(APP_NAME_EMPTY, PROCESS_NAME,
         uid, bundleInfo, specifiedProcessFlag, isProCache, instanceKey, customProcessFlag);
     EXPECT_EQ(ret, nullptr);
 
     record = appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->SetProcessCacheBlocked(true);
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->CheckAppRunningRecordIsExist(APP_NAME_EMPTY, PROCESS_NAME,
         uid, bundleInfo, specifiedProcessFlag, isProCache, instanceKey, customProcessFlag);
     EXPECT_EQ(ret, nullptr);
 
     record = appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->CheckAppRunningRecordIsExist(APP_NAME_EMPTY, PROCESS_NAME,
         uid, bundleInfo, specifiedProcessFlag, isProCache, instanceKey, customProcessFlag);
     EXPECT_EQ(ret, nullptr);
@@ -289,9 +289,9 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_CheckAppRunningRecordIsE
     appInfo_->name = APP_NAME;
     std::shared_ptr<AppRunningRecord> record =
         appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->appInfos_.insert(std::make_pair("test", appInfo_));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     auto ret = appRunningManager_->CheckAppRunningRecordIsExist(APP_NAME, PROCESS_NAME,
         uid, bundleInfo, specifiedProcessFlag, isProCache, instanceKey, customProcessFlag);
     EXPECT_NE(ret, nullptr);
@@ -299,9 +299,9 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_CheckAppRunningRecordIsE
     bool value = false;
     isProCache = &value;
     record = appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->appInfos_.insert(std::make_pair("test", appInfo_));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->CheckAppRunningRecordIsExist(APP_NAME, PROCESS_NAME,
         uid, bundleInfo, specifiedProcessFlag, isProCache, instanceKey, customProcessFlag);
     EXPECT_NE(ret, nullptr);
@@ -324,9 +324,9 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_CheckAppRunningRecordIsE
     appInfo_->name = APP_NAME;
     std::shared_ptr<AppRunningRecord> record =
         appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->appInfos_.insert(std::make_pair("test", appInfo_));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     auto ret = appRunningManager_->CheckAppRunningRecordIsExist(APP_NAME, PROCESS_NAME,
         uid, bundleInfo, specifiedProcessFlag, isProCache, instanceKey, customProcessFlag);
     EXPECT_NE(ret, nullptr);
@@ -334,9 +334,9 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_CheckAppRunningRecordIsE
     bool value = false;
     isProCache = &value;
     record = appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->appInfos_.insert(std::make_pair("test", appInfo_));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
 
     bool notReuseCachedPorcess = true;
     ret = appRunningManager_->CheckAppRunningRecordIsExist(APP_NAME, PROCESS_NAME,
@@ -366,8 +366,8 @@ HWTEST_F(AppRunningManagerFourthTest,
     record->appInfos_.insert(std::make_pair("test", appInfo_));
     record->priorityObject_->SetPid(TEST_PID);
     record->SetUid(uid);
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, record);
 
     auto ret = appRunningManager_->CheckAppRunningRecordIsExist(APP_NAME, PROCESS_NAME,
         uid, bundleInfo, specifiedProcessFlag, isProCache, instanceKey, customProcessFlag);
@@ -395,8 +395,8 @@ HWTEST_F(AppRunningManagerFourthTest,
     ASSERT_NE(record, nullptr);
     record->appInfos_.insert(std::make_pair("test", appInfo_));
     record->priorityObject_->SetPid(TEST_PID);
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, record);
 
     auto ret = appRunningManager_->CheckAppRunningRecordIsExist(APP_NAME, PROCESS_NAME,
         uid, bundleInfo, specifiedProcessFlag, isProCache, instanceKey, customProcessFlag);
@@ -415,9 +415,9 @@ HWTEST_F(AppRunningManagerFourthTest,
     appInfo_->name = APP_NAME;
     auto record = appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
     ASSERT_NE(record, nullptr);
-    record->GetPriorityObject()->SetPid(TEST_PID);
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->SetAppRunningRecordPid(record, TEST_PID);
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, record);
 
     auto ret = appRunningManager_->GetValidAppRunningRecordByPid(TEST_PID);
     EXPECT_NE(ret, nullptr);
@@ -432,7 +432,7 @@ HWTEST_F(AppRunningManagerFourthTest,
 HWTEST_F(AppRunningManagerFourthTest,
     GetValidAppRunningRecordByPid_ShouldReturnNullptrWhenPidNotFound, TestSize.Level1)
 {
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
 
     auto ret = appRunningManager_->GetValidAppRunningRecordByPid(9999);
     EXPECT_EQ(ret, nullptr);
@@ -450,10 +450,10 @@ HWTEST_F(AppRunningManagerFourthTest,
     appInfo_->name = APP_NAME;
     auto record = appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
     ASSERT_NE(record, nullptr);
-    record->GetPriorityObject()->SetPid(TEST_PID);
+    appRunningManager_->SetAppRunningRecordPid(record, TEST_PID);
     record->SetTerminating();
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, record);
 
     auto ret = appRunningManager_->GetValidAppRunningRecordByPid(TEST_PID);
     EXPECT_EQ(ret, nullptr);
@@ -471,10 +471,10 @@ HWTEST_F(AppRunningManagerFourthTest,
     appInfo_->name = APP_NAME;
     auto record = appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
     ASSERT_NE(record, nullptr);
-    record->GetPriorityObject()->SetPid(TEST_PID);
+    appRunningManager_->SetAppRunningRecordPid(record, TEST_PID);
     record->SetKilling();
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, record);
 
     auto ret = appRunningManager_->GetValidAppRunningRecordByPid(TEST_PID);
     EXPECT_EQ(ret, nullptr);
@@ -492,10 +492,10 @@ HWTEST_F(AppRunningManagerFourthTest,
     appInfo_->name = APP_NAME;
     auto record = appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
     ASSERT_NE(record, nullptr);
-    record->GetPriorityObject()->SetPid(TEST_PID);
+    appRunningManager_->SetAppRunningRecordPid(record, TEST_PID);
     record->SetRestartAppFlag(true);
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, record);
 
     auto ret = appRunningManager_->GetValidAppRunningRecordByPid(TEST_PID);
     EXPECT_EQ(ret, nullptr);
@@ -513,10 +513,10 @@ HWTEST_F(AppRunningManagerFourthTest,
     appInfo_->name = APP_NAME;
     auto record = appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
     ASSERT_NE(record, nullptr);
-    record->GetPriorityObject()->SetPid(TEST_PID);
+    appRunningManager_->SetAppRunningRecordPid(record, TEST_PID);
     record->SetUserRequestCleaning();
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, record);
 
     auto ret = appRunningManager_->GetValidAppRunningRecordByPid(TEST_PID);
     EXPECT_EQ(ret, nullptr);
@@ -534,11 +534,11 @@ HWTEST_F(AppRunningManagerFourthTest,
     appInfo_->name = APP_NAME;
     auto record = appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
     ASSERT_NE(record, nullptr);
-    record->GetPriorityObject()->SetPid(TEST_PID);
+    appRunningManager_->SetAppRunningRecordPid(record, TEST_PID);
     record->SetProcessCaching(true);
     record->SetProcessCacheBlocked(true);
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, record);
 
     auto ret = appRunningManager_->GetValidAppRunningRecordByPid(TEST_PID);
     EXPECT_EQ(ret, nullptr);
@@ -556,10 +556,10 @@ HWTEST_F(AppRunningManagerFourthTest,
     appInfo_->name = APP_NAME;
     auto record = appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
     ASSERT_NE(record, nullptr);
-    record->GetPriorityObject()->SetPid(TEST_PID);
+    appRunningManager_->SetAppRunningRecordPid(record, TEST_PID);
     record->SetIsKillPrecedeStart(true);
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, record);
 
     auto ret = appRunningManager_->GetValidAppRunningRecordByPid(TEST_PID);
     EXPECT_EQ(ret, nullptr);
@@ -578,23 +578,23 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_GetProcessInfosByUserId_
     BundleInfo bundleInfo;
     std::shared_ptr<AppRunningRecord> record =
         appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, nullptr));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, nullptr);
     auto ret = appRunningManager_->GetProcessInfosByUserId(userId, processInfos);
     EXPECT_FALSE(ret);
 
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->SetUid(TEST_BASE_USER_RANGE);
     record->appInfos_.insert(std::make_pair("test", appInfo_));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->GetProcessInfosByUserId(userId, processInfos);
     EXPECT_FALSE(ret);
 
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->SetUid(TEST_BASE_USER_RANGE);
     record->priorityObject_->SetPid(TEST_PID);
     record->appInfos_.insert(std::make_pair("test", appInfo_));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->GetProcessInfosByUserId(userId, processInfos);
     EXPECT_TRUE(ret);
 }
@@ -612,31 +612,31 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_IsAppRunningByBundleName
     BundleInfo bundleInfo;
     std::shared_ptr<AppRunningRecord> record =
         appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, nullptr));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, nullptr);
     auto ret = appRunningManager_->IsAppRunningByBundleNameAndUserId(bundleName, userId, isRunning);
     EXPECT_FALSE(isRunning);
 
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->IsAppRunningByBundleNameAndUserId(BUNDLE_NAME, userId, isRunning);
     EXPECT_FALSE(isRunning);
 
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->SetRestartAppFlag(true);
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->IsAppRunningByBundleNameAndUserId(BUNDLE_NAME, userId, isRunning);
     EXPECT_FALSE(isRunning);
 
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->SetRestartAppFlag(false);
     record->SetUid(0);
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->IsAppRunningByBundleNameAndUserId(BUNDLE_NAME, userId, isRunning);
     EXPECT_FALSE(isRunning);
 
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->SetUid(TEST_BASE_USER_RANGE);
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->IsAppRunningByBundleNameAndUserId(BUNDLE_NAME, userId, isRunning);
     EXPECT_TRUE(isRunning);
 }
@@ -654,40 +654,40 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_IsAppRunningByBundleName
     BundleInfo bundleInfo;
     std::shared_ptr<AppRunningRecord> record =
         appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, nullptr));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, nullptr);
     auto ret = appRunningManager_->IsAppRunningByBundleName(bundleName, 0, userId, isRunning);
     EXPECT_FALSE(isRunning);
 
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->IsAppRunningByBundleName(BUNDLE_NAME, 0, userId, isRunning);
     EXPECT_FALSE(isRunning);
 
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->SetRestartAppFlag(true);
     record->SetUid(TEST_BASE_USER_RANGE);
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->IsAppRunningByBundleName(BUNDLE_NAME, 0, userId, isRunning);
     EXPECT_FALSE(isRunning);
 
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->SetRestartAppFlag(false);
     record->SetUid(0);
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->IsAppRunningByBundleName(BUNDLE_NAME, 0, userId, isRunning);
     EXPECT_FALSE(isRunning);
 
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->SetRestartAppFlag(false);
     record->SetUid(TEST_BASE_USER_RANGE);
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->IsAppRunningByBundleName(BUNDLE_NAME, 1, userId, isRunning);
     EXPECT_FALSE(isRunning);
 
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->SetRestartAppFlag(false);
     record->SetUid(TEST_BASE_USER_RANGE);
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->IsAppRunningByBundleName(BUNDLE_NAME, 0, userId, isRunning);
     EXPECT_TRUE(isRunning);
 }
@@ -704,35 +704,35 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_ProcessUpdateApplication
     BundleInfo bundleInfo;
     std::shared_ptr<AppRunningRecord> record =
         appRunningManager_->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, nullptr));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, nullptr);
     auto ret = appRunningManager_->ProcessUpdateApplicationInfoInstalled(appInfo, MODULE_NAME);
     EXPECT_EQ(ret, ERR_OK);
 
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->appInfos_.insert(std::make_pair("test", appInfo_));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->ProcessUpdateApplicationInfoInstalled(appInfo, MODULE_NAME);
     EXPECT_EQ(ret, ERR_OK);
 
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->appInfos_.insert(std::make_pair("test", appInfo_));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     appInfo.bundleName = BUNDLE_NAME;
     ret = appRunningManager_->ProcessUpdateApplicationInfoInstalled(appInfo, MODULE_NAME);
     EXPECT_EQ(ret, ERR_OK);
 
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->appInfos_.insert(std::make_pair("test", appInfo_));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     appInfo.bundleName = "";
     appInfo.uid = TEST_UID;
     ret = appRunningManager_->ProcessUpdateApplicationInfoInstalled(appInfo, MODULE_NAME);
     EXPECT_EQ(ret, ERR_OK);
 
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     record->appInfos_.insert(std::make_pair("test", appInfo_));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     appInfo.bundleName = BUNDLE_NAME;
     appInfo.uid = TEST_UID;
     ret = appRunningManager_->ProcessUpdateApplicationInfoInstalled(appInfo, MODULE_NAME);
@@ -777,7 +777,7 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_HandleUserRequestClean_0
     moduleRunningRecords.push_back(moduleRecord);
     appRunningRecord->hapModules_.emplace(BUNDLE_NAME, moduleRunningRecords);
     auto recordId = AppRecordId::Create();
-    appRunningManager_->appRunningRecordMap_.emplace(recordId, appRunningRecord);
+    appRunningManager_->AddAppRunningRecord(recordId, appRunningRecord);
     ret = appRunningManager_->HandleUserRequestClean(token, targetPid, targetUid, recordId);
     EXPECT_EQ(ret, true);
 
@@ -832,7 +832,7 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_CheckIsKiaProcess_0100,
     appRunningRecord->priorityObject_ = std::make_shared<PriorityObject>();
     appRunningRecord->priorityObject_->SetPid(pid);
     auto recordId = AppRecordId::Create();
-    appRunningManager_->appRunningRecordMap_.emplace(recordId, appRunningRecord);
+    appRunningManager_->AddAppRunningRecord(recordId, appRunningRecord);
     ret = appRunningManager_->CheckIsKiaProcess(pid, isKia);
     EXPECT_EQ(ret, ERR_OK);
 
@@ -864,12 +864,12 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_CheckAppRunningRecordIsL
     ret = appRunningManager_->CheckAppRunningRecordIsLast(appRunningRecord);
     EXPECT_EQ(ret, true);
 
-    appRunningManager_->appRunningRecordMap_.emplace(TWO, nullptr);
+    appRunningManager_->AddAppRunningRecord(TWO, nullptr);
     ret = appRunningManager_->CheckAppRunningRecordIsLast(appRunningRecord);
     EXPECT_EQ(ret, true);
 
     appRunningRecord->SetUid(TWO);
-    appRunningManager_->appRunningRecordMap_.emplace(ONE, appRunningRecord);
+    appRunningManager_->AddAppRunningRecord(ONE, appRunningRecord);
     ret = appRunningManager_->CheckAppRunningRecordIsLast(appRunningRecord);
     EXPECT_EQ(ret, true);
 
@@ -900,7 +900,7 @@ HWTEST_F(AppRunningManagerFourthTest, ProcessExitByBundleNameAndAppIndex_0100, T
     ASSERT_NE(appRunningManager, nullptr);
     std::shared_ptr<AppRunningRecord> appRunningRecord = nullptr;
     int32_t num = 100;
-    appRunningManager->appRunningRecordMap_.insert(std::make_pair(num, appRunningRecord));
+    appRunningManager->AddAppRunningRecord(num, appRunningRecord);
 
     std::string bundleName = "bundleName";
     int32_t appIndex = 8;
@@ -931,7 +931,7 @@ HWTEST_F(AppRunningManagerFourthTest, ProcessExitByBundleNameAndAppIndex_0200, T
     appRunningRecord->isKeepAliveBundle_ = true;
     appRunningRecord->isKeepAliveRdb_ = true;
     int32_t num = 100;
-    appRunningManager->appRunningRecordMap_.insert(std::make_pair(num, appRunningRecord));
+    appRunningManager->AddAppRunningRecord(num, appRunningRecord);
     std::string bundleName = "bundleName";
     int32_t appIndex = 8;
     std::list<pid_t> pids;
@@ -959,7 +959,7 @@ HWTEST_F(AppRunningManagerFourthTest, ProcessExitByBundleNameAndAppIndex_0300, T
     int32_t priorityUid = 2000000;
     appRunningRecord->SetUid(priorityUid);
     int32_t num = 100;
-    appRunningManager->appRunningRecordMap_.insert(std::make_pair(num, appRunningRecord));
+    appRunningManager->AddAppRunningRecord(num, appRunningRecord);
     std::string bundleName = "bundleName";
     int32_t appIndex = 8;
     std::list<pid_t> pids;
@@ -989,7 +989,7 @@ HWTEST_F(AppRunningManagerFourthTest, ProcessExitByBundleNameAndAppIndex_0400, T
     appRunningRecord->SetUid(priorityUid);
     appRunningRecord->priorityObject_ = nullptr;
     int32_t num = 100;
-    appRunningManager->appRunningRecordMap_.insert(std::make_pair(num, appRunningRecord));
+    appRunningManager->AddAppRunningRecord(num, appRunningRecord);
     std::string bundleName = "bundleName";
     int32_t appIndex = 8;
     std::list<pid_t> pids;
@@ -1021,7 +1021,7 @@ HWTEST_F(AppRunningManagerFourthTest, ProcessExitByBundleNameAndAppIndex_0500, T
     int32_t priorityUid = 2000000;
     appRunningRecord->SetUid(priorityUid);
     int32_t num = 100;
-    appRunningManager->appRunningRecordMap_.insert(std::make_pair(num, appRunningRecord));
+    appRunningManager->AddAppRunningRecord(num, appRunningRecord);
     int32_t appIndex = 8;
     appRunningRecord->SetAppIndex(appIndex);
     std::string bundleName = "bundleName";
@@ -1054,7 +1054,7 @@ HWTEST_F(AppRunningManagerFourthTest, ProcessExitByBundleNameAndAppIndex_0600, T
     int32_t priorityUid = 2000000;
     appRunningRecord->SetUid(priorityUid);
     int32_t num = 100;
-    appRunningManager->appRunningRecordMap_.insert(std::make_pair(num, appRunningRecord));
+    appRunningManager->AddAppRunningRecord(num, appRunningRecord);
     int32_t appIndex = 8;
     appRunningRecord->SetAppIndex(appIndex);
     std::string bundleName = "bundleName";
@@ -1080,7 +1080,7 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_DumpIpcStop_0100, TestSi
     EXPECT_EQ(ret, DumpErrorCode::ERR_INVALID_PID_ERROR);
 
     auto appRunningRecord = std::make_shared<AppRunningRecord>(appInfo, RECORD_ID, PROCESS_NAME);
-    appRunningManager->appRunningRecordMap_.insert(make_pair(recordId, appRunningRecord));
+    appRunningManager->AddAppRunningRecord(recordId, appRunningRecord);
     ret = appRunningManager->DumpIpcStop(recordId, result);
     EXPECT_NE(ret, DumpErrorCode::ERR_INVALID_PID_ERROR);
 }
@@ -1102,7 +1102,7 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_DumpIpcStat_0100, TestSi
     EXPECT_EQ(ret, DumpErrorCode::ERR_INVALID_PID_ERROR);
 
     auto appRunningRecord = std::make_shared<AppRunningRecord>(appInfo, RECORD_ID, PROCESS_NAME);
-    appRunningManager->appRunningRecordMap_.insert(make_pair(recordId, appRunningRecord));
+    appRunningManager->AddAppRunningRecord(recordId, appRunningRecord);
     ret = appRunningManager->DumpIpcStat(recordId, result);
     EXPECT_NE(ret, DumpErrorCode::ERR_INVALID_PID_ERROR);
 }
@@ -1126,9 +1126,9 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_DumpFfrt_0100, TestSize.
 
     pids = {1, 0, 4, 6};
     auto appRunningRecord = std::make_shared<AppRunningRecord>(appInfo, RECORD_ID, PROCESS_NAME);
-    appRunningManager->appRunningRecordMap_.clear();
+    appRunningManager->ClearAppRunningRecordMap();
     appRunningRecord->appLifeCycleDeal_ = std::make_shared<AppLifeCycleDeal>();
-    appRunningManager->appRunningRecordMap_.insert(make_pair(recordId, appRunningRecord));
+    appRunningManager->AddAppRunningRecord(recordId, appRunningRecord);
     ret = appRunningManager->DumpFfrt(pids, result);
     EXPECT_EQ(ret, DumpErrorCode::ERR_INTERNAL_ERROR);
 
@@ -1173,7 +1173,7 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_DumpArkWeb_0200, TestSiz
     if (priorityObject) {
         priorityObject->SetPid(1);
     }
-    appRunningManager->appRunningRecordMap_.insert(make_pair(RECORD_ID, appRecord));
+    appRunningManager->AddAppRunningRecord(RECORD_ID, appRecord);
 
     std::string customArgs;
     std::string result;
@@ -1201,7 +1201,7 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_DumpArkWeb_0300, TestSiz
         priorityObject->SetPid(1);
     }
     appRecord->appLifeCycleDeal_ = std::make_shared<AppLifeCycleDeal>();
-    appRunningManager->appRunningRecordMap_.insert(make_pair(RECORD_ID, appRecord));
+    appRunningManager->AddAppRunningRecord(RECORD_ID, appRecord);
 
     std::string customArgs;
     std::string result = "Result:";
@@ -1229,7 +1229,7 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_OnRenderProcessExitedByP
 
     // no app record for the pid
     int32_t pid = 1;
-    appRunningManager->appRunningRecordMap_.clear();
+    appRunningManager->ClearAppRunningRecordMap();
     ret = appRunningManager->OnRenderProcessExitedByPid(pid);
     EXPECT_EQ(ret, nullptr);
 
@@ -1237,8 +1237,8 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_OnRenderProcessExitedByP
     std::shared_ptr<ApplicationInfo> appInfo = std::make_shared<ApplicationInfo>();
     auto appRunningRecord = std::make_shared<AppRunningRecord>(appInfo, RECORD_ID, PROCESS_NAME);
     appRunningRecord->appLifeCycleDeal_ = std::make_shared<AppLifeCycleDeal>();
-    appRunningManager->appRunningRecordMap_.clear();
-    appRunningManager->appRunningRecordMap_.insert(std::make_pair(0, appRunningRecord));
+    appRunningManager->ClearAppRunningRecordMap();
+    appRunningManager->AddAppRunningRecord(0, appRunningRecord);
     ret = appRunningManager->OnRenderProcessExitedByPid(pid);
     EXPECT_EQ(ret, nullptr);
 }
@@ -1256,8 +1256,8 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_OnRenderProcessExitedByP
     std::shared_ptr<ApplicationInfo> appInfo = std::make_shared<ApplicationInfo>();
     auto hostRecord = std::make_shared<AppRunningRecord>(appInfo, RECORD_ID, PROCESS_NAME);
     hostRecord->appLifeCycleDeal_ = std::make_shared<AppLifeCycleDeal>();
-    appRunningManager->appRunningRecordMap_.clear();
-    appRunningManager->appRunningRecordMap_.insert(std::make_pair(RECORD_ID, hostRecord));
+    appRunningManager->ClearAppRunningRecordMap();
+    appRunningManager->AddAppRunningRecord(RECORD_ID, hostRecord);
 
     pid_t renderPid = 200;
     int32_t renderUid = 100200;
@@ -1370,8 +1370,8 @@ HWTEST_F(AppRunningManagerFourthTest, ExecuteConfigurationTask_0100, TestSize.Le
     appRecord->appRecordId_ = 0;
     appRecord->appIndex_ = 0;
     appRecord->curState_ = ApplicationState::APP_STATE_BACKGROUND;
-    appRunningManager->appRunningRecordMap_.emplace(0, appRecord);
-    appRunningManager->appRunningRecordMap_.emplace(1, nullptr);
+    appRunningManager->AddAppRunningRecord(0, appRecord);
+    appRunningManager->AddAppRunningRecord(1, nullptr);
     info.bandleName = "KeepAliveApplication";
     info.appIndex = 0;
     userId = 1;
@@ -1453,8 +1453,8 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_CheckMasterProcessAppRun
     record->SetMasterProcess(true);
     record->SetUid(uid);
     abilityInfo.type = AppExecFwk::AbilityType::PAGE;
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     auto ret = appRunningManager_->CheckMasterProcessAppRunningRecordIsExist(APP_NAME_EMPTY, abilityInfo, uid);
     EXPECT_EQ(ret, true);
 
@@ -1462,8 +1462,8 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_CheckMasterProcessAppRun
     record->SetMasterProcess(true);
     record->SetUid(uid);
     abilityInfo.type = AppExecFwk::AbilityType::PAGE;
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->CheckMasterProcessAppRunningRecordIsExist(APP_NAME_EMPTY, abilityInfo, uid);
     EXPECT_EQ(ret, false);
 
@@ -1471,8 +1471,8 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_CheckMasterProcessAppRun
     record->SetMasterProcess(false);
     record->SetUid(uid);
     abilityInfo.type = AppExecFwk::AbilityType::PAGE;
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, record));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, record);
     ret = appRunningManager_->CheckMasterProcessAppRunningRecordIsExist(APP_NAME_EMPTY, abilityInfo, uid);
     EXPECT_EQ(ret, false);
 }
@@ -1507,10 +1507,10 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_FindMasterProcessAppRunn
     recordThree->processType_ = ProcessType::EXTENSION;
     recordThree->SetMasterProcess(true);
     recordThree->SetUid(uid);
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, recordOne));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(TWO, recordTwo));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(THREE, recordThree));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, recordOne);
+    appRunningManager_->AddAppRunningRecord(TWO, recordTwo);
+    appRunningManager_->AddAppRunningRecord(THREE, recordThree);
     auto ret = appRunningManager_->FindMasterProcessAppRunningRecord(APP_NAME_EMPTY, abilityInfo, uid);
     EXPECT_EQ(ret, recordOne);
 }
@@ -1547,10 +1547,10 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_FindMasterProcessAppRunn
     recordThree->SetTimeStamp(-1);
     recordThree->SetMasterProcess(false);
     recordThree->SetUid(uid);
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, recordOne));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(TWO, recordTwo));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(THREE, recordThree));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, recordOne);
+    appRunningManager_->AddAppRunningRecord(TWO, recordTwo);
+    appRunningManager_->AddAppRunningRecord(THREE, recordThree);
     auto ret = appRunningManager_->FindMasterProcessAppRunningRecord(APP_NAME_EMPTY, abilityInfo, uid);
     EXPECT_EQ(ret, recordTwo);
 }
@@ -1587,10 +1587,10 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_FindMasterProcessAppRunn
     recordThree->SetTimeStamp(-1);
     recordThree->SetMasterProcess(false);
     recordThree->SetUid(uid);
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, recordOne));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(TWO, recordTwo));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(THREE, recordThree));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, recordOne);
+    appRunningManager_->AddAppRunningRecord(TWO, recordTwo);
+    appRunningManager_->AddAppRunningRecord(THREE, recordThree);
     auto ret = appRunningManager_->FindMasterProcessAppRunningRecord(APP_NAME_EMPTY, abilityInfo, uid);
     EXPECT_EQ(ret, recordOne);
 }
@@ -1627,10 +1627,10 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_FindMasterProcessAppRunn
     recordThree->SetTimeStamp(-1);
     recordThree->SetMasterProcess(false);
     recordThree->SetUid(uid);
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, recordOne));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(TWO, recordTwo));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(THREE, recordThree));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, recordOne);
+    appRunningManager_->AddAppRunningRecord(TWO, recordTwo);
+    appRunningManager_->AddAppRunningRecord(THREE, recordThree);
     auto ret = appRunningManager_->FindMasterProcessAppRunningRecord(APP_NAME_EMPTY, abilityInfo, uid);
     EXPECT_EQ(ret, recordTwo);
 }
@@ -1667,10 +1667,10 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_FindMasterProcessAppRunn
     recordThree->SetTimeStamp(-1);
     recordThree->SetMasterProcess(false);
     recordThree->SetUid(uid);
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, recordOne));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(TWO, recordTwo));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(THREE, recordThree));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, recordOne);
+    appRunningManager_->AddAppRunningRecord(TWO, recordTwo);
+    appRunningManager_->AddAppRunningRecord(THREE, recordThree);
     auto ret = appRunningManager_->FindMasterProcessAppRunningRecord(APP_NAME_EMPTY, abilityInfo, uid);
     EXPECT_EQ(ret, recordThree);
 }
@@ -1707,10 +1707,10 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_FindMasterProcessAppRunn
     recordThree->SetTimeStamp(-1);
     recordThree->SetMasterProcess(false);
     recordThree->SetUid(uid);
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, recordOne));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(TWO, recordTwo));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(THREE, recordThree));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, recordOne);
+    appRunningManager_->AddAppRunningRecord(TWO, recordTwo);
+    appRunningManager_->AddAppRunningRecord(THREE, recordThree);
     auto ret = appRunningManager_->FindMasterProcessAppRunningRecord(APP_NAME_EMPTY, abilityInfo, uid);
     EXPECT_EQ(ret, recordOne);
 }
@@ -1750,10 +1750,10 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_FindMasterProcessAppRunn
     recordThree->SetMasterProcess(false);
     recordThree->SetUid(uid);
     recordThree->appRecordId_ = 2;
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, recordOne));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(TWO, recordTwo));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(THREE, recordThree));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, recordOne);
+    appRunningManager_->AddAppRunningRecord(TWO, recordTwo);
+    appRunningManager_->AddAppRunningRecord(THREE, recordThree);
     auto ret = appRunningManager_->FindMasterProcessAppRunningRecord(APP_NAME_EMPTY, abilityInfo, uid);
     EXPECT_EQ(ret, recordOne);
 }
@@ -1803,10 +1803,10 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_FindMasterProcessAppRunn
     recordThree->processType_ = ProcessType::EXTENSION;
     recordThree->SetMasterProcess(false);
     recordThree->SetUid(uid);
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, recordOne));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(TWO, recordTwo));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(THREE, recordThree));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, recordOne);
+    appRunningManager_->AddAppRunningRecord(TWO, recordTwo);
+    appRunningManager_->AddAppRunningRecord(THREE, recordThree);
     auto ret = appRunningManager_->FindMasterProcessAppRunningRecord(APP_NAME_EMPTY, abilityInfo, uid);
     EXPECT_EQ(ret, nullptr);
 }
@@ -1839,10 +1839,10 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_FindMainProcessAppRunnin
     recordThree->processType_ = ProcessType::EXTENSION;
     recordThree->SetMainProcess(false);
     recordThree->SetUid(uid);
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, recordOne));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(TWO, recordTwo));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(THREE, recordThree));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, recordOne);
+    appRunningManager_->AddAppRunningRecord(TWO, recordTwo);
+    appRunningManager_->AddAppRunningRecord(THREE, recordThree);
     auto ret = appRunningManager_->FindMainProcessAppRunningRecord(uid);
     EXPECT_EQ(ret, recordOne);
 }
@@ -1869,9 +1869,9 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_FindMainProcessAppRunnin
     recordTwo->processType_ = ProcessType::EXTENSION;
     recordTwo->SetMainProcess(false);
     recordTwo->SetUid(uid);
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, recordOne));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(TWO, recordTwo));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, recordOne);
+    appRunningManager_->AddAppRunningRecord(TWO, recordTwo);
     auto ret = appRunningManager_->FindMainProcessAppRunningRecord(uid);
     EXPECT_EQ(ret, nullptr);
 }
@@ -1884,7 +1884,7 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_FindMainProcessAppRunnin
 HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_FindMainProcessAppRunningRecord_0300, TestSize.Level1)
 {
     int uid = 100;
-    appRunningManager_->appRunningRecordMap_.clear();
+    appRunningManager_->ClearAppRunningRecordMap();
     auto ret = appRunningManager_->FindMainProcessAppRunningRecord(uid);
     EXPECT_EQ(ret, nullptr);
 }
@@ -1906,8 +1906,8 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_FindMainProcessAppRunnin
     recordOne->processType_ = ProcessType::NORMAL;
     recordOne->SetMainProcess(true);
     recordOne->SetUid(otherUid);
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, recordOne));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, recordOne);
     auto ret = appRunningManager_->FindMainProcessAppRunningRecord(uid);
     EXPECT_EQ(ret, nullptr);
 }
@@ -1935,9 +1935,9 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_FindMainProcessAppRunnin
     recordTwo->processType_ = ProcessType::NORMAL;
     recordTwo->SetMainProcess(true);
     recordTwo->SetUid(uid);
-    appRunningManager_->appRunningRecordMap_.clear();
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(ONE, recordOne));
-    appRunningManager_->appRunningRecordMap_.insert(std::make_pair(TWO, recordTwo));
+    appRunningManager_->ClearAppRunningRecordMap();
+    appRunningManager_->AddAppRunningRecord(ONE, recordOne);
+    appRunningManager_->AddAppRunningRecord(TWO, recordTwo);
     auto ret = appRunningManager_->FindMainProcessAppRunningRecord(uid);
     EXPECT_EQ(ret, recordTwo);
 }
@@ -1991,7 +1991,7 @@ HWTEST_F(AppRunningManagerFourthTest, CheckAppRunningRecordForSpecifiedProcess_0
     appRecord->SetUid(uid);
     appRecord->SetCustomProcessFlag(customProcessFlag);
 
-    appRunningManager->appRunningRecordMap_.emplace(111, appRecord);
+    appRunningManager->AddAppRunningRecord(111, appRecord);
     auto result = appRunningManager->CheckAppRunningRecordForSpecifiedProcess(uid, instanceKey, customProcessFlag);
     EXPECT_NE(result, nullptr);
 }
@@ -2047,7 +2047,7 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_GetRunningProcessInfoByT
     auto recordId = AppRecordId::Create();
     auto appRecord = std::make_shared<AppRunningRecord>(appInfo, recordId, PROCESS_NAME);
     appRecord->curState_ = ApplicationState::APP_STATE_FOREGROUND;
-    appRunningManager->appRunningRecordMap_.emplace(recordId, appRecord);
+    appRunningManager->AddAppRunningRecord(recordId, appRecord);
 
     AppExecFwk::RunningProcessInfo info;
     appRunningManager->GetRunningProcessInfoByToken(token, info);
@@ -2131,8 +2131,8 @@ HWTEST_F(AppRunningManagerFourthTest, AppRunningManager_GetAllAppRunningRecordCo
     auto appRecord1 = std::make_shared<AppRunningRecord>(appInfo, recordId1, PROCESS_NAME);
     auto recordId2 = AppRecordId::Create();
     auto appRecord2 = std::make_shared<AppRunningRecord>(appInfo, recordId2, PROCESS_NAME);
-    appRunningManager->appRunningRecordMap_.emplace(recordId1, appRecord1);
-    appRunningManager->appRunningRecordMap_.emplace(recordId2, appRecord2);
+    appRunningManager->AddAppRunningRecord(recordId1, appRecord1);
+    appRunningManager->AddAppRunningRecord(recordId2, appRecord2);
 
     count = appRunningManager->GetAllAppRunningRecordCountByBundleName(BUNDLE_NAME);
     EXPECT_EQ(count, 2);
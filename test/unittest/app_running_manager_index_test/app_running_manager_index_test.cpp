@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#include "app_running_manager.h"
+#include "app_running_record.h"
+#undef private
+
+#include "mock_ability_token.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+const std::string BUNDLE_NAME_PREFIX = "com.example.index";
+const std::string MODULE_NAME = "entry";
+constexpr int32_t BASE_TEST_UID = 20010000;
+constexpr pid_t BASE_TEST_PID = 10000;
+}
+
+class AppRunningManagerIndexTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override;
+    void TearDown() override;
+
+    std::shared_ptr<AppRunningRecord> CreateRecord(int32_t index, sptr<IRemoteObject> &token);
+    void CreateRecords(int32_t count);
+    std::shared_ptr<AppRunningRecord> ScanByPid(pid_t pid);
+    std::shared_ptr<AppRunningRecord> ScanByToken(const sptr<IRemoteObject> &token);
+
+    std::shared_ptr<AppRunningManager> appRunningManager_ = nullptr;
+    std::vector<sptr<IRemoteObject>> tokens_;
+};
+
+void AppRunningManagerIndexTest::SetUp()
+{
+    appRunningManager_ = std::make_shared<AppRunningManager>();
+    tokens_.clear();
+}
+
+void AppRunningManagerIndexTest::TearDown()
+{
+    appRunningManager_.reset();
+    tokens_.clear();
+}
+
+std::shared_ptr<AppRunningRecord> AppRunningManagerIndexTest::CreateRecord(int32_t index,
+    sptr<IRemoteObject> &token)
+{
+    auto appInfo = std::make_shared<ApplicationInfo>();
+    appInfo->bundleName = BUNDLE_NAME_PREFIX + std::to_string(index);
+    appInfo->name = appInfo->bundleName;
+    BundleInfo bundleInfo;
+    auto appRecord = appRunningManager_->CreateAppRunningRecord(appInfo, appInfo->bundleName, bundleInfo, "");
+    if (appRecord == nullptr) {
+        return nullptr;
+    }
+    appRunningManager_->SetAppRunningRecordPid(appRecord, BASE_TEST_PID + index);
+    appRecord->SetUid(BASE_TEST_UID + index);
+    auto abilityInfo = std::make_shared<AbilityInfo>();
+    abilityInfo->name = "MainAbility";
+    HapModuleInfo hapModuleInfo;
+    hapModuleInfo.moduleName = MODULE_NAME;
+    token = sptr<MockAbilityToken>::MakeSptr();
+    appRecord->AddModule(appInfo, abilityInfo, token, hapModuleInfo, nullptr, 0);
+    return appRecord;
+}
+
+void AppRunningManagerIndexTest::CreateRecords(int32_t count)
+{
+    for (int32_t i = 0; i < count; i++) {
+        sptr<IRemoteObject> token = nullptr;
+        CreateRecord(i, token);
+        tokens_.push_back(token);
+    }
+}
+
+std::shared_ptr<AppRunningRecord> AppRunningManagerIndexTest::ScanByPid(pid_t pid)
+{
+    std::lock_guard guard(appRunningManager_->runningRecordMapMutex_);
+    for (const auto &item : appRunningManager_->appRunningRecordMap_) {
+        if (item.second->GetPid() == pid) {
+            return item.second;
+        }
+    }
+    return nullptr;
+}
+
+std::shared_ptr<AppRunningRecord> AppRunningManagerIndexTest::ScanByToken(const sptr<IRemoteObject> &token)
+{
+    std::lock_guard guard(appRunningManager_->runningRecordMapMutex_);
+    for (const auto &item : appRunningManager_->appRunningRecordMap_) {
+        if (item.second->GetAbilityRunningRecordByToken(token)) {
+            return item.second;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @tc.name: AppRunningManagerIndex_GetAppRunningRecordByPid_0100
+ * @tc.desc: Pid lookup returns the record and follows pid changes and removal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AppRunningManagerIndexTest, AppRunningManagerIndex_GetAppRunningRecordByPid_0100, TestSize.Level1)
+{
+    sptr<IRemoteObject> token = nullptr;
+    auto appRecord = CreateRecord(1, token);
+    ASSERT_NE(appRecord, nullptr);
+    EXPECT_EQ(appRunningManager_->GetAppRunningRecordByPid(BASE_TEST_PID + 1), appRecord);
+
+    appRunningManager_->SetAppRunningRecordPid(appRecord, BASE_TEST_PID + 2);
+    EXPECT_EQ(appRecord->GetPid(), BASE_TEST_PID + 2);
+    EXPECT_EQ(appRunningManager_->GetAppRunningRecordByPid(BASE_TEST_PID + 1), nullptr);
+    EXPECT_EQ(appRunningManager_->GetAppRunningRecordByPid(BASE_TEST_PID + 2), appRecord);
+    EXPECT_EQ(appRunningManager_->pidIndex_.size(), 1);
+
+    appRunningManager_->RemoveAppRunningRecordById(appRecord->GetRecordId());
+    EXPECT_EQ(appRunningManager_->GetAppRunningRecordByPid(BASE_TEST_PID + 2), nullptr);
+    EXPECT_TRUE(appRunningManager_->pidIndex_.empty());
+}
+
+/**
+ * @tc.name: AppRunningManagerIndex_GetAppRunningRecordByAbilityToken_0100
+ * @tc.desc: Token lookup returns the owning record and drops the index entry on terminate and removal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AppRunningManagerIndexTest, AppRunningManagerIndex_GetAppRunningRecordByAbilityToken_0100,
+    TestSize.Level1)
+{
+    sptr<IRemoteObject> token = nullptr;
+    auto appRecord = CreateRecord(1, token);
+    ASSERT_NE(appRecord, nullptr);
+    EXPECT_EQ(appRunningManager_->GetAppRunningRecordByAbilityToken(token), appRecord);
+    EXPECT_EQ(appRunningManager_->GetAppRunningRecordByAbilityToken(token), appRecord);
+    EXPECT_EQ(appRunningManager_->GetAppRunningRecordByAbilityToken(nullptr), nullptr);
+
+    sptr<IRemoteObject> unknownToken = sptr<MockAbilityToken>::MakeSptr();
+    EXPECT_EQ(appRunningManager_->GetAppRunningRecordByAbilityToken(unknownToken), nullptr);
+
+    appRecord->TerminateAbility(token, true, true);
+    EXPECT_EQ(appRunningManager_->GetAppRunningRecordByAbilityToken(token), nullptr);
+    EXPECT_TRUE(appRunningManager_->abilityTokenIndex_.empty());
+
+    auto abilityInfo = std::make_shared<AbilityInfo>();
+    abilityInfo->name = "SecondAbility";
+    HapModuleInfo hapModuleInfo;
+    hapModuleInfo.moduleName = MODULE_NAME;
+    sptr<IRemoteObject> secondToken = sptr<MockAbilityToken>::MakeSptr();
+    appRecord->AddModule(appRecord->GetApplicationInfo(), abilityInfo, secondToken, hapModuleInfo, nullptr, 0);
+    EXPECT_EQ(appRunningManager_->GetAppRunningRecordByAbilityToken(secondToken), appRecord);
+
+    appRunningManager_->RemoveAppRunningRecordById(appRecord->GetRecordId());
+    EXPECT_EQ(appRunningManager_->GetAppRunningRecordByAbilityToken(secondToken), nullptr);
+    EXPECT_TRUE(appRunningManager_->abilityTokenIndex_.empty());
+    EXPECT_TRUE(appRunningManager_->recordIndexEntries_.empty());
+}
+
+/**
+ * @tc.name: AppRunningManagerIndex_GetAppRunningRecordsByUid_0100
+ * @tc.desc: Uid index follows SetUid and keeps record id order.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AppRunningManagerIndexTest, AppRunningManagerIndex_GetAppRunningRecordsByUid_0100, TestSize.Level1)
+{
+    sptr<IRemoteObject> token = nullptr;
+    auto firstRecord = CreateRecord(1, token);
+    auto secondRecord = CreateRecord(2, token);
+    ASSERT_NE(firstRecord, nullptr);
+    ASSERT_NE(secondRecord, nullptr);
+
+    secondRecord->SetUid(BASE_TEST_UID + 1);
+    auto records = appRunningManager_->GetAppRunningRecordsByUid(BASE_TEST_UID + 1);
+    ASSERT_EQ(records.size(), 2);
+    EXPECT_EQ(records[0], firstRecord);
+    EXPECT_EQ(records[1], secondRecord);
+    EXPECT_TRUE(appRunningManager_->GetAppRunningRecordsByUid(BASE_TEST_UID + 2).empty());
+    EXPECT_TRUE(appRunningManager_->CheckAppRunningRecordIsExistByUid(BASE_TEST_UID + 1));
+
+    secondRecord->SetUid(BASE_TEST_UID + 3);
+    EXPECT_EQ(secondRecord->GetUid(), BASE_TEST_UID + 3);
+    appRunningManager_->RemoveAppRunningRecordById(secondRecord->GetRecordId());
+    EXPECT_EQ(appRunningManager_->uidIndex_.count(BASE_TEST_UID + 3), 0);
+    EXPECT_EQ(appRunningManager_->GetAppRunningRecordsByUid(BASE_TEST_UID + 1).size(), 1);
+
+    appRunningManager_->ClearAppRunningRecordMap();
+    EXPECT_FALSE(appRunningManager_->CheckAppRunningRecordIsExistByUid(BASE_TEST_UID + 1));
+
+    // the uid still changes once the manager is gone
+    appRunningManager_.reset();
+    firstRecord->SetUid(BASE_TEST_UID + 4);
+    EXPECT_EQ(firstRecord->GetUid(), BASE_TEST_UID + 4);
+}
+
+/**
+ * @tc.name: AppRunningManagerIndex_GetAppRunningRecordsByBundleName_0100
+ * @tc.desc: Bundle name index covers records added with AddAppRunningRecord, a used record id is rejected.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AppRunningManagerIndexTest, AppRunningManagerIndex_GetAppRunningRecordsByBundleName_0100,
+    TestSize.Level1)
+{
+    sptr<IRemoteObject> token = nullptr;
+    auto appRecord = CreateRecord(1, token);
+    ASSERT_NE(appRecord, nullptr);
+    EXPECT_EQ(appRunningManager_->GetAllAppRunningRecordCountByBundleName(BUNDLE_NAME_PREFIX + "1"), 1);
+
+    auto appInfo = std::make_shared<ApplicationInfo>();
+    appInfo->bundleName = BUNDLE_NAME_PREFIX + "1";
+    auto recordId = AppRecordId::Create();
+    auto otherRecord = std::make_shared<AppRunningRecord>(appInfo, recordId, appInfo->bundleName);
+    EXPECT_TRUE(appRunningManager_->AddAppRunningRecord(recordId, otherRecord));
+    EXPECT_FALSE(appRunningManager_->AddAppRunningRecord(recordId, appRecord));
+    EXPECT_TRUE(appRunningManager_->AddAppRunningRecord(AppRecordId::Create(), nullptr));
+    EXPECT_EQ(appRunningManager_->GetAllAppRunningRecordCountByBundleName(BUNDLE_NAME_PREFIX + "1"), 2);
+    EXPECT_TRUE(appRunningManager_->GetAppRunningStateByBundleName(BUNDLE_NAME_PREFIX + "1"));
+    EXPECT_FALSE(appRunningManager_->GetAppRunningStateByBundleName(BUNDLE_NAME_PREFIX + "2"));
+}
+
+/**
+ * @tc.name: AppRunningManagerIndex_GetAppRunningRecordSnapshot_0100
+ * @tc.desc: Snapshot is shared until the record list changes, also in the middle of the list.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AppRunningManagerIndexTest, AppRunningManagerIndex_GetAppRunningRecordSnapshot_0100, TestSize.Level1)
+{
+    sptr<IRemoteObject> token = nullptr;
+    auto appRecord = CreateRecord(1, token);
+    ASSERT_NE(appRecord, nullptr);
+    auto firstSnapshot = appRunningManager_->GetAppRunningRecordSnapshot();
+    ASSERT_NE(firstSnapshot, nullptr);
+    EXPECT_EQ(firstSnapshot->size(), 1);
+    EXPECT_EQ(appRunningManager_->GetAppRunningRecordSnapshot(), firstSnapshot);
+
+    auto secondRecord = CreateRecord(2, token);
+    auto secondSnapshot = appRunningManager_->GetAppRunningRecordSnapshot();
+    EXPECT_NE(secondSnapshot, firstSnapshot);
+    EXPECT_EQ(firstSnapshot->size(), 1);
+    EXPECT_EQ(secondSnapshot->size(), 2);
+
+    // a writer replacing the record in the middle keeps the size, the first and the last record
+    ASSERT_NE(CreateRecord(3, token), nullptr);
+    auto thirdSnapshot = appRunningManager_->GetAppRunningRecordSnapshot();
+    auto replacedId = secondRecord->GetRecordId();
+    appRunningManager_->RemoveAppRunningRecordById(replacedId);
+    appRunningManager_->AddAppRunningRecord(replacedId, nullptr);
+    auto fourthSnapshot = appRunningManager_->GetAppRunningRecordSnapshot();
+    EXPECT_NE(fourthSnapshot, thirdSnapshot);
+    ASSERT_EQ(fourthSnapshot->size(), 3);
+    EXPECT_EQ(fourthSnapshot->at(replacedId), nullptr);
+    EXPECT_EQ(thirdSnapshot->at(replacedId), secondRecord);
+
+    // an add rejected for a used record id leaves the list and its snapshot as they are
+    EXPECT_FALSE(appRunningManager_->AddAppRunningRecord(replacedId, appRecord));
+    EXPECT_EQ(appRunningManager_->GetAppRunningRecordSnapshot(), fourthSnapshot);
+
+    appRunningManager_->AddAppRunningRecord(AppRecordId::Create(), appRecord);
+    EXPECT_EQ(appRunningManager_->GetAppRunningRecordSnapshot()->size(), 4);
+
+    appRunningManager_->ClearAppRunningRecordMap();
+    EXPECT_TRUE(appRunningManager_->GetAppRunningRecordSnapshot()->empty());
+}
+
+/**
+ * @tc.name: AppRunningManagerIndex_LookupMatchesScan_0100
+ * @tc.desc: Pid, token and uid lookups return the record a full scan finds at 50, 200 and 1000 records.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AppRunningManagerIndexTest, AppRunningManagerIndex_LookupMatchesScan_0100, TestSize.Level1)
+{
+    for (int32_t count : { 50, 200, 1000 }) {
+        appRunningManager_ = std::make_shared<AppRunningManager>();
+        tokens_.clear();
+        CreateRecords(count);
+        ASSERT_EQ(tokens_.size(), static_cast<size_t>(count));
+        for (int32_t i = 0; i < count; i++) {
+            auto appRecord = appRunningManager_->GetAppRunningRecordByPid(BASE_TEST_PID + i);
+            ASSERT_NE(appRecord, nullptr);
+            EXPECT_EQ(appRecord, ScanByPid(BASE_TEST_PID + i));
+            EXPECT_EQ(appRecord->GetBundleName(), BUNDLE_NAME_PREFIX + std::to_string(i));
+            EXPECT_EQ(appRunningManager_->GetAppRunningRecordByAbilityToken(tokens_[i]), appRecord);
+            EXPECT_EQ(ScanByToken(tokens_[i]), appRecord);
+            auto uidRecords = appRunningManager_->GetAppRunningRecordsByUid(BASE_TEST_UID + i);
+            ASSERT_EQ(uidRecords.size(), 1);
+            EXPECT_EQ(uidRecords[0], appRecord);
+        }
+        EXPECT_EQ(appRunningManager_->GetAppRunningRecordByPid(BASE_TEST_PID + count), nullptr);
+        EXPECT_EQ(appRunningManager_->pidIndex_.size(), static_cast<size_t>(count));
+        EXPECT_EQ(appRunningManager_->abilityTokenIndex_.size(), static_cast<size_t>(count));
+    }
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
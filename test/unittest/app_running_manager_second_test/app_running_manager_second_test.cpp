@@ -141,9 +141,9 @@ HWTEST_F(AppRunningManagerSecondTest, AppRunningManager_CheckAppRunningRecordIsE
      * @tc.steps: step5. appRunningRecord is nullptr
      * @tc.expected: step5. expect CheckAppRunningRecordIsExistByUid false
      */
-    appRunningManager->appRunningRecordMap_.clear();
+    appRunningManager->ClearAppRunningRecordMap();
     auto recordId = AppRecordId::Create();
-    appRunningManager->appRunningRecordMap_.emplace(recordId, nullptr);
+    appRunningManager->AddAppRunningRecord(recordId, nullptr);
     ret = appRunningManager->CheckAppRunningRecordIsExistByUid(USR_ID_101);
     EXPECT_FALSE(ret);
     TAG_LOGI(AAFwkTag::TEST, "AppRunningManager_CheckAppRunningRecordIsExistByUid_0100 end");
@@ -207,9 +207,9 @@ HWTEST_F(AppRunningManagerSecondTest, AppRunningManager_CheckAppCloneRunningReco
      * @tc.steps: step6. SetRestartAppFlag false, SetRestartAppFlag true.
      * @tc.expected: step6. expect isRunning false
      */
-    appRunningManager->appRunningRecordMap_.clear();
+    appRunningManager->ClearAppRunningRecordMap();
     auto recordId = AppRecordId::Create();
-    appRunningManager->appRunningRecordMap_.emplace(recordId, nullptr);
+    appRunningManager->AddAppRunningRecord(recordId, nullptr);
     appRunningManager->CheckAppCloneRunningRecordIsExistByBundleName("", 0, isRunning);
     EXPECT_FALSE(isRunning);
 
@@ -217,7 +217,7 @@ HWTEST_F(AppRunningManagerSecondTest, AppRunningManager_CheckAppCloneRunningReco
      * @tc.steps: step7. clear appRunningRecordMap_.
      * @tc.expected: step7. expect isRunning false
      */
-    appRunningManager->appRunningRecordMap_.clear();
+    appRunningManager->ClearAppRunningRecordMap();
     int32_t ret = appRunningManager->CheckAppCloneRunningRecordIsExistByBundleName("", 0, isRunning);
     EXPECT_EQ(ret, ERR_OK);
 }
@@ -440,7 +440,7 @@ HWTEST_F(AppRunningManagerSecondTest, AppRunningManager_NotifyMemoryLevel_0100,
     std::shared_ptr<AppRunningRecord> record =
         appRunningManager->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
     auto recordId = AppRecordId::Create();
-    appRunningManager->appRunningRecordMap_.emplace(recordId, nullptr);
+    appRunningManager->AddAppRunningRecord(recordId, nullptr);
     std::shared_ptr<AppRunningRecord> record2 =
         appRunningManager->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
     record2->priorityObject_ = nullptr;
@@ -465,7 +465,7 @@ HWTEST_F(AppRunningManagerSecondTest, AppRunningManager_NotifyProcMemoryLevel_01
     appInfo_->bundleName = BUNDLE_NAME;
     appRunningManager->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
     auto recordId = AppRecordId::Create();
-    appRunningManager->appRunningRecordMap_.emplace(recordId, nullptr);
+    appRunningManager->AddAppRunningRecord(recordId, nullptr);
     std::shared_ptr<AppRunningRecord> record2 =
         appRunningManager->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
     record2->priorityObject_ = nullptr;
@@ -596,7 +596,7 @@ HWTEST_F(AppRunningManagerSecondTest, AppRunningManager_NotifyLoadRepairPatch_03
     appInfo_->bundleName = BUNDLE_NAME;
     appRunningManager->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
     auto recordId = AppRecordId::Create();
-    appRunningManager->appRunningRecordMap_.emplace(recordId, nullptr);
+    appRunningManager->AddAppRunningRecord(recordId, nullptr);
 
     /**
      * @tc.steps: step1. Initialize AppRunningManager instance
@@ -679,7 +679,7 @@ HWTEST_F(AppRunningManagerSecondTest, AppRunningManager_NotifyHotReloadPage_0300
     appInfo_->bundleName = BUNDLE_NAME;
     appRunningManager->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
     auto recordId = AppRecordId::Create();
-    appRunningManager->appRunningRecordMap_.emplace(recordId, nullptr);
+    appRunningManager->AddAppRunningRecord(recordId, nullptr);
 
     /**
      * @tc.steps: step1. Initialize AppRunningManager instance
@@ -765,7 +765,7 @@ HWTEST_F(AppRunningManagerSecondTest, AppRunningManager_NotifyUnLoadRepairPatch_
     appInfo_->bundleName = BUNDLE_NAME;
     appRunningManager->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
     auto recordId = AppRecordId::Create();
-    appRunningManager->appRunningRecordMap_.emplace(recordId, nullptr);
+    appRunningManager->AddAppRunningRecord(recordId, nullptr);
 
     /**
      * @tc.steps: step1. Initialize AppRunningManager instance
@@ -869,7 +869,7 @@ HWTEST_F(AppRunningManagerSecondTest, AppRunningManager_IsApplicationFirstForegr
     auto appRunningManager = std::make_shared<AppRunningManager>();
     EXPECT_NE(appRunningManager, nullptr);
     auto recordId = AppRecordId::Create();
-    appRunningManager->appRunningRecordMap_.emplace(recordId, nullptr);
+    appRunningManager->AddAppRunningRecord(recordId, nullptr);
 
     /**
      * @tc.steps: step1. Initialize AppRunningManager instance
@@ -897,7 +897,7 @@ HWTEST_F(AppRunningManagerSecondTest, AppRunningManager_IsApplicationFirstForegr
     auto appRunningManager = std::make_shared<AppRunningManager>();
     EXPECT_NE(appRunningManager, nullptr);
     auto recordId = AppRecordId::Create();
-    appRunningManager->appRunningRecordMap_.emplace(recordId, nullptr);
+    appRunningManager->AddAppRunningRecord(recordId, nullptr);
 
     /**
      * @tc.steps: step1. Initialize AppRunningManager instance
@@ -1140,7 +1140,7 @@ HWTEST_F(AppRunningManagerSecondTest, AppRunningManager_IsApplicationBackground_
     auto appRunningManager = std::make_shared<AppRunningManager>();
     EXPECT_NE(appRunningManager, nullptr);
     auto recordId = AppRecordId::Create();
-    appRunningManager->appRunningRecordMap_.emplace(recordId, nullptr);
+    appRunningManager->AddAppRunningRecord(recordId, nullptr);
 
     /**
      * @tc.steps: step1. Initialize AppRunningManager instance
@@ -1286,7 +1286,7 @@ HWTEST_F(AppRunningManagerSecondTest, AppRunningManager_IsApplicationFirstFocuse
     auto appRunningManager = std::make_shared<AppRunningManager>();
     EXPECT_NE(appRunningManager, nullptr);
     auto recordId = AppRecordId::Create();
-    appRunningManager->appRunningRecordMap_.emplace(recordId, nullptr);
+    appRunningManager->AddAppRunningRecord(recordId, nullptr);
 
     /**
      * @tc.steps: step2. Initialize AppRunningManager instance
@@ -1435,7 +1435,7 @@ HWTEST_F(AppRunningManagerSecondTest, AppRunningManager_IsApplicationUnfocused_0
     auto appRunningManager = std::make_shared<AppRunningManager>();
     EXPECT_NE(appRunningManager, nullptr);
     auto recordId = AppRecordId::Create();
-    appRunningManager->appRunningRecordMap_.emplace(recordId, nullptr);
+    appRunningManager->AddAppRunningRecord(recordId, nullptr);
 
     /**
      * @tc.steps: step2. Initialize AppRunningManager instance
@@ -1545,7 +1545,7 @@ HWTEST_F(AppRunningManagerSecondTest, AppRunningManager_SignRestartAppFlag_0100,
     auto appRunningManager = std::make_shared<AppRunningManager>();
     EXPECT_NE(appRunningManager, nullptr);
     auto recordId = AppRecordId::Create();
-    appRunningManager->appRunningRecordMap_.emplace(recordId, nullptr);
+    appRunningManager->AddAppRunningRecord(recordId, nullptr);
 
     /**
      * @tc.steps: step2. Initialize AppRunningManager instance
@@ -1681,7 +1681,7 @@ HWTEST_F(AppRunningManagerSecondTest, AppRunningManager_NeedNotifyAppStateChange
     auto appRunningManager = std::make_shared<AppRunningManager>();
     EXPECT_NE(appRunningManager, nullptr);
     auto recordId = AppRecordId::Create();
-    appRunningManager->appRunningRecordMap_.emplace(recordId, nullptr);
+    appRunningManager->AddAppRunningRecord(recordId, nullptr);
 
     /**
      * @tc.steps: step1. Initialize AppRunningManager instance
@@ -1799,14 +1799,14 @@ HWTEST_F(AppRunningManagerSecondTest, AppRunningManager_SignRestartProcess_0100,
     EXPECT_EQ(ret, ERR_INVALID_VALUE);
 
     auto recordId = AppRecordId::Create();
-    appRunningManager->appRunningRecordMap_.emplace(recordId, nullptr);
+    appRunningManager->AddAppRunningRecord(recordId, nullptr);
     ret = appRunningManager->SignRestartProcess(pid);
     EXPECT_EQ(ret, ERR_INVALID_VALUE);
 
     appInfo_->bundleName = BUNDLE_NAME;
     auto record = appRunningManager->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
     recordId = AppRecordId::Create();
-    appRunningManager->appRunningRecordMap_.emplace(recordId, record);
+    appRunningManager->AddAppRunningRecord(recordId, record);
     ret = appRunningManager->SignRestartProcess(pid);
     EXPECT_EQ(ret, ERR_INVALID_VALUE);
 
@@ -1831,14 +1831,14 @@ HWTEST_F(AppRunningManagerSecondTest, AppRunningManager_ProcessExitByPid_0100, T
     EXPECT_EQ(ret, false);
 
     auto recordId = AppRecordId::Create();
-    appRunningManager->appRunningRecordMap_.emplace(recordId, nullptr);
+    appRunningManager->AddAppRunningRecord(recordId, nullptr);
     ret = appRunningManager->ProcessExitByPid(pid, config);
     EXPECT_EQ(ret, false);
 
     appInfo_->bundleName = BUNDLE_NAME;
     auto record = appRunningManager->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
     recordId = AppRecordId::Create();
-    appRunningManager->appRunningRecordMap_.emplace(recordId, record);
+    appRunningManager->AddAppRunningRecord(recordId, record);
     ret = appRunningManager->ProcessExitByPid(pid, config);
     EXPECT_EQ(ret, false);
 
@@ -75,7 +75,7 @@ HWTEST_F(AppRunningManagerTest, AppRunningManager_SetAttachAppDebug_0100, TestSi
     int32_t recordId = RECORD_ID;
     std::string processName;
     auto appRunningRecord = std::make_shared<AppRunningRecord>(appInfo, recordId, processName);
-    appRunningManager->appRunningRecordMap_.insert(make_pair(RECORD_ID, appRunningRecord));
+    appRunningManager->AddAppRunningRecord(RECORD_ID, appRunningRecord);
     appRunningManager->SetAttachAppDebug(bundleName, true, false);
     for (const auto &item : appRunningManager->appRunningRecordMap_) {
         const auto &appRecord = item.second;
@@ -101,7 +101,7 @@ HWTEST_F(AppRunningManagerTest, AppRunningManager_SetAttachAppDebug_0200, TestSi
     int32_t recordId = RECORD_ID;
     std::string processName;
     auto appRunningRecord = std::make_shared<AppRunningRecord>(appInfo, recordId, processName);
-    appRunningManager->appRunningRecordMap_.insert(make_pair(RECORD_ID, appRunningRecord));
+    appRunningManager->AddAppRunningRecord(RECORD_ID, appRunningRecord);
     appRunningManager->SetAttachAppDebug(bundleName, isAttachDebug, false);
     for (const auto &item : appRunningManager->appRunningRecordMap_) {
         const auto &appRecord = item.second;
@@ -128,7 +128,7 @@ HWTEST_F(AppRunningManagerTest, AppRunningManager_GetAppDebugInfoByBundleName_01
     int32_t recordId = RECORD_ID;
     std::string processName;
     auto appRunningRecord = std::make_shared<AppRunningRecord>(appInfo, recordId, processName);
-    appRunningManager->appRunningRecordMap_.insert(make_pair(RECORD_ID, appRunningRecord));
+    appRunningManager->AddAppRunningRecord(RECORD_ID, appRunningRecord);
     appRunningManager->GetAppDebugInfosByBundleName(bundleName, isDetachDebug);
     EXPECT_EQ(appRunningManager->appRunningRecordMap_.size(), RECORD_MAP_SIZE);
     for (const auto &item : appRunningManager->appRunningRecordMap_) {
@@ -154,7 +154,7 @@ HWTEST_F(AppRunningManagerTest, AppRunningManager_GetAbilityTokensByBundleName_0
     int32_t recordId = RECORD_ID;
     std::string processName;
     auto appRunningRecord = std::make_shared<AppRunningRecord>(appInfo, recordId, processName);
-    appRunningManager->appRunningRecordMap_.insert(make_pair(RECORD_ID, appRunningRecord));
+    appRunningManager->AddAppRunningRecord(RECORD_ID, appRunningRecord);
     appRunningManager->GetAbilityTokensByBundleName(bundleName, abilityTokens);
     for (const auto &item : appRunningManager->appRunningRecordMap_) {
         const auto &appRecord = item.second;
@@ -186,7 +186,7 @@ HWTEST_F(AppRunningManagerTest, AppRunningManager_OnWindowVisibilityChanged_0100
     EXPECT_NE(appRunningRecord, nullptr);
     appRunningRecord->curState_ = ApplicationState::APP_STATE_BACKGROUND;
     appRunningRecord->GetPriorityObject()->SetPid(PID);
-    appRunningManager->appRunningRecordMap_.emplace(recordId, appRunningRecord);
+    appRunningManager->AddAppRunningRecord(recordId, appRunningRecord);
 
     // 3. construct WindowVisibilityInfos
     std::vector<sptr<OHOS::Rosen::WindowVisibilityInfo>> windowVisibilityInfos;
@@ -223,7 +223,7 @@ HWTEST_F(AppRunningManagerTest, AppRunningManager_GetAppRunningRecordByChildProc
     pid_t childPid = 201;
     childRecord->pid_ = childPid;
     appRecord->AddChildProcessRecord(childPid, childRecord);
-    appRunningManager->appRunningRecordMap_.insert(make_pair(RECORD_ID, appRecord));
+    appRunningManager->AddAppRunningRecord(RECORD_ID, appRecord);
 
     auto record = appRunningManager->GetAppRunningRecordByChildProcessPid(childPid);
     EXPECT_NE(record, nullptr);
@@ -263,13 +263,13 @@ HWTEST_F(AppRunningManagerTest, AppRunningManager_UpdateConfiguration_0100, Test
     std::string processName;
     Configuration config;
     auto appRunningRecord = std::make_shared<AppRunningRecord>(appInfo, recordId, processName);
-    appRunningManager->appRunningRecordMap_.emplace(recordId, appRunningRecord);
-    appRunningManager->appRunningRecordMap_.emplace(++recordId, nullptr);
+    appRunningManager->AddAppRunningRecord(recordId, appRunningRecord);
+    appRunningManager->AddAppRunningRecord(++recordId, nullptr);
     appRunningRecord->SetState(ApplicationState::APP_STATE_READY);
-    appRunningManager->appRunningRecordMap_.emplace(++recordId, appRunningRecord);
+    appRunningManager->AddAppRunningRecord(++recordId, appRunningRecord);
     appInfo->name = "com.shell_assistant";
     appRunningRecord = std::make_shared<AppRunningRecord>(appInfo, recordId, processName);
-    appRunningManager->appRunningRecordMap_.emplace(++recordId, appRunningRecord);
+    appRunningManager->AddAppRunningRecord(++recordId, appRunningRecord);
     EXPECT_EQ(appRunningManager->appRunningRecordMap_.size(), recordId);
     EXPECT_TRUE(appRunningManager != nullptr);
 }
@@ -303,10 +303,10 @@ HWTEST_F(AppRunningManagerTest, AppRunningManager_UpdateConfiguration_0300, Test
     std::string processName;
     Configuration config;
     auto appRunningRecord = std::make_shared<AppRunningRecord>(appInfo, recordId, processName);
-    appRunningManager->appRunningRecordMap_.emplace(recordId, appRunningRecord);
+    appRunningManager->AddAppRunningRecord(recordId, appRunningRecord);
     appRunningRecord = std::make_shared<AppRunningRecord>(appInfo, recordId, processName);
     appRunningRecord->SetState(ApplicationState::APP_STATE_BACKGROUND);
-    appRunningManager->appRunningRecordMap_.emplace(++recordId, appRunningRecord);
+    appRunningManager->AddAppRunningRecord(++recordId, appRunningRecord);
     auto ret = appRunningManager->UpdateConfiguration(config);
     EXPECT_EQ(ret, ERR_OK);
     EXPECT_EQ(appRunningManager->updateConfigurationDelayedMap_[0], false);
@@ -692,12 +692,12 @@ HWTEST_F(AppRunningManagerTest, IsAppProcessesAllCached_0100, TestSize.Level1)
     appRunningRecord2->SetSupportedProcessCache(true);
     appRunningRecord2->SetUIAbilityLaunched(true);
 
-    appRunningManager->appRunningRecordMap_.insert(make_pair(recordId1, appRunningRecord1));
+    appRunningManager->AddAppRunningRecord(recordId1, appRunningRecord1);
     std::set<std::shared_ptr<AppRunningRecord>> cachedSet;
     cachedSet.insert(appRunningRecord1);
     EXPECT_EQ(appRunningManager->IsAppProcessesAllCached(appInfo->bundleName, appInfo->uid, cachedSet), true);
 
-    appRunningManager->appRunningRecordMap_.insert(make_pair(recordId2, appRunningRecord2));
+    appRunningManager->AddAppRunningRecord(recordId2, appRunningRecord2);
     EXPECT_EQ(appRunningManager->IsAppProcessesAllCached(appInfo->bundleName, appInfo->uid, cachedSet), false);
 }
 
@@ -767,7 +767,7 @@ HWTEST_F(AppRunningManagerTest, HandleChildRelation_0100, TestSize.Level1)
     pid_t childPid = 201;
     childRecord->pid_ = childPid;
     appRecord->AddChildProcessRecord(childPid, childRecord);
-    appRunningManager->appRunningRecordMap_.insert(make_pair(RECORD_ID, appRecord));
+    appRunningManager->AddAppRunningRecord(RECORD_ID, appRecord);
     appRunningManager->HandleChildRelation(childRecord, appRecord);
     auto record = appRunningManager->GetAppRunningRecordByChildProcessPid(childPid);
     EXPECT_NE(record, nullptr);
@@ -802,7 +802,7 @@ HWTEST_F(AppRunningManagerTest, AppRunningManager_IsAppExist_0200, TestSize.Leve
     int32_t recordId = RECORD_ID;
     std::string processName = "test.process";
     auto appRecord = std::make_shared<AppRunningRecord>(appInfo, recordId, processName);
-    appRunningManager->appRunningRecordMap_.emplace(recordId, appRecord);
+    appRunningManager->AddAppRunningRecord(recordId, appRecord);
 
     bool result = appRunningManager->IsAppExist(1000);
     EXPECT_EQ(result, true);
@@ -823,7 +823,7 @@ HWTEST_F(AppRunningManagerTest, AppRunningManager_IsAppExist_0300, TestSize.Leve
     int32_t recordId = RECORD_ID;
     std::string processName = "test.process";
     auto appRecord = std::make_shared<AppRunningRecord>(appInfo, recordId, processName);
-    appRunningManager->appRunningRecordMap_.emplace(recordId, appRecord);
+    appRunningManager->AddAppRunningRecord(recordId, appRecord);
 
     bool result = appRunningManager->IsAppExist(2000);
     EXPECT_EQ(result, false);
@@ -846,7 +846,7 @@ HWTEST_F(AppRunningManagerTest, AppRunningManager_GetAppRunningRecordByPid_0200,
     auto priorityObj = appRecord->GetPriorityObject();
     ASSERT_NE(priorityObj, nullptr);
     appRecord->GetPriorityObject()->SetPid(1000);
-    appRunningManager->appRunningRecordMap_.emplace(recordId, appRecord);
+    appRunningManager->AddAppRunningRecord(recordId, appRecord);
 
     auto result = appRunningManager->GetAppRunningRecordByPid(1000);
     EXPECT_NE(result, nullptr);
@@ -870,7 +870,7 @@ HWTEST_F(AppRunningManagerTest, AppRunningManager_GetAppRunningRecordByPid_0300,
     auto priorityObj = appRecord->GetPriorityObject();
     ASSERT_NE(priorityObj, nullptr);
     priorityObj->SetPid(1000);
-    appRunningManager->appRunningRecordMap_.emplace(recordId, appRecord);
+    appRunningManager->AddAppRunningRecord(recordId, appRecord);
 
     auto result = appRunningManager->GetAppRunningRecordByPid(2000);
     EXPECT_EQ(result, nullptr);
@@ -906,8 +906,8 @@ HWTEST_F(AppRunningManagerTest, AppRunningManager_GetAppRunningRecordMap_0200, T
     std::string processName = "test.process";
     auto appRecord1 = std::make_shared<AppRunningRecord>(appInfo, recordId1, processName);
     auto appRecord2 = std::make_shared<AppRunningRecord>(appInfo, recordId2, processName);
-    appRunningManager->appRunningRecordMap_.emplace(recordId1, appRecord1);
-    appRunningManager->appRunningRecordMap_.emplace(recordId2, appRecord2);
+    appRunningManager->AddAppRunningRecord(recordId1, appRecord1);
+    appRunningManager->AddAppRunningRecord(recordId2, appRecord2);
 
     auto result = appRunningManager->GetAppRunningRecordMap();
     EXPECT_EQ(result.size(), 2);
@@ -927,7 +927,7 @@ HWTEST_F(AppRunningManagerTest, AppRunningManager_ClearAppRunningRecordMap_0100,
     int32_t recordId = RECORD_ID;
     std::string processName = "test.process";
     auto appRecord = std::make_shared<AppRunningRecord>(appInfo, recordId, processName);
-    appRunningManager->appRunningRecordMap_.emplace(recordId, appRecord);
+    appRunningManager->AddAppRunningRecord(recordId, appRecord);
 
     EXPECT_EQ(appRunningManager->appRunningRecordMap_.size(), 1);
     appRunningManager->ClearAppRunningRecordMap();
@@ -1000,7 +1000,7 @@ HWTEST_F(AppRunningManagerTest, AppRunningManager_GetForegroundApplications_0200
     std::string processName = "test.process";
     auto appRecord = std::make_shared<AppRunningRecord>(appInfo, recordId, processName);
     appRecord->curState_ = ApplicationState::APP_STATE_FOREGROUND;
-    appRunningManager->appRunningRecordMap_.emplace(recordId, appRecord);
+    appRunningManager->AddAppRunningRecord(recordId, appRecord);
 
     std::vector<AppStateData> list;
     appRunningManager->GetForegroundApplications(list);
@@ -1024,7 +1024,7 @@ HWTEST_F(AppRunningManagerTest, AppRunningManager_GetForegroundApplications_0300
     std::string processName = "test.process";
     auto appRecord = std::make_shared<AppRunningRecord>(appInfo, recordId, processName);
     appRecord->curState_ = ApplicationState::APP_STATE_BACKGROUND;
-    appRunningManager->appRunningRecordMap_.emplace(recordId, appRecord);
+    appRunningManager->AddAppRunningRecord(recordId, appRecord);
 
     std::vector<AppStateData> list;
     appRunningManager->GetForegroundApplications(list);
@@ -1097,7 +1097,7 @@ HWTEST_F(AppRunningManagerTest, GetAllAbilityInfos_0300, TestSize.Level1)
     std::string processName = "test.app";
     auto appRecord = std::make_shared<AppRunningRecord>(appInfo, recordId, processName);
     appRecord->GetPriorityObject()->SetPid(1001);
-    appRunningManager->appRunningRecordMap_.emplace(recordId, appRecord);
+    appRunningManager->AddAppRunningRecord(recordId, appRecord);
 
     std::vector<AppExecFwk::AbilityStateData> infos;
     int32_t pid = 1001;
@@ -1121,7 +1121,7 @@ HWTEST_F(AppRunningManagerTest, GetAllAbilityInfos_0400, TestSize.Level1)
     std::string processName = "test.app";
     auto appRecord = std::make_shared<AppRunningRecord>(appInfo, recordId, processName);
     appRecord->GetPriorityObject()->SetPid(1001);
-    appRunningManager->appRunningRecordMap_.emplace(recordId, appRecord);
+    appRunningManager->AddAppRunningRecord(recordId, appRecord);
 
     std::vector<AppExecFwk::AbilityStateData> infos;
     auto ret = appRunningManager->GetAllAbilityInfos(-1, infos);
@@ -137,15 +137,15 @@ HWTEST_F(AppRunningManagerThirdTest, AppRunningManager_OnChildProcessExitedByPid
     EXPECT_EQ(appRunningManager->OnChildProcessExitedByPid(PID), nullptr);
 
     // appRecord null in map
-    appRunningManager->appRunningRecordMap_.clear();
+    appRunningManager->ClearAppRunningRecordMap();
     appRunningRecord = nullptr;
-    appRunningManager->appRunningRecordMap_.emplace(PID, appRunningRecord);
+    appRunningManager->AddAppRunningRecord(PID, appRunningRecord);
     EXPECT_EQ(appRunningManager->OnChildProcessExitedByPid(PID), nullptr);
 
     // appRecord valid, childProcessRecordMap empty
     appRunningRecord = std::make_shared<AppRunningRecord>(appInfo_, USR_ID_100, PROCESS_NAME);
-    appRunningManager->appRunningRecordMap_.clear();
-    appRunningManager->appRunningRecordMap_.emplace(PID, appRunningRecord);
+    appRunningManager->ClearAppRunningRecordMap();
+    appRunningManager->AddAppRunningRecord(PID, appRunningRecord);
     appRunningRecord->childProcessRecordMap_.clear();
     EXPECT_EQ(appRunningManager->OnChildProcessExitedByPid(PID), nullptr);
 
@@ -157,7 +157,7 @@ HWTEST_F(AppRunningManagerThirdTest, AppRunningManager_OnChildProcessExitedByPid
     appRunningRecord->childProcessRecordMap_.clear();
     appRunningRecord->childProcessRecordMap_.emplace(PID + 1, childRecord);
     EXPECT_EQ(appRunningManager->OnChildProcessExitedByPid(PID), nullptr);
-    appRunningManager->appRunningRecordMap_.clear();
+    appRunningManager->ClearAppRunningRecordMap();
     TAG_LOGI(AAFwkTag::TEST, "AppRunningManager_OnChildProcessExitedByPid_0100 end");
 }
 
@@ -171,10 +171,10 @@ HWTEST_F(AppRunningManagerThirdTest, AppRunningManager_GetAppRunningUniqueIdByPi
     TAG_LOGI(AAFwkTag::TEST, "AppRunningManager_GetAppRunningUniqueIdByPid_0100 start");
     auto appRunningManager = std::make_shared<AppRunningManager>();
     auto appRunningRecord = std::make_shared<AppRunningRecord>(appInfo_, USR_ID_100, PROCESS_NAME);
-    appRunningManager->appRunningRecordMap_.emplace(PID, appRunningRecord);
+    appRunningManager->AddAppRunningRecord(PID, appRunningRecord);
     std::string appRunningUniqueId = "test";
     EXPECT_EQ(appRunningManager->GetAppRunningUniqueIdByPid(PID, appRunningUniqueId), ERR_OK);
-    appRunningManager->appRunningRecordMap_.clear();
+    appRunningManager->ClearAppRunningRecordMap();
     EXPECT_EQ(appRunningManager->GetAppRunningUniqueIdByPid(PID, appRunningUniqueId), ERR_INVALID_VALUE);
     TAG_LOGI(AAFwkTag::TEST, "AppRunningManager_GetAppRunningUniqueIdByPid_0100 end");
 }
@@ -189,7 +189,7 @@ HWTEST_F(AppRunningManagerThirdTest, AppRunningManager_DumpIpcAllStart_0100, Tes
     TAG_LOGI(AAFwkTag::TEST, "AppRunningManager_DumpIpcAllStart_0100 start");
     auto appRunningManager = std::make_shared<AppRunningManager>();
     auto appRunningRecord = std::make_shared<AppRunningRecord>(appInfo_, USR_ID_100, PROCESS_NAME);
-    appRunningManager->appRunningRecordMap_.emplace(PID, appRunningRecord);
+    appRunningManager->AddAppRunningRecord(PID, appRunningRecord);
     appRunningRecord->appLifeCycleDeal_ = std::make_shared<AppLifeCycleDeal>();
     appRunningRecord->appLifeCycleDeal_->appThread_ = new (std::nothrow) MockAppScheduler();
     std::string result;
@@ -209,7 +209,7 @@ HWTEST_F(AppRunningManagerThirdTest, AppRunningManager_DumpIpcAllStop_0100, Test
     TAG_LOGI(AAFwkTag::TEST, "AppRunningManager_DumpIpcAllStop_0100 start");
     auto appRunningManager = std::make_shared<AppRunningManager>();
     auto appRunningRecord = std::make_shared<AppRunningRecord>(appInfo_, USR_ID_100, PROCESS_NAME);
-    appRunningManager->appRunningRecordMap_.emplace(PID, appRunningRecord);
+    appRunningManager->AddAppRunningRecord(PID, appRunningRecord);
     appRunningRecord->appLifeCycleDeal_ = std::make_shared<AppLifeCycleDeal>();
     appRunningRecord->appLifeCycleDeal_->appThread_ = new (std::nothrow) MockAppScheduler();
     std::string result;
@@ -229,7 +229,7 @@ HWTEST_F(AppRunningManagerThirdTest, AppRunningManager_DumpIpcAllStat_0100, Test
     TAG_LOGI(AAFwkTag::TEST, "AppRunningManager_DumpIpcAllStat_0100 start");
     auto appRunningManager = std::make_shared<AppRunningManager>();
     auto appRunningRecord = std::make_shared<AppRunningRecord>(appInfo_, USR_ID_100, PROCESS_NAME);
-    appRunningManager->appRunningRecordMap_.emplace(PID, appRunningRecord);
+    appRunningManager->AddAppRunningRecord(PID, appRunningRecord);
     appRunningRecord->appLifeCycleDeal_ = std::make_shared<AppLifeCycleDeal>();
     appRunningRecord->appLifeCycleDeal_->appThread_ = new (std::nothrow) MockAppScheduler();
     std::string result;
@@ -249,7 +249,7 @@ HWTEST_F(AppRunningManagerThirdTest, AppRunningManager_DumpIpcStart_0100, TestSi
     TAG_LOGI(AAFwkTag::TEST, "AppRunningManager_DumpIpcStart_0100 start");
     auto appRunningManager = std::make_shared<AppRunningManager>();
     auto appRunningRecord = std::make_shared<AppRunningRecord>(appInfo_, USR_ID_100, PROCESS_NAME);
-    appRunningManager->appRunningRecordMap_.emplace(PID, appRunningRecord);
+    appRunningManager->AddAppRunningRecord(PID, appRunningRecord);
     appRunningRecord->appLifeCycleDeal_ = std::make_shared<AppLifeCycleDeal>();
     appRunningRecord->appLifeCycleDeal_->appThread_ = new (std::nothrow) MockAppScheduler();
     std::string result;
@@ -274,26 +274,26 @@ HWTEST_F(AppRunningManagerThirdTest, AppRunningManager_ProcessExitByTokenIdAndIn
     std::list<pid_t> pids;
     bool clearPageStack = false;
     auto recordId = AppRecordId::Create();
-    appRunningManager->appRunningRecordMap_.emplace(recordId, nullptr);
+    appRunningManager->AddAppRunningRecord(recordId, nullptr);
 
     auto recordIdOne = AppRecordId::Create();
     std::shared_ptr<AppRunningRecord> record =
     appRunningManager->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
     record->appInfo_ = nullptr;
-    appRunningManager->appRunningRecordMap_.emplace(recordIdOne, record);
+    appRunningManager->AddAppRunningRecord(recordIdOne, record);
 
     auto recordIdTwo = AppRecordId::Create();
     record = appRunningManager->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
     record->appInfo_ = std::make_shared<ApplicationInfo>();
     record->appInfo_->accessTokenId = 1;
-    appRunningManager->appRunningRecordMap_.emplace(recordIdTwo, record);
+    appRunningManager->AddAppRunningRecord(recordIdTwo, record);
 
     auto recordIdThree = AppRecordId::Create();
     record = appRunningManager->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
     record->appInfo_ = std::make_shared<ApplicationInfo>();
     record->appInfo_->accessTokenId = accessTokenId;
     record->appInfo_->multiAppMode.multiAppModeType = MultiAppModeType::UNSPECIFIED;
-    appRunningManager->appRunningRecordMap_.emplace(recordIdThree, record);
+    appRunningManager->AddAppRunningRecord(recordIdThree, record);
 
     auto recordIdFour = AppRecordId::Create();
     instanceKey = "123";
@@ -302,7 +302,7 @@ HWTEST_F(AppRunningManagerThirdTest, AppRunningManager_ProcessExitByTokenIdAndIn
     record->appInfo_->accessTokenId = accessTokenId;
     record->appInfo_->multiAppMode.multiAppModeType = MultiAppModeType::MULTI_INSTANCE;
     record->instanceKey_ = "456";
-    appRunningManager->appRunningRecordMap_.emplace(recordIdFour, record);
+    appRunningManager->AddAppRunningRecord(recordIdFour, record);
 
     auto ret = appRunningManager->ProcessExitByTokenIdAndInstance(accessTokenId, instanceKey, pids, clearPageStack);
     EXPECT_EQ(ret, false);
@@ -330,7 +330,7 @@ HWTEST_F(AppRunningManagerThirdTest, AppRunningManager_ProcessExitByTokenIdAndIn
     record->appInfo_->multiAppMode.multiAppModeType = MultiAppModeType::MULTI_INSTANCE;
     record->priorityObject_ = nullptr;
     record->instanceKey_ = instanceKey;
-    appRunningManager->appRunningRecordMap_.emplace(recordIdFive, record);
+    appRunningManager->AddAppRunningRecord(recordIdFive, record);
 
     auto recordIdSix = AppRecordId::Create();
     record = appRunningManager->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
@@ -340,7 +340,7 @@ HWTEST_F(AppRunningManagerThirdTest, AppRunningManager_ProcessExitByTokenIdAndIn
     record->priorityObject_ = std::make_shared<PriorityObject>();
     record->instanceKey_ = instanceKey;
     record->priorityObject_->pid_ = 0;
-    appRunningManager->appRunningRecordMap_.emplace(recordIdSix, record);
+    appRunningManager->AddAppRunningRecord(recordIdSix, record);
 
     auto recordIdSeven = AppRecordId::Create();
     record = appRunningManager->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
@@ -350,7 +350,7 @@ HWTEST_F(AppRunningManagerThirdTest, AppRunningManager_ProcessExitByTokenIdAndIn
     record->priorityObject_ = std::make_shared<PriorityObject>();
     record->instanceKey_ = instanceKey;
     record->priorityObject_->pid_ = 1;
-    appRunningManager->appRunningRecordMap_.emplace(recordIdSeven, record);
+    appRunningManager->AddAppRunningRecord(recordIdSeven, record);
     auto ret = appRunningManager->ProcessExitByTokenIdAndInstance(accessTokenId, instanceKey, pids, clearPageStack);
     EXPECT_EQ(ret, true);
     clearPageStack = true;
@@ -410,7 +410,7 @@ HWTEST_F(AppRunningManagerThirdTest, AppRunningManager_GetRunningProcessInfoByCh
     record->appInfo_ = std::make_shared<ApplicationInfo>();
     record->priorityObject_ = std::make_shared<PriorityObject>();
     record->priorityObject_->pid_ = 1;
-    appRunningManager->appRunningRecordMap_.emplace(recordId, record);
+    appRunningManager->AddAppRunningRecord(recordId, record);
     ret = appRunningManager->GetRunningProcessInfoByChildProcessPid(childPid, info);
     EXPECT_EQ(ret, ERR_OK);
     TAG_LOGI(AAFwkTag::TEST, "AppRunningManager_GetRunningProcessInfoByChildProcessPid_0100 end");
@@ -437,7 +437,7 @@ HWTEST_F(AppRunningManagerThirdTest, AppRunningManager_DumpJsHeapMemory_0100, Te
     record->appInfo_ = std::make_shared<ApplicationInfo>();
     record->priorityObject_ = std::make_shared<PriorityObject>();
     record->priorityObject_->pid_ = 1;
-    appRunningManager->appRunningRecordMap_.emplace(recordId, record);
+    appRunningManager->AddAppRunningRecord(recordId, record);
     ret = appRunningManager->DumpJsHeapMemory(info);
     EXPECT_EQ(ret, ERR_OK);
     TAG_LOGI(AAFwkTag::TEST, "AppRunningManager_DumpJsHeapMemory_0100 end");
@@ -464,7 +464,7 @@ HWTEST_F(AppRunningManagerThirdTest, AppRunningManager_DumpJsHandleMap_0100, Tes
     record->appInfo_ = std::make_shared<ApplicationInfo>();
     record->priorityObject_ = std::make_shared<PriorityObject>();
     record->priorityObject_->pid_ = 1;
-    appRunningManager->appRunningRecordMap_.emplace(recordId, record);
+    appRunningManager->AddAppRunningRecord(recordId, record);
     ret = appRunningManager->DumpJsHandleMap(info);
     EXPECT_EQ(ret, ERR_OK);
     TAG_LOGI(AAFwkTag::TEST, "AppRunningManager_DumpJsHandleMap_0100 end");
@@ -491,7 +491,7 @@ HWTEST_F(AppRunningManagerThirdTest, AppRunningManager_DumpCjHeapMemory_0100, Te
     record->appInfo_ = std::make_shared<ApplicationInfo>();
     record->priorityObject_ = std::make_shared<PriorityObject>();
     record->priorityObject_->pid_ = 1;
-    appRunningManager->appRunningRecordMap_.emplace(recordId, record);
+    appRunningManager->AddAppRunningRecord(recordId, record);
     ret = appRunningManager->DumpCjHeapMemory(info);
     EXPECT_EQ(ret, ERR_OK);
     TAG_LOGI(AAFwkTag::TEST, "AppRunningManager_DumpCjHeapMemory_0100 end");
@@ -519,7 +519,7 @@ HWTEST_F(AppRunningManagerThirdTest, AppRunningManager_DumpMem_0100, TestSize.Le
     record->appInfo_ = std::make_shared<ApplicationInfo>();
     record->priorityObject_ = std::make_shared<PriorityObject>();
     record->priorityObject_->pid_ = 1;
-    appRunningManager->appRunningRecordMap_.emplace(recordId, record);
+    appRunningManager->AddAppRunningRecord(recordId, record);
     ret = appRunningManager->DumpMem(info, callback);
     EXPECT_EQ(ret, ERR_OK);
     TAG_LOGI(AAFwkTag::TEST, "AppRunningManager_DumpMem_0100 end");
@@ -541,15 +541,15 @@ HWTEST_F(AppRunningManagerThirdTest, AppRunningManager_UpdateConfigurationByBund
     auto recordId = AppRecordId::Create();
     auto record = appRunningManager->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
     record->SetState(ApplicationState::APP_STATE_CREATE);
-    appRunningManager->appRunningRecordMap_.emplace(recordId, record);
+    appRunningManager->AddAppRunningRecord(recordId, record);
 
     auto recordIdOne = AppRecordId::Create();
-    appRunningManager->appRunningRecordMap_.emplace(recordIdOne, nullptr);
+    appRunningManager->AddAppRunningRecord(recordIdOne, nullptr);
 
     auto recordIdTwo = AppRecordId::Create();
     record = appRunningManager->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
     record->SetState(ApplicationState::APP_STATE_READY);
-    appRunningManager->appRunningRecordMap_.emplace(recordIdTwo, record);
+    appRunningManager->AddAppRunningRecord(recordIdTwo, record);
 
     auto ret = appRunningManager->UpdateConfigurationByBundleName(config, name, appIndex);
     EXPECT_EQ(ret, ERR_OK);
@@ -570,7 +570,7 @@ HWTEST_F(AppRunningManagerThirdTest, AppRunningManager_UpdateConfigurationByBund
     const std::string name = "123";
     int32_t appIndex = 0;
     auto recordIdOne = AppRecordId::Create();
-    appRunningManager->appRunningRecordMap_.emplace(recordIdOne, nullptr);
+    appRunningManager->AddAppRunningRecord(recordIdOne, nullptr);
     auto recordIdTwo = AppRecordId::Create();
     auto record = appRunningManager->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
     record->SetState(ApplicationState::APP_STATE_READY);
@@ -578,7 +578,7 @@ HWTEST_F(AppRunningManagerThirdTest, AppRunningManager_UpdateConfigurationByBund
     record->appInfo_->name = "123";
     record->mainBundleName_ = "123";
     record->appIndex_ = 0;
-    appRunningManager->appRunningRecordMap_.emplace(recordIdTwo, record);
+    appRunningManager->AddAppRunningRecord(recordIdTwo, record);
     auto recordIdThree = AppRecordId::Create();
     record = appRunningManager->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
     record->SetState(ApplicationState::APP_STATE_READY);
@@ -586,7 +586,7 @@ HWTEST_F(AppRunningManagerThirdTest, AppRunningManager_UpdateConfigurationByBund
     record->appInfo_->name = "1234";
     record->mainBundleName_ = "123";
     record->appIndex_ = 0;
-    appRunningManager->appRunningRecordMap_.emplace(recordIdThree, record);
+    appRunningManager->AddAppRunningRecord(recordIdThree, record);
     auto recordIdFour = AppRecordId::Create();
     record = appRunningManager->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
     record->SetState(ApplicationState::APP_STATE_READY);
@@ -594,7 +594,7 @@ HWTEST_F(AppRunningManagerThirdTest, AppRunningManager_UpdateConfigurationByBund
     record->appInfo_->name = "123";
     record->mainBundleName_ = "123";
     record->appIndex_ = 1;
-    appRunningManager->appRunningRecordMap_.emplace(recordIdFour, record);
+    appRunningManager->AddAppRunningRecord(recordIdFour, record);
     auto recordIdFive = AppRecordId::Create();
     record = appRunningManager->CreateAppRunningRecord(appInfo_, PROCESS_NAME, bundleInfo, "");
     record->SetState(ApplicationState::APP_STATE_READY);
@@ -602,7 +602,7 @@ HWTEST_F(AppRunningManagerThirdTest, AppRunningManager_UpdateConfigurationByBund
     record->appInfo_->name = "123";
     record->mainBundleName_ = "1234";
     record->appIndex_ = 1;
-    appRunningManager->appRunningRecordMap_.emplace(recordIdFive, record);
+    appRunningManager->AddAppRunningRecord(recordIdFive, record);
     auto ret = appRunningManager->UpdateConfigurationByBundleName(config, name, appIndex);
     EXPECT_EQ(ret, ERR_INVALID_VALUE);
     TAG_LOGI(AAFwkTag::TEST, "AppRunningManager_UpdateConfigurationByBundleName_0200 end");
@@ -638,7 +638,7 @@ HWTEST_F(AppRunningManagerThirdTest, AppRunningManager_GetAppRunningRecordByChil
     auto appRunningRecordChild = std::make_shared<AppRunningRecord>(appInfo_, USR_ID_100, PROCESS_NAME);
     appRunningRecord->childAppRecordMap_[PID] = appRunningRecordChild;
     EXPECT_NE(appRunningRecord, nullptr);
-    appRunningManager->appRunningRecordMap_.emplace(PID, appRunningRecord);
+    appRunningManager->AddAppRunningRecord(PID, appRunningRecord);
     pid_t pid = PID;
     auto ret = appRunningManager->GetAppRunningRecordByChildRecordPid(pid);
     EXPECT_NE(ret, nullptr);
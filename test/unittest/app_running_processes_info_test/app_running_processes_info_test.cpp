@@ -360,7 +360,7 @@ HWTEST_F(AppRunningProcessesInfoTest, UpdateAppRunningRecord_005, TestSize.Level
     record->SetState(ApplicationState::APP_STATE_BACKGROUND);
     record->SetApplicationClient(GetMockedAppSchedulerClient());
     pid_t pid = 16738;
-    record->GetPriorityObject()->SetPid(pid);
+    service_->appRunningManager_->SetAppRunningRecordPid(record, pid);
     RunningProcessInfo info;
     service_->appRunningManager_->GetRunningProcessInfoByPid(pid, info);
     EXPECT_TRUE(info.processName_ == GetTestProcessName());
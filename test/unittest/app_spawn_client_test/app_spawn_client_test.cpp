@@ -1100,5 +1100,120 @@ HWTEST_F(AppSpawnClientTest, SendAppSpawnUninstallDebugHapMsg_001, TestSize.Leve
     auto ret = appSpawnClient->SendAppSpawnUninstallDebugHapMsg(userId);
     ASSERT_EQ(ret, ERR_OK);
 }
+
+static AppSpawnStartMsg BuildTemplateStartMsg()
+{
+    AppSpawnStartMsg startMsg;
+    startMsg.bundleName = "com.example.template";
+    startMsg.uid = 20010001;
+    for (int32_t i = 0; i < 4; i++) {
+        BaseSharedBundleInfo hsp;
+        hsp.bundleName = "com.example.hsp" + std::to_string(i);
+        hsp.moduleName = "library";
+        hsp.versionCode = 1000;
+        startMsg.hspList.emplace_back(hsp);
+    }
+    DataGroupInfo dataGroupInfo;
+    dataGroupInfo.dataGroupId = "group.example";
+    dataGroupInfo.uuid = "3e8b6c1d-a7f2-4b09-9d25-7c4e1a0f8b36";
+    dataGroupInfo.gid = 3000;
+    dataGroupInfo.userId = 100;
+    startMsg.dataGroupInfoList.emplace_back(dataGroupInfo);
+    startMsg.appEnv = { { "TSAN_ENABLED", "0" }, { "HWASAN_ENABLED", "0" }, { "UBSAN_ENABLED", "0" } };
+    startMsg.jitPermissionsMap = { { "ohos.permission.jit1", "" }, { "ohos.permission.jit2", "1" } };
+    return startMsg;
+}
+
+/**
+ * @tc.name: GetSpawnMsgTemplate_001
+ * @tc.desc: The template of a bundle is reused while its inputs are unchanged.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AppSpawnClientTest, GetSpawnMsgTemplate_001, TestSize.Level2)
+{
+    auto appSpawnClient = std::make_shared<AppSpawnClient>(false);
+    AppSpawnStartMsg startMsg = BuildTemplateStartMsg();
+    auto msgTemplate = appSpawnClient->GetSpawnMsgTemplate(startMsg);
+    ASSERT_NE(msgTemplate, nullptr);
+    EXPECT_EQ(msgTemplate->hspListJson, DumpHspListToJson(startMsg.hspList));
+    EXPECT_EQ(msgTemplate->dataGroupInfoListJson,
+        DumpDataGroupInfoListToJson(startMsg.dataGroupInfoList, startMsg.isScreenLockDataProtect));
+    EXPECT_EQ(msgTemplate->appEnvJson, DumpAppEnvToJson(startMsg.appEnv));
+    EXPECT_EQ(msgTemplate->jitPermissionsJson, DumpJITPermissionListToJson(startMsg.jitPermissionsMap));
+
+    startMsg.procName = "com.example.template:service";
+    EXPECT_EQ(appSpawnClient->GetSpawnMsgTemplate(startMsg), msgTemplate);
+}
+
+/**
+ * @tc.name: GetSpawnMsgTemplate_002
+ * @tc.desc: A changed input or a bundle change builds a new template.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AppSpawnClientTest, GetSpawnMsgTemplate_002, TestSize.Level2)
+{
+    auto appSpawnClient = std::make_shared<AppSpawnClient>(false);
+    AppSpawnStartMsg startMsg = BuildTemplateStartMsg();
+    auto msgTemplate = appSpawnClient->GetSpawnMsgTemplate(startMsg);
+
+    startMsg.hspList[0].versionCode++;
+    auto upgraded = appSpawnClient->GetSpawnMsgTemplate(startMsg);
+    EXPECT_NE(upgraded, msgTemplate);
+    EXPECT_EQ(upgraded->hspListJson, DumpHspListToJson(startMsg.hspList));
+
+    startMsg.isScreenLockDataProtect = true;
+    auto protectedTemplate = appSpawnClient->GetSpawnMsgTemplate(startMsg);
+    EXPECT_NE(protectedTemplate, upgraded);
+    EXPECT_EQ(protectedTemplate->dataGroupInfoListJson,
+        DumpDataGroupInfoListToJson(startMsg.dataGroupInfoList, true));
+
+    appSpawnClient->ClearSpawnMsgTemplates(startMsg.bundleName);
+    EXPECT_TRUE(appSpawnClient->spawnMsgTemplates_.empty());
+    EXPECT_NE(appSpawnClient->GetSpawnMsgTemplate(startMsg), protectedTemplate);
+}
+
+/**
+ * @tc.name: GetSpawnMsgTemplate_003
+ * @tc.desc: Each bundle and uid keeps its own template, equal to serializing its inputs.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AppSpawnClientTest, GetSpawnMsgTemplate_003, TestSize.Level2)
+{
+    constexpr int32_t bundleCount = 8;
+    auto appSpawnClient = std::make_shared<AppSpawnClient>(false);
+    std::vector<AppSpawnStartMsg> startMsgs;
+    std::vector<std::shared_ptr<const SpawnMsgTemplate>> msgTemplates;
+    for (int32_t i = 0; i < bundleCount; i++) {
+        AppSpawnStartMsg startMsg = BuildTemplateStartMsg();
+        startMsg.bundleName += std::to_string(i / 2);
+        startMsg.uid += i;
+        startMsg.hspList[0].versionCode += i;
+        startMsgs.push_back(startMsg);
+        msgTemplates.push_back(appSpawnClient->GetSpawnMsgTemplate(startMsg));
+        ASSERT_NE(msgTemplates.back(), nullptr);
+    }
+    EXPECT_EQ(appSpawnClient->spawnMsgTemplates_.size(), static_cast<size_t>(bundleCount));
+    for (int32_t i = 0; i < bundleCount; i++) {
+        const auto &startMsg = startMsgs[i];
+        auto msgTemplate = appSpawnClient->GetSpawnMsgTemplate(startMsg);
+        EXPECT_EQ(msgTemplate, msgTemplates[i]);
+        EXPECT_EQ(msgTemplate->hspListJson, DumpHspListToJson(startMsg.hspList));
+        EXPECT_EQ(msgTemplate->dataGroupInfoListJson,
+            DumpDataGroupInfoListToJson(startMsg.dataGroupInfoList, startMsg.isScreenLockDataProtect));
+        EXPECT_EQ(msgTemplate->appEnvJson, DumpAppEnvToJson(startMsg.appEnv));
+        EXPECT_EQ(msgTemplate->jitPermissionsJson, DumpJITPermissionListToJson(startMsg.jitPermissionsMap));
+    }
+
+    // both uids of the first bundle are dropped, the other bundles keep theirs
+    appSpawnClient->ClearSpawnMsgTemplates(startMsgs[0].bundleName);
+    EXPECT_EQ(appSpawnClient->spawnMsgTemplates_.size(), static_cast<size_t>(bundleCount - 2));
+    EXPECT_NE(appSpawnClient->GetSpawnMsgTemplate(startMsgs[1]), msgTemplates[1]);
+    EXPECT_EQ(appSpawnClient->GetSpawnMsgTemplate(startMsgs[2]), msgTemplates[2]);
+
+    AppSpawnStartMsg anonymousMsg = BuildTemplateStartMsg();
+    anonymousMsg.bundleName.clear();
+    EXPECT_NE(appSpawnClient->GetSpawnMsgTemplate(anonymousMsg), nullptr);
+    EXPECT_EQ(appSpawnClient->spawnMsgTemplates_.size(), static_cast<size_t>(bundleCount - 1));
+}
 } // namespace AppExecFwk
 } // namespace OHOS
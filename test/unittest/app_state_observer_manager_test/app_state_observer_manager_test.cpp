@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <future>
 #include <gtest/gtest.h>
 
 #include "ability_foreground_state_observer_proxy.h"
@@ -66,6 +67,55 @@ public:
     }
     MOCK_METHOD(void, OnProcessReused, (const ProcessData &processData), (override));
 };
+class BatchApplicationStateObserver : public MockApplicationStateObserver {
+public:
+    void OnAppStateChanged(const AppStateData &appStateData) override
+    {
+        singleCount_++;
+    }
+    void OnAppStatesChanged(const std::vector<AppStateData> &appStateDataList) override
+    {
+        batches_.push_back(appStateDataList);
+    }
+    int32_t singleCount_ = 0;
+    std::vector<std::vector<AppStateData>> batches_;
+};
+class OrderedApplicationStateObserver : public MockApplicationStateObserver {
+public:
+    void OnAppStarted(const AppStateData &appStateData) override
+    {
+        calls_.push_back("started:" + appStateData.bundleName);
+    }
+    void OnAppStopped(const AppStateData &appStateData) override
+    {
+        calls_.push_back("stopped:" + appStateData.bundleName);
+    }
+    void OnForegroundApplicationChanged(const AppStateData &appStateData) override
+    {
+        calls_.push_back("foreground:" + std::to_string(appStateData.state));
+    }
+    void OnAppStateChanged(const AppStateData &appStateData) override
+    {
+        calls_.push_back("state:" + std::to_string(appStateData.state));
+    }
+    void OnAppStatesChanged(const std::vector<AppStateData> &appStateDataList) override
+    {
+        std::string call = "states:";
+        for (const auto &appStateData : appStateDataList) {
+            call.append(std::to_string(appStateData.state));
+        }
+        calls_.push_back(call);
+    }
+    void OnProcessCreated(const ProcessData &processData) override
+    {
+        calls_.push_back("created:" + std::to_string(processData.pid));
+    }
+    void OnProcessDied(const ProcessData &processData) override
+    {
+        calls_.push_back("died:" + std::to_string(processData.pid));
+    }
+    std::vector<std::string> calls_;
+};
 class AppForegroundStateObserver : public AppForegroundStateObserverStub {
 public:
     AppForegroundStateObserver() = default;
@@ -415,7 +465,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnWindowShow_002, TestSize.Level2)
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     manager->HandleOnWindowShow(appRecord);
 }
 
@@ -451,7 +501,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnWindowHidden_002, TestSize.Level2)
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     manager->HandleOnWindowHidden(appRecord);
 }
 
@@ -510,7 +560,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnAppStarted_001, TestSize.Level2)
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     manager->HandleOnAppStarted(appRecord);
 }
 
@@ -530,7 +580,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnAppStarted_002, TestSize.Level2)
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     manager->HandleOnAppStarted(appRecord);
 }
 
@@ -552,7 +602,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnAppStarted_003, TestSize.Level2)
     std::string bundleName2 = "com.ohos.unittest2";
     appRecord->mainBundleName_ = bundleName1;
     bundleNameList.push_back(bundleName2);
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     manager->HandleOnAppStarted(appRecord);
 }
 
@@ -573,7 +623,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnAppStarted_004, TestSize.Level2)
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(nullptr, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(nullptr, AppStateObserverInfo{0, bundleNameList});
     manager->HandleOnAppStarted(appRecord);
 }
 
@@ -595,7 +645,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnAppStopped_001, TestSize.Level2)
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     manager->HandleOnAppStopped(appRecord);
 }
 
@@ -615,7 +665,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnAppStopped_002, TestSize.Level2)
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     manager->HandleOnAppStopped(appRecord);
 }
 
@@ -637,7 +687,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnAppStopped_003, TestSize.Level2)
     std::string bundleName2 = "com.ohos.unittest2";
     appRecord->mainBundleName_ = bundleName1;
     bundleNameList.push_back(bundleName2);
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     manager->HandleOnAppStopped(appRecord);
 }
 
@@ -658,7 +708,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnAppStopped_004, TestSize.Level2)
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(nullptr, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(nullptr, AppStateObserverInfo{0, bundleNameList});
     manager->HandleOnAppStopped(appRecord);
 }
 
@@ -681,7 +731,7 @@ HWTEST_F(AppSpawnSocketTest, HandleAppStateChanged_001, TestSize.Level2)
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     manager->HandleAppStateChanged(appRecord, state, needNotifyApp, false, false);
 }
 
@@ -704,7 +754,7 @@ HWTEST_F(AppSpawnSocketTest, HandleAppStateChanged_002, TestSize.Level2)
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     manager->HandleAppStateChanged(appRecord, state, needNotifyApp, false, false);
 }
 
@@ -726,7 +776,7 @@ HWTEST_F(AppSpawnSocketTest, HandleAppStateChanged_003, TestSize.Level2)
     bool needNotifyApp = false;
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
-    manager->appStateObserverMap_.emplace(nullptr, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(nullptr, AppStateObserverInfo{0, bundleNameList});
     manager->HandleAppStateChanged(appRecord, state, needNotifyApp, false, false);
 }
 
@@ -748,7 +798,7 @@ HWTEST_F(AppSpawnSocketTest, HandleAppStateChanged_004, TestSize.Level2)
     bool needNotifyApp = false;
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     manager->HandleAppStateChanged(appRecord, state, needNotifyApp, false, false);
 }
 
@@ -771,7 +821,7 @@ HWTEST_F(AppSpawnSocketTest, HandleAppStateChanged_005, TestSize.Level2)
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     manager->HandleAppStateChanged(appRecord, state, needNotifyApp, false, false);
 }
 
@@ -795,7 +845,7 @@ HWTEST_F(AppSpawnSocketTest, HandleAppStateChanged_006, TestSize.Level2)
     std::string bundleName2 = "com.ohos.unittest2";
     appRecord->mainBundleName_ = bundleName1;
     bundleNameList.push_back(bundleName2);
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     manager->HandleAppStateChanged(appRecord, state, needNotifyApp, false, false);
 }
 
@@ -817,7 +867,7 @@ HWTEST_F(AppSpawnSocketTest, HandleAppStateChanged_007, TestSize.Level2)
     bool needNotifyApp = false;
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
-    manager->appStateObserverMap_.emplace(nullptr, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(nullptr, AppStateObserverInfo{0, bundleNameList});
     manager->HandleAppStateChanged(appRecord, state, needNotifyApp, false, false);
 }
 
@@ -858,7 +908,7 @@ HWTEST_F(AppSpawnSocketTest, HandleStateChangedNotifyObserver_001, TestSize.Leve
     std::string bundleName = "com.ohos.unittest";
     abilityStateData.bundleName = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     manager->HandleStateChangedNotifyObserver(abilityStateData, isAbility, false);
 }
 
@@ -879,7 +929,7 @@ HWTEST_F(AppSpawnSocketTest, HandleStateChangedNotifyObserver_002, TestSize.Leve
     std::vector<std::string> bundleNameList;
     std::string bundleName = "com.ohos.unittest";
     abilityStateData.bundleName = bundleName;
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     manager->HandleStateChangedNotifyObserver(abilityStateData, isAbility, false);
 }
 
@@ -902,7 +952,7 @@ HWTEST_F(AppSpawnSocketTest, HandleStateChangedNotifyObserver_003, TestSize.Leve
     std::string bundleName2 = "com.ohos.unittest2";
     abilityStateData.bundleName = bundleName1;
     bundleNameList.push_back(bundleName2);
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     manager->HandleStateChangedNotifyObserver(abilityStateData, isAbility, false);
 }
 
@@ -924,7 +974,7 @@ HWTEST_F(AppSpawnSocketTest, HandleStateChangedNotifyObserver_004, TestSize.Leve
     std::string bundleName = "com.ohos.unittest";
     abilityStateData.bundleName = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(nullptr, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(nullptr, AppStateObserverInfo{0, bundleNameList});
     manager->HandleStateChangedNotifyObserver(abilityStateData, isAbility, false);
 }
 
@@ -986,7 +1036,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessCreated_001, TestSize.Level2)
     std::vector<std::string> bundleNameList;
     std::string bundleName = "com.ohos.unittest";
     data->bundleName = bundleName;
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     manager->HandleOnProcessCreated(data);
 }
 
@@ -1007,7 +1057,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessCreated_002, TestSize.Level2)
     std::string bundleName = "com.ohos.unittest";
     data->bundleName = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     manager->HandleOnProcessCreated(data);
 }
 
@@ -1029,7 +1079,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessCreated_003, TestSize.Level2)
     std::string bundleName2 = "com.ohos.unittest";
     data->bundleName = bundleName1;
     bundleNameList.push_back(bundleName2);
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     manager->HandleOnProcessCreated(data);
 }
 
@@ -1050,7 +1100,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessCreated_004, TestSize.Level2)
     std::string bundleName = "com.ohos.unittest";
     data->bundleName = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(nullptr, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(nullptr, AppStateObserverInfo{0, bundleNameList});
     manager->HandleOnProcessCreated(data);
 }
 
@@ -1088,7 +1138,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessStateChanged_002, TestSize.Level2)
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     auto data = manager->WrapProcessData(appRecord);
     auto applicationInfo = appRecord->GetApplicationInfo();
     BundleType bundleType = applicationInfo != nullptr ? applicationInfo->bundleType : BundleType::APP;
@@ -1111,7 +1161,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessStateChanged_003, TestSize.Level2)
     std::vector<std::string> bundleNameList;
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     auto data = manager->WrapProcessData(appRecord);
     auto applicationInfo = appRecord->GetApplicationInfo();
     BundleType bundleType = applicationInfo != nullptr ? applicationInfo->bundleType : BundleType::APP;
@@ -1136,7 +1186,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessStateChanged_004, TestSize.Level2)
     std::string bundleName2 = "com.ohos.unittest2";
     appRecord->mainBundleName_ = bundleName1;
     bundleNameList.push_back(bundleName2);
-    manager->appStateObserverMap_.emplace(nullptr, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(nullptr, AppStateObserverInfo{0, bundleNameList});
     auto data = manager->WrapProcessData(appRecord);
     BundleType bundleType = BundleType::APP;
     manager->HandleOnProcessStateChanged(data, bundleType, false);
@@ -1159,7 +1209,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessStateChanged_005, TestSize.Level2)
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(nullptr, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(nullptr, AppStateObserverInfo{0, bundleNameList});
     auto data = manager->WrapProcessData(appRecord);
     BundleType bundleType = BundleType::APP;
     manager->HandleOnProcessStateChanged(data, bundleType, false);
@@ -1223,7 +1273,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessDied_001, TestSize.Level2)
     std::vector<std::string> bundleNameList;
     std::string bundleName = "com.ohos.unittest";
     data->bundleName = bundleName;
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     manager->HandleOnProcessDied(data);
 }
 
@@ -1244,7 +1294,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessDied_002, TestSize.Level2)
     std::string bundleName = "com.ohos.unittest";
     data->bundleName = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     manager->HandleOnProcessDied(data);
 }
 
@@ -1266,7 +1316,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessDied_003, TestSize.Level2)
     std::string bundleName2 = "com.ohos.unittest2";
     data->bundleName = bundleName1;
     bundleNameList.push_back(bundleName2);
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     manager->HandleOnProcessDied(data);
 }
 
@@ -1287,7 +1337,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessDied_004, TestSize.Level2)
     std::string bundleName = "com.ohos.unittest";
     data->bundleName = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(nullptr, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(nullptr, AppStateObserverInfo{0, bundleNameList});
     manager->HandleOnProcessDied(data);
 }
 
@@ -1319,7 +1369,7 @@ HWTEST_F(AppSpawnSocketTest, ObserverExist_002, TestSize.Level2)
     auto manager = std::make_shared<AppStateObserverManager>();
     sptr<IApplicationStateObserver> observer = new MockApplicationStateObserver();
     std::vector<std::string> bundleNameList;
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, bundleNameList});
     bool res = manager->ObserverExist(observer);
     EXPECT_TRUE(res);
 }
@@ -1606,7 +1656,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnAppCacheStateChanged_001, TestSize.Level2)
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     manager->HandleOnAppCacheStateChanged(appRecord, ApplicationState::APP_STATE_CREATE);
 }
 
@@ -1626,7 +1676,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnAppCacheStateChanged_002, TestSize.Level2)
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     manager->HandleOnAppCacheStateChanged(appRecord, ApplicationState::APP_STATE_CREATE);
 }
 
@@ -1648,7 +1698,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnAppCacheStateChanged_003, TestSize.Level2)
     std::string bundleName2 = "com.ohos.unittest2";
     appRecord->mainBundleName_ = bundleName1;
     bundleNameList.push_back(bundleName2);
-    manager->appStateObserverMap_.emplace(observer_, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(observer_, AppStateObserverInfo{0, bundleNameList});
     manager->HandleOnAppCacheStateChanged(appRecord, ApplicationState::APP_STATE_CREATE);
 }
 
@@ -1669,7 +1719,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnAppCacheStateChanged_004, TestSize.Level2)
     std::string bundleName = "com.ohos.unittest";
     appRecord->mainBundleName_ = bundleName;
     bundleNameList.push_back(bundleName);
-    manager->appStateObserverMap_.emplace(nullptr, AppStateObserverInfo{0, bundleNameList});
+    manager->AddAppStateObserverLocked(nullptr, AppStateObserverInfo{0, bundleNameList});
     manager->HandleOnAppCacheStateChanged(appRecord, ApplicationState::APP_STATE_CREATE);
 }
 
@@ -1750,7 +1800,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessResued_001, TestSize.Level2)
     auto manager = std::make_shared<AppStateObserverManager>();
     auto* mockObserver = new MockApplicationStateObserver();
     sptr<IApplicationStateObserver> observer = mockObserver;
-    manager->appStateObserverMap_[observer] = AppStateObserverInfo{0, {"com.example"}};
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, {"com.example"}});
     EXPECT_CALL(*mockObserver, OnProcessReused(_)).Times(0);
     auto data = std::make_shared<ProcessData>();
     BundleType bundleType = BundleType::APP;
@@ -1774,7 +1824,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessResued_002, TestSize.Level2)
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
     std::vector<std::string> bundleNames{"com.ohos.unittest"};
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, bundleNames});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, bundleNames});
     EXPECT_CALL(*mockObserver, OnProcessReused(_)).Times(1);
     auto data = manager->WrapProcessData(appRecord);
     auto applicationInfo = appRecord->GetApplicationInfo();
@@ -1799,7 +1849,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessResued_003, TestSize.Level2)
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
     std::vector<std::string> bundleNames;
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, bundleNames});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, bundleNames});
     EXPECT_CALL(*mockObserver, OnProcessReused(_)).Times(1);
     auto data = manager->WrapProcessData(appRecord);
     auto applicationInfo = appRecord->GetApplicationInfo();
@@ -1824,7 +1874,7 @@ HWTEST_F(AppSpawnSocketTest, HandleOnProcessResued_004, TestSize.Level2)
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
     std::vector<std::string> bundleNames{"com.ohos.other"};
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, bundleNames});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, bundleNames});
     EXPECT_CALL(*mockObserver, OnProcessReused(_)).Times(0);
     auto data = manager->WrapProcessData(appRecord);
     auto applicationInfo = appRecord->GetApplicationInfo();
@@ -1890,5 +1940,181 @@ HWTEST_F(AppSpawnSocketTest, OnProcessStateChanged_002, TestSize.Level2)
     std::shared_ptr<AppRunningRecord> appRecord;
     manager->OnProcessStateChanged(appRecord);
 }
+
+/*
+ * Feature: AppStateObserverManager
+ * Function: GetAppStateObserversByBundleName
+ * SubFunction: NA
+ * FunctionPoints: AppStateObserverManager GetAppStateObserversByBundleName
+ * EnvConditions: NA
+ * CaseDescription: Only observers of the bundle and observers without bundle list are returned
+ */
+HWTEST_F(AppSpawnSocketTest, GetAppStateObserversByBundleName_001, TestSize.Level1)
+{
+    auto manager = std::make_shared<AppStateObserverManager>();
+    ASSERT_NE(manager, nullptr);
+    sptr<IApplicationStateObserver> allObserver = new MockApplicationStateObserver();
+    sptr<IApplicationStateObserver> bundleObserver = new MockApplicationStateObserver();
+    sptr<IApplicationStateObserver> otherObserver = new MockApplicationStateObserver();
+    manager->AddAppStateObserverLocked(allObserver, AppStateObserverInfo{1, {}});
+    manager->AddAppStateObserverLocked(bundleObserver, AppStateObserverInfo{2, {"com.test.a", "com.test.b"}});
+    manager->AddAppStateObserverLocked(otherObserver, AppStateObserverInfo{3, {"com.test.c"}});
+
+    auto targets = manager->GetAppStateObserversByBundleName("com.test.b");
+    ASSERT_EQ(targets.size(), 2);
+    std::set<int32_t> uids;
+    for (const auto &target : targets) {
+        uids.insert(target.uid);
+    }
+    EXPECT_EQ(uids, (std::set<int32_t>{1, 2}));
+    EXPECT_EQ(manager->GetAppStateObserversByBundleName("com.test.d").size(), 1);
+
+    manager->EraseAppStateObserverLocked(manager->appStateObserverMap_.find(bundleObserver));
+    EXPECT_EQ(manager->GetAppStateObserversByBundleName("com.test.b").size(), 1);
+}
+
+/*
+ * Feature: AppStateObserverManager
+ * Function: EnqueueAppStateCallback
+ * SubFunction: NA
+ * FunctionPoints: AppStateObserverManager EnqueueAppStateCallback
+ * EnvConditions: NA
+ * CaseDescription: Pending states of one observer are delivered in one batch in order, none is dropped
+ */
+HWTEST_F(AppSpawnSocketTest, EnqueueAppStateCallback_001, TestSize.Level1)
+{
+    auto manager = std::make_shared<AppStateObserverManager>();
+    ASSERT_NE(manager, nullptr);
+    manager->Init();
+    sptr<BatchApplicationStateObserver> observer = new BatchApplicationStateObserver();
+
+    std::promise<void> gate;
+    auto gateFuture = gate.get_future().share();
+    manager->handler_->SubmitTask([gateFuture]() { gateFuture.wait(); });
+    AppStateData first;
+    first.pid = 100;
+    first.uid = 20010001;
+    first.bundleName = "com.test.a";
+    first.state = static_cast<int32_t>(ApplicationState::APP_STATE_FOREGROUND);
+    AppStateData second = first;
+    second.pid = 101;
+    second.bundleName = "com.test.b";
+    AppStateData third = first;
+    third.state = static_cast<int32_t>(ApplicationState::APP_STATE_BACKGROUND);
+    using Callback = AppStateObserverManager::AppStateCallback;
+    manager->EnqueueAppStateCallback(observer, Callback::APP_STATE_CHANGED, first);
+    manager->EnqueueAppStateCallback(observer, Callback::APP_STATE_CHANGED, second);
+    manager->EnqueueAppStateCallback(observer, Callback::APP_STATE_CHANGED, third);
+    gate.set_value();
+
+    std::promise<void> done;
+    auto doneFuture = done.get_future();
+    manager->handler_->SubmitTask([&done]() { done.set_value(); });
+    doneFuture.wait();
+
+    EXPECT_EQ(observer->singleCount_, 0);
+    ASSERT_EQ(observer->batches_.size(), 1);
+    ASSERT_EQ(observer->batches_[0].size(), 3);
+    EXPECT_EQ(observer->batches_[0][0].bundleName, "com.test.a");
+    EXPECT_EQ(observer->batches_[0][0].state, static_cast<int32_t>(ApplicationState::APP_STATE_FOREGROUND));
+    EXPECT_EQ(observer->batches_[0][1].bundleName, "com.test.b");
+    EXPECT_EQ(observer->batches_[0][2].bundleName, "com.test.a");
+    EXPECT_EQ(observer->batches_[0][2].state, static_cast<int32_t>(ApplicationState::APP_STATE_BACKGROUND));
+
+    std::string result;
+    manager->DumpAppStateDeliveryStat(result);
+    EXPECT_NE(result.find("delivered: 3"), std::string::npos);
+}
+
+/*
+ * Feature: AppStateObserverManager
+ * Function: EnqueueAppStateCallback
+ * SubFunction: NA
+ * FunctionPoints: AppStateObserverManager EnqueueAppStateCallback
+ * EnvConditions: NA
+ * CaseDescription: Started, state, foreground and stopped callbacks of one observer keep the order they happened in
+ */
+HWTEST_F(AppSpawnSocketTest, EnqueueAppStateCallback_002, TestSize.Level1)
+{
+    auto manager = std::make_shared<AppStateObserverManager>();
+    ASSERT_NE(manager, nullptr);
+    manager->Init();
+    sptr<OrderedApplicationStateObserver> observer = new OrderedApplicationStateObserver();
+
+    std::promise<void> gate;
+    auto gateFuture = gate.get_future().share();
+    manager->handler_->SubmitTask([gateFuture]() { gateFuture.wait(); });
+    AppStateData foreground;
+    foreground.pid = 100;
+    foreground.bundleName = "com.test.a";
+    foreground.state = static_cast<int32_t>(ApplicationState::APP_STATE_FOREGROUND);
+    AppStateData background = foreground;
+    background.state = static_cast<int32_t>(ApplicationState::APP_STATE_BACKGROUND);
+    using Callback = AppStateObserverManager::AppStateCallback;
+    manager->EnqueueAppStateCallback(observer, Callback::APP_STARTED, foreground);
+    manager->EnqueueAppStateCallback(observer, Callback::FOREGROUND_APPLICATION_CHANGED, foreground);
+    manager->EnqueueAppStateCallback(observer, Callback::APP_STATE_CHANGED, foreground);
+    manager->EnqueueAppStateCallback(observer, Callback::APP_STATE_CHANGED, background);
+    manager->EnqueueAppStateCallback(observer, Callback::FOREGROUND_APPLICATION_CHANGED, background);
+    manager->EnqueueAppStateCallback(observer, Callback::APP_STATE_CHANGED, foreground);
+    manager->EnqueueAppStateCallback(observer, Callback::APP_STOPPED, foreground);
+    gate.set_value();
+
+    std::promise<void> done;
+    auto doneFuture = done.get_future();
+    manager->handler_->SubmitTask([&done]() { done.set_value(); });
+    doneFuture.wait();
+
+    std::string fg = std::to_string(static_cast<int32_t>(ApplicationState::APP_STATE_FOREGROUND));
+    std::string bg = std::to_string(static_cast<int32_t>(ApplicationState::APP_STATE_BACKGROUND));
+    std::vector<std::string> expected = { "started:com.test.a", "foreground:" + fg, "states:" + fg + bg,
+        "foreground:" + bg, "state:" + fg, "stopped:com.test.a" };
+    EXPECT_EQ(observer->calls_, expected);
+}
+
+/*
+ * Feature: AppStateObserverManager
+ * Function: HandleOnProcessCreated, HandleOnProcessDied
+ * SubFunction: NA
+ * FunctionPoints: AppStateObserverManager EnqueueObserverCallback
+ * EnvConditions: NA
+ * CaseDescription: Process callbacks go through the same queue as app callbacks and keep their order
+ */
+HWTEST_F(AppSpawnSocketTest, EnqueueAppStateCallback_003, TestSize.Level1)
+{
+    auto manager = std::make_shared<AppStateObserverManager>();
+    ASSERT_NE(manager, nullptr);
+    manager->Init();
+    sptr<OrderedApplicationStateObserver> observer = new OrderedApplicationStateObserver();
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, {}});
+
+    std::promise<void> gate;
+    auto gateFuture = gate.get_future().share();
+    manager->handler_->SubmitTask([gateFuture]() { gateFuture.wait(); });
+    AppStateData appStateData;
+    appStateData.pid = 100;
+    appStateData.bundleName = "com.test.a";
+    appStateData.state = static_cast<int32_t>(ApplicationState::APP_STATE_FOREGROUND);
+    auto processData = std::make_shared<ProcessData>();
+    processData->pid = 100;
+    processData->bundleName = "com.test.a";
+    using Callback = AppStateObserverManager::AppStateCallback;
+    manager->EnqueueAppStateCallback(observer, Callback::APP_STARTED, appStateData);
+    manager->HandleOnProcessCreated(processData, BundleType::APP);
+    manager->EnqueueAppStateCallback(observer, Callback::APP_STATE_CHANGED, appStateData);
+    manager->HandleOnProcessDied(processData, BundleType::APP);
+    manager->EnqueueAppStateCallback(observer, Callback::APP_STOPPED, appStateData);
+    gate.set_value();
+
+    std::promise<void> done;
+    auto doneFuture = done.get_future();
+    manager->handler_->SubmitTask([&done]() { done.set_value(); });
+    doneFuture.wait();
+
+    std::string fg = std::to_string(static_cast<int32_t>(ApplicationState::APP_STATE_FOREGROUND));
+    std::vector<std::string> expected = { "started:com.test.a", "created:100", "state:" + fg, "died:100",
+        "stopped:com.test.a" };
+    EXPECT_EQ(observer->calls_, expected);
+}
 } // namespace AppExecFwk
 } // namespace OHOS
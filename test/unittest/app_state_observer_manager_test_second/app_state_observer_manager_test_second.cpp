@@ -158,7 +158,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, OnAppStarted_001, TestSize.Level2)
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
     std::vector<std::string> bundleNames;
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, bundleNames});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, bundleNames});
     EXPECT_CALL(*mockObserver, OnAppStarted(_)).Times(1);
     manager->OnAppStarted(appRecord);
 }
@@ -183,7 +183,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, OnAppStopped_001, TestSize.Level2)
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
     std::vector<std::string> bundleNames;
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, bundleNames});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, bundleNames});
     EXPECT_CALL(*mockObserver, OnAppStopped(_)).Times(1);
     manager->OnAppStopped(appRecord);
 }
@@ -208,7 +208,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, OnAppStateChanged_001, TestSize.Leve
     appRecord->mainBundleName_ = "com.ohos.unittest";
     ApplicationState state = ApplicationState::APP_STATE_FOREGROUND;
 
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
 
     EXPECT_CALL(*mockObserver, OnForegroundApplicationChanged(_)).Times(1);
     EXPECT_CALL(*mockObserver, OnAppStateChanged(_)).Times(1);
@@ -235,7 +235,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, OnProcessDied_001, TestSize.Level2)
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
 
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
 
     EXPECT_CALL(*mockObserver, OnProcessDied(_)).Times(1);
 
@@ -261,7 +261,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, OnWindowShow_001, TestSize.Level2)
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
 
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
 
     EXPECT_CALL(*mockObserver, OnWindowShow(_)).Times(1);
 
@@ -287,7 +287,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, OnWindowHidden_001, TestSize.Level2)
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
 
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
 
     EXPECT_CALL(*mockObserver, OnWindowHidden(_)).Times(1);
 
@@ -313,7 +313,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, OnProcessCreated_001, TestSize.Level
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
 
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
 
 
     EXPECT_CALL(*mockObserver, OnProcessCreated(_)).Times(1);
@@ -338,7 +338,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, OnChildProcessDied_001, TestSize.Lev
     sptr<IApplicationStateObserver> observer(mockObserver);
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
     ChildProcessRequest request;
     request.srcEntry = "test.js";
     request.childProcessType = CHILD_PROCESS_TYPE_JS;
@@ -365,7 +365,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, OnChildProcessDied_002, TestSize.Lev
     sptr<IApplicationStateObserver> observer(mockObserver);
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
     ChildProcessRequest request;
     request.srcEntry = "test.js";
     request.childProcessType = CHILD_PROCESS_TYPE_JS;
@@ -393,7 +393,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, OnChildProcessCreated_001, TestSize.
     sptr<IApplicationStateObserver> observer(mockObserver);
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
     ChildProcessRequest request;
     request.srcEntry = "test.js";
     request.childProcessType = CHILD_PROCESS_TYPE_JS;
@@ -420,7 +420,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, OnChildProcessCreated_002, TestSize.
     sptr<IApplicationStateObserver> observer(mockObserver);
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
     ChildProcessRequest request;
     request.srcEntry = "test.js";
     request.childProcessType = CHILD_PROCESS_TYPE_JS;
@@ -445,7 +445,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, HandleOnChildProcessCreated_001, Tes
     sptr<IApplicationStateObserver> observer(mockObserver);
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
     ChildProcessRequest request;
     request.srcEntry = "test.js";
     request.childProcessType = CHILD_PROCESS_TYPE_JS;
@@ -471,7 +471,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, HandleOnChildProcessDied_001, TestSi
     sptr<IApplicationStateObserver> observer(mockObserver);
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
     ChildProcessRequest request;
     request.srcEntry = "test.js";
     request.childProcessType = CHILD_PROCESS_TYPE_JS;
@@ -556,7 +556,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, OnProcessReused_001, TestSize.Level2
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
 
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
 
     EXPECT_CALL(*mockObserver, OnProcessReused(_)).Times(1);
 
@@ -579,7 +579,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, OnProcessReused_002, TestSize.Level2
     sptr<IApplicationStateObserver> observer(mockObserver);
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
 
     EXPECT_CALL(*mockObserver, OnProcessReused(_)).Times(0);
     manager->OnProcessReused(appRecord);
@@ -603,7 +603,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, OnKeepAliveStateChanged_001, TestSiz
     sptr<IApplicationStateObserver> observer(mockObserver);
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
 
     EXPECT_CALL(*mockObserver, OnKeepAliveStateChanged(_)).Times(1);
     manager->OnKeepAliveStateChanged(appRecord);
@@ -625,7 +625,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, OnKeepAliveStateChanged_002, TestSiz
     sptr<IApplicationStateObserver> observer(mockObserver);
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
 
     EXPECT_CALL(*mockObserver, OnKeepAliveStateChanged(_)).Times(0);
     manager->OnKeepAliveStateChanged(appRecord);
@@ -646,7 +646,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, HandleOnKeepAliveStateChanged_001, T
     sptr<IApplicationStateObserver> observer(mockObserver);
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
 
     EXPECT_CALL(*mockObserver, OnKeepAliveStateChanged(_)).Times(1);
     manager->HandleOnKeepAliveStateChanged(appRecord);
@@ -665,7 +665,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, HandleOnKeepAliveStateChanged_002, T
     auto manager = std::make_shared<AppStateObserverManager>();
     auto mockObserver = new MockApplicationStateObserver();
     sptr<IApplicationStateObserver> observer(mockObserver);
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
 
     EXPECT_CALL(*mockObserver, OnKeepAliveStateChanged(_)).Times(0);
     manager->HandleOnKeepAliveStateChanged(nullptr);
@@ -689,7 +689,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, OnProcessPreForegroundChanged_001, T
     sptr<IApplicationStateObserver> observer(mockObserver);
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
 
     EXPECT_CALL(*mockObserver, OnProcessPreForegroundChanged(_)).Times(0);
     manager->OnProcessPreForegroundChanged(appRecord);
@@ -738,7 +738,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, OnProcessPreForegroundChanged_003, T
     sptr<IApplicationStateObserver> observer(mockObserver);
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
 
     EXPECT_CALL(*mockObserver, OnProcessPreForegroundChanged(_)).Times(1);
     manager->OnProcessPreForegroundChanged(appRecord);
@@ -762,7 +762,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, HandleOnProcessPreForegroundChanged_
 
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, {}});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, {}});
 
     EXPECT_CALL(*mockObserver, OnProcessPreForegroundChanged(_)).Times(1);
     manager->HandleOnProcessPreForegroundChanged(appRecord);
@@ -786,7 +786,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, HandleOnProcessPreForegroundChanged_
 
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, {"com.ohos.nonexist"}});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, {"com.ohos.nonexist"}});
 
     EXPECT_CALL(*mockObserver, OnProcessPreForegroundChanged(_)).Times(0);
     manager->HandleOnProcessPreForegroundChanged(appRecord);
@@ -810,7 +810,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, HandleOnProcessPreForegroundChanged_
 
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
-    manager->appStateObserverMap_.emplace(nullptr, AppStateObserverInfo{0, {"com.ohos.unittest"}});
+    manager->AddAppStateObserverLocked(nullptr, AppStateObserverInfo{0, {"com.ohos.unittest"}});
 
     EXPECT_CALL(*mockObserver, OnProcessPreForegroundChanged(_)).Times(0);
     manager->HandleOnProcessPreForegroundChanged(appRecord);
@@ -834,7 +834,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, HandleOnProcessPreForegroundChanged_
 
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
-    manager->appStateObserverMap_.emplace(nullptr, AppStateObserverInfo{0, {}});
+    manager->AddAppStateObserverLocked(nullptr, AppStateObserverInfo{0, {}});
 
     EXPECT_CALL(*mockObserver, OnProcessPreForegroundChanged(_)).Times(0);
     manager->HandleOnProcessPreForegroundChanged(appRecord);
@@ -856,7 +856,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, HandleOnProcessPreForegroundChanged_
     auto mockObserver = new MockApplicationStateObserver();
     sptr<IApplicationStateObserver> observer(mockObserver);
 
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
     EXPECT_CALL(*mockObserver, OnProcessPreForegroundChanged(_)).Times(0);
 
     manager->HandleOnProcessPreForegroundChanged(nullptr);
@@ -880,7 +880,7 @@ HWTEST_F(AppStateObserverManagerTestSecond, HandleOnProcessPreForegroundChanged_
 
     std::shared_ptr<AppRunningRecord> appRecord = MockAppRecord();
     appRecord->mainBundleName_ = "com.ohos.unittest";
-    manager->appStateObserverMap_.emplace(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
+    manager->AddAppStateObserverLocked(observer, AppStateObserverInfo{0, {"com.ohos.unittest"}});
 
     EXPECT_CALL(*mockObserver, OnProcessPreForegroundChanged(_)).Times(1);
     manager->HandleOnProcessPreForegroundChanged(appRecord);
@@ -140,6 +140,18 @@ void AppRunningRecord::SetUid(const int32_t uid)
     mainUid_ = uid;
 }
 
+void AppRunningRecord::SetUidChangedHandler(UidChangedHandler handler)
+{
+    std::lock_guard lock(uidChangedHandlerLock_);
+    uidChangedHandler_ = std::move(handler);
+}
+
+void AppRunningRecord::SetAbilityChangedHandler(AbilityChangedHandler handler)
+{
+    std::lock_guard lock(abilityChangedHandlerLock_);
+    abilityChangedHandler_ = std::move(handler);
+}
+
 uint32_t AppRunningRecord::GetAccessTokenId() const
 {
     return 0;
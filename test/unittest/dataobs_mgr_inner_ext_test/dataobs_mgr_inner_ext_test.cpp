@@ -575,7 +575,7 @@ HWTEST_F(DataObsMgrInnerExtTest, DataObsMgrInnerExt_HandleUnregisterObserver_030
 
     EXPECT_EQ(dataObsMgrInnerExt->HandleUnregisterObserver(uri134, observer), SUCCESS);
     EXPECT_EQ(dataObsMgrInnerExt->obsRecipientRefs.size(), 0);
-    EXPECT_TRUE(dataObsMgrInnerExt->root_->childrens_.empty());
+    EXPECT_TRUE(dataObsMgrInnerExt->nodes_[DataObsMgrInnerExt::ROOT_NODE].children.empty());
     EXPECT_EQ(observer->onChangeCall_, 2);
     EXPECT_EQ(observer2->onChangeCall_, 1);
 }
@@ -747,7 +747,7 @@ HWTEST_F(DataObsMgrInnerExtTest, DataObsMgrInnerExt_HandleUnregisterObserverAll_
     EXPECT_EQ(observer1->onChangeCall_, 0);
     EXPECT_EQ(observer2->onChangeCall_, 205);
     EXPECT_EQ(dataObsMgrInnerExt->HandleUnregisterObserver(observer2), SUCCESS);
-    EXPECT_TRUE(dataObsMgrInnerExt->root_->childrens_.empty());
+    EXPECT_TRUE(dataObsMgrInnerExt->nodes_[DataObsMgrInnerExt::ROOT_NODE].children.empty());
 }
 
 /*
@@ -801,7 +801,7 @@ HWTEST_F(DataObsMgrInnerExtTest, DataObsMgrInnerExt_DeathRecipient_0100, TestSiz
     EXPECT_EQ(observer1->onChangeCall_, 0);
     EXPECT_EQ(observer2->onChangeCall_, 205);
     dataObsMgrInnerExt->OnCallBackDied(observer2->AsObject());
-    EXPECT_TRUE(dataObsMgrInnerExt->root_->childrens_.empty());
+    EXPECT_TRUE(dataObsMgrInnerExt->nodes_[DataObsMgrInnerExt::ROOT_NODE].children.empty());
     EXPECT_TRUE(dataObsMgrInnerExt->obsRecipientRefs.empty());
 }
 
@@ -947,5 +947,94 @@ HWTEST_F(DataObsMgrInnerExtTest, DataObsMgrInnerExt_HandleNotifyChange_0100, Tes
     EXPECT_EQ(observer2->onChangeCall_, 1);
 }
 
+/*
+ * Feature: DataObsMgrInnerExt
+ * Function: HandleRegisterObserver/HandleUnregisterObserver test
+ * SubFunction: 0100
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription:Shared path segments are interned once and released with the last node using them
+ */
+HWTEST_F(DataObsMgrInnerExtTest, DataObsMgrInnerExt_SegmentPool_0100, TestSize.Level1)
+{
+    std::shared_ptr<DataObsMgrInnerExt> dataObsMgrInnerExt = std::make_shared<DataObsMgrInnerExt>();
+    Uri uri1("datashare://media/external/images/1");
+    Uri uri2("datashare://media/external/images/2");
+    Uri uri3("datashare://media/images//1/");
+    sptr<MockDataAbilityObserverStub> observer = (new (std::nothrow) MockDataAbilityObserverStub());
+    ObserverInfo info(0, 0, 0, USER_TEST, false);
+    EXPECT_EQ(dataObsMgrInnerExt->HandleRegisterObserver(uri1, observer, info), SUCCESS);
+    EXPECT_EQ(dataObsMgrInnerExt->HandleRegisterObserver(uri2, observer, info), SUCCESS);
+    EXPECT_EQ(dataObsMgrInnerExt->HandleRegisterObserver(uri3, observer, info), SUCCESS);
+    // datashare, media, external, images, 1, 2
+    EXPECT_EQ(dataObsMgrInnerExt->segmentPool_.Size(), 6);
+
+    std::vector<NotifyInfo> infos = MakeDefaultNotifyInfo(1);
+    EXPECT_EQ(dataObsMgrInnerExt->HandleNotifyChange({ ChangeInfo::ChangeType::INSERT,
+        { Uri("datashare://media/images/1") } }, USER_TEST, infos), SUCCESS);
+    EXPECT_EQ(observer->onChangeCall_, 1);
+    EXPECT_EQ(dataObsMgrInnerExt->HandleNotifyChange({ ChangeInfo::ChangeType::INSERT,
+        { Uri("datashare://media/external/images/3") } }, USER_TEST, infos), NO_OBS_FOR_URI);
+
+    EXPECT_EQ(dataObsMgrInnerExt->HandleUnregisterObserver(uri1, observer), SUCCESS);
+    EXPECT_EQ(dataObsMgrInnerExt->segmentPool_.Size(), 6);
+    EXPECT_EQ(dataObsMgrInnerExt->HandleUnregisterObserver(observer), SUCCESS);
+    EXPECT_EQ(dataObsMgrInnerExt->segmentPool_.Size(), 0);
+    EXPECT_TRUE(dataObsMgrInnerExt->nodes_[DataObsMgrInnerExt::ROOT_NODE].children.empty());
+    EXPECT_EQ(dataObsMgrInnerExt->freeNodes_.size() + 1, dataObsMgrInnerExt->nodes_.size());
+}
+
+/*
+ * Feature: DataObsMgrInnerExt
+ * Function: HandleNotifyChange test
+ * SubFunction: 0200
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription:Notify deep uris with 10k observers registered, only the photo observer and the descendant
+ *                 observer of its album are called
+ */
+HWTEST_F(DataObsMgrInnerExtTest, DataObsMgrInnerExt_HandleNotifyChange_0200, TestSize.Level1)
+{
+    constexpr int32_t observerCount = 10000;
+    constexpr int32_t albumCount = 100;
+    constexpr int32_t notifyCount = 1000;
+    std::shared_ptr<DataObsMgrInnerExt> dataObsMgrInnerExt = std::make_shared<DataObsMgrInnerExt>();
+    std::string uriBase = "datashare://media/external/images/album";
+    std::vector<sptr<MockDataAbilityObserverStub>> observers;
+    ObserverInfo info(0, 0, 0, USER_TEST, false);
+    for (int32_t i = 0; i < observerCount; i++) {
+        sptr<MockDataAbilityObserverStub> observer = (new (std::nothrow) MockDataAbilityObserverStub());
+        observers.push_back(observer);
+        // every album has one descendant observer, the rest observe single photos
+        bool isDescendants = i < albumCount;
+        Uri uri(isDescendants ? uriBase + std::to_string(i) :
+            uriBase + std::to_string(i % albumCount) + "/photo/" + std::to_string(i));
+        EXPECT_EQ(dataObsMgrInnerExt->HandleRegisterObserver(uri, observer, info, isDescendants), SUCCESS);
+    }
+
+    std::vector<NotifyInfo> infos = MakeDefaultNotifyInfo(1);
+    std::vector<int32_t> expectedCalls(observerCount, 0);
+    for (int32_t i = 0; i < notifyCount; i++) {
+        int32_t photo = albumCount + (i * 7) % (observerCount - albumCount);
+        Uri uri(uriBase + std::to_string(photo % albumCount) + "/photo/" + std::to_string(photo));
+        EXPECT_EQ(dataObsMgrInnerExt->HandleNotifyChange({ ChangeInfo::ChangeType::UPDATE, { uri } },
+            USER_TEST, infos), SUCCESS);
+        expectedCalls[photo]++;
+        expectedCalls[photo % albumCount]++;
+    }
+    for (int32_t i = 0; i < observerCount; i++) {
+        EXPECT_EQ(observers[i]->onChangeCall_, expectedCalls[i]) << "observer " << i;
+    }
+    Uri unknownUri(uriBase + "0/photo/" + std::to_string(observerCount));
+    EXPECT_EQ(dataObsMgrInnerExt->HandleNotifyChange({ ChangeInfo::ChangeType::UPDATE, { unknownUri } },
+        USER_TEST, infos), SUCCESS);
+    EXPECT_EQ(observers[0]->onChangeCall_, expectedCalls[0] + 1);
+
+    for (auto &observer : observers) {
+        EXPECT_EQ(dataObsMgrInnerExt->HandleUnregisterObserver(observer), SUCCESS);
+    }
+    EXPECT_EQ(dataObsMgrInnerExt->segmentPool_.Size(), 0);
+}
+
 } // namespace DataObsMgrInnerExtTest
 } // namespace OHOS
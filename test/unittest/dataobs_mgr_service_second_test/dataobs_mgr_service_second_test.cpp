@@ -12,17 +12,39 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <thread>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include "hilog_tag_wrapper.h"
 
+#include "data_ability_observer_stub.h"
 #include "dataobs_mgr_service.h"
 
 namespace OHOS {
 namespace AAFwk {
 using namespace testing::ext;
+namespace {
+constexpr int32_t USER_TEST = 100;
+}
+class CountingDataAbilityObserver : public DataAbilityObserverStub {
+public:
+    void OnChange() override
+    {}
+
+    void OnChangeExt(const ChangeInfo &changeInfo) override
+    {
+        wakeUps_++;
+        uris_ += changeInfo.uris_.size();
+    }
+
+    std::atomic<uint64_t> wakeUps_ = 0;
+    std::atomic<uint64_t> uris_ = 0;
+};
+
 class DataObsMgrServiceSecondTest : public testing::Test {
 public:
     DataObsMgrServiceSecondTest() = default;
@@ -98,7 +120,6 @@ HWTEST_F(DataObsMgrServiceSecondTest, DataObsMgrServiceSecondTest_NotifyChange_0
 HWTEST_F(DataObsMgrServiceSecondTest, DataObsMgrServiceSecondTest_NotifyChange_0300, TestSize.Level1)
 {
     TAG_LOGI(AAFwkTag::TEST, "DataObsMgrServiceSecondTest_NotifyChange_0300 start");
-    const int testVal = static_cast<int>(DATAOBS_SERVICE_TASK_LIMMIT);
     std::shared_ptr<Uri> uri =
         std::make_shared<Uri>("dataability://device_id/com.domainname.dataability.persondata/person/10");
     auto dataObsMgrServer = std::make_shared<DataObsMgrService>();
@@ -106,7 +127,19 @@ HWTEST_F(DataObsMgrServiceSecondTest, DataObsMgrServiceSecondTest_NotifyChange_0
     auto tmp = dataObsMgrServer->taskCount_;
     dataObsMgrServer->taskCount_ = DataObsMgrService::TASK_COUNT_MAX;
 
-    EXPECT_EQ(testVal, dataObsMgrServer->NotifyChange(*uri));
+    // without a free task slot the uri stays queued and its flush runs outside the task budget
+    EXPECT_EQ(NO_ERROR, dataObsMgrServer->NotifyChange(*uri));
+    for (int32_t i = 0; i < 100; i++) {
+        {
+            std::lock_guard<ffrt::mutex> lock(dataObsMgrServer->notifyQueueMutex_);
+            if (!dataObsMgrServer->notifyFlushScheduled_) {
+                break;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(dataObsMgrServer->notifyQueueStat_.unbudgetedFlushes, 1);
+    EXPECT_EQ(dataObsMgrServer->taskCount_, DataObsMgrService::TASK_COUNT_MAX);
     dataObsMgrServer->taskCount_ = tmp;
     TAG_LOGI(AAFwkTag::TEST, "DataObsMgrServiceSecondTest_NotifyChange_0300 end");
 }
@@ -335,5 +368,157 @@ HWTEST_F(DataObsMgrServiceSecondTest, DataObsMgrServiceSecondTest_NotifyProcessO
     TAG_LOGI(AAFwkTag::TEST, "DataObsMgrServiceSecondTest_NotifyProcessObserver_0100 end");
 }
 
+/*
+ * Feature: DataObsMgrService
+ * Function: SubmitNotifyChangeTask
+ * SubFunction: NA
+ * FunctionPoints: DataObsMgrService SubmitNotifyChangeTask
+ * EnvConditions: NA
+ * CaseDescription: Duplicate uris are merged while pending and delivered to an observer in one ChangeInfo.
+ */
+HWTEST_F(DataObsMgrServiceSecondTest, DataObsMgrServiceSecondTest_SubmitNotifyChangeTask_0100, TestSize.Level1)
+{
+    TAG_LOGI(AAFwkTag::TEST, "DataObsMgrServiceSecondTest_SubmitNotifyChangeTask_0100 start");
+    auto dataObsMgrServer = std::make_shared<DataObsMgrService>();
+    dataObsMgrServer->Init();
+    sptr<CountingDataAbilityObserver> observer(new (std::nothrow) CountingDataAbilityObserver());
+    ASSERT_NE(observer, nullptr);
+    Uri baseUri("datashare://com.test.notify/contacts");
+    ObserverInfo registerInfo(0, 0, 0, USER_TEST, false);
+    EXPECT_EQ(dataObsMgrServer->dataObsMgrInnerExt_->HandleRegisterObserver(baseUri, observer, registerInfo, true),
+        SUCCESS);
+
+    // pretend a flush is already scheduled so that the queue is only drained below
+    dataObsMgrServer->notifyFlushScheduled_ = true;
+    dataObsMgrServer->taskCount_ = 1;
+    Uri first("datashare://com.test.notify/contacts/1");
+    Uri second("datashare://com.test.notify/contacts/2");
+    ObserverInfo info(0, 0, 0, USER_TEST, false);
+    std::string readPermission = DataShare::DataSharePermission::NO_PERMISSION;
+    EXPECT_EQ(dataObsMgrServer->SubmitNotifyChangeTask(first, USER_TEST, readPermission, info), NO_ERROR);
+    EXPECT_EQ(dataObsMgrServer->SubmitNotifyChangeTask(second, USER_TEST, readPermission, info), NO_ERROR);
+    EXPECT_EQ(dataObsMgrServer->SubmitNotifyChangeTask(first, USER_TEST, readPermission, info), NO_ERROR);
+    EXPECT_EQ(dataObsMgrServer->SubmitNotifyChangeTask(first, USER_TEST, readPermission, info), NO_ERROR);
+    EXPECT_EQ(dataObsMgrServer->pendingNotifies_.size(), 2);
+    EXPECT_EQ(dataObsMgrServer->notifyQueueStat_.coalesced, 2);
+
+    dataObsMgrServer->FlushNotifyChanges();
+    EXPECT_EQ(observer->wakeUps_.load(), 1);
+    EXPECT_EQ(observer->uris_.load(), 2);
+    EXPECT_TRUE(dataObsMgrServer->pendingNotifies_.empty());
+    EXPECT_EQ(dataObsMgrServer->taskCount_, 0);
+    TAG_LOGI(AAFwkTag::TEST, "DataObsMgrServiceSecondTest_SubmitNotifyChangeTask_0100 end");
+}
+
+/*
+ * Feature: DataObsMgrService
+ * Function: SubmitNotifyChangeTask
+ * SubFunction: NA
+ * FunctionPoints: DataObsMgrService SubmitNotifyChangeTask
+ * EnvConditions: NA
+ * CaseDescription: When the caller scheduling the flush gets no task slot, its uri and the uris accepted from
+ *                  other callers meanwhile are all delivered by one flush outside the task budget.
+ */
+HWTEST_F(DataObsMgrServiceSecondTest, DataObsMgrServiceSecondTest_SubmitNotifyChangeTask_0200, TestSize.Level1)
+{
+    TAG_LOGI(AAFwkTag::TEST, "DataObsMgrServiceSecondTest_SubmitNotifyChangeTask_0200 start");
+    auto dataObsMgrServer = std::make_shared<DataObsMgrService>();
+    dataObsMgrServer->Init();
+    sptr<CountingDataAbilityObserver> observer(new (std::nothrow) CountingDataAbilityObserver());
+    ASSERT_NE(observer, nullptr);
+    Uri baseUri("datashare://com.test.notify/contacts");
+    ObserverInfo registerInfo(0, 0, 0, USER_TEST, false);
+    EXPECT_EQ(dataObsMgrServer->dataObsMgrInnerExt_->HandleRegisterObserver(baseUri, observer, registerInfo, true),
+        SUCCESS);
+
+    dataObsMgrServer->taskCount_ = DataObsMgrService::TASK_COUNT_MAX;
+    Uri first("datashare://com.test.notify/contacts/1");
+    Uri second("datashare://com.test.notify/contacts/2");
+    ObserverInfo info(0, 0, 0, USER_TEST, false);
+    std::string readPermission = DataShare::DataSharePermission::NO_PERMISSION;
+    int32_t firstResult = NO_ERROR;
+    std::thread scheduler([&]() {
+        firstResult = dataObsMgrServer->SubmitNotifyChangeTask(first, USER_TEST, readPermission, info);
+    });
+    // the first caller waits for a task slot with its uri queued and the flush marked as scheduled
+    for (int32_t i = 0; i < 50; i++) {
+        {
+            std::lock_guard<ffrt::mutex> lock(dataObsMgrServer->notifyQueueMutex_);
+            if (!dataObsMgrServer->pendingNotifies_.empty()) {
+                break;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(dataObsMgrServer->SubmitNotifyChangeTask(second, USER_TEST, readPermission, info), NO_ERROR);
+    scheduler.join();
+    EXPECT_EQ(firstResult, NO_ERROR);
+
+    for (int32_t i = 0; i < 100 && observer->uris_.load() == 0; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(observer->wakeUps_.load(), 1);
+    EXPECT_EQ(observer->uris_.load(), 2);
+    {
+        std::lock_guard<ffrt::mutex> lock(dataObsMgrServer->notifyQueueMutex_);
+        EXPECT_TRUE(dataObsMgrServer->pendingNotifies_.empty());
+        EXPECT_FALSE(dataObsMgrServer->notifyFlushScheduled_);
+    }
+    EXPECT_EQ(dataObsMgrServer->taskCount_, DataObsMgrService::TASK_COUNT_MAX);
+    dataObsMgrServer->taskCount_ = 0;
+    TAG_LOGI(AAFwkTag::TEST, "DataObsMgrServiceSecondTest_SubmitNotifyChangeTask_0200 end");
+}
+
+/*
+ * Feature: DataObsMgrService
+ * Function: SubmitNotifyChangeTask
+ * SubFunction: NA
+ * FunctionPoints: DataObsMgrService SubmitNotifyChangeTask
+ * EnvConditions: NA
+ * CaseDescription: Stress NotifyChange with a burst over a small uri set, log notifications/sec and wake-ups.
+ */
+HWTEST_F(DataObsMgrServiceSecondTest, DataObsMgrServiceSecondTest_NotifyChangeStress_0100, TestSize.Level3)
+{
+    TAG_LOGI(AAFwkTag::TEST, "DataObsMgrServiceSecondTest_NotifyChangeStress_0100 start");
+    constexpr int32_t notifyCount = 20000;
+    constexpr int32_t uriCount = 100;
+    auto dataObsMgrServer = std::make_shared<DataObsMgrService>();
+    dataObsMgrServer->Init();
+    sptr<CountingDataAbilityObserver> observer(new (std::nothrow) CountingDataAbilityObserver());
+    ASSERT_NE(observer, nullptr);
+    Uri baseUri("datashare://com.test.stress/media");
+    ObserverInfo registerInfo(0, 0, 0, USER_TEST, false);
+    dataObsMgrServer->dataObsMgrInnerExt_->HandleRegisterObserver(baseUri, observer, registerInfo, true);
+
+    std::vector<Uri> uris;
+    for (int32_t i = 0; i < uriCount; i++) {
+        uris.emplace_back("datashare://com.test.stress/media/" + std::to_string(i));
+    }
+    ObserverInfo info(0, 0, 0, USER_TEST, false);
+    std::string readPermission = DataShare::DataSharePermission::NO_PERMISSION;
+    int32_t accepted = 0;
+    auto begin = std::chrono::steady_clock::now();
+    for (int32_t i = 0; i < notifyCount; i++) {
+        if (dataObsMgrServer->SubmitNotifyChangeTask(uris[i % uriCount], USER_TEST, readPermission, info) ==
+            NO_ERROR) {
+            accepted++;
+        }
+    }
+    auto costUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+    for (int32_t i = 0; i < 100 && dataObsMgrServer->taskCount_ != 0; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(accepted, notifyCount);
+    std::string stat;
+    dataObsMgrServer->DumpNotifyQueueStat(stat);
+    TAG_LOGI(AAFwkTag::TEST, "notify %{public}d in %{public}lld us, %{public}.0f notify/s, wake-ups %{public}llu, "
+        "uris delivered %{public}llu\n%{public}s", notifyCount, static_cast<long long>(costUs),
+        costUs == 0 ? 0.0 : notifyCount * 1000000.0 / costUs,
+        static_cast<unsigned long long>(observer->wakeUps_.load()),
+        static_cast<unsigned long long>(observer->uris_.load()), stat.c_str());
+    TAG_LOGI(AAFwkTag::TEST, "DataObsMgrServiceSecondTest_NotifyChangeStress_0100 end");
+}
+
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -28,6 +28,9 @@ namespace AAFwk {
 namespace {
 constexpr int32_t TIME_DELAY = 100;
 constexpr int32_t TIME_SLEEP = 4000;
+constexpr int64_t WHEEL_START_TIME = 1000000;
+constexpr int32_t WHEEL_EVENT_COUNT = 10000;
+constexpr int32_t WHEEL_BASE_DELAY = 5000;
 inline int64_t GetCurrentTimeMillis()
 {
     return std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -314,5 +317,196 @@ HWTEST_F(EventHandlerWrapTest, RemoveEvent_0060, TestSize.Level2) {
     EventTask::cancelStatus = false;
     Mock::VerifyAndClear(&MockLogger::instance);
 }
+
+/**
+ * @tc.name: EventTimerWheel_0010
+ * @tc.desc: Events on all levels expire at their time, not before.
+ * @tc.type: FUNC
+ */
+HWTEST_F(EventHandlerWrapTest, EventTimerWheel_0010, TestSize.Level2) {
+    EventTimerWheel wheel;
+    int64_t expireTime = 0;
+    EXPECT_TRUE(wheel.Arm(EventWrap(1, 1), WHEEL_START_TIME, 50, expireTime)); // 50: on the lowest level
+    EXPECT_EQ(expireTime, WHEEL_START_TIME + 50);
+    EXPECT_TRUE(wheel.Arm(EventWrap(2, 1), WHEEL_START_TIME, 3000, expireTime)); // 3000: on the second level
+    EXPECT_TRUE(wheel.Arm(EventWrap(3, 1), WHEEL_START_TIME, 200000, expireTime)); // 200000: on the third level
+    EXPECT_FALSE(wheel.Arm(EventWrap(1, 1), WHEEL_START_TIME, 50, expireTime));
+    EXPECT_EQ(wheel.GetSize(), 3);
+    EXPECT_EQ(wheel.GetNextExpireTime(), WHEEL_START_TIME + 50);
+
+    std::vector<EventWrap> events;
+    wheel.Expire(WHEEL_START_TIME + 40, events);
+    EXPECT_TRUE(events.empty());
+    wheel.Expire(WHEEL_START_TIME + 50, events);
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0].GetEventId(), 1);
+
+    // the second level is cascaded before the event expires
+    events.clear();
+    int64_t nextTime = wheel.GetNextExpireTime();
+    EXPECT_GT(nextTime, WHEEL_START_TIME + 50);
+    EXPECT_LE(nextTime, WHEEL_START_TIME + 3000);
+    wheel.Expire(nextTime, events);
+    EXPECT_TRUE(events.empty());
+    EXPECT_EQ(wheel.GetNextExpireTime(), WHEEL_START_TIME + 3000);
+    wheel.Expire(WHEEL_START_TIME + 2990, events);
+    EXPECT_TRUE(events.empty());
+    wheel.Expire(WHEEL_START_TIME + 3000, events);
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0].GetEventId(), 2);
+
+    events.clear();
+    wheel.Expire(WHEEL_START_TIME + 199990, events);
+    EXPECT_TRUE(events.empty());
+    wheel.Expire(WHEEL_START_TIME + 200000, events);
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0].GetEventId(), 3);
+    EXPECT_EQ(wheel.GetSize(), 0);
+    EXPECT_EQ(wheel.GetNextExpireTime(), -1);
+}
+
+/**
+ * @tc.name: EventTimerWheel_0020
+ * @tc.desc: Cancelled events never expire and their keys can be armed again.
+ * @tc.type: FUNC
+ */
+HWTEST_F(EventHandlerWrapTest, EventTimerWheel_0020, TestSize.Level2) {
+    EventTimerWheel wheel;
+    int64_t expireTime = 0;
+    EXPECT_TRUE(wheel.Arm(EventWrap(1, 1), WHEEL_START_TIME, TIME_DELAY, expireTime));
+    EXPECT_TRUE(wheel.Arm(EventWrap(1, 2), WHEEL_START_TIME, TIME_DELAY, expireTime));
+    EXPECT_NE(wheel.Find(1, 1), nullptr);
+    EXPECT_TRUE(wheel.Cancel(1, 1));
+    EXPECT_FALSE(wheel.Cancel(1, 1));
+    EXPECT_EQ(wheel.Find(1, 1), nullptr);
+    EXPECT_TRUE(wheel.Arm(EventWrap(1, 1), WHEEL_START_TIME, TIME_DELAY * 2, expireTime));
+
+    std::vector<EventWrap> events;
+    wheel.Expire(WHEEL_START_TIME + TIME_DELAY, events);
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0].GetParam(), 2);
+    events.clear();
+    wheel.Expire(WHEEL_START_TIME + TIME_DELAY * 2, events);
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0].GetParam(), 1);
+}
+
+/**
+ * @tc.name: SendEvent_0070
+ * @tc.desc: Timeouts sent without force insert share one task, removing them submits nothing.
+ * @tc.type: FUNC
+ */
+HWTEST_F(EventHandlerWrapTest, SendEvent_0070, TestSize.Level2) {
+    auto handler = std::make_shared<MockEventHandlerWrap>();
+    auto taskHandler = std::make_shared<TaskHandlerWrap>();
+    handler->taskHandler_ = taskHandler;
+
+    EXPECT_CALL(*taskHandler, SubmitTaskJust(::testing::_, "EventTimerWheel", ::testing::_))
+        .WillOnce(::testing::Return(std::make_shared<int32_t>(0)));
+    EventWrap event1(1, 1);
+    EventWrap event2(1, 2);
+    event1.sameStatus = true;
+    EXPECT_TRUE(handler->SendEvent(event1, TIME_DELAY, false));
+    EXPECT_TRUE(handler->SendEvent(event2, TIME_DELAY * 2, false));
+    EXPECT_FALSE(handler->SendEvent(event1, TIME_DELAY, false));
+    EXPECT_EQ(handler->timerWheel_.GetSize(), 2);
+
+    EXPECT_TRUE(handler->RemoveEvent(event1, false));
+    EXPECT_TRUE(handler->RemoveEvent(event2));
+    EXPECT_EQ(handler->timerWheel_.GetSize(), 0);
+    Mock::VerifyAndClear(taskHandler.get());
+}
+
+/**
+ * @tc.name: SendEvent_0080
+ * @tc.desc: An expired timeout stays indexed until it is processed, then it is processed once.
+ * @tc.type: FUNC
+ */
+HWTEST_F(EventHandlerWrapTest, SendEvent_0080, TestSize.Level2) {
+    auto handler = std::make_shared<MockEventHandlerWrap>();
+    auto taskHandler = std::make_shared<TaskHandlerWrap>();
+    handler->taskHandler_ = taskHandler;
+
+    EventWrap event(1, 1);
+    event.eventString = "1_1";
+    event.sameStatus = true;
+    std::function<void()> eventTask;
+    EXPECT_CALL(*taskHandler, SubmitTaskJust(::testing::_, "EventTimerWheel", ::testing::_))
+        .WillOnce(::testing::Return(std::make_shared<int32_t>(0)));
+    EXPECT_CALL(*taskHandler, SubmitTaskJust(::testing::_, "1_1", 0))
+        .WillOnce([&eventTask](std::function<void()> task, const std::string& name, int64_t delay) {
+            eventTask = task;
+            return std::make_shared<int32_t>(0);
+        });
+    EXPECT_CALL(*handler, ProcessEvent).Times(1);
+    EXPECT_TRUE(handler->SendEvent(event, TIME_DELAY, false));
+    usleep((TIME_DELAY + EventTimerWheel::DEFAULT_TICK_MILLIS) * 1000); // 1000: us per ms
+    handler->DriveTimerWheel(handler->timerWheelDriveTime_);
+    EXPECT_EQ(handler->timerWheel_.GetSize(), 0);
+    EXPECT_EQ(handler->timerWheelDriveTime_, 0);
+    EXPECT_EQ(handler->eventMap_.count("1_1"), 1);
+    EXPECT_FALSE(handler->SendEvent(event, TIME_DELAY, false));
+
+    ASSERT_NE(eventTask, nullptr);
+    eventTask();
+    EXPECT_TRUE(handler->eventMap_.empty());
+}
+
+/**
+ * @tc.name: SendEvent_0090
+ * @tc.desc: An expired timeout removed before it is processed has its task cancelled.
+ * @tc.type: FUNC
+ */
+HWTEST_F(EventHandlerWrapTest, SendEvent_0090, TestSize.Level2) {
+    auto handler = std::make_shared<MockEventHandlerWrap>();
+    auto taskHandler = std::make_shared<TaskHandlerWrap>();
+    handler->taskHandler_ = taskHandler;
+
+    EventWrap event(1, 1);
+    event.eventString = "1_1";
+    EXPECT_CALL(*taskHandler, SubmitTaskJust(::testing::_, "EventTimerWheel", ::testing::_))
+        .WillOnce(::testing::Return(std::make_shared<int32_t>(0)));
+    EXPECT_CALL(*taskHandler, SubmitTaskJust(::testing::_, "1_1", 0))
+        .WillOnce(::testing::Return(std::make_shared<int32_t>(0)));
+    EXPECT_TRUE(handler->SendEvent(event, TIME_DELAY, false));
+    usleep((TIME_DELAY + EventTimerWheel::DEFAULT_TICK_MILLIS) * 1000); // 1000: us per ms
+    handler->DriveTimerWheel(handler->timerWheelDriveTime_);
+
+    EventTask::cancelStatus = true;
+    EXPECT_TRUE(handler->RemoveEvent(event));
+    EXPECT_TRUE(handler->eventMap_.empty());
+    EventTask::cancelStatus = false;
+}
+
+/**
+ * @tc.name: SendEvent_0100
+ * @tc.desc: Arming and cancelling many timeouts through the handler submits one task, keeps the slot count fixed
+ *           and reuses the wheel nodes.
+ * @tc.type: FUNC
+ */
+HWTEST_F(EventHandlerWrapTest, SendEvent_0100, TestSize.Level3) {
+    auto handler = std::make_shared<MockEventHandlerWrap>();
+    auto taskHandler = std::make_shared<TaskHandlerWrap>();
+    handler->taskHandler_ = taskHandler;
+    size_t slotCount = handler->timerWheel_.slots_.size();
+
+    EXPECT_CALL(*taskHandler, SubmitTaskJust(::testing::_, "EventTimerWheel", ::testing::_))
+        .WillOnce(::testing::Return(std::make_shared<int32_t>(0)));
+    for (int32_t round = 0; round < 2; round++) {
+        for (int32_t i = 0; i < WHEEL_EVENT_COUNT; i++) {
+            EXPECT_TRUE(handler->SendEvent(EventWrap(1, i), WHEEL_BASE_DELAY + i, false));
+        }
+        EXPECT_EQ(handler->timerWheel_.GetSize(), static_cast<size_t>(WHEEL_EVENT_COUNT));
+        EXPECT_EQ(handler->timerWheel_.slots_.size(), slotCount);
+        EXPECT_EQ(handler->timerWheel_.nodes_.size(), static_cast<size_t>(WHEEL_EVENT_COUNT));
+        for (int32_t i = 0; i < WHEEL_EVENT_COUNT; i++) {
+            EXPECT_TRUE(handler->RemoveEvent(EventWrap(1, i)));
+        }
+        EXPECT_EQ(handler->timerWheel_.GetSize(), 0);
+        EXPECT_EQ(handler->timerWheel_.freeNodes_.size(), handler->timerWheel_.nodes_.size());
+    }
+    EXPECT_TRUE(handler->eventMap_.empty());
+    Mock::VerifyAndClear(taskHandler.get());
+}
 }  // namespace AAFwk
 }  // namespace OHOS
\ No newline at end of file
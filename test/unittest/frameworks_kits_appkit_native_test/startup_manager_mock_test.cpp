@@ -44,19 +44,19 @@ void StartupManagerMockTest::SetUp(void) {}
 void StartupManagerMockTest::TearDown(void) {}
 
 /**
- * @tc.name: GetStartupConfigString_0200
+ * @tc.name: GetStartupConfigJson_0100
  * @tc.type: FUNC
- * @tc.Function: GetStartupConfigString
+ * @tc.Function: GetStartupConfigJson
  */
-HWTEST_F(StartupManagerMockTest, GetStartupConfigString_0100, Function | MediumTest | Level1)
+HWTEST_F(StartupManagerMockTest, GetStartupConfigJson_0100, Function | MediumTest | Level1)
 {
     std::string name = "test_name";
-    std::string config = "test_config";
+    nlohmann::json config;
     std::string startupConfig = "$profile:test";
     std::shared_ptr<StartupManager> startupManager = DelayedSingleton<StartupManager>::GetInstance();
     EXPECT_TRUE(startupManager != nullptr);
     ModuleStartupConfigInfo info(name, startupConfig, "", AppExecFwk::ModuleType::UNKNOWN, false);
-    int32_t ret = startupManager->GetStartupConfigString(info, config);
+    int32_t ret = startupManager->GetStartupConfigJson(info, config);
     EXPECT_EQ(ret, ERR_STARTUP_CONFIG_PARSE_ERROR);
 }
 
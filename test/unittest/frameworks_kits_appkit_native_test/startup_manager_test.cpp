@@ -649,52 +649,41 @@ HWTEST_F(StartupManagerTest, RunAppPreloadSoTaskMainThread_0100, Function | Medi
 }
 
 /**
- * @tc.name: GetStartupConfigString_0100
+ * @tc.name: GetStartupConfigJson_0100
  * @tc.type: FUNC
- * @tc.Function: GetStartupConfigString
+ * @tc.Function: GetStartupConfigJson
  */
-HWTEST_F(StartupManagerTest, GetStartupConfigString_0100, Function | MediumTest | Level1)
+HWTEST_F(StartupManagerTest, GetStartupConfigJson_0100, Function | MediumTest | Level1)
 {
-    GTEST_LOG_(INFO) << "StartupManagerTest GetStartupConfigString_0100 start";
+    GTEST_LOG_(INFO) << "StartupManagerTest GetStartupConfigJson_0100 start";
     std::string name = "test_name";
     std::string config = "test_config";
+    nlohmann::json profileJson;
     std::shared_ptr<StartupManager> startupManager = DelayedSingleton<StartupManager>::GetInstance();
     EXPECT_TRUE(startupManager != nullptr);
     ModuleStartupConfigInfo info(name, "", "", AppExecFwk::ModuleType::UNKNOWN, false);
-    int32_t ret = startupManager->GetStartupConfigString(info, config);
+    int32_t ret = startupManager->GetStartupConfigJson(info, profileJson);
     EXPECT_NE(ret, ERR_OK);
     info.startupConfig_ = config;
-    ret = startupManager->GetStartupConfigString(info, config);
+    ret = startupManager->GetStartupConfigJson(info, profileJson);
     EXPECT_NE(ret, ERR_OK);
-    GTEST_LOG_(INFO) << "StartupManagerTest GetStartupConfigString_0100 end";
+    GTEST_LOG_(INFO) << "StartupManagerTest GetStartupConfigJson_0100 end";
 }
 
 /**
- * @tc.name: AnalyzeStartupConfig_0100
+ * @tc.name: AnalyzeStartupProfile_0100
  * @tc.type: FUNC
- * @tc.Function: AnalyzeStartupConfig
+ * @tc.Function: AnalyzeStartupProfile
  */
-HWTEST_F(StartupManagerTest, AnalyzeStartupConfig_0100, Function | MediumTest | Level1)
+HWTEST_F(StartupManagerTest, AnalyzeStartupProfile_0100, Function | MediumTest | Level1)
 {
-    GTEST_LOG_(INFO) << "StartupManagerTest AnalyzeStartupConfig_0100 start";
+    GTEST_LOG_(INFO) << "StartupManagerTest AnalyzeStartupProfile_0100 start";
     std::shared_ptr<StartupManager> startupManager = DelayedSingleton<StartupManager>::GetInstance();
     EXPECT_TRUE(startupManager != nullptr);
     std::string name = "test_name";
     ModuleStartupConfigInfo info(name, "", "", AppExecFwk::ModuleType::UNKNOWN, false);
-    std::string startupConfig;
-    std::map<std::string, std::shared_ptr<AppStartupTask>> preloadSoStartupTasks;
-    std::map<std::string, std::shared_ptr<AppStartupTask>> preloadSystemSoStartupTasks;
-    std::vector<StartupTaskInfo> pendingStartupTaskInfos;
-    std::pair<std::string, std::string> pendingConfigEntry;
     bool ret = false;
-    ret = startupManager->AnalyzeStartupConfig(info, startupConfig, preloadSoStartupTasks,
-        preloadSystemSoStartupTasks, pendingStartupTaskInfos, pendingConfigEntry);
-    EXPECT_EQ(ret, false);
-    startupConfig = "test_startupConfig";
-    ret = startupManager->AnalyzeStartupConfig(info, startupConfig, preloadSoStartupTasks,
-        preloadSystemSoStartupTasks, pendingStartupTaskInfos, pendingConfigEntry);
-    EXPECT_EQ(ret, false);
-    const nlohmann::json startupConfig_json = R"(
+    nlohmann::json startupConfig_json = R"(
         {
             "startupConfig" : [
                 {
@@ -704,9 +693,8 @@ HWTEST_F(StartupManagerTest, AnalyzeStartupConfig_0100, Function | MediumTest |
             ]
         }
     )"_json;
-    startupConfig = startupConfig_json.dump();
-    ret = startupManager->AnalyzeStartupConfig(info, startupConfig, preloadSoStartupTasks,
-        preloadSystemSoStartupTasks, pendingStartupTaskInfos, pendingConfigEntry);
+    ModuleStartupProfile profile;
+    ret = startupManager->AnalyzeStartupProfile(info, startupConfig_json, profile);
     EXPECT_EQ(ret, true);
 
     info.moduleType_ = AppExecFwk::ModuleType::ENTRY;
@@ -715,11 +703,10 @@ HWTEST_F(StartupManagerTest, AnalyzeStartupConfig_0100, Function | MediumTest |
             {"configEntry", "test_configEntry"}
         }}
     };
-    startupConfig = startupConfigJson.dump();
-    ret = startupManager->AnalyzeStartupConfig(info, startupConfig, preloadSoStartupTasks,
-        preloadSystemSoStartupTasks, pendingStartupTaskInfos, pendingConfigEntry);
+    ModuleStartupProfile entryProfile;
+    ret = startupManager->AnalyzeStartupProfile(info, startupConfigJson, entryProfile);
     EXPECT_EQ(ret, false);
-    GTEST_LOG_(INFO) << "StartupManagerTest AnalyzeStartupConfig_0100 end";
+    GTEST_LOG_(INFO) << "StartupManagerTest AnalyzeStartupProfile_0100 end";
 }
 
 /**
@@ -907,31 +894,27 @@ HWTEST_F(StartupManagerTest, AnalyzePreloadSystemSoStartupTask_0100, Function |
     std::shared_ptr<StartupManager> startupManager = DelayedSingleton<StartupManager>::GetInstance();
     EXPECT_TRUE(startupManager != nullptr);
     std::string name = "test_name";
-    std::map<std::string, std::shared_ptr<AppStartupTask>> preloadSoStartupTasks;
-    startupManager->preloadSystemSoAllowlist_.clear();
+    std::vector<std::pair<std::string, std::string>> preloadSystemSoTasks;
 
     nlohmann::json preloadHintStartupTasksJson1 = R"(
         {"systemPreloadHintStartupTasks":""}
     )"_json;
-    startupManager->AnalyzePreloadSystemSoStartupTask(preloadHintStartupTasksJson1, preloadSoStartupTasks);
-    EXPECT_TRUE(preloadSoStartupTasks.empty());
-
-    startupManager->preloadSystemSoAllowlist_.insert("@ohos:testUrl");
-    startupManager->AnalyzePreloadSystemSoStartupTask(preloadHintStartupTasksJson1, preloadSoStartupTasks);
-    EXPECT_TRUE(preloadSoStartupTasks.empty());
+    startupManager->AnalyzePreloadSystemSoStartupTask(preloadHintStartupTasksJson1, preloadSystemSoTasks);
+    EXPECT_TRUE(preloadSystemSoTasks.empty());
 
     nlohmann::json preloadHintStartupTasksJson2 = R"(
         {"systemPreloadHintStartupTasks":[]}
     )"_json;
-    startupManager->AnalyzePreloadSystemSoStartupTask(preloadHintStartupTasksJson2, preloadSoStartupTasks);
-    EXPECT_TRUE(preloadSoStartupTasks.empty());
+    startupManager->AnalyzePreloadSystemSoStartupTask(preloadHintStartupTasksJson2, preloadSystemSoTasks);
+    EXPECT_TRUE(preloadSystemSoTasks.empty());
 
     nlohmann::json preloadHintStartupTasksJson3 = R"(
         {"systemPreloadHintStartupTasks":[{"name":"testName", "srcEntry":"testEntry", "ohmurl":"@ohos:testUrl"}, {}]}
     )"_json;
-    startupManager->AnalyzePreloadSystemSoStartupTask(preloadHintStartupTasksJson3, preloadSoStartupTasks);
-    EXPECT_FALSE(preloadSoStartupTasks.empty());
-    startupManager->preloadSystemSoAllowlist_.clear();
+    startupManager->AnalyzePreloadSystemSoStartupTask(preloadHintStartupTasksJson3, preloadSystemSoTasks);
+    ASSERT_EQ(preloadSystemSoTasks.size(), 1);
+    EXPECT_EQ(preloadSystemSoTasks[0].first, "testName");
+    EXPECT_EQ(preloadSystemSoTasks[0].second, "@ohos:testUrl");
     GTEST_LOG_(INFO) << "StartupManagerTest AnalyzePreloadSystemSoStartupTask_0100 end";
 }
 
@@ -1140,42 +1123,42 @@ HWTEST_F(StartupManagerTest, AnalyzePreloadSystemSoStartupTaskInner_0100, Functi
     std::shared_ptr<StartupManager> startupManager = DelayedSingleton<StartupManager>::GetInstance();
     EXPECT_TRUE(startupManager != nullptr);
     std::string name = "test_name";
-    std::map<std::string, std::shared_ptr<AppStartupTask>> preloadSoStartupTasks;
+    std::vector<std::pair<std::string, std::string>> preloadSystemSoTasks;
 
     nlohmann::json preloadSoStartupTaskInnerJson0 = R"(
         {"name":"testName"}
     )"_json;
     startupManager->AnalyzePreloadSystemSoStartupTaskInner(preloadSoStartupTaskInnerJson0.at("name"),
-        preloadSoStartupTasks);
-    EXPECT_TRUE(preloadSoStartupTasks.empty());
+        preloadSystemSoTasks);
+    EXPECT_TRUE(preloadSystemSoTasks.empty());
 
     nlohmann::json preloadSoStartupTaskInnerJson1 = R"(
         {}
     )"_json;
     startupManager->AnalyzePreloadSystemSoStartupTaskInner(preloadSoStartupTaskInnerJson1,
-        preloadSoStartupTasks);
-    EXPECT_TRUE(preloadSoStartupTasks.empty());
+        preloadSystemSoTasks);
+    EXPECT_TRUE(preloadSystemSoTasks.empty());
 
     nlohmann::json preloadSoStartupTaskInnerJson2 = R"(
         {"name":[]}
     )"_json;
     startupManager->AnalyzePreloadSystemSoStartupTaskInner(preloadSoStartupTaskInnerJson2,
-        preloadSoStartupTasks);
-    EXPECT_TRUE(preloadSoStartupTasks.empty());
+        preloadSystemSoTasks);
+    EXPECT_TRUE(preloadSystemSoTasks.empty());
 
     nlohmann::json preloadSoStartupTaskInnerJson3 = R"(
         {"name":"testName"}
     )"_json;
     startupManager->AnalyzePreloadSystemSoStartupTaskInner(preloadSoStartupTaskInnerJson3,
-        preloadSoStartupTasks);
-    EXPECT_TRUE(preloadSoStartupTasks.empty());
+        preloadSystemSoTasks);
+    EXPECT_TRUE(preloadSystemSoTasks.empty());
 
     nlohmann::json preloadSoStartupTaskInnerJson4 = R"(
-        {"name":"testName", "ohmurl":"[]"}
+        {"name":"testName", "ohmurl":[]}
     )"_json;
     startupManager->AnalyzePreloadSystemSoStartupTaskInner(preloadSoStartupTaskInnerJson4,
-        preloadSoStartupTasks);
-    EXPECT_TRUE(preloadSoStartupTasks.empty());
+        preloadSystemSoTasks);
+    EXPECT_TRUE(preloadSystemSoTasks.empty());
     GTEST_LOG_(INFO) << "StartupManagerTest AnalyzePreloadSystemSoStartupTaskInner_0100 end";
 }
 
@@ -1189,37 +1172,47 @@ HWTEST_F(StartupManagerTest, AnalyzePreloadSystemSoStartupTaskInner_0200, Functi
     GTEST_LOG_(INFO) << "StartupManagerTest AnalyzePreloadSystemSoStartupTaskInner_0200 start";
     std::shared_ptr<StartupManager> startupManager = DelayedSingleton<StartupManager>::GetInstance();
     EXPECT_TRUE(startupManager != nullptr);
-    std::string name = "test_name";
-    std::map<std::string, std::shared_ptr<AppStartupTask>> preloadSoStartupTasks;
-    startupManager->preloadSystemSoAllowlist_.clear();
+    std::vector<std::pair<std::string, std::string>> preloadSystemSoTasks;
 
     nlohmann::json preloadSoStartupTaskInnerJson1 = R"(
         {"name":"testName", "srcEntry":"testEntry", "ohmurl":"testOhmurl"}
     )"_json;
     startupManager->AnalyzePreloadSystemSoStartupTaskInner(
-        preloadSoStartupTaskInnerJson1.at("name"), preloadSoStartupTasks);
-    EXPECT_TRUE(preloadSoStartupTasks.empty());
+        preloadSoStartupTaskInnerJson1.at("name"), preloadSystemSoTasks);
+    EXPECT_TRUE(preloadSystemSoTasks.empty());
 
     startupManager->AnalyzePreloadSystemSoStartupTaskInner(preloadSoStartupTaskInnerJson1,
-        preloadSoStartupTasks);
+        preloadSystemSoTasks);
+    ASSERT_EQ(preloadSystemSoTasks.size(), 1);
+    EXPECT_EQ(preloadSystemSoTasks[0].first, "testName");
+    EXPECT_EQ(preloadSystemSoTasks[0].second, "testOhmurl");
+    GTEST_LOG_(INFO) << "StartupManagerTest AnalyzePreloadSystemSoStartupTaskInner_0200 end";
+}
+
+/**
+ * @tc.name: AddPreloadSystemSoStartupTask_0100
+ * @tc.type: FUNC
+ * @tc.Function: AddPreloadSystemSoStartupTask
+ */
+HWTEST_F(StartupManagerTest, AddPreloadSystemSoStartupTask_0100, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "StartupManagerTest AddPreloadSystemSoStartupTask_0100 start";
+    std::shared_ptr<StartupManager> startupManager = DelayedSingleton<StartupManager>::GetInstance();
+    EXPECT_TRUE(startupManager != nullptr);
+    std::map<std::string, std::shared_ptr<AppStartupTask>> preloadSoStartupTasks;
+    startupManager->preloadSystemSoAllowlist_.clear();
+
+    startupManager->AddPreloadSystemSoStartupTask("testName", "testOhmurl", preloadSoStartupTasks);
     EXPECT_TRUE(preloadSoStartupTasks.empty());
 
     startupManager->preloadSystemSoAllowlist_.insert("testOhmurl");
-    nlohmann::json preloadSoStartupTaskInnerJson2 = R"(
-        {"name":"", "srcEntry":"testEntry", "ohmurl":"testOhmurl"}
-    )"_json;
-    startupManager->AnalyzePreloadSystemSoStartupTaskInner(preloadSoStartupTaskInnerJson2,
-        preloadSoStartupTasks);
+    startupManager->AddPreloadSystemSoStartupTask("", "testOhmurl", preloadSoStartupTasks);
     EXPECT_TRUE(preloadSoStartupTasks.empty());
 
-    nlohmann::json preloadSoStartupTaskInnerJson3 = R"(
-        {"name":"testName", "srcEntry":"testEntry", "ohmurl":"testOhmurl"}
-    )"_json;
-    startupManager->AnalyzePreloadSystemSoStartupTaskInner(preloadSoStartupTaskInnerJson3,
-        preloadSoStartupTasks);
+    startupManager->AddPreloadSystemSoStartupTask("testName", "testOhmurl", preloadSoStartupTasks);
     EXPECT_FALSE(preloadSoStartupTasks.empty());
     startupManager->preloadSystemSoAllowlist_.clear();
-    GTEST_LOG_(INFO) << "StartupManagerTest AnalyzePreloadSystemSoStartupTaskInner_0200 end";
+    GTEST_LOG_(INFO) << "StartupManagerTest AddPreloadSystemSoStartupTask_0100 end";
 }
 
 /**
@@ -1276,21 +1269,21 @@ HWTEST_F(StartupManagerTest, RunLoadModuleStartupConfigTask_0100, Function | Med
 }
 
 /**
- * @tc.name: GetStartupConfigString_0200
+ * @tc.name: GetStartupConfigJson_0200
  * @tc.type: FUNC
- * @tc.Function: GetStartupConfigString
+ * @tc.Function: GetStartupConfigJson
  */
-HWTEST_F(StartupManagerTest, GetStartupConfigString_0200, Function | MediumTest | Level1)
+HWTEST_F(StartupManagerTest, GetStartupConfigJson_0200, Function | MediumTest | Level1)
 {
     std::string name = "test_name";
-    std::string config = "test_config";
+    nlohmann::json config;
     std::string startupConfig = "$profile:test";
     std::shared_ptr<StartupManager> startupManager = DelayedSingleton<StartupManager>::GetInstance();
     EXPECT_TRUE(startupManager != nullptr);
     std::shared_ptr<Extractor> extractorPtr = std::make_shared<Extractor>("test");
     AbilityBase::ExtractorUtil::extractorMap_.insert(std::make_pair("hap", extractorPtr));
     ModuleStartupConfigInfo info(name, startupConfig, "hap", AppExecFwk::ModuleType::UNKNOWN, false);
-    int32_t ret = startupManager->GetStartupConfigString(info, config);
+    int32_t ret = startupManager->GetStartupConfigJson(info, config);
     EXPECT_EQ(ret, ERR_STARTUP_CONFIG_PATH_ERROR);
 }
 
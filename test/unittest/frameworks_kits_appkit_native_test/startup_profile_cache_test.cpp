@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define private public
+#define protected public
+#include "startup_manager.h"
+#undef private
+#undef protected
+#include "startup_profile_cache.h"
+
+using namespace testing::ext;
+using namespace OHOS::AbilityRuntime;
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+constexpr const char* TEST_CACHE_DIR = "/data/local/tmp/startup_profile_cache_test";
+constexpr const char* TEST_HAP_PATH = "/data/local/tmp/startup_profile_cache_test.hap";
+
+const char* TEST_PROFILE = R"({
+    "configEntry": "./ets/startup/StartupConfig.ets",
+    "startupTasks": [
+        {
+            "name": "Task1",
+            "srcEntry": "./ets/startup/Task1.ets",
+            "dependencies": ["Task2"],
+            "runOnThread": "taskPool",
+            "waitOnMainThread": false,
+            "matchRules": {"uris": ["test://uri"]}
+        },
+        {
+            "name": "Task2",
+            "srcEntry": "./ets/startup/Task2.ets",
+            "excludeFromAutoStart": true
+        }
+    ],
+    "appPreloadHintStartupTasks": [
+        {
+            "name": "So1",
+            "srcEntry": "libso1.so",
+            "ohmurl": "@normalized:Y&&&libso1.so&",
+            "dependencies": ["So2"],
+            "matchRules": {"actions": ["test.action"]}
+        }
+    ],
+    "systemPreloadHintStartupTasks": [
+        {
+            "name": "SystemSo1",
+            "ohmurl": "@ohos:system.so1"
+        }
+    ]
+})";
+
+StartupProfileKey BuildKey()
+{
+    StartupProfileKey key;
+    key.hapPath = TEST_HAP_PATH;
+    key.moduleName = "entry";
+    key.appStartup = "$profile:startup_config";
+    key.hapSize = 1024; // 1024: any size
+    key.hapModifyTime = 1;
+    return key;
+}
+} // namespace
+
+class StartupProfileCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override
+    {
+        DelayedSingleton<StartupManager>::GetInstance()->enableLazyLoadingAppStartupTasks_ = false;
+        DelayedSingleton<StartupManager>::GetInstance()->preloadSystemSoAllowlist_.clear();
+    }
+};
+
+/**
+ * @tc.name: StartupProfileCache_001
+ * @tc.desc: The profile analyzed from json is decoded back only with the key it is encoded with.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StartupProfileCacheTest, StartupProfileCache_001, TestSize.Level1)
+{
+    auto startupManager = DelayedSingleton<StartupManager>::GetInstance();
+    ASSERT_NE(startupManager, nullptr);
+    startupManager->enableLazyLoadingAppStartupTasks_ = false;
+    ModuleStartupConfigInfo info("entry", "$profile:startup_config", TEST_HAP_PATH, ModuleType::ENTRY, true);
+    nlohmann::json profileJson = nlohmann::json::parse(TEST_PROFILE);
+    ModuleStartupProfile profile;
+    ASSERT_TRUE(startupManager->AnalyzeStartupProfile(info, profileJson, profile));
+    EXPECT_TRUE(profile.enableLazyLoading);
+    EXPECT_FALSE(startupManager->enableLazyLoadingAppStartupTasks_);
+
+    std::string data;
+    StartupProfileCache::Encode(BuildKey(), profile, data);
+    ModuleStartupProfile decoded;
+    ASSERT_TRUE(StartupProfileCache::Decode(data, BuildKey(), decoded));
+    EXPECT_EQ(decoded.configEntry.first, "./ets/startup/StartupConfig.ets");
+    ASSERT_EQ(decoded.startupTaskInfos.size(), 2);
+    EXPECT_EQ(decoded.startupTaskInfos[0].name, "Task1");
+    EXPECT_EQ(decoded.startupTaskInfos[0].dependencies, std::vector<std::string>{"Task2"});
+    EXPECT_FALSE(decoded.startupTaskInfos[0].callCreateOnMainThread);
+    EXPECT_FALSE(decoded.startupTaskInfos[0].waitOnMainThread);
+    EXPECT_EQ(decoded.startupTaskInfos[0].matchRules.uris, std::vector<std::string>{"test://uri"});
+    EXPECT_TRUE(decoded.startupTaskInfos[1].excludeFromAutoStart);
+    ASSERT_EQ(decoded.preloadSoTaskInfos.size(), 1);
+    EXPECT_EQ(decoded.preloadSoTaskInfos[0].ohmUrl, "@normalized:Y&&&libso1.so&");
+    EXPECT_EQ(decoded.preloadSoTaskInfos[0].matchRules.actions, std::vector<std::string>{"test.action"});
+    ASSERT_EQ(decoded.preloadSystemSoTasks.size(), 1);
+    EXPECT_EQ(decoded.preloadSystemSoTasks[0].second, "@ohos:system.so1");
+    EXPECT_TRUE(decoded.enableLazyLoading);
+
+    StartupProfileKey key = BuildKey();
+    key.hapModifyTime++;
+    EXPECT_FALSE(StartupProfileCache::Decode(data, key, decoded));
+    EXPECT_FALSE(StartupProfileCache::Decode(data.substr(0, data.size() - 1), BuildKey(), decoded));
+    EXPECT_FALSE(StartupProfileCache::Decode(data + "0", BuildKey(), decoded));
+}
+
+/**
+ * @tc.name: StartupProfileCache_002
+ * @tc.desc: Tasks built from a cached profile are the same as the ones built from the analyzed profile.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StartupProfileCacheTest, StartupProfileCache_002, TestSize.Level1)
+{
+    auto startupManager = DelayedSingleton<StartupManager>::GetInstance();
+    ASSERT_NE(startupManager, nullptr);
+    startupManager->preloadSystemSoAllowlist_ = { "@ohos:system.so1" };
+    ModuleStartupConfigInfo info("entry", "$profile:startup_config", TEST_HAP_PATH, ModuleType::ENTRY, true);
+    std::map<std::string, std::shared_ptr<AppStartupTask>> preloadSoTasks;
+    std::map<std::string, std::shared_ptr<AppStartupTask>> preloadSystemSoTasks;
+    std::vector<StartupTaskInfo> taskInfos;
+    std::pair<std::string, std::string> configEntry;
+    nlohmann::json profileJson = nlohmann::json::parse(TEST_PROFILE);
+    ModuleStartupProfile profile;
+    ASSERT_TRUE(startupManager->AnalyzeStartupProfile(info, profileJson, profile));
+    startupManager->ApplyStartupProfile(info, profile, preloadSoTasks, preloadSystemSoTasks, taskInfos,
+        configEntry);
+    EXPECT_TRUE(startupManager->enableLazyLoadingAppStartupTasks_);
+    EXPECT_EQ(preloadSystemSoTasks.count("SystemSo1"), 1);
+
+    startupManager->enableLazyLoadingAppStartupTasks_ = false;
+    std::string data;
+    StartupProfileCache::Encode(BuildKey(), profile, data);
+    ModuleStartupProfile decoded;
+    ASSERT_TRUE(StartupProfileCache::Decode(data, BuildKey(), decoded));
+    std::map<std::string, std::shared_ptr<AppStartupTask>> cachedPreloadSoTasks;
+    std::map<std::string, std::shared_ptr<AppStartupTask>> cachedPreloadSystemSoTasks;
+    std::vector<StartupTaskInfo> cachedTaskInfos;
+    std::pair<std::string, std::string> cachedConfigEntry;
+    startupManager->ApplyStartupProfile(info, decoded, cachedPreloadSoTasks, cachedPreloadSystemSoTasks,
+        cachedTaskInfos, cachedConfigEntry);
+
+    EXPECT_TRUE(startupManager->enableLazyLoadingAppStartupTasks_);
+    EXPECT_EQ(cachedConfigEntry, configEntry);
+    ASSERT_EQ(cachedTaskInfos.size(), taskInfos.size());
+    for (size_t i = 0; i < taskInfos.size(); i++) {
+        EXPECT_EQ(cachedTaskInfos[i].name, taskInfos[i].name);
+        EXPECT_EQ(cachedTaskInfos[i].srcEntry, taskInfos[i].srcEntry);
+        EXPECT_EQ(cachedTaskInfos[i].moduleName, taskInfos[i].moduleName);
+        EXPECT_EQ(cachedTaskInfos[i].hapPath, taskInfos[i].hapPath);
+        EXPECT_EQ(cachedTaskInfos[i].dependencies, taskInfos[i].dependencies);
+        EXPECT_EQ(cachedTaskInfos[i].excludeFromAutoStart, taskInfos[i].excludeFromAutoStart);
+    }
+    ASSERT_EQ(cachedPreloadSoTasks.size(), 1);
+    auto task = std::static_pointer_cast<PreloadSoStartupTask>(cachedPreloadSoTasks["So1"]);
+    auto expected = std::static_pointer_cast<PreloadSoStartupTask>(preloadSoTasks["So1"]);
+    ASSERT_NE(task, nullptr);
+    ASSERT_NE(expected, nullptr);
+    EXPECT_EQ(task->GetOhmUrl(), expected->GetOhmUrl());
+    EXPECT_EQ(task->path_, expected->path_);
+    EXPECT_EQ(task->GetDependencies(), expected->GetDependencies());
+    EXPECT_EQ(task->GetActionMatchRules(), expected->GetActionMatchRules());
+    EXPECT_EQ(cachedPreloadSystemSoTasks.size(), preloadSystemSoTasks.size());
+    EXPECT_EQ(cachedPreloadSystemSoTasks.count("SystemSo1"), 1);
+}
+
+/**
+ * @tc.name: StartupProfileCache_003
+ * @tc.desc: A saved profile is loaded until the hap file changes.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StartupProfileCacheTest, StartupProfileCache_003, TestSize.Level1)
+{
+    {
+        std::ofstream hap(TEST_HAP_PATH, std::ios::out | std::ios::trunc);
+        ASSERT_TRUE(hap.is_open());
+        hap << "hap";
+    }
+    StartupProfileKey key;
+    ASSERT_TRUE(StartupProfileCache::MakeKey(TEST_HAP_PATH, "entry", "$profile:startup_config", key));
+    EXPECT_FALSE(StartupProfileCache::MakeKey("/data/local/tmp/not_exist.hap", "entry", "", key));
+
+    StartupProfileCache cache(TEST_CACHE_DIR);
+    ModuleStartupProfile profile;
+    profile.configEntry.first = "./ets/startup/StartupConfig.ets";
+    profile.parseCostUs = 100; // 100: any cost
+    ModuleStartupProfile loaded;
+    EXPECT_FALSE(cache.Load(key, loaded));
+    ASSERT_TRUE(cache.Save(key, profile));
+    ASSERT_TRUE(cache.Load(key, loaded));
+    EXPECT_EQ(loaded.configEntry.first, profile.configEntry.first);
+    EXPECT_EQ(loaded.parseCostUs, profile.parseCostUs);
+
+    {
+        std::ofstream hap(TEST_HAP_PATH, std::ios::out | std::ios::app);
+        hap << "updated";
+    }
+    StartupProfileKey newKey;
+    ASSERT_TRUE(StartupProfileCache::MakeKey(TEST_HAP_PATH, "entry", "$profile:startup_config", newKey));
+    EXPECT_FALSE(cache.Load(newKey, loaded));
+
+    std::string filePath = cache.GetFilePath(key);
+    unlink(filePath.c_str());
+    rmdir(TEST_CACHE_DIR);
+    unlink(TEST_HAP_PATH);
+}
+} // namespace AppExecFwk
+} // namespace OHOS
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <unistd.h>
+#define private public
+#define protected public
+#include "startup_task_cost_recorder.h"
+#include "startup_task_dispatcher.h"
+#undef private
+#undef protected
+#include "hilog_tag_wrapper.h"
+#include "native_startup_task.h"
+#include "startup_topologysort.h"
+
+using namespace testing::ext;
+using namespace OHOS::AbilityRuntime;
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+constexpr const char* TEST_CACHE_DIR = "/data/local/tmp/startup_task_cost_test";
+constexpr int32_t BENCHMARK_LOOP = 1000;
+constexpr int32_t BENCHMARK_LAYER_COUNT = 8;
+constexpr int32_t BENCHMARK_LAYER_WIDTH = 8;
+
+struct TestTaskRecord {
+    std::vector<std::string> startedTasks;
+    std::map<std::string, std::unique_ptr<StartupTaskResultCallback>> callbacks;
+};
+
+std::shared_ptr<StartupTask> CreateTask(const std::string &name, const std::vector<std::string> &dependencies,
+    bool callCreateOnMainThread, const std::shared_ptr<TestTaskRecord> &record)
+{
+    auto task = std::make_shared<NativeStartupTask>(name,
+        [name, record](std::unique_ptr<StartupTaskResultCallback> callback) {
+            record->startedTasks.emplace_back(name);
+            record->callbacks[name] = std::move(callback);
+            return ERR_OK;
+        });
+    task->SetDependencies(dependencies);
+    task->SetCallCreateOnMainThread(callCreateOnMainThread);
+    task->SetWaitOnMainThread(false);
+    return task;
+}
+
+std::shared_ptr<StartupTask> CreateSyncTask(const std::string &name, const std::vector<std::string> &dependencies)
+{
+    auto task = std::make_shared<NativeStartupTask>(name, [](std::unique_ptr<StartupTaskResultCallback> callback) {
+        callback->Call(std::make_shared<StartupTaskResult>());
+        return ERR_OK;
+    });
+    task->SetDependencies(dependencies);
+    task->SetCallCreateOnMainThread(false);
+    task->SetWaitOnMainThread(false);
+    return task;
+}
+
+void CompleteTask(const std::shared_ptr<TestTaskRecord> &record, const std::string &name)
+{
+    auto callback = std::move(record->callbacks[name]);
+    ASSERT_NE(callback, nullptr);
+    callback->Call(std::make_shared<StartupTaskResult>());
+}
+} // namespace
+
+class StartupTaskDispatcherTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override
+    {
+        auto &costRecorder = StartupTaskCostRecorder::GetInstance();
+        costRecorder.isLoaded_ = false;
+        costRecorder.isChanged_ = false;
+        costRecorder.cacheDir_.clear();
+        costRecorder.costs_.clear();
+    }
+};
+
+/**
+ * @tc.name: StartupTopologySort_001
+ * @tc.desc: The graph is compiled into indexes in the order of the task names, and a task with a longer path to
+ *           the end has a higher priority.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StartupTaskDispatcherTest, StartupTopologySort_001, TestSize.Level1)
+{
+    auto record = std::make_shared<TestTaskRecord>();
+    std::map<std::string, std::shared_ptr<StartupTask>> tasks;
+    tasks.emplace("a", CreateTask("a", {}, false, record));
+    tasks.emplace("b", CreateTask("b", {}, false, record));
+    tasks.emplace("c", CreateTask("c", { "b" }, false, record));
+    tasks.emplace("d", CreateTask("d", { "a", "c" }, false, record));
+    StartupTaskCostRecorder::GetInstance().costs_["a"] = 100; // 100: measured cost of a
+
+    std::shared_ptr<StartupSortResult> sortResult;
+    ASSERT_EQ(StartupTopologySort::Sort(tasks, sortResult), ERR_OK);
+    ASSERT_NE(sortResult, nullptr);
+    ASSERT_EQ(sortResult->tasks_.size(), 4);
+    EXPECT_EQ(sortResult->tasks_[3]->GetName(), "d");
+    EXPECT_EQ(sortResult->zeroIndexes_, (std::vector<uint32_t>{ 0, 1 }));
+    EXPECT_EQ(sortResult->childrenIndexes_[1], std::vector<uint32_t>{ 2 });
+    EXPECT_EQ(sortResult->inDegrees_, (std::vector<uint32_t>{ 0, 0, 1, 2 }));
+    EXPECT_EQ(sortResult->priorities_, (std::vector<int64_t>{ 101, 3, 2, 1 }));
+
+    tasks["b"]->SetDependencies({ "d" });
+    EXPECT_EQ(StartupTopologySort::Sort(tasks, sortResult), ERR_STARTUP_CIRCULAR_DEPENDENCY);
+    tasks["b"]->SetDependencies({ "e" });
+    EXPECT_EQ(StartupTopologySort::Sort(tasks, sortResult), ERR_STARTUP_DEPENDENCY_NOT_FOUND);
+}
+
+/**
+ * @tc.name: StartupTaskDispatcher_001
+ * @tc.desc: Ready worker tasks start before the main thread ones, the one on the critical path first.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StartupTaskDispatcherTest, StartupTaskDispatcher_001, TestSize.Level1)
+{
+    auto record = std::make_shared<TestTaskRecord>();
+    std::map<std::string, std::shared_ptr<StartupTask>> tasks;
+    tasks.emplace("a_main", CreateTask("a_main", {}, true, record));
+    tasks.emplace("b_short", CreateTask("b_short", {}, false, record));
+    tasks.emplace("c_long", CreateTask("c_long", {}, false, record));
+    tasks.emplace("d_child", CreateTask("d_child", { "c_long" }, false, record));
+    tasks.emplace("e_child", CreateTask("e_child", { "d_child" }, true, record));
+    std::shared_ptr<StartupSortResult> sortResult;
+    ASSERT_EQ(StartupTopologySort::Sort(tasks, sortResult), ERR_OK);
+
+    bool isCompleted = false;
+    auto completedCallback = std::make_shared<OnCompletedCallback>(
+        [&isCompleted](const std::shared_ptr<StartupTaskResult> &result) {
+            isCompleted = true;
+        });
+    auto dispatcher = std::make_shared<StartupTaskDispatcher>(sortResult);
+    ASSERT_EQ(dispatcher->Run(completedCallback, nullptr), ERR_OK);
+    EXPECT_EQ(record->startedTasks, (std::vector<std::string>{ "c_long", "b_short", "a_main" }));
+
+    CompleteTask(record, "c_long");
+    EXPECT_EQ(record->startedTasks.back(), "d_child");
+    CompleteTask(record, "a_main");
+    CompleteTask(record, "b_short");
+    CompleteTask(record, "d_child");
+    EXPECT_EQ(record->startedTasks.back(), "e_child");
+    EXPECT_FALSE(isCompleted);
+    CompleteTask(record, "e_child");
+    EXPECT_TRUE(isCompleted);
+    EXPECT_GE(StartupTaskCostRecorder::GetInstance().GetCostUs("c_long"), 1);
+    EXPECT_TRUE(StartupTaskCostRecorder::GetInstance().isChanged_);
+}
+
+/**
+ * @tc.name: StartupTaskCostRecorder_001
+ * @tc.desc: Costs saved by a launch are loaded by the next one, and smoothed when recorded again.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StartupTaskDispatcherTest, StartupTaskCostRecorder_001, TestSize.Level1)
+{
+    auto &costRecorder = StartupTaskCostRecorder::GetInstance();
+    unlink((std::string(TEST_CACHE_DIR) + "/startup_task_cost").c_str());
+    costRecorder.Load(TEST_CACHE_DIR);
+    EXPECT_EQ(costRecorder.GetCostUs("task with space"), 1);
+    costRecorder.Record("task with space", 400); // 400: measured cost
+    costRecorder.Record("other", 100); // 100: measured cost
+    costRecorder.Save();
+    EXPECT_FALSE(costRecorder.isChanged_);
+
+    costRecorder.isLoaded_ = false;
+    costRecorder.costs_.clear();
+    costRecorder.Load(TEST_CACHE_DIR);
+    EXPECT_EQ(costRecorder.GetCostUs("task with space"), 400);
+    EXPECT_EQ(costRecorder.GetCostUs("other"), 100);
+    costRecorder.Record("task with space", 800); // 800: cost of the next launch
+    EXPECT_EQ(costRecorder.GetCostUs("task with space"), 500);
+}
+
+/**
+ * @tc.name: StartupTaskDispatcher_Benchmark_001
+ * @tc.desc: Cost of sorting and dispatching a layered graph of 64 tasks which complete synchronously.
+ * @tc.type: PERF
+ */
+HWTEST_F(StartupTaskDispatcherTest, StartupTaskDispatcher_Benchmark_001, TestSize.Level3)
+{
+    std::map<std::string, std::shared_ptr<StartupTask>> tasks;
+    auto begin = std::chrono::steady_clock::now();
+    for (int32_t loop = 0; loop < BENCHMARK_LOOP; loop++) {
+        tasks.clear();
+        for (int32_t layer = 0; layer < BENCHMARK_LAYER_COUNT; layer++) {
+            for (int32_t i = 0; i < BENCHMARK_LAYER_WIDTH; i++) {
+                std::vector<std::string> dependencies;
+                if (layer > 0) {
+                    dependencies.emplace_back("task_" + std::to_string(layer - 1) + "_" + std::to_string(i));
+                    dependencies.emplace_back("task_" + std::to_string(layer - 1) + "_0");
+                }
+                std::string name = "task_" + std::to_string(layer) + "_" + std::to_string(i);
+                tasks.emplace(name, CreateSyncTask(name, dependencies));
+            }
+        }
+        std::shared_ptr<StartupSortResult> sortResult;
+        ASSERT_EQ(StartupTopologySort::Sort(tasks, sortResult), ERR_OK);
+        int32_t completedCount = 0;
+        auto completedCallback = std::make_shared<OnCompletedCallback>(
+            [&completedCount](const std::shared_ptr<StartupTaskResult> &result) {
+                completedCount++;
+            });
+        auto dispatcher = std::make_shared<StartupTaskDispatcher>(sortResult);
+        ASSERT_EQ(dispatcher->Run(completedCallback, nullptr), ERR_OK);
+        ASSERT_EQ(completedCount, 1);
+    }
+    auto costNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - begin).count() / BENCHMARK_LOOP;
+    TAG_LOGI(AAFwkTag::TEST, "tasks: %{public}zu, %{public}lld ns/op", tasks.size(),
+        static_cast<long long>(costNs));
+}
+} // namespace AppExecFwk
+} // namespace OHOS
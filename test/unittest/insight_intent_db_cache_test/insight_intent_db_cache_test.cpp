@@ -31,6 +31,26 @@ void MockLoadConfigInsightIntentInfos(bool mockRet);
 void MockLoadConfigInsightIntentInfoByName(bool mockRet);
 void MockLoadConfigInsightIntentInfo(bool mockRet);
 
+namespace {
+std::vector<InsightIntentInfo> BuildConfigInfos(const std::string &prefix, int32_t count)
+{
+    std::vector<InsightIntentInfo> configInfos;
+    for (int32_t i = 0; i < count; i++) {
+        InsightIntentInfo configInfo;
+        configInfo.intentName = prefix + std::to_string(i);
+        configInfos.emplace_back(configInfo);
+    }
+    return configInfos;
+}
+
+void ResetIntentCache(int32_t userId)
+{
+    MockLoadInsightIntentInfos(true);
+    DelayedSingleton<InsightIntentDbCache>::GetInstance()->InitInsightIntentCache(userId + 1);
+    DelayedSingleton<InsightIntentDbCache>::GetInstance()->InitInsightIntentCache(userId);
+}
+}
+
 class InsightIntentDbCacheTest : public testing::Test {
 public:
     static void SetUpTestCase();
@@ -374,5 +394,113 @@ HWTEST_F(InsightIntentDbCacheTest, InsightIntentDbCacheTest_008, TestSize.Level0
         bundleName, moduleName, intentName, otherUserId, infoEmpty);
     EXPECT_TRUE(infoEmpty.intentName.empty());
 }
+
+/**
+ * @tc.name: InsightIntentDbCacheTest_009
+ * @tc.desc: Test intents of the cache user are served from the parsed cache and follow save and delete
+ * @tc.type: FUNC
+ */
+HWTEST_F(InsightIntentDbCacheTest, InsightIntentDbCacheTest_009, TestSize.Level0)
+{
+    int32_t userId = 0;
+    std::string bundleName = "cache.bundle";
+    std::string moduleName = "cacheModule";
+    auto dbCache = DelayedSingleton<InsightIntentDbCache>::GetInstance();
+    ResetIntentCache(userId);
+    MockDeleteData(true);
+    MockSaveData(true);
+    ExtractInsightIntentProfileInfoVec profileInfos;
+    EXPECT_EQ(dbCache->SaveInsightIntentTotalInfo(bundleName, moduleName, userId, 1, profileInfos,
+        BuildConfigInfos("intent", 2)), ERR_OK);
+
+    MockLoadConfigInsightIntentInfo(false);
+    MockLoadConfigInsightIntentInfoByName(false);
+    InsightIntentInfo info;
+    dbCache->GetConfigInsightIntentInfo(bundleName, moduleName, "intent1", userId, info);
+    EXPECT_EQ(info.intentName, "intent1");
+    EXPECT_EQ(info.bundleName, bundleName);
+    EXPECT_EQ(info.moduleName, moduleName);
+    std::vector<InsightIntentInfo> configInfos;
+    dbCache->GetConfigInsightIntentInfoByName(bundleName, userId, configInfos);
+    EXPECT_EQ(configInfos.size(), 2);
+
+    EXPECT_EQ(dbCache->DeleteInsightIntentTotalInfo(bundleName, moduleName, userId), ERR_OK);
+    configInfos.clear();
+    dbCache->GetConfigInsightIntentInfoByName(bundleName, userId, configInfos);
+    EXPECT_TRUE(configInfos.empty());
+    InsightIntentInfo deletedInfo;
+    dbCache->GetConfigInsightIntentInfo(bundleName, moduleName, "intent1", userId, deletedInfo);
+    EXPECT_TRUE(deletedInfo.intentName.empty());
+    MockLoadConfigInsightIntentInfo(true);
+    MockLoadConfigInsightIntentInfoByName(true);
+}
+
+/**
+ * @tc.name: InsightIntentDbCacheTest_010
+ * @tc.desc: Test the least recently used bundles are evicted and loaded from storage again
+ * @tc.type: FUNC
+ */
+HWTEST_F(InsightIntentDbCacheTest, InsightIntentDbCacheTest_010, TestSize.Level0)
+{
+    int32_t userId = 0;
+    constexpr int32_t bundleCount = 5;
+    constexpr int32_t intentCount = 1000;
+    auto dbCache = DelayedSingleton<InsightIntentDbCache>::GetInstance();
+    ResetIntentCache(userId);
+    MockDeleteData(true);
+    MockSaveData(true);
+    ExtractInsightIntentProfileInfoVec profileInfos;
+    for (int32_t i = 0; i < bundleCount; i++) {
+        EXPECT_EQ(dbCache->SaveInsightIntentTotalInfo("bundle" + std::to_string(i), "module", userId, 1,
+            profileInfos, BuildConfigInfos("intent", intentCount)), ERR_OK);
+    }
+
+    MockLoadConfigInsightIntentInfoByName(false);
+    std::vector<InsightIntentInfo> configInfos;
+    dbCache->GetConfigInsightIntentInfoByName("bundle4", userId, configInfos);
+    EXPECT_EQ(configInfos.size(), static_cast<size_t>(intentCount));
+    configInfos.clear();
+    dbCache->GetConfigInsightIntentInfoByName("bundle0", userId, configInfos);
+    EXPECT_TRUE(configInfos.empty());
+
+    MockLoadConfigInsightIntentInfoByName(true);
+    dbCache->GetConfigInsightIntentInfoByName("bundle0", userId, configInfos);
+    EXPECT_FALSE(configInfos.empty());
+}
+
+/**
+ * @tc.name: InsightIntentDbCacheTest_011
+ * @tc.desc: Test config intents of many bundles of the cache user are all served from the cache
+ * @tc.type: FUNC
+ */
+HWTEST_F(InsightIntentDbCacheTest, InsightIntentDbCacheTest_011, TestSize.Level0)
+{
+    int32_t userId = 0;
+    constexpr int32_t bundleCount = 200;
+    constexpr int32_t intentCount = 10;
+    auto dbCache = DelayedSingleton<InsightIntentDbCache>::GetInstance();
+    ResetIntentCache(userId);
+    MockDeleteData(true);
+    MockSaveData(true);
+    ExtractInsightIntentProfileInfoVec profileInfos;
+    for (int32_t i = 0; i < bundleCount; i++) {
+        EXPECT_EQ(dbCache->SaveInsightIntentTotalInfo("bundle" + std::to_string(i), "module", userId, 1,
+            profileInfos, BuildConfigInfos("intent", intentCount)), ERR_OK);
+    }
+
+    MockLoadConfigInsightIntentInfo(false);
+    for (int32_t i = 0; i < bundleCount; i++) {
+        std::string bundleName = "bundle" + std::to_string(i);
+        std::string intentName = "intent" + std::to_string(i % intentCount);
+        InsightIntentInfo info;
+        dbCache->GetConfigInsightIntentInfo(bundleName, "module", intentName, userId, info);
+        EXPECT_EQ(info.intentName, intentName);
+        EXPECT_EQ(info.bundleName, bundleName);
+    }
+    InsightIntentInfo missingInfo;
+    dbCache->GetConfigInsightIntentInfo("bundle0", "module", "missing", userId, missingInfo);
+    EXPECT_TRUE(missingInfo.intentName.empty());
+    MockLoadConfigInsightIntentInfo(true);
+}
+}
 }
-}
\ No newline at end of file
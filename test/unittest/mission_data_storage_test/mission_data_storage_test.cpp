@@ -13,21 +13,34 @@
  * limitations under the License.
  */
 
+#include <chrono>
+#include <fstream>
 #include <gtest/gtest.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #define private public
 #define protected public
 #include "mission_data_storage.h"
+#include "mission_info_log.h"
 #ifdef SUPPORT_SCREEN
 #include "pixel_map.h"
 #endif //SUPPORT_SCREEN
 #undef private
 #undef protected
+#include "directory_ex.h"
+#include "file_ex.h"
+#include "hilog_tag_wrapper.h"
 
 using namespace testing::ext;
 using namespace OHOS::AppExecFwk;
 
 namespace OHOS {
 namespace AAFwk {
+namespace {
+constexpr const char* TEST_LOG_PATH = "/data/local/tmp/mission_info_log_test.log";
+constexpr int TEST_USER_ID = 1099;
+}
+
 class MissionDataStorageTest : public testing::Test {
 public:
     static void SetUpTestCase(void);
@@ -163,7 +176,7 @@ HWTEST_F(MissionDataStorageTest, GetMissionSnapshot_001, TestSize.Level1)
     int missionId = 0;
     MissionSnapshot missionSnapshot;
     bool isLowResolution = true;
-    missionDataStorage->SaveCachedSnapshot(missionId, missionSnapshot);
+    missionDataStorage->QueueMissionSnapshot(missionId, missionSnapshot);
     bool res = missionDataStorage->GetMissionSnapshot(missionId, missionSnapshot, isLowResolution);
     EXPECT_TRUE(res);
 }
@@ -182,7 +195,7 @@ HWTEST_F(MissionDataStorageTest, GetMissionSnapshot_002, TestSize.Level1)
     int missionId = 0;
     MissionSnapshot missionSnapshot;
     bool isLowResolution = false;
-    missionDataStorage->SaveCachedSnapshot(missionId, missionSnapshot);
+    missionDataStorage->QueueMissionSnapshot(missionId, missionSnapshot);
     bool res = missionDataStorage->GetMissionSnapshot(missionId, missionSnapshot, isLowResolution);
     EXPECT_TRUE(res);
 }
@@ -269,7 +282,7 @@ HWTEST_F(MissionDataStorageTest, SaveSnapshotFile_001, TestSize.Level1)
     EXPECT_NE(missionDataStorage, nullptr);
     int32_t missionId = 0;
     MissionSnapshot missionSnapshot;
-    missionDataStorage->SaveSnapshotFile(missionId, missionSnapshot);
+    missionDataStorage->SaveSnapshotFile(missionId, missionSnapshot.snapshot, missionSnapshot.isPrivate, false);
 }
 
 /*
@@ -287,7 +300,7 @@ HWTEST_F(MissionDataStorageTest, SaveSnapshotFile_002, TestSize.Level1)
     int32_t missionId = 1;
     MissionSnapshot missionSnapshot;
     missionSnapshot.snapshot = std::make_shared<Media::PixelMap>();
-    missionDataStorage->SaveSnapshotFile(missionId, missionSnapshot);
+    missionDataStorage->SaveSnapshotFile(missionId, missionSnapshot.snapshot, missionSnapshot.isPrivate, false);
 }
 
 /*
@@ -306,7 +319,7 @@ HWTEST_F(MissionDataStorageTest, SaveSnapshotFile_004, TestSize.Level1)
     MissionSnapshot missionSnapshot;
     missionSnapshot.snapshot = std::make_shared<Media::PixelMap>();
     missionSnapshot.snapshot->imageInfo_.pixelFormat = Media::PixelFormat::RGB_565;
-    missionDataStorage->SaveSnapshotFile(missionId, missionSnapshot);
+    missionDataStorage->SaveSnapshotFile(missionId, missionSnapshot.snapshot, missionSnapshot.isPrivate, false);
 }
 
 /*
@@ -325,7 +338,7 @@ HWTEST_F(MissionDataStorageTest, SaveSnapshotFile_005, TestSize.Level1)
     MissionSnapshot missionSnapshot;
     missionSnapshot.snapshot = std::make_shared<Media::PixelMap>();
     missionSnapshot.snapshot->imageInfo_.pixelFormat = Media::PixelFormat::RGBA_8888;
-    missionDataStorage->SaveSnapshotFile(missionId, missionSnapshot);
+    missionDataStorage->SaveSnapshotFile(missionId, missionSnapshot.snapshot, missionSnapshot.isPrivate, false);
 }
 
 /*
@@ -344,7 +357,7 @@ HWTEST_F(MissionDataStorageTest, SaveSnapshotFile_006, TestSize.Level1)
     MissionSnapshot missionSnapshot;
     missionSnapshot.snapshot = std::make_shared<Media::PixelMap>();
     missionSnapshot.snapshot->imageInfo_.pixelFormat = Media::PixelFormat::RGB_888;
-    missionDataStorage->SaveSnapshotFile(missionId, missionSnapshot);
+    missionDataStorage->SaveSnapshotFile(missionId, missionSnapshot.snapshot, missionSnapshot.isPrivate, false);
 }
 
 /*
@@ -362,7 +375,7 @@ HWTEST_F(MissionDataStorageTest, SaveSnapshotFile_007, TestSize.Level1)
     int32_t missionId = 0;
     MissionSnapshot missionSnapshot;
     missionSnapshot.snapshot = std::make_shared<Media::PixelMap>();
-    missionDataStorage->SaveSnapshotFile(missionId, missionSnapshot);
+    missionDataStorage->SaveSnapshotFile(missionId, missionSnapshot.snapshot, missionSnapshot.isPrivate, false);
 }
 
 /*
@@ -434,123 +447,387 @@ HWTEST_F(MissionDataStorageTest, GetCachedSnapshot_002, TestSize.Level1)
 
 /*
  * Feature: MissionDataStorage
- * Function: SaveCachedSnapshot
+ * Function: GetSnapshot
  * SubFunction: NA
- * FunctionPoints: MissionDataStorage SaveCachedSnapshot
+ * FunctionPoints: MissionDataStorage GetSnapshot
  * EnvConditions: NA
- * CaseDescription: Verify SaveCachedSnapshot
+ * CaseDescription: Verify GetSnapshot
  */
-HWTEST_F(MissionDataStorageTest, SaveCachedSnapshot_001, TestSize.Level1)
+HWTEST_F(MissionDataStorageTest, GetSnapshot_001, TestSize.Level1)
 {
     auto missionDataStorage = std::make_shared<MissionDataStorage>();
     int32_t missionId = 0;
-    MissionSnapshot missionSnapshot;
-    missionSnapshot.snapshot = std::make_shared<Media::PixelMap>();
-    bool res = missionDataStorage->SaveCachedSnapshot(missionId, missionSnapshot);
-    EXPECT_TRUE(res);
+    bool isLowResolution = true;
+    std::shared_ptr<Media::PixelMap> res = missionDataStorage->GetSnapshot(missionId, isLowResolution);
+    EXPECT_EQ(res, nullptr);
 }
 
 /*
  * Feature: MissionDataStorage
- * Function: SaveCachedSnapshot
+ * Function: GetPixelMap
  * SubFunction: NA
- * FunctionPoints: MissionDataStorage SaveCachedSnapshot
+ * FunctionPoints: MissionDataStorage GetPixelMap
  * EnvConditions: NA
- * CaseDescription: Verify SaveCachedSnapshot
+ * CaseDescription: Verify GetPixelMap
  */
-HWTEST_F(MissionDataStorageTest, SaveCachedSnapshot_002, TestSize.Level1)
+HWTEST_F(MissionDataStorageTest, GetPixelMap_001, TestSize.Level1)
 {
     auto missionDataStorage = std::make_shared<MissionDataStorage>();
     int32_t missionId = 0;
-    MissionSnapshot missionSnapshot;
-    missionDataStorage->SaveCachedSnapshot(missionId, missionSnapshot);
-    bool res = missionDataStorage->SaveCachedSnapshot(missionId, missionSnapshot);
-    EXPECT_FALSE(res);
+    bool isLowResolution = true;
+    std::unique_ptr<Media::PixelMap> res = missionDataStorage->GetPixelMap(missionId, isLowResolution);
+    EXPECT_EQ(res, nullptr);
 }
 
 /*
  * Feature: MissionDataStorage
- * Function: DeleteCachedSnapshot
+ * Function: GetPixelMap
  * SubFunction: NA
- * FunctionPoints: MissionDataStorage DeleteCachedSnapshot
+ * FunctionPoints: MissionDataStorage GetPixelMap
  * EnvConditions: NA
- * CaseDescription: Verify DeleteCachedSnapshot
+ * CaseDescription: Verify GetPixelMap
  */
-HWTEST_F(MissionDataStorageTest, DeleteCachedSnapshot_001, TestSize.Level1)
+HWTEST_F(MissionDataStorageTest, GetPixelMap_002, TestSize.Level1)
 {
     auto missionDataStorage = std::make_shared<MissionDataStorage>();
-    int32_t missionId = 0;
-    bool res = missionDataStorage->DeleteCachedSnapshot(missionId);
-    EXPECT_FALSE(res);
+    EXPECT_NE(missionDataStorage, nullptr);
+    int32_t missionId = 100;
+    bool isLowResolution = false;
+    std::unique_ptr<Media::PixelMap> res = missionDataStorage->GetPixelMap(missionId, isLowResolution);
+    EXPECT_EQ(res, nullptr);
+}
+
+/*
+ * Feature: MissionInfoLog
+ * Function: Put/Delete/Load
+ * SubFunction: NA
+ * FunctionPoints: MissionInfoLog replays the last record of every mission
+ * EnvConditions: NA
+ * CaseDescription: Verify records survive a reload
+ */
+HWTEST_F(MissionDataStorageTest, MissionInfoLog_001, TestSize.Level1)
+{
+    OHOS::RemoveFile(TEST_LOG_PATH);
+    {
+        MissionInfoLog missionLog(TEST_LOG_PATH);
+        EXPECT_TRUE(missionLog.Put(1, "first"));
+        EXPECT_TRUE(missionLog.Put(2, "second"));
+        EXPECT_TRUE(missionLog.Put(1, "first updated"));
+        EXPECT_TRUE(missionLog.Delete(2));
+        EXPECT_FALSE(missionLog.Delete(3));
+    }
+    MissionInfoLog missionLog(TEST_LOG_PATH);
+    std::map<int32_t, std::string> records;
+    EXPECT_TRUE(missionLog.Load(records));
+    ASSERT_EQ(records.size(), 1);
+    EXPECT_EQ(records[1], "first updated");
+    OHOS::RemoveFile(TEST_LOG_PATH);
+}
+
+/*
+ * Feature: MissionInfoLog
+ * Function: Load
+ * SubFunction: NA
+ * FunctionPoints: MissionInfoLog drops a torn tail record
+ * EnvConditions: NA
+ * CaseDescription: Verify the records before a partial append are kept and the tail is cut off
+ */
+HWTEST_F(MissionDataStorageTest, MissionInfoLog_002, TestSize.Level1)
+{
+    OHOS::RemoveFile(TEST_LOG_PATH);
+    {
+        MissionInfoLog missionLog(TEST_LOG_PATH);
+        EXPECT_TRUE(missionLog.Put(1, "first"));
+    }
+    std::string record = MissionInfoLog::EncodeRecord(MissionInfoLog::RECORD_PUT, 2, "second");
+    {
+        std::ofstream file(TEST_LOG_PATH, std::ios::binary | std::ios::app);
+        file.write(record.data(), record.size() / 2);
+    }
+    MissionInfoLog missionLog(TEST_LOG_PATH);
+    std::map<int32_t, std::string> records;
+    EXPECT_TRUE(missionLog.Load(records));
+    ASSERT_EQ(records.size(), 1);
+    EXPECT_EQ(records[1], "first");
+    EXPECT_TRUE(missionLog.Put(2, "second"));
+
+    MissionInfoLog reloadLog(TEST_LOG_PATH);
+    EXPECT_TRUE(reloadLog.Load(records));
+    EXPECT_EQ(records.size(), 2);
+    OHOS::RemoveFile(TEST_LOG_PATH);
+}
+
+/*
+ * Feature: MissionInfoLog
+ * Function: Put
+ * SubFunction: NA
+ * FunctionPoints: MissionInfoLog rewrites the file when dead records dominate it
+ * EnvConditions: NA
+ * CaseDescription: Verify the file shrinks after compaction and keeps the live records
+ */
+HWTEST_F(MissionDataStorageTest, MissionInfoLog_003, TestSize.Level1)
+{
+    OHOS::RemoveFile(TEST_LOG_PATH);
+    MissionInfoLog missionLog(TEST_LOG_PATH);
+    std::string content(1024, 'a');
+    for (int32_t i = 0; i < 1000; i++) {
+        EXPECT_TRUE(missionLog.Put(i % 10, content));
+    }
+    EXPECT_LT(missionLog.fileSize_, 1000 * content.size());
+    EXPECT_EQ(missionLog.liveSize_, 10 * MissionInfoLog::EncodeRecord(MissionInfoLog::RECORD_PUT, 0,
+        content).size());
+
+    MissionInfoLog reloadLog(TEST_LOG_PATH);
+    std::map<int32_t, std::string> records;
+    EXPECT_TRUE(reloadLog.Load(records));
+    EXPECT_EQ(records.size(), 10);
+    OHOS::RemoveFile(TEST_LOG_PATH);
 }
 
 /*
  * Feature: MissionDataStorage
- * Function: DeleteCachedSnapshot
+ * Function: LoadAllMissionInfo
  * SubFunction: NA
- * FunctionPoints: MissionDataStorage DeleteCachedSnapshot
+ * FunctionPoints: MissionDataStorage migrates legacy json files into the mission log
  * EnvConditions: NA
- * CaseDescription: Verify DeleteCachedSnapshot
+ * CaseDescription: Verify legacy missions are loaded once and their files removed
  */
-HWTEST_F(MissionDataStorageTest, DeleteCachedSnapshot_002, TestSize.Level1)
+HWTEST_F(MissionDataStorageTest, LoadAllMissionInfo_001, TestSize.Level1)
 {
-    auto missionDataStorage = std::make_shared<MissionDataStorage>();
-    missionDataStorage->cachedPixelMap_.insert({ 0, nullptr });
-    int32_t missionId = 0;
-    bool res = missionDataStorage->DeleteCachedSnapshot(missionId);
-    EXPECT_TRUE(res);
+    auto missionDataStorage = std::make_shared<MissionDataStorage>(TEST_USER_ID);
+    std::string dirPath = missionDataStorage->GetMissionDataDirPath();
+    OHOS::ForceRemoveDirectory(dirPath);
+    ASSERT_TRUE(missionDataStorage->EnsureMissionDataDir());
+    InnerMissionInfo legacyInfo;
+    legacyInfo.missionInfo.id = 5;
+    legacyInfo.isTemporary = false;
+    std::string legacyPath = missionDataStorage->GetMissionDataFilePath(5);
+    ASSERT_TRUE(OHOS::SaveStringToFile(legacyPath, legacyInfo.ToJsonStr(), true));
+    InnerMissionInfo savedInfo;
+    savedInfo.missionInfo.id = 6;
+    savedInfo.isTemporary = false;
+    missionDataStorage->SaveMissionInfo(savedInfo);
+
+    std::list<InnerMissionInfo> missionInfoList;
+    EXPECT_TRUE(missionDataStorage->LoadAllMissionInfo(missionInfoList));
+    EXPECT_EQ(missionInfoList.size(), 2);
+    EXPECT_FALSE(OHOS::FileExists(legacyPath));
+
+    auto reloadStorage = std::make_shared<MissionDataStorage>(TEST_USER_ID);
+    missionInfoList.clear();
+    EXPECT_TRUE(reloadStorage->LoadAllMissionInfo(missionInfoList));
+    EXPECT_EQ(missionInfoList.size(), 2);
+    reloadStorage->DeleteMissionInfo(5);
+    missionInfoList.clear();
+    EXPECT_TRUE(reloadStorage->LoadAllMissionInfo(missionInfoList));
+    EXPECT_EQ(missionInfoList.size(), 1);
+    OHOS::ForceRemoveDirectory(dirPath);
 }
 
 /*
  * Feature: MissionDataStorage
- * Function: GetSnapshot
+ * Function: LoadAllMissionInfo
  * SubFunction: NA
- * FunctionPoints: MissionDataStorage GetSnapshot
+ * FunctionPoints: MissionDataStorage keeps legacy files it fails to parse
  * EnvConditions: NA
- * CaseDescription: Verify GetSnapshot
+ * CaseDescription: Verify the parsed file is migrated and the unparsable one stays on disk
  */
-HWTEST_F(MissionDataStorageTest, GetSnapshot_001, TestSize.Level1)
+HWTEST_F(MissionDataStorageTest, LoadAllMissionInfo_002, TestSize.Level1)
 {
-    auto missionDataStorage = std::make_shared<MissionDataStorage>();
-    int32_t missionId = 0;
-    bool isLowResolution = true;
-    std::shared_ptr<Media::PixelMap> res = missionDataStorage->GetSnapshot(missionId, isLowResolution);
-    EXPECT_EQ(res, nullptr);
+    auto missionDataStorage = std::make_shared<MissionDataStorage>(TEST_USER_ID);
+    std::string dirPath = missionDataStorage->GetMissionDataDirPath();
+    OHOS::ForceRemoveDirectory(dirPath);
+    ASSERT_TRUE(missionDataStorage->EnsureMissionDataDir());
+    InnerMissionInfo legacyInfo;
+    legacyInfo.missionInfo.id = 5;
+    legacyInfo.isTemporary = false;
+    std::string legacyPath = missionDataStorage->GetMissionDataFilePath(5);
+    ASSERT_TRUE(OHOS::SaveStringToFile(legacyPath, legacyInfo.ToJsonStr(), true));
+    std::string brokenPath = missionDataStorage->GetMissionDataFilePath(6);
+    ASSERT_TRUE(OHOS::SaveStringToFile(brokenPath, "{broken", true));
+
+    std::list<InnerMissionInfo> missionInfoList;
+    EXPECT_TRUE(missionDataStorage->LoadAllMissionInfo(missionInfoList));
+    EXPECT_EQ(missionInfoList.size(), 1);
+    EXPECT_FALSE(OHOS::FileExists(legacyPath));
+    EXPECT_TRUE(OHOS::FileExists(brokenPath));
+    OHOS::ForceRemoveDirectory(dirPath);
 }
 
 /*
  * Feature: MissionDataStorage
- * Function: GetPixelMap
+ * Function: LoadAllMissionInfo
  * SubFunction: NA
- * FunctionPoints: MissionDataStorage GetPixelMap
+ * FunctionPoints: MissionDataStorage does not migrate into a log it fails to read
  * EnvConditions: NA
- * CaseDescription: Verify GetPixelMap
+ * CaseDescription: Verify legacy missions are loaded, and the log and legacy files are left untouched
  */
-HWTEST_F(MissionDataStorageTest, GetPixelMap_001, TestSize.Level1)
+HWTEST_F(MissionDataStorageTest, LoadAllMissionInfo_003, TestSize.Level1)
 {
-    auto missionDataStorage = std::make_shared<MissionDataStorage>();
-    int32_t missionId = 0;
-    bool isLowResolution = true;
-    std::unique_ptr<Media::PixelMap> res = missionDataStorage->GetPixelMap(missionId, isLowResolution);
-    EXPECT_EQ(res, nullptr);
+    auto missionDataStorage = std::make_shared<MissionDataStorage>(TEST_USER_ID);
+    std::string dirPath = missionDataStorage->GetMissionDataDirPath();
+    OHOS::ForceRemoveDirectory(dirPath);
+    ASSERT_TRUE(missionDataStorage->EnsureMissionDataDir());
+    InnerMissionInfo legacyInfo;
+    legacyInfo.missionInfo.id = 5;
+    legacyInfo.isTemporary = false;
+    std::string legacyPath = missionDataStorage->GetMissionDataFilePath(5);
+    ASSERT_TRUE(OHOS::SaveStringToFile(legacyPath, legacyInfo.ToJsonStr(), true));
+    // a log that can not be opened, the open fails with ELOOP rather than ENOENT
+    std::string logPath = dirPath + "/" + MISSION_LOG_FILE_NAME;
+    ASSERT_EQ(symlink(logPath.c_str(), logPath.c_str()), 0);
+
+    std::list<InnerMissionInfo> missionInfoList;
+    EXPECT_TRUE(missionDataStorage->LoadAllMissionInfo(missionInfoList));
+    EXPECT_EQ(missionInfoList.size(), 1);
+    EXPECT_TRUE(OHOS::FileExists(legacyPath));
+    struct stat logStat = {};
+    ASSERT_EQ(lstat(logPath.c_str(), &logStat), 0);
+    EXPECT_TRUE(S_ISLNK(logStat.st_mode));
+    OHOS::ForceRemoveDirectory(dirPath);
 }
 
 /*
  * Feature: MissionDataStorage
- * Function: GetPixelMap
+ * Function: QueueMissionSnapshot/SaveQueuedSnapshot
  * SubFunction: NA
- * FunctionPoints: MissionDataStorage GetPixelMap
+ * FunctionPoints: A snapshot superseded before it is saved is dropped
  * EnvConditions: NA
- * CaseDescription: Verify GetPixelMap
+ * CaseDescription: The older snapshot is dropped and leaves the newer one in cache
  */
-HWTEST_F(MissionDataStorageTest, GetPixelMap_002, TestSize.Level1)
+HWTEST_F(MissionDataStorageTest, SaveQueuedSnapshot_001, TestSize.Level1)
 {
-    auto missionDataStorage = std::make_shared<MissionDataStorage>();
-    EXPECT_NE(missionDataStorage, nullptr);
-    int32_t missionId = 100;
-    bool isLowResolution = false;
-    std::unique_ptr<Media::PixelMap> res = missionDataStorage->GetPixelMap(missionId, isLowResolution);
-    EXPECT_EQ(res, nullptr);
+    auto missionDataStorage = std::make_shared<MissionDataStorage>(TEST_USER_ID);
+    int32_t missionId = 1;
+    MissionSnapshot oldSnapshot;
+    oldSnapshot.snapshot = std::make_shared<Media::PixelMap>();
+    MissionSnapshot newSnapshot;
+    newSnapshot.snapshot = std::make_shared<Media::PixelMap>();
+    auto oldGeneration = missionDataStorage->QueueMissionSnapshot(missionId, oldSnapshot);
+    auto newGeneration = missionDataStorage->QueueMissionSnapshot(missionId, newSnapshot);
+    EXPECT_NE(oldGeneration, newGeneration);
+
+    missionDataStorage->SaveQueuedSnapshot(missionId, oldGeneration);
+    EXPECT_EQ(missionDataStorage->droppedSnapshotCount_.load(), 1);
+    MissionSnapshot cachedSnapshot;
+    EXPECT_TRUE(missionDataStorage->GetCachedSnapshot(missionId, cachedSnapshot));
+    EXPECT_EQ(cachedSnapshot.snapshot, newSnapshot.snapshot);
+
+    missionDataStorage->SaveQueuedSnapshot(missionId, newGeneration);
+    EXPECT_EQ(missionDataStorage->droppedSnapshotCount_.load(), 1);
+    EXPECT_EQ(missionDataStorage->encodedSnapshotCount_.load(), 1);
+    EXPECT_FALSE(missionDataStorage->GetCachedSnapshot(missionId, cachedSnapshot));
+    EXPECT_TRUE(missionDataStorage->queuedSnapshots_.empty());
+}
+
+/*
+ * Feature: MissionDataStorage
+ * Function: DeleteMissionSnapshot
+ * SubFunction: NA
+ * FunctionPoints: Deleting the snapshot drops the queued one
+ * EnvConditions: NA
+ * CaseDescription: The queued snapshot is not saved after the mission snapshot is deleted
+ */
+HWTEST_F(MissionDataStorageTest, SaveQueuedSnapshot_002, TestSize.Level1)
+{
+    auto missionDataStorage = std::make_shared<MissionDataStorage>(TEST_USER_ID);
+    int32_t missionId = 1;
+    MissionSnapshot missionSnapshot;
+    missionSnapshot.snapshot = std::make_shared<Media::PixelMap>();
+    auto generation = missionDataStorage->QueueMissionSnapshot(missionId, missionSnapshot);
+    missionDataStorage->DeleteMissionSnapshot(missionId);
+    missionDataStorage->SaveQueuedSnapshot(missionId, generation);
+    EXPECT_EQ(missionDataStorage->droppedSnapshotCount_.load(), 1);
+    EXPECT_EQ(missionDataStorage->encodedSnapshotCount_.load(), 0);
+}
+
+/*
+ * Feature: MissionDataStorage
+ * Function: GetPrivatePlaceholder
+ * SubFunction: NA
+ * FunctionPoints: The placeholder of private missions is encoded once per size
+ * EnvConditions: NA
+ * CaseDescription: The same size returns the cached placeholder, an empty size returns none
+ */
+HWTEST_F(MissionDataStorageTest, GetPrivatePlaceholder_001, TestSize.Level1)
+{
+    auto missionDataStorage = std::make_shared<MissionDataStorage>(TEST_USER_ID);
+    EXPECT_EQ(missionDataStorage->GetPrivatePlaceholder(0, 100), nullptr);
+    auto placeholder = missionDataStorage->GetPrivatePlaceholder(64, 128);
+    if (placeholder != nullptr) {
+        EXPECT_EQ(missionDataStorage->GetPrivatePlaceholder(64, 128), placeholder);
+        EXPECT_EQ(missionDataStorage->placeholderHitCount_.load(), 1);
+        EXPECT_NE(missionDataStorage->GetPrivatePlaceholder(32, 64), placeholder);
+        EXPECT_EQ(missionDataStorage->placeholderHitCount_.load(), 1);
+    }
+}
+
+/*
+ * Feature: MissionDataStorage
+ * Function: DumpSnapshotStats
+ * SubFunction: NA
+ * FunctionPoints: MissionDataStorage DumpSnapshotStats
+ * EnvConditions: NA
+ * CaseDescription: The dump shows the encode and drop counters
+ */
+HWTEST_F(MissionDataStorageTest, DumpSnapshotStats_001, TestSize.Level1)
+{
+    auto missionDataStorage = std::make_shared<MissionDataStorage>(TEST_USER_ID);
+    missionDataStorage->encodedSnapshotCount_ = 2;
+    missionDataStorage->droppedSnapshotCount_ = 3;
+    missionDataStorage->totalEncodeTime_ = 100;
+    missionDataStorage->maxEncodeTime_ = 70;
+    std::vector<std::string> info;
+    missionDataStorage->DumpSnapshotStats(info);
+    ASSERT_EQ(info.size(), 2);
+    EXPECT_NE(info[0].find("encoded [2] dropped [3]"), std::string::npos);
+    EXPECT_NE(info[1].find("avg [50us] max [70us]"), std::string::npos);
+}
+
+/*
+ * Feature: MissionDataStorage
+ * Function: QueueMissionSnapshot/SaveQueuedSnapshot
+ * SubFunction: NA
+ * FunctionPoints: Cost of saving snapshots of rapid mission switches
+ * EnvConditions: NA
+ * CaseDescription: Only the latest snapshot of each mission is encoded
+ */
+HWTEST_F(MissionDataStorageTest, SaveQueuedSnapshot_Benchmark_001, TestSize.Level3)
+{
+    constexpr int32_t missionCount = 4;
+    constexpr int32_t switchRounds = 10;
+    auto missionDataStorage = std::make_shared<MissionDataStorage>(TEST_USER_ID);
+    Media::InitializationOptions options;
+    options.size.width = 1260;
+    options.size.height = 2720;
+    options.pixelFormat = Media::PixelFormat::RGBA_8888;
+    std::shared_ptr<Media::PixelMap> pixelMap = Media::PixelMap::Create(options);
+    ASSERT_NE(pixelMap, nullptr);
+    std::vector<std::pair<int32_t, uint64_t>> tasks;
+    for (int32_t round = 0; round < switchRounds; round++) {
+        for (int32_t missionId = 0; missionId < missionCount; missionId++) {
+            MissionSnapshot missionSnapshot;
+            missionSnapshot.snapshot = pixelMap;
+            missionSnapshot.isPrivate = missionId % 2 == 0;
+            tasks.emplace_back(missionId, missionDataStorage->QueueMissionSnapshot(missionId, missionSnapshot));
+        }
+    }
+    auto begin = std::chrono::steady_clock::now();
+    for (const auto &[missionId, generation] : tasks) {
+        missionDataStorage->SaveQueuedSnapshot(missionId, generation);
+    }
+    auto cost = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+    EXPECT_EQ(missionDataStorage->encodedSnapshotCount_.load(), missionCount);
+    EXPECT_EQ(missionDataStorage->droppedSnapshotCount_.load(), missionCount * (switchRounds - 1));
+    std::vector<std::string> info;
+    missionDataStorage->DumpSnapshotStats(info);
+    TAG_LOGI(AAFwkTag::TEST, "save %{public}zu snapshots cost %{public}lld ms", tasks.size(),
+        static_cast<long long>(cost));
+    for (const auto &line : info) {
+        TAG_LOGI(AAFwkTag::TEST, "%{public}s", line.c_str());
+    }
+    OHOS::ForceRemoveDirectory(missionDataStorage->GetMissionDataDirPath());
 }
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -17,6 +17,7 @@
 #include "bundlemgr/mock_bundle_manager.h"
 #include "mock_native_token.h"
 #include "ability_manager_errors.h"
+#include "hilog_tag_wrapper.h"
 #define private public
 #define protected public
 #include "ability_event_handler.h"
@@ -1561,5 +1562,76 @@ HWTEST_F(PendingWantManagerTest, PendingWantManagerTest_6700, TestSize.Level1)
     EXPECT_EQ(getWantInfo->GetElement().GetAbilityName(), "abilityName");
     EXPECT_EQ(getWantInfo->GetParams().GetStringParam("test_key"), "test_value");
 }
+
+/*
+ * @tc.number    : PendingWantManagerTest_GetPendingWantRecordByKey_0100
+ * @tc.name      : PendingWantManager GetPendingWantRecordByKey
+ * @tc.desc      : 1.Equal keys have the same hash and find the record, the index follows cancel
+ */
+HWTEST_F(PendingWantManagerTest, PendingWantManagerTest_GetPendingWantRecordByKey_0100, TestSize.Level1)
+{
+    Want want;
+    ElementName element("device", "bundleName", "abilityName");
+    want.SetElement(element);
+    want.SetAction("action.test");
+    want.SetParam("key", 1);
+    WantSenderInfo wantSenderInfo = MakeWantSenderInfo(want, 0, 0);
+    pendingManager_ = std::make_shared<PendingWantManager>();
+    auto sender = pendingManager_->GetWantSenderLocked(1, 1, wantSenderInfo.userId, wantSenderInfo, nullptr);
+    ASSERT_NE(sender, nullptr);
+    EXPECT_EQ(pendingManager_->wantRecordIndex_.size(), 1);
+
+    auto sameKey = MakeWantKey(wantSenderInfo);
+    EXPECT_EQ(sameKey->GetHashCode(), pendingManager_->wantRecordIndex_.begin()->second->GetHashCode());
+    EXPECT_EQ(pendingManager_->GetPendingWantRecordByKey(sameKey), sender);
+
+    Want otherWant = want;
+    otherWant.SetParam("key", 2);
+    WantSenderInfo otherInfo = MakeWantSenderInfo(otherWant, 0, 0);
+    EXPECT_EQ(pendingManager_->GetPendingWantRecordByKey(MakeWantKey(otherInfo)), nullptr);
+    otherInfo.requestCode++;
+    EXPECT_EQ(pendingManager_->GetPendingWantRecordByKey(MakeWantKey(otherInfo)), nullptr);
+
+    sptr<PendingWantRecord> record = static_cast<PendingWantRecord *>(sender.GetRefPtr());
+    pendingManager_->CancelWantSenderLocked(*record, true);
+    EXPECT_TRUE(pendingManager_->wantRecordIndex_.empty());
+    EXPECT_EQ(pendingManager_->GetPendingWantRecordByKey(sameKey), nullptr);
+}
+
+/*
+ * @tc.number    : PendingWantManagerTest_GetPendingWantRecordByKey_0200
+ * @tc.name      : PendingWantManager GetPendingWantRecordByKey
+ * @tc.desc      : 1.Every key among 10k records sharing request codes finds its own record
+ */
+HWTEST_F(PendingWantManagerTest, PendingWantManagerTest_GetPendingWantRecordByKey_0200, TestSize.Level1)
+{
+    constexpr int32_t recordCount = 10000;
+    pendingManager_ = std::make_shared<PendingWantManager>();
+    std::vector<std::shared_ptr<PendingWantKey>> keys;
+    std::vector<sptr<IWantSender>> senders;
+    for (int32_t i = 0; i < recordCount; i++) {
+        Want want;
+        ElementName element("device", "com.ix.hiRadio", "abilityName");
+        want.SetElement(element);
+        want.SetParam("notificationId", i);
+        WantSenderInfo wantSenderInfo = MakeWantSenderInfo(want, 0, 0);
+        wantSenderInfo.requestCode = i % 100;
+        auto sender = pendingManager_->GetWantSenderLocked(1, 1, wantSenderInfo.userId, wantSenderInfo, nullptr);
+        ASSERT_NE(sender, nullptr);
+        senders.push_back(sender);
+        keys.push_back(MakeWantKey(wantSenderInfo));
+    }
+    EXPECT_EQ(pendingManager_->wantRecords_.size(), static_cast<size_t>(recordCount));
+    EXPECT_EQ(pendingManager_->wantRecordIndex_.size(), static_cast<size_t>(recordCount));
+    for (int32_t i = 0; i < recordCount; i++) {
+        EXPECT_EQ(pendingManager_->GetPendingWantRecordByKey(keys[i]), senders[i]) << "key " << i;
+    }
+
+    Want want;
+    ElementName element("device", "com.ix.hiRadio", "abilityName");
+    want.SetElement(element);
+    want.SetParam("notificationId", recordCount);
+    EXPECT_EQ(pendingManager_->GetPendingWantRecordByKey(MakeWantKey(MakeWantSenderInfo(want, 0, 0))), nullptr);
+}
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -14,6 +14,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <cstdarg>
 #include <string>
 
@@ -33,6 +34,10 @@ using namespace testing::ext;
 
 namespace OHOS {
 namespace AbilityRuntime {
+namespace {
+constexpr int32_t HAP_ENTRY_COUNT = 2100;
+constexpr size_t ASSET_ENTRY_MAX_COUNT = 4096; // limit of AssetEntryIndex
+}
 class JsWorkerTest : public testing::Test {
 public:
     static void SetUpTestCase();
@@ -124,5 +129,67 @@ HWTEST_F(JsWorkerTest, AssetHelper_0200, TestSize.Level1)
     auto ret = helper.GetSafeData("test.txt", &buff, &buffSize, &mapper);
     EXPECT_EQ(ret, false);
 }
+
+/**
+ * @tc.name: AssetEntryIndex_0100
+ * @tc.desc: Each entry of a hap is looked up once, the result is shared.
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsWorkerTest, AssetEntryIndex_0100, TestSize.Level1)
+{
+    int32_t lookupCount = 0;
+    auto lookup = [&lookupCount](const std::string& entryName) {
+        lookupCount++;
+        return entryName == "assets/js/default/workers/worker.abc";
+    };
+    auto& index = AssetEntryIndex::GetInstance();
+    const std::string hapPath = "/data/test/AssetEntryIndex_0100.hap";
+    EXPECT_TRUE(index.HasEntry(hapPath, "assets/js/default/workers/worker.abc", lookup));
+    EXPECT_FALSE(index.HasEntry(hapPath, "assets/js/share/workers/worker.abc", lookup));
+    EXPECT_EQ(lookupCount, 2);
+
+    EXPECT_TRUE(index.HasEntry(hapPath, "assets/js/default/workers/worker.abc", lookup));
+    EXPECT_FALSE(index.HasEntry(hapPath, "assets/js/share/workers/worker.abc", lookup));
+    EXPECT_EQ(lookupCount, 2);
+
+    EXPECT_TRUE(index.HasEntry(hapPath + ".other", "assets/js/default/workers/worker.abc", lookup));
+    EXPECT_EQ(lookupCount, 3);
+    EXPECT_FALSE(index.HasEntry(hapPath + ".none", "assets/js/default/workers/worker.abc", nullptr));
+}
+
+/**
+ * @tc.name: AssetEntryIndex_0200
+ * @tc.desc: The index answers as the file list of the hap, also once it is full and emptied.
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsWorkerTest, AssetEntryIndex_0200, TestSize.Level1)
+{
+    std::vector<std::string> files;
+    for (int32_t i = 0; i < HAP_ENTRY_COUNT; i++) {
+        files.emplace_back("assets/js/default/pages/page" + std::to_string(i) + ".abc");
+    }
+    const std::string entryName = "assets/js/default/workers/worker.abc";
+    files.emplace_back(entryName);
+    size_t lookupCount = 0;
+    auto lookup = [&files, &lookupCount](const std::string& name) {
+        lookupCount++;
+        return std::find(files.begin(), files.end(), name) != files.end();
+    };
+
+    auto& index = AssetEntryIndex::GetInstance();
+    const std::string hapPath = "/data/test/AssetEntryIndex_0200.hap";
+    for (const auto& file : files) {
+        EXPECT_TRUE(index.HasEntry(hapPath, file, lookup));
+        EXPECT_FALSE(index.HasEntry(hapPath, file + ".map", lookup));
+    }
+    EXPECT_EQ(lookupCount, files.size() * 2);
+    EXPECT_LE(index.entryCount_, ASSET_ENTRY_MAX_COUNT);
+
+    // the latest entries are kept, the first ones were dropped when the index was emptied
+    EXPECT_TRUE(index.HasEntry(hapPath, entryName, lookup));
+    EXPECT_EQ(lookupCount, files.size() * 2);
+    EXPECT_TRUE(index.HasEntry(hapPath, files.front(), lookup));
+    EXPECT_EQ(lookupCount, files.size() * 2 + 1);
+}
 } // namespace AbilityRuntime
 } // namespace OHOS
@@ -124,7 +124,7 @@ HWTEST_F(UIAbilityLifecycleManagerSecondTest, HandleLegacyAcceptWantDone_001, Te
     abilityRequest.sessionInfo = sessionInfo;
     UIAbilityRecordPtr abilityRecord = InitAbilityRecord();
     abilityRecord->collaboratorType_ = CollaboratorType::RESERVE_TYPE;
-    mgr->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    mgr->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     bool reuse = false;
     std::string flag = "";
     int32_t requestId = 1;
@@ -165,7 +165,7 @@ HWTEST_F(UIAbilityLifecycleManagerSecondTest, FindRecordFromSessionMap_001, Test
     abilityRequest.abilityInfo.name = "MainAbility";
     abilityRequest.abilityInfo.type = AppExecFwk::AbilityType::PAGE;
     UIAbilityRecordPtr abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    mgr->sessionAbilityMap_[sessionId] = abilityRecord;
+    mgr->AddSessionRecord(sessionId, abilityRecord);
 
     const auto info = abilityRecord->GetAbilityInfo();
 
@@ -207,19 +207,20 @@ HWTEST_F(UIAbilityLifecycleManagerSecondTest, IsSpecifiedModuleLoaded_003, TestS
     auto ret = mgr->IsSpecifiedModuleLoaded(abilityRequest, true, isDebug);
     EXPECT_EQ(ret, false);
 
-    mgr->sessionAbilityMap_.emplace(0, nullptr);
+    mgr->AddSessionRecord(0, nullptr);
 
     int32_t uid = 100;
     std::string instanceKey = "testInstanceKey";
     abilityRequest.abilityInfo.uid = uid;
     abilityRequest.want.SetParam(Want::APP_INSTANCE_KEY, instanceKey);
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    mgr->sessionAbilityMap_.emplace(1, abilityRecord);
+    mgr->AddSessionRecord(1, abilityRecord);
 
     ret = mgr->IsSpecifiedModuleLoaded(abilityRequest, true, isDebug);
     EXPECT_EQ(ret, false);
 
     abilityRecord->SetInstanceKey(instanceKey);
+    mgr->AddSessionRecord(1, abilityRecord);
     ret = mgr->IsSpecifiedModuleLoaded(abilityRequest, true, isDebug);
     EXPECT_EQ(ret, true);
     TAG_LOGI(AAFwkTag::TEST, "IsSpecifiedModuleLoaded_003 end.");
@@ -272,7 +273,7 @@ HWTEST_F(UIAbilityLifecycleManagerSecondTest, PrepareTerminateAppAndGetRemaining
     abilityRequest.sessionInfo = nullptr;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->abilityInfo_.applicationInfo.accessTokenId = 1;
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(0, abilityRecord);
     sptr<IRemoteObject> token = abilityRecord->GetToken()->AsObject();
     tokens.push_back(token);
     AAFwk::MyFlag::flag_ = 1;
@@ -368,7 +369,7 @@ HWTEST_F(UIAbilityLifecycleManagerSecondTest, TryProcessHookModule_002, TestSize
     UIAbilityRecordPtr abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->SetIsHook(true);
     abilityRecord->SetHookOff(true);
-    uiAbilityLifecycleManager->sessionAbilityMap_[sessionId] = abilityRecord;
+    uiAbilityLifecycleManager->AddSessionRecord(sessionId, abilityRecord);
 
     auto specifiedRequest = std::make_shared<AAFwk::SpecifiedRequest>(0, abilityRequest);
     auto ret = uiAbilityLifecycleManager->TryProcessHookModule(*specifiedRequest, true);
@@ -392,7 +393,7 @@ HWTEST_F(UIAbilityLifecycleManagerSecondTest, TryProcessHookModule_003, TestSize
     abilityRequest.appInfo.bundleName = "com.example.unittest";
     UIAbilityRecordPtr abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->SetIsHook(true);
-    uiAbilityLifecycleManager->sessionAbilityMap_[sessionId] = abilityRecord;
+    uiAbilityLifecycleManager->AddSessionRecord(sessionId, abilityRecord);
     auto specifiedRequest = std::make_shared<AAFwk::SpecifiedRequest>(100, abilityRequest);
     auto ret = uiAbilityLifecycleManager->TryProcessHookModule(*specifiedRequest, true);
     EXPECT_TRUE(ret);
@@ -875,7 +876,6 @@ HWTEST_F(UIAbilityLifecycleManagerSecondTest, TryProcessHookModule_004, TestSize
 HWTEST_F(UIAbilityLifecycleManagerSecondTest, TryProcessHookModule_005, TestSize.Level1)
 {
     auto mgr = std::make_shared<UIAbilityLifecycleManager>();
-    mgr->sessionAbilityMap_.clear();
     AbilityRequest abilityRequest;
     auto specifiedRequest = std::make_shared<AAFwk::SpecifiedRequest>(100, abilityRequest);
 
@@ -902,8 +902,7 @@ HWTEST_F(UIAbilityLifecycleManagerSecondTest, TryProcessHookModule_006, TestSize
     abilityRecord->abilityInfo_.moduleName = "HelloWorld";
     abilityRecord->SetInstanceKey("HelloWorld");
 
-    mgr->sessionAbilityMap_.clear();
-    mgr->sessionAbilityMap_.emplace(1, abilityRecord);
+    mgr->AddSessionRecord(1, abilityRecord);
     
     AbilityRequest abilityRequest2;
     abilityRequest2.abilityInfo.bundleName = "HelloWorld";
@@ -911,6 +910,7 @@ HWTEST_F(UIAbilityLifecycleManagerSecondTest, TryProcessHookModule_006, TestSize
     abilityRequest2.want.SetParam(Want::APP_INSTANCE_KEY, std::string("HelloWorld"));
     AbilityRuntime::StartupUtil::GetAppIndex(abilityRequest2.want, appIndex);
     abilityRecord->SetAppIndex(appIndex);
+    mgr->AddSessionRecord(1, abilityRecord);
 
     auto specifiedRequest = std::make_shared<AAFwk::SpecifiedRequest>(100, abilityRequest2);
 
@@ -962,7 +962,6 @@ HWTEST_F(UIAbilityLifecycleManagerSecondTest, HandleColdAcceptWantDone_001, Test
     AbilityRequest abilityRequest;
     SpecifiedRequest specifiedRequest(1, abilityRequest);
 
-    mgr->sessionAbilityMap_.clear();
 
     auto ret = mgr->HandleColdAcceptWantDone(want, flag, specifiedRequest);
     EXPECT_EQ(ret, false);
@@ -986,8 +985,7 @@ HWTEST_F(UIAbilityLifecycleManagerSecondTest, HandleColdAcceptWantDone_002, Test
         abilityRequest.want, abilityRequest.abilityInfo, abilityRequest.appInfo, abilityRequest.requestCode);
     abilityRecord->specifiedFlag_ = "";
 
-    mgr->sessionAbilityMap_.clear();
-    mgr->sessionAbilityMap_.emplace(1, abilityRecord);
+    mgr->AddSessionRecord(1, abilityRecord);
 
     auto ret = mgr->HandleColdAcceptWantDone(want, flag, specifiedRequest);
     EXPECT_EQ(ret, true);
@@ -1102,18 +1100,14 @@ HWTEST_F(UIAbilityLifecycleManagerSecondTest, RecordPidKilling_001, TestSize.Lev
     auto abilityRecord = std::make_shared<UIAbilityRecord>(
         abilityRequest.want, abilityRequest.abilityInfo, abilityRequest.appInfo, abilityRequest.requestCode);
     abilityRecord->pid_ = 1;
-    std::unordered_map<int32_t, UIAbilityRecordPtr> sessionAbilityMap =
-    {
-        {1, abilityRecord},
-    };
-    mgr->sessionAbilityMap_ = sessionAbilityMap;
+    mgr->AddSessionRecord(1, abilityRecord);
     pid_t pid = 1;
     std::string reason = "HelloWorld";
     bool isKillPrecedeStart = true;
     
     mgr->RecordPidKilling(pid, reason, isKillPrecedeStart);
-    EXPECT_EQ(mgr->sessionAbilityMap_[1]->killReason_, "HelloWorld");
-    EXPECT_EQ(mgr->sessionAbilityMap_[1]->isKillPrecedeStart_, true);
+    EXPECT_EQ(mgr->GetSessionRecord(1)->killReason_, "HelloWorld");
+    EXPECT_EQ(mgr->GetSessionRecord(1)->isKillPrecedeStart_, true);
 }
 
 /**
@@ -1648,7 +1642,7 @@ HWTEST_F(UIAbilityLifecycleManagerSecondTest, CheckStartByOEExt_005, TestSize.Le
     EXPECT_EQ(reuse, true);  // Should remain unchanged
 
     auto abilityRecord = InitAbilityRecord();
-    mgr->sessionAbilityMap_[persistentId] = abilityRecord;
+    mgr->AddSessionRecord(persistentId, abilityRecord);
     ret = mgr->CheckStartByOEExt(abilityRequest, requestId, persistentId, reuse);
     EXPECT_TRUE(ret);
 
@@ -1686,7 +1680,7 @@ HWTEST_F(UIAbilityLifecycleManagerSecondTest, CheckStartByOEExt_006, TestSize.Le
     EXPECT_TRUE(ret);  // Should return true (not duplicate)
 
     auto abilityRecord = InitAbilityRecord();
-    mgr->sessionAbilityMap_.emplace(persistentId, abilityRecord);
+    mgr->AddSessionRecord(persistentId, abilityRecord);
     ret = mgr->CheckStartByOEExt(abilityRequest, requestId, persistentId, reuse);
     EXPECT_TRUE(ret);  // Should return true (not duplicate)
 
@@ -1694,11 +1688,11 @@ HWTEST_F(UIAbilityLifecycleManagerSecondTest, CheckStartByOEExt_006, TestSize.Le
     ret = mgr->CheckStartByOEExt(abilityRequest, requestId, persistentId, reuse);
     EXPECT_TRUE(ret);  // Should return true (not duplicate)
 
-    mgr->sessionAbilityMap_.clear();
+    mgr->EraseSessionRecord(persistentId);
     ret = mgr->CheckStartByOEExt(abilityRequest, requestId, persistentId, reuse);
     EXPECT_TRUE(ret);  // Should return true (not duplicate)
 
-    mgr->sessionAbilityMap_[persistentId] = abilityRecord;
+    mgr->AddSessionRecord(persistentId, abilityRecord);
     ret = mgr->CheckStartByOEExt(abilityRequest, requestId, persistentId, reuse);
     EXPECT_TRUE(ret);  // Should return true (not duplicate)
 
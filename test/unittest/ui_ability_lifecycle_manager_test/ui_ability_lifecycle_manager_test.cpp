@@ -185,7 +185,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, StartUIAbility_003, TestSize.Level1)
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->SetPendingState(AbilityState::FOREGROUND);
-    mgr->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    mgr->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     AbilityRuntime::StartParamsBySCB params;
     bool isColdStart = false;
     EXPECT_EQ(mgr->StartUIAbility(abilityRequest, sessionInfo, params, isColdStart), ERR_OK);
@@ -249,7 +249,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, StartUIAbility_006, TestSize.Level1)
     sessionInfo->isNewWant = false;
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    mgr->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    mgr->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     AbilityRuntime::StartParamsBySCB params;
     bool isColdStart = false;
     EXPECT_EQ(mgr->StartUIAbility(abilityRequest, sessionInfo, params, isColdStart), ERR_OK);
@@ -273,7 +273,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, StartUIAbility_007, TestSize.Level1)
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->isReady_ = true;
-    mgr->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    mgr->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     AbilityRuntime::StartParamsBySCB params;
     bool isColdStart = false;
     EXPECT_EQ(mgr->StartUIAbility(abilityRequest, sessionInfo, params, isColdStart), ERR_OK);
@@ -314,7 +314,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, StartUIAbility_009, TestSize.Level1)
     sessionInfo->reuseDelegatorWindow = true;
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    mgr->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    mgr->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     AbilityRuntime::StartParamsBySCB params;
     bool isColdStart = false;
     EXPECT_EQ(mgr->StartUIAbility(abilityRequest, sessionInfo, params, isColdStart), ERR_OK);
@@ -336,7 +336,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, StartUIAbility_1000, TestSize.Level1)
     sessionInfo->processOptions = std::make_shared<ProcessOptions>();
     sessionInfo->processOptions->isPreloadStart = true;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    mgr->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    mgr->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     AbilityRuntime::StartParamsBySCB params;
     bool isColdStart = false;
     EXPECT_EQ(mgr->StartUIAbility(abilityRequest, sessionInfo, params, isColdStart), ERR_OK);
@@ -361,7 +361,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, StartUIAbility_1100, TestSize.Level1)
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->SetPreloaded();
-    mgr->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    mgr->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     AbilityRuntime::StartParamsBySCB params;
     bool isColdStart = false;
     EXPECT_EQ(mgr->StartUIAbility(abilityRequest, sessionInfo, params, isColdStart), ERR_OK);
@@ -390,7 +390,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, StartUIAbility_1200, TestSize.Level1)
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->SetPid(1000);
-    mgr->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    mgr->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     abilityRequest.appInfo.uid = 3000;
     AbilityRuntime::StartParamsBySCB params;
     bool isColdStart = false;
@@ -535,7 +535,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, AttachAbilityThread_002, TestSize.Level1
     auto mgr = std::make_unique<UIAbilityLifecycleManager>();
     AbilityRequest abilityRequest;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    mgr->sessionAbilityMap_.emplace(1, abilityRecord);
+    mgr->AddSessionRecord(1, abilityRecord);
     sptr<IAbilityScheduler> scheduler = nullptr;
     auto&& token = abilityRecord->GetToken()->AsObject();
     EXPECT_EQ(mgr->AttachAbilityThread(scheduler, token), ERR_INVALID_VALUE);
@@ -553,7 +553,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, AttachAbilityThread_003, TestSize.Level1
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->SetStartedByCall(true);
 
-    mgr->sessionAbilityMap_.emplace(1, abilityRecord);
+    mgr->AddSessionRecord(1, abilityRecord);
     sptr<IAbilityScheduler> scheduler = nullptr;
     auto&& token = abilityRecord->GetToken()->AsObject();
     EXPECT_EQ(mgr->AttachAbilityThread(scheduler, token), ERR_INVALID_VALUE);
@@ -574,7 +574,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, AttachAbilityThread_004, TestSize.Level1
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->SetStartedByCall(true);
 
-    mgr->sessionAbilityMap_.emplace(1, abilityRecord);
+    mgr->AddSessionRecord(1, abilityRecord);
     sptr<IAbilityScheduler> scheduler = nullptr;
     auto&& token = abilityRecord->GetToken()->AsObject();
     EXPECT_EQ(mgr->AttachAbilityThread(scheduler, token), ERR_INVALID_VALUE);
@@ -605,7 +605,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnAbilityRequestDone_002, TestSize.Level
     EXPECT_NE(mgr, nullptr);
     AbilityRequest abilityRequest;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    mgr->sessionAbilityMap_[1] = abilityRecord;
+    mgr->AddSessionRecord(1, abilityRecord);
     auto&& token = abilityRecord->GetToken()->AsObject();
     int32_t foreground = 2;
     mgr->OnAbilityRequestDone(token, foreground);
@@ -648,7 +648,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRecordByToken_003, TestSize.Le
     auto mgr = std::make_unique<UIAbilityLifecycleManager>();
     AbilityRequest abilityRequest;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    mgr->sessionAbilityMap_.emplace(1, abilityRecord);
+    mgr->AddSessionRecord(1, abilityRecord);
     auto&& token = abilityRecord->GetToken()->AsObject();
     EXPECT_NE(mgr->GetAbilityRecordByToken(token), nullptr);
 }
@@ -764,7 +764,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, EraseAbilityRecord_002, TestSize.Level1)
     EXPECT_NE(mgr, nullptr);
     AbilityRequest abilityRequest;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    mgr->sessionAbilityMap_.emplace(1, abilityRecord);
+    mgr->AddSessionRecord(1, abilityRecord);
     mgr->EraseAbilityRecord(abilityRecord);
     EXPECT_NE(mgr, nullptr);
 }
@@ -1385,7 +1385,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnTimeOut_002, TestSize.Level1)
     UIAbilityRecordPtr abilityRecord = InitAbilityRecord();
     uint32_t msgId = 0;
     int64_t abilityRecordId = 0;
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(0, abilityRecord);
     uiAbilityLifecycleManager->OnTimeOut(msgId, abilityRecordId);
     uiAbilityLifecycleManager.reset();
 }
@@ -1402,7 +1402,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnTimeOut_003, TestSize.Level1)
     UIAbilityRecordPtr abilityRecord = InitAbilityRecord();
     uint32_t msgId = 5;
     int64_t abilityRecordId = 0;
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(0, abilityRecord);
     uiAbilityLifecycleManager->OnTimeOut(msgId, abilityRecordId);
     uiAbilityLifecycleManager.reset();
 }
@@ -1419,7 +1419,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnTimeOut_004, TestSize.Level1)
     UIAbilityRecordPtr abilityRecord = InitAbilityRecord();
     uint32_t msgId = 6;
     int64_t abilityRecordId = 0;
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(msgId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(msgId, abilityRecord);
     uiAbilityLifecycleManager->OnTimeOut(msgId, abilityRecordId);
     uiAbilityLifecycleManager.reset();
 }
@@ -1508,7 +1508,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, NotifySCBToHandleException_005, TestSize
     abilityRequest.sessionInfo = sessionInfo;
     sessionInfo->persistentId = 0;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     uiAbilityLifecycleManager->NotifySCBToHandleException(abilityRecord,
         static_cast<int32_t>(ErrorLifecycleState::ABILITY_STATE_LOAD_TIMEOUT), "handleLoadTimeout");
     uiAbilityLifecycleManager.reset();
@@ -1530,7 +1530,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, NotifySCBToHandleException_006, TestSize
     abilityRequest.sessionInfo = sessionInfo;
     sessionInfo->persistentId = 0;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     uiAbilityLifecycleManager->NotifySCBToHandleException(abilityRecord,
         static_cast<int32_t>(ErrorLifecycleState::ABILITY_STATE_FOREGROUND_TIMEOUT), "handleForegroundTimeout");
     uiAbilityLifecycleManager.reset();
@@ -1552,7 +1552,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, NotifySCBToHandleException_007, TestSize
     abilityRequest.sessionInfo = sessionInfo;
     sessionInfo->persistentId = 0;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     uiAbilityLifecycleManager->NotifySCBToHandleException(abilityRecord,
         static_cast<int32_t>(ErrorLifecycleState::ABILITY_STATE_DIED), "onAbilityDied");
     uiAbilityLifecycleManager.reset();
@@ -1637,7 +1637,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, HandleLoadTimeout_005, TestSize.Level1)
     abilityRequest.sessionInfo = sessionInfo;
     sessionInfo->persistentId = 0;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     uiAbilityLifecycleManager->HandleLoadTimeout(abilityRecord);
     uiAbilityLifecycleManager.reset();
 }
@@ -1740,7 +1740,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, HandleForegroundTimeout_006, TestSize.Le
     sessionInfo->persistentId = 0;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->currentState_ = AbilityState::FOREGROUNDING;
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     uiAbilityLifecycleManager->HandleForegroundTimeout(abilityRecord);
     uiAbilityLifecycleManager.reset();
 }
@@ -1824,7 +1824,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnAbilityDied_005, TestSize.Level1)
     abilityRequest.sessionInfo = sessionInfo;
     sessionInfo->persistentId = 0;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     uiAbilityLifecycleManager->OnAbilityDied(abilityRecord);
     uiAbilityLifecycleManager.reset();
 }
@@ -1943,7 +1943,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetPersistentIdByAbilityRequest_003, Tes
     sessionInfo->persistentId = 1;
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     bool reuse = false;
     EXPECT_EQ(uiAbilityLifecycleManager->GetPersistentIdByAbilityRequest(abilityRequest, reuse),
         sessionInfo->persistentId);
@@ -1969,7 +1969,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetPersistentIdByAbilityRequest_004, Tes
     abilityRequest.sessionInfo = sessionInfo;
     abilityRequest.abilityInfo.name = "testAbility";
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     bool reuse = false;
     EXPECT_EQ(uiAbilityLifecycleManager->GetPersistentIdByAbilityRequest(abilityRequest1, reuse), 0);
 }
@@ -2013,7 +2013,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetReusedSpecifiedPersistentId_002, Test
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->SetSpecifiedFlag(flag);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     bool reuse = false;
     EXPECT_EQ(uiAbilityLifecycleManager->GetReusedSpecifiedPersistentId(abilityRequest, reuse),
         sessionInfo->persistentId);
@@ -2040,7 +2040,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetReusedSpecifiedPersistentId_003, Test
     sessionInfo->persistentId = 1;
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     bool reuse = false;
     EXPECT_EQ(uiAbilityLifecycleManager->GetReusedSpecifiedPersistentId(abilityRequest, reuse), 0);
 }
@@ -2081,7 +2081,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetReusedStandardPersistentId_002, TestS
     sessionInfo->persistentId = 1;
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     bool reuse = false;
     EXPECT_EQ(uiAbilityLifecycleManager->GetReusedStandardPersistentId(abilityRequest, reuse),
         sessionInfo->persistentId);
@@ -2103,7 +2103,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, NotifySCBPendingActivation_001, TestSize
     sessionInfo->persistentId = 1;
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     auto token = abilityRecord->GetToken();
     EXPECT_NE(token, nullptr);
     abilityRequest.callerToken = token->AsObject();
@@ -2128,7 +2128,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, NotifySCBPendingActivation_002, TestSize
     sessionInfo->persistentId = 1;
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     auto token = abilityRecord->GetToken();
     EXPECT_NE(token, nullptr);
     abilityRequest.callerToken = token->AsObject();
@@ -2201,7 +2201,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, NotifySCBPendingActivationInSplitMode_00
     sessionInfo->persistentId = 1;
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     auto token = abilityRecord->GetToken();
     EXPECT_NE(token, nullptr);
     abilityRequest.callerToken = token->AsObject();
@@ -2279,7 +2279,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, CallAbilityLocked_001, TestSize.Level1)
     abilityRequest.want = want;
     abilityRequest.abilityInfo.launchMode = AppExecFwk::LaunchMode::SINGLETON;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     abilityRecord->isReady_ = true;
 
     std::string errMsg;
@@ -2445,7 +2445,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, CallUIAbilityBySCB_007, TestSize.Level1)
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
 
     uiAbilityLifecycleManager->tmpAbilityMap_.emplace(1, abilityRecord);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     bool isColdStart = false;
     AbilityRuntime::StartParamsBySCB params;
     uiAbilityLifecycleManager->CallUIAbilityBySCB(sessionInfo, params, isColdStart);
@@ -2522,7 +2522,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ReleaseCallLocked_002, TestSize.Level1)
     auto uiAbilityLifecycleManager = std::make_unique<UIAbilityLifecycleManager>();
     EXPECT_NE(uiAbilityLifecycleManager, nullptr);
     auto abilityRecord = InitAbilityRecord();
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(1, abilityRecord);
     sptr<IAbilityConnection> connect = new UIAbilityLifecycleManagerTestStub();
     AppExecFwk::ElementName element("", "com.example.unittest", "MainAbility");
     auto ret = uiAbilityLifecycleManager->ReleaseCallLocked(connect, element);
@@ -2540,8 +2540,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, Dump_001, TestSize.Level1)
     EXPECT_NE(uiAbilityLifecycleManager, nullptr);
     AbilityRequest abilityRequest;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, nullptr);
+    uiAbilityLifecycleManager->AddSessionRecord(1, abilityRecord);
     std::vector<std::string> info;
     uiAbilityLifecycleManager->Dump(info);
 }
@@ -2557,8 +2556,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, DumpMissionList_001, TestSize.Level1)
     EXPECT_NE(uiAbilityLifecycleManager, nullptr);
     AbilityRequest abilityRequest;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, nullptr);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(1, nullptr);
     std::vector<std::string> info;
     bool isClient = false;
     std::string args;
@@ -2576,7 +2574,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, DumpMissionList_002, TestSize.Level1)
     EXPECT_NE(uiAbilityLifecycleManager, nullptr);
     AbilityRequest abilityRequest;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(1, abilityRecord);
     std::vector<std::string> info;
     bool isClient = false;
     std::string args;
@@ -2594,8 +2592,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, DumpMissionListByRecordId_001, TestSize.
     EXPECT_NE(uiAbilityLifecycleManager, nullptr);
     AbilityRequest abilityRequest;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, nullptr);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(1, nullptr);
     std::vector<std::string> info;
     bool isClient = false;
     int32_t abilityRecordId = 0;
@@ -2614,7 +2611,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, DumpMissionListByRecordId_002, TestSize.
     EXPECT_NE(uiAbilityLifecycleManager, nullptr);
     AbilityRequest abilityRequest;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(1, abilityRecord);
     std::vector<std::string> info;
     bool isClient = false;
     int32_t abilityRecordId = 1;
@@ -2671,7 +2668,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnAcceptWantResponse_002, TestSize.Level
     abilityRecord->abilityInfo_.moduleName = "entry";
     abilityRecord->SetAppIndex(1);
     abilityRecord->SetSpecifiedFlag(flag);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(1, abilityRecord);
     uiAbilityLifecycleManager->OnAcceptWantResponse(want, flag, 0);
 
     UIAbilityRecordPtr callerAbility = InitAbilityRecord();
@@ -3093,7 +3090,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityStateByPersistentId_002, TestS
     EXPECT_NE(uiAbilityLifecycleManager, nullptr);
     UIAbilityRecordPtr abilityRecord = InitAbilityRecord();
     abilityRecord->SetPendingState(AbilityState::INITIAL);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(100, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(100, abilityRecord);
     int32_t persistentId = 100;
     bool state;
     int32_t ret = uiAbilityLifecycleManager->GetAbilityStateByPersistentId(persistentId, state);
@@ -3139,7 +3136,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, IsContainsAbility_002, TestSize.Level1)
     AbilityRequest abilityRequest;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     auto&& token = abilityRecord->GetToken()->AsObject();
-    mgr->sessionAbilityMap_.emplace(1, abilityRecord);
+    mgr->AddSessionRecord(1, abilityRecord);
     bool boolValue = mgr->IsContainsAbility(token);
     EXPECT_TRUE(boolValue);
 }
@@ -3170,7 +3167,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, IsContainsAbilityInner_002, TestSize.Lev
     AbilityRequest abilityRequest;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     auto&& token = abilityRecord->GetToken()->AsObject();
-    mgr->sessionAbilityMap_.emplace(1, abilityRecord);
+    mgr->AddSessionRecord(1, abilityRecord);
     bool boolValue = mgr->IsContainsAbilityInner(token);
     EXPECT_TRUE(boolValue);
 }
@@ -3245,7 +3242,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetUIAbilityRecordBySessionInfo_004, Tes
     sessionInfo->persistentId = 1;
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     EXPECT_NE(uiAbilityLifecycleManager->GetUIAbilityRecordBySessionInfo(sessionInfo), nullptr);
 }
 
@@ -3403,7 +3400,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetSessionIdByAbilityToken_002, TestSize
     auto mgr = std::make_unique<UIAbilityLifecycleManager>();
     AbilityRequest abilityRequest;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    mgr->sessionAbilityMap_.emplace(1, abilityRecord);
+    mgr->AddSessionRecord(1, abilityRecord);
     auto&& token = abilityRecord->GetToken()->AsObject();
     EXPECT_EQ(mgr->GetSessionIdByAbilityToken(token), 1);
 }
@@ -3419,7 +3416,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetActiveAbilityList_001, TestSize.Level
     EXPECT_NE(uiAbilityLifecycleManager, nullptr);
     AbilityRequest abilityRequest;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(1, abilityRecord);
     std::vector<std::string> abilityList;
     int32_t pid = 100;
     uiAbilityLifecycleManager->GetActiveAbilityList(TEST_UID, abilityList, pid);
@@ -3443,7 +3440,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetActiveAbilityList_002, TestSize.Level
     abilityRequest.abilityInfo.applicationInfo.uid = TEST_UID;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->SetOwnerMissionUserId(AbilityRuntime::UserController::GetInstance().GetCallerUserId());
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(1, abilityRecord);
     std::vector<std::string> abilityList;
     int32_t pid = 100;
     uiAbilityLifecycleManager->GetActiveAbilityList(TEST_UID, abilityList, pid);
@@ -3466,7 +3463,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, IsAbilityStarted_001, TestSize.Level1)
     sessionInfo->persistentId = 0;
     abilityRequest.sessionInfo = sessionInfo;
     auto targetRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, targetRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, targetRecord);
     std::shared_ptr<AbilityRecord> tmpRecord;
     EXPECT_EQ(uiAbilityLifecycleManager->IsAbilityStarted(abilityRequest, tmpRecord), false);
 }
@@ -3487,7 +3484,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, IsAbilityStarted_002, TestSize.Level1)
     sessionInfo->persistentId = 1;
     abilityRequest.sessionInfo = sessionInfo;
     auto targetRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, targetRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, targetRecord);
     sptr<IAbilityScheduler> scheduler = new AbilitySchedulerMock();
     targetRecord->SetScheduler(scheduler);
     std::shared_ptr<AbilityRecord> tmpRecord;
@@ -3533,7 +3530,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ChangeAbilityVisibility_003, TestSize.Le
     AbilityRequest abilityRequest;
     abilityRequest.appInfo.accessTokenId = 100;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(0, abilityRecord);
     sptr<IRemoteObject> token = abilityRecord->GetToken()->AsObject();
     bool isShow = true;
     EXPECT_EQ(uiAbilityLifecycleManager->ChangeAbilityVisibility(token, isShow), ERR_NATIVE_NOT_SELF_APPLICATION);
@@ -3552,7 +3549,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ChangeAbilityVisibility_004, TestSize.Le
     abilityRequest.appInfo.accessTokenId = IPCSkeleton::GetCallingTokenID();
     abilityRequest.sessionInfo = nullptr;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(0, abilityRecord);
     sptr<IRemoteObject> token = abilityRecord->GetToken()->AsObject();
     bool isShow = true;
     EXPECT_EQ(uiAbilityLifecycleManager->ChangeAbilityVisibility(token, isShow), ERR_INVALID_VALUE);
@@ -3573,7 +3570,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ChangeAbilityVisibility_005, TestSize.Le
     sessionInfo->processOptions = nullptr;
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(0, abilityRecord);
     sptr<IRemoteObject> token = abilityRecord->GetToken()->AsObject();
     bool isShow = true;
     EXPECT_EQ(uiAbilityLifecycleManager->ChangeAbilityVisibility(token, isShow), ERR_START_OPTIONS_CHECK_FAILED);
@@ -3594,7 +3591,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ChangeAbilityVisibility_006, TestSize.Le
     sessionInfo->processOptions = std::make_shared<ProcessOptions>();
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(0, abilityRecord);
     sptr<IRemoteObject> token = abilityRecord->GetToken()->AsObject();
     bool isShow = true;
     EXPECT_EQ(uiAbilityLifecycleManager->ChangeAbilityVisibility(token, isShow), ERR_START_OPTIONS_CHECK_FAILED);
@@ -3617,7 +3614,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ChangeAbilityVisibility_007, TestSize.Le
     sessionInfo->processOptions->processMode = ProcessMode::NEW_PROCESS_ATTACH_TO_STATUS_BAR_ITEM;
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(0, abilityRecord);
     sptr<IRemoteObject> token = abilityRecord->GetToken()->AsObject();
     bool isShow = true;
     EXPECT_EQ(uiAbilityLifecycleManager->ChangeAbilityVisibility(token, isShow), ERR_START_OPTIONS_CHECK_FAILED);
@@ -3641,7 +3638,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ChangeAbilityVisibility_008, TestSize.Le
     sessionInfo->processOptions->processMode = ProcessMode::NEW_PROCESS_ATTACH_TO_STATUS_BAR_ITEM;
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(0, abilityRecord);
     sptr<IRemoteObject> token = abilityRecord->GetToken()->AsObject();
     bool isShow = true;
     EXPECT_EQ(uiAbilityLifecycleManager->ChangeAbilityVisibility(token, isShow), ERR_START_OPTIONS_CHECK_FAILED);
@@ -3665,7 +3662,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ChangeAbilityVisibility_009, TestSize.Le
     sessionInfo->processOptions->processMode = ProcessMode::NEW_PROCESS_ATTACH_TO_STATUS_BAR_ITEM;
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(0, abilityRecord);
     sptr<IRemoteObject> token = abilityRecord->GetToken()->AsObject();
     bool isShow = false;
     EXPECT_EQ(uiAbilityLifecycleManager->ChangeAbilityVisibility(token, isShow), ERR_START_OPTIONS_CHECK_FAILED);
@@ -3699,7 +3696,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ChangeUIAbilityVisibilityBySCB_003, Test
     sessionInfo->persistentId = 100;
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(0, abilityRecord);
     bool isShow = false;
     EXPECT_EQ(uiAbilityLifecycleManager->ChangeUIAbilityVisibilityBySCB(sessionInfo, isShow),
         ERR_NATIVE_ABILITY_NOT_FOUND);
@@ -3716,7 +3713,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ChangeUIAbilityVisibilityBySCB_004, Test
     EXPECT_NE(uiAbilityLifecycleManager, nullptr);
     sptr<SessionInfo> sessionInfo(new SessionInfo());
     sessionInfo->persistentId = 100;
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, nullptr);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, nullptr);
     bool isShow = false;
     EXPECT_EQ(uiAbilityLifecycleManager->ChangeUIAbilityVisibilityBySCB(sessionInfo, isShow),
         ERR_INVALID_VALUE);
@@ -3737,7 +3734,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ChangeUIAbilityVisibilityBySCB_005, Test
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->SetAbilityVisibilityState(AbilityVisibilityState::INITIAL);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     bool isShow = false;
     EXPECT_EQ(uiAbilityLifecycleManager->ChangeUIAbilityVisibilityBySCB(sessionInfo, isShow), ERR_OK);
 }
@@ -3757,7 +3754,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ChangeUIAbilityVisibilityBySCB_006, Test
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->SetAbilityVisibilityState(AbilityVisibilityState::UNSPECIFIED);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     bool isShow = false;
     EXPECT_EQ(uiAbilityLifecycleManager->ChangeUIAbilityVisibilityBySCB(sessionInfo, isShow), ERR_OK);
 }
@@ -3777,7 +3774,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ChangeUIAbilityVisibilityBySCB_007, Test
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->SetAbilityVisibilityState(AbilityVisibilityState::FOREGROUND_SHOW);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     bool isShow = true;
     EXPECT_EQ(uiAbilityLifecycleManager->ChangeUIAbilityVisibilityBySCB(sessionInfo, isShow), ERR_OK);
 }
@@ -3797,7 +3794,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, ChangeUIAbilityVisibilityBySCB_008, Test
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->SetAbilityVisibilityState(AbilityVisibilityState::FOREGROUND_HIDE);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     bool isShow = false;
     EXPECT_EQ(uiAbilityLifecycleManager->ChangeUIAbilityVisibilityBySCB(sessionInfo, isShow), ERR_OK);
 }
@@ -3816,7 +3813,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRecordsByName_001, TestSize.Le
     abilityRequest.abilityInfo.name = "MainAbility";
     abilityRequest.abilityInfo.deviceId = "100";
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(1, abilityRecord);
     AppExecFwk::ElementName element;
     int32_t appIndex = 0;
     auto ret = uiAbilityLifecycleManager->GetAbilityRecordsByName(element, appIndex);
@@ -3837,7 +3834,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRecordsByName_002, TestSize.Le
     abilityRequest.abilityInfo.bundleName = "com.example.unittest";
     abilityRequest.abilityInfo.name = "MainAbility";
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(1, abilityRecord);
     AppExecFwk::ElementName element("100", "com.example.unittest", "MainAbility");
     int32_t appIndex = 0;
     auto ret = uiAbilityLifecycleManager->GetAbilityRecordsByName(element, appIndex);
@@ -3859,7 +3856,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRecordsByName_003, TestSize.Le
     abilityRequest.abilityInfo.name = "MainAbility";
     abilityRequest.abilityInfo.moduleName = "entry";
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(1, abilityRecord);
     AppExecFwk::ElementName element("100", "com.example.unittest", "MainAbility", "entry");
     int32_t appIndex = 0;
     auto ret = uiAbilityLifecycleManager->GetAbilityRecordsByName(element, appIndex);
@@ -3880,7 +3877,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRecordsByNameInner_001, TestSi
     abilityRequest.abilityInfo.name = "MainAbility";
     abilityRequest.abilityInfo.deviceId = "100";
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(1, abilityRecord);
     AppExecFwk::ElementName element;
     int32_t appIndex = 0;
     auto ret = uiAbilityLifecycleManager->GetAbilityRecordsByNameInner(element, appIndex);
@@ -3901,7 +3898,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRecordsByNameInner_002, TestSi
     abilityRequest.abilityInfo.bundleName = "com.example.unittest";
     abilityRequest.abilityInfo.name = "MainAbility";
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(1, abilityRecord);
     AppExecFwk::ElementName element("100", "com.example.unittest", "MainAbility");
     int32_t appIndex = 0;
     auto ret = uiAbilityLifecycleManager->GetAbilityRecordsByNameInner(element, appIndex);
@@ -3922,7 +3919,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRecordsByNameInner_003, TestSi
     abilityRequest.abilityInfo.bundleName = "com.example.unittest";
     abilityRequest.abilityInfo.name = "MainAbility";
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(1, abilityRecord);
     AppExecFwk::ElementName element("100", "com.example.unittest", "MainAbility");
     int32_t appIndex = -1;
     auto ret = uiAbilityLifecycleManager->GetAbilityRecordsByNameInner(element, appIndex);
@@ -3944,7 +3941,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRecordsByNameInner_004, TestSi
     abilityRequest.abilityInfo.name = "MainAbility";
     abilityRequest.abilityInfo.moduleName = "entry";
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(1, abilityRecord);
     AppExecFwk::ElementName element("100", "com.example.unittest", "MainAbility", "entry");
     int32_t appIndex = 0;
     auto ret = uiAbilityLifecycleManager->GetAbilityRecordsByNameInner(element, appIndex);
@@ -3966,7 +3963,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRecordsByNameInner_005, TestSi
     abilityRequest.abilityInfo.name = "MainAbility";
     abilityRequest.abilityInfo.moduleName = "entry";
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(1, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(1, abilityRecord);
     AppExecFwk::ElementName element("100", "com.example.unittest", "MainAbility", "entry");
     int32_t appIndex = -1;
     auto ret = uiAbilityLifecycleManager->GetAbilityRecordsByNameInner(element, appIndex);
@@ -4026,7 +4023,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRecordsById_001, TestSize.Leve
     int32_t sessionId = 100;
     AbilityRequest abilityRequest;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionId, abilityRecord);
     EXPECT_EQ(uiAbilityLifecycleManager->GetAbilityRecordsById(sessionId + 1), nullptr);
 }
 
@@ -4041,7 +4038,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRecordsById_002, TestSize.Leve
     int32_t sessionId = 100;
     AbilityRequest abilityRequest;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionId, abilityRecord);
     EXPECT_NE(uiAbilityLifecycleManager->GetAbilityRecordsById(sessionId), nullptr);
 }
 
@@ -4150,7 +4147,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnAppStateChanged_005, TestSize.Level1)
     AppInfo info;
     info.processName = "com.example.unittest";
     info.state = AppState::COLD_START;
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(0, abilityRecord);
     uiAbilityLifecycleManager->OnAppStateChanged(info);
     uiAbilityLifecycleManager.reset();
 }
@@ -4172,7 +4169,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnAppStateChanged_006, TestSize.Level1)
     AppInfo info;
     info.processName = "AbilityProcess";
     info.state = AppState::COLD_START;
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(0, abilityRecord);
     uiAbilityLifecycleManager->OnAppStateChanged(info);
     uiAbilityLifecycleManager.reset();
 }
@@ -4193,7 +4190,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnAppStateChanged_007, TestSize.Level1)
     UIAbilityRecordPtr abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     AppInfo info;
     info.processName = "com.example.unittest";
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(0, abilityRecord);
     uiAbilityLifecycleManager->OnAppStateChanged(info);
     uiAbilityLifecycleManager.reset();
 }
@@ -4214,7 +4211,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnAppStateChanged_008, TestSize.Level1)
     UIAbilityRecordPtr abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     AppInfo info;
     info.processName = "AbilityProcess";
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(0, abilityRecord);
     uiAbilityLifecycleManager->OnAppStateChanged(info);
     uiAbilityLifecycleManager.reset();
 }
@@ -4336,7 +4333,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnAppStateChanged_013, TestSize.Level1)
     info.instanceKey = abilityRecord->GetInstanceKey();
     info.pid = abilityRecord->GetPid();
     info.state = AppState::COLD_START;
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(0, abilityRecord);
     uiAbilityLifecycleManager->OnAppStateChanged(info);
     uiAbilityLifecycleManager.reset();
 }
@@ -4383,7 +4380,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnAppStateChanged_015, TestSize.Level1)
     info.appIndex = abilityRecord->GetAppIndex();
     info.instanceKey = abilityRecord->GetInstanceKey();
     info.pid = abilityRecord->GetPid();
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(0, abilityRecord);
     uiAbilityLifecycleManager->OnAppStateChanged(info);
     uiAbilityLifecycleManager.reset();
 }
@@ -4425,7 +4422,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, UninstallApp_001, TestSize.Level1)
     AppInfo info;
     std::string bundleName = "com.example.unittest";
     int32_t uid = 0;
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(0, abilityRecord);
     uiAbilityLifecycleManager->UninstallApp(bundleName, uid);
     uiAbilityLifecycleManager.reset();
 }
@@ -4440,7 +4437,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRunningInfos_001, TestSize.Lev
     auto uiAbilityLifecycleManager = std::make_shared<UIAbilityLifecycleManager>();
     ASSERT_NE(uiAbilityLifecycleManager, nullptr);
     UIAbilityRecordPtr abilityRecord = InitAbilityRecord();
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(0, abilityRecord);
     std::vector<AbilityRunningInfo> info;
     bool isPerm = true;
     uiAbilityLifecycleManager->GetAbilityRunningInfos(info, isPerm);
@@ -4459,7 +4456,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRunningInfos_002, TestSize.Lev
     AbilityRequest abilityRequest;
     abilityRequest.appInfo.accessTokenId = IPCSkeleton::GetCallingTokenID();
     UIAbilityRecordPtr abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(0, abilityRecord);
     std::vector<AbilityRunningInfo> info;
     bool isPerm = false;
     uiAbilityLifecycleManager->GetAbilityRunningInfos(info, isPerm);
@@ -4495,7 +4492,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, MoveMissionToFront_002, TestSize.Level1)
     int32_t sessionId = 100;
     std::shared_ptr<StartOptions> startOptions;
     UIAbilityRecordPtr abilityRecord = InitAbilityRecord();
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(0, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(0, abilityRecord);
     EXPECT_EQ(uiAbilityLifecycleManager->MoveMissionToFront(sessionId, startOptions), ERR_INVALID_VALUE);
 }
 
@@ -4516,7 +4513,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, MoveMissionToFront_003, TestSize.Level1)
     sptr<SessionInfo> sessionInfo = nullptr;
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionId, abilityRecord);
     EXPECT_EQ(uiAbilityLifecycleManager->MoveMissionToFront(sessionId, startOptions), ERR_INVALID_VALUE);
 }
 
@@ -4537,7 +4534,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, MoveMissionToFront_004, TestSize.Level1)
     sptr<SessionInfo> sessionInfo = (new SessionInfo());
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionId, abilityRecord);
     EXPECT_EQ(uiAbilityLifecycleManager->MoveMissionToFront(sessionId, startOptions), ERR_OK);
 }
 
@@ -4562,7 +4559,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, MoveMissionToFront_005, TestSize.Level1)
     sptr<SessionInfo> sessionInfo = (new SessionInfo());
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionId, abilityRecord);
     auto ret = uiAbilityLifecycleManager->MoveMissionToFront(sessionId, startOptions);
     EXPECT_EQ(ret, ERR_OK);
     EXPECT_EQ(sessionInfo->want.GetIntParam(Want::PARAM_RESV_DISPLAY_ID, -1), 1);
@@ -4587,7 +4584,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetReusedCollaboratorPersistentId_001, T
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->collaboratorType_ = CollaboratorType::DEFAULT_TYPE;
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     bool reuse = false;
     EXPECT_NE(uiAbilityLifecycleManager->GetReusedCollaboratorPersistentId(abilityRequest, reuse),
         sessionInfo->persistentId);
@@ -4611,7 +4608,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetReusedCollaboratorPersistentId_002, T
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->collaboratorType_ = CollaboratorType::RESERVE_TYPE;
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     bool reuse = false;
     EXPECT_EQ(uiAbilityLifecycleManager->GetReusedCollaboratorPersistentId(abilityRequest, reuse),
         sessionInfo->persistentId);
@@ -4635,7 +4632,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetReusedCollaboratorPersistentId_003, T
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     abilityRecord->collaboratorType_ = CollaboratorType::OTHERS_TYPE;
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
     bool reuse = false;
     EXPECT_EQ(uiAbilityLifecycleManager->GetReusedCollaboratorPersistentId(abilityRequest, reuse),
         sessionInfo->persistentId);
@@ -5467,7 +5464,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, SetKillForPermissionUpdateFlag_0100, Tes
     abilityRecord->abilityInfo_.applicationInfo.accessTokenId = accessTokenId;
     abilityRecord->abilityInfo_.applicationInfo.bundleType = AppExecFwk::BundleType::ATOMIC_SERVICE;
     abilityRecord->abilityInfo_.type = AppExecFwk::AbilityType::PAGE;
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(std::make_pair(accessTokenId, abilityRecord));
+    uiAbilityLifecycleManager->AddSessionRecord(accessTokenId, abilityRecord);
     uiAbilityLifecycleManager->SetKillForPermissionUpdateFlag(accessTokenId);
     for (auto& item : uiAbilityLifecycleManager->sessionAbilityMap_) {
         if (item.second != nullptr) {
@@ -5491,33 +5488,33 @@ HWTEST_F(UIAbilityLifecycleManagerTest, SetKillForPermissionUpdateFlag_0200, Tes
     abilityRecord->abilityInfo_.applicationInfo.bundleType = AppExecFwk::BundleType::ATOMIC_SERVICE;
     abilityRecord->abilityInfo_.type = AppExecFwk::AbilityType::PAGE;
     auto abilityRecord2 = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(std::make_pair(accessTokenId, abilityRecord2));
+    uiAbilityLifecycleManager->AddSessionRecord(accessTokenId, abilityRecord2);
     uiAbilityLifecycleManager->SetKillForPermissionUpdateFlag(accessTokenId);
     for (auto& item : uiAbilityLifecycleManager->sessionAbilityMap_) {
         if (item.second != nullptr) {
             EXPECT_EQ(item.second->isKillForPermissionUpdate_, false);
         }
     }
-    uiAbilityLifecycleManager->sessionAbilityMap_.clear();
+    uiAbilityLifecycleManager->EraseSessionRecord(accessTokenId);
 
     abilityRecord->abilityInfo_.applicationInfo.accessTokenId = 1;
     abilityRecord->abilityInfo_.applicationInfo.bundleType = AppExecFwk::BundleType::APP;
     abilityRecord->abilityInfo_.type = AppExecFwk::AbilityType::PAGE;
     auto abilityRecord3 = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(std::make_pair(accessTokenId, abilityRecord3));
+    uiAbilityLifecycleManager->AddSessionRecord(accessTokenId, abilityRecord3);
     uiAbilityLifecycleManager->SetKillForPermissionUpdateFlag(accessTokenId);
     for (auto& item : uiAbilityLifecycleManager->sessionAbilityMap_) {
         if (item.second != nullptr) {
             EXPECT_EQ(item.second->isKillForPermissionUpdate_, false);
         }
     }
-    uiAbilityLifecycleManager->sessionAbilityMap_.clear();
+    uiAbilityLifecycleManager->EraseSessionRecord(accessTokenId);
 
     abilityRecord->abilityInfo_.applicationInfo.accessTokenId = 1;
     abilityRecord->abilityInfo_.applicationInfo.bundleType = AppExecFwk::BundleType::APP;
     abilityRecord->abilityInfo_.type = AppExecFwk::AbilityType::SERVICE;
     auto abilityRecord4 = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(std::make_pair(accessTokenId, abilityRecord4));
+    uiAbilityLifecycleManager->AddSessionRecord(accessTokenId, abilityRecord4);
     uiAbilityLifecycleManager->SetKillForPermissionUpdateFlag(accessTokenId);
     for (auto& item : uiAbilityLifecycleManager->sessionAbilityMap_) {
         if (item.second != nullptr) {
@@ -5827,7 +5824,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GenerateAbilityRecord_0003, TestSize.Lev
     AbilityRequest request;
     sptr<SessionInfo> sessionInfo = new SessionInfo();
     sessionInfo->persistentId = 4;
-    mgr->sessionAbilityMap_[4] = nullptr;
+    mgr->AddSessionRecord(4, nullptr);
     bool isColdStart = false;
     auto record = mgr->GenerateAbilityRecord(request, sessionInfo, isColdStart);
     EXPECT_EQ(record, nullptr);
@@ -5849,7 +5846,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GenerateAbilityRecord_0004, TestSize.Lev
     auto recordSessionInfo = new SessionInfo();
     sessionInfo->sessionToken = new OHOS::IPCObjectStub(u"desc2");
     record->SetSessionInfo(recordSessionInfo);
-    mgr->sessionAbilityMap_[5] = record;
+    mgr->AddSessionRecord(5, record);
     bool isColdStart = false;
     auto ret = mgr->GenerateAbilityRecord(request, sessionInfo, isColdStart);
     EXPECT_EQ(ret, nullptr);
@@ -5871,7 +5868,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GenerateAbilityRecord_0005, TestSize.Lev
     auto recordSessionInfo = new SessionInfo();
     recordSessionInfo->sessionToken = sessionInfo->sessionToken;
     record->SetSessionInfo(recordSessionInfo);
-    mgr->sessionAbilityMap_[6] = record;
+    mgr->AddSessionRecord(6, record);
     bool isColdStart = false;
     auto ret = mgr->GenerateAbilityRecord(request, sessionInfo, isColdStart);
     ASSERT_NE(ret, nullptr);
@@ -5895,7 +5892,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GenerateAbilityRecord_0006, TestSize.Lev
     auto recordSessionInfo = new SessionInfo();
     recordSessionInfo->sessionToken = sessionInfo->sessionToken;
     record->SetSessionInfo(recordSessionInfo);
-    mgr->sessionAbilityMap_[7] = record;
+    mgr->AddSessionRecord(7, record);
     bool isColdStart = false;
     auto ret = mgr->GenerateAbilityRecord(request, sessionInfo, isColdStart);
     EXPECT_EQ(ret, record);
@@ -6024,7 +6021,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, AttachAbilityThread_0001, TestSize.Level
     AbilityRequest request;
     auto record = UIAbilityRecord::CreateAbilityRecord(request);
     auto token = record->GetToken();
-    mgr->sessionAbilityMap_[1] = record;
+    mgr->AddSessionRecord(1, record);
 
     int ret = mgr->AttachAbilityThread(nullptr, token);
     EXPECT_EQ(ret, ERR_INVALID_VALUE);
@@ -6083,7 +6080,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, NotifySCBToStartUIAbility_0003, TestSize
     EXPECT_NE(ret, ERR_OK);
 
     auto record = UIAbilityRecord::CreateAbilityRecord(request);
-    mgr->sessionAbilityMap_[1] = record;
+    mgr->AddSessionRecord(1, record);
     ret = mgr->NotifySCBToStartUIAbility(request);
     EXPECT_NE(ret, ERR_OK);
 
@@ -6947,7 +6944,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, CallAbilityLocked_0001, TestSize.Level1)
     auto record = UIAbilityRecord::CreateAbilityRecord(request);
     record->SetPendingState(AbilityState::FOREGROUND);
     int32_t persistentId = 1;
-    mgr->sessionAbilityMap_[persistentId] = record;
+    mgr->AddSessionRecord(persistentId, record);
     std::string errMsg;
     int ret = mgr->CallAbilityLocked(request, errMsg);
     EXPECT_EQ(record->GetPendingState(), AbilityState::FOREGROUND);
@@ -7287,7 +7284,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnTimeOut_0002, TestSize.Level1)
     request.abilityInfo.name = "AbilityA";
     auto record = UIAbilityRecord::CreateAbilityRecord(request);
     int64_t abilityRecordId = record->GetAbilityRecordId();
-    mgr->sessionAbilityMap_[1] = record;
+    mgr->AddSessionRecord(1, record);
 
     uint32_t msgId = 1;
     bool isHalf = true;
@@ -7325,7 +7322,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnTimeOut_0004, TestSize.Level1)
     request.abilityInfo.name = "AbilityC";
     auto record = UIAbilityRecord::CreateAbilityRecord(request);
     int64_t abilityRecordId = record->GetAbilityRecordId();
-    mgr->sessionAbilityMap_[2] = record;
+    mgr->AddSessionRecord(2, record);
 
     uint32_t msgId = AbilityManagerService::LOAD_TIMEOUT_MSG;
     bool isHalf = false;
@@ -7345,7 +7342,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnTimeOut_0005, TestSize.Level1)
     request.abilityInfo.name = "AbilityD";
     auto record = UIAbilityRecord::CreateAbilityRecord(request);
     int64_t abilityRecordId = record->GetAbilityRecordId();
-    mgr->sessionAbilityMap_[3] = record;
+    mgr->AddSessionRecord(3, record);
 
     uint32_t msgId = AbilityManagerService::FOREGROUND_TIMEOUT_MSG;
     bool isHalf = false;
@@ -7364,7 +7361,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, OnTimeOut_0006, TestSize.Level1)
     request.abilityInfo.name = "AbilityE";
     auto record = UIAbilityRecord::CreateAbilityRecord(request);
     int64_t abilityRecordId = record->GetAbilityRecordId();
-    mgr->sessionAbilityMap_[4] = record;
+    mgr->AddSessionRecord(4, record);
 
     uint32_t msgId = 0xDEADBEEF;
     bool isHalf = false;
@@ -7439,7 +7436,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, IsUIAbilityAlreadyExist_0001, TestSize.L
     auto record = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     record->SetAppIndex(appIndex);
     record->SetInstanceKey(instanceKey);
-    mgr->sessionAbilityMap_[1] = record;
+    mgr->AddSessionRecord(1, record);
 
     Want want;
     want.SetElementName("device", bundleName, abilityName, moduleName);
@@ -7474,7 +7471,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, IsUIAbilityAlreadyExist_0002, TestSize.L
     record->SetAppIndex(appIndex);
     record->SetInstanceKey(instanceKey);
     record->SetSpecifiedFlag(specifiedFlag);
-    mgr->sessionAbilityMap_[10] = record;
+    mgr->AddSessionRecord(10, record);
 
     Want want;
     want.SetElementName("device", bundleName, abilityName, moduleName);
@@ -7505,7 +7502,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, IsUIAbilityAlreadyExist_0003, TestSize.L
     auto record = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     record->SetAppIndex(0);
     record->SetInstanceKey("key");
-    mgr->sessionAbilityMap_[5] = record;
+    mgr->AddSessionRecord(5, record);
     ret = mgr->IsUIAbilityAlreadyExist(want, "flag", 0, "key", AppExecFwk::LaunchMode::SINGLETON);
     EXPECT_EQ(ret, ERR_OK);
 }
@@ -7536,7 +7533,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, FindUIAbilityRecordByIdLocked_0002, Test
     AbilityRequest abilityRequest;
     auto record = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     record->recordId_ = 100;
-    mgr->sessionAbilityMap_.emplace(1, record);
+    mgr->AddSessionRecord(1, record);
     auto ret = mgr->FindUIAbilityRecordByIdLocked(100);
     EXPECT_NE(ret, nullptr);
 }
@@ -7573,12 +7570,12 @@ HWTEST_F(UIAbilityLifecycleManagerTest, HandleUIAbilityDiedByPid_0001, TestSize.
     AbilityRequest abilityRequest;
     auto record = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     record->pid_ = 1;
-    mgr->sessionAbilityMap_.emplace(111, record);
-    mgr->sessionAbilityMap_.emplace(112, nullptr);
+    mgr->AddSessionRecord(111, record);
+    mgr->AddSessionRecord(112, nullptr);
     pid_t pid = 1;
     mgr->HandleUIAbilityDiedByPid(pid);
-    EXPECT_NE(mgr->sessionAbilityMap_[111], nullptr);
-    EXPECT_EQ(mgr->sessionAbilityMap_[112], nullptr);
+    EXPECT_NE(mgr->GetSessionRecord(111), nullptr);
+    EXPECT_EQ(mgr->GetSessionRecord(112), nullptr);
     TAG_LOGI(AAFwkTag::TEST, "UIAbilityLifecycleManagerTest HandleUIAbilityDiedByPid_0001 end");
 }
 
@@ -7596,12 +7593,12 @@ HWTEST_F(UIAbilityLifecycleManagerTest, HandleUIAbilityDiedByPid_0002, TestSize.
     AbilityRequest abilityRequest;
     auto record = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     record->pid_ = 2;
-    mgr->sessionAbilityMap_.emplace(111, record);
-    mgr->sessionAbilityMap_.emplace(112, nullptr);
+    mgr->AddSessionRecord(111, record);
+    mgr->AddSessionRecord(112, nullptr);
     pid_t pid = 1;
     mgr->HandleUIAbilityDiedByPid(pid);
-    EXPECT_NE(mgr->sessionAbilityMap_[111], nullptr);
-    EXPECT_EQ(mgr->sessionAbilityMap_[112], nullptr);
+    EXPECT_NE(mgr->GetSessionRecord(111), nullptr);
+    EXPECT_EQ(mgr->GetSessionRecord(112), nullptr);
     TAG_LOGI(AAFwkTag::TEST, "UIAbilityLifecycleManagerTest HandleUIAbilityDiedByPid_0002 end");
 }
 
@@ -7643,7 +7640,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, MarkStartingFlag_001, TestSize.Level1)
     auto record = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     record->pid_ = 123;
     record->uid_ = 100;
-    mgr->sessionAbilityMap_.emplace(1, record);
+    mgr->AddSessionRecord(1, record);
     
     mgr->MarkStartingFlag(abilityRequest);
     EXPECT_TRUE(mgr->IsBundleStarting(123));
@@ -7686,7 +7683,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, StartUIAbility_isLowMemKill_001, TestSiz
 
     auto oldRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     oldRecord->SetIsKillPrecedeStart(true);
-    mgr->sessionAbilityMap_.emplace(1, oldRecord);
+    mgr->AddSessionRecord(1, oldRecord);
 
     AbilityRuntime::StartParamsBySCB params;
     bool isColdStart = false;
@@ -7775,7 +7772,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, AttachAbilityThread_ProcessAttachSuccess
 
     auto record = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
     auto token = record->GetToken();
-    mgr->sessionAbilityMap_.emplace(1, record);
+    mgr->AddSessionRecord(1, record);
     
     auto result = mgr->AttachAbilityThread(nullptr, token->AsObject());
     EXPECT_EQ(result, ERR_OK);
@@ -7797,7 +7794,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, AttachAbilityThread_StartedByCall_001, T
     record->isStartedByCall_ = true;
     record->isStartToForeground_ = true;
     auto token = record->GetToken();
-    mgr->sessionAbilityMap_.emplace(1, record);
+    mgr->AddSessionRecord(1, record);
     
     auto result = mgr->AttachAbilityThread(nullptr, token->AsObject());
     EXPECT_EQ(result, ERR_OK);
@@ -7861,7 +7858,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, SignRestartAppFlag_AppRecovery_001, Test
     req.sessionInfo->persistentId = 1;
     auto record = UIAbilityRecord::CreateAbilityRecord(req);
     record->uid_ = 100;
-    mgr->sessionAbilityMap_.emplace(1, record);
+    mgr->AddSessionRecord(1, record);
     
     mgr->SignRestartAppFlag(100, "", true);
     EXPECT_TRUE(record->isRestartApp_);
@@ -7935,7 +7932,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, GetAbilityRecordByToken_Various_001, Tes
     EXPECT_EQ(mgr->GetAbilityRecordByToken(record->GetToken()->AsObject()), record);
     
     mgr->terminateAbilityList_.clear();
-    mgr->sessionAbilityMap_.emplace(1, record);
+    mgr->AddSessionRecord(1, record);
     EXPECT_EQ(mgr->GetAbilityRecordByToken(record->GetToken()->AsObject()), record);
 }
 
@@ -7973,7 +7970,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, NotifySCBToStartUIAbility_Hook_001, Test
     
     auto record = UIAbilityRecord::CreateAbilityRecord(request);
     record->isHook_ = true;
-    mgr->sessionAbilityMap_.emplace(1, record);
+    mgr->AddSessionRecord(1, record);
     
     auto result = mgr->NotifySCBToStartUIAbility(request);
     EXPECT_NE(result, ERR_OK);
@@ -8000,7 +7997,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, StartUIAbility_Preload_001, TestSize.Lev
     
     auto record = UIAbilityRecord::CreateAbilityRecord(request);
     record->isPreloaded_ = false;
-    mgr->sessionAbilityMap_.emplace(1, record);
+    mgr->AddSessionRecord(1, record);
     
     AbilityRuntime::StartParamsBySCB params;
     bool isColdStart = false;
@@ -8059,7 +8056,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, StartUIAbility_CallerTypeForAnco_ADD_002
 
     // Pre-populate sessionAbilityMap_
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    mgr->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    mgr->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
 
     AbilityRuntime::StartParamsBySCB params;
     bool isColdStart = false;
@@ -8110,7 +8107,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, StartUIAbility_CallerTypeForAnco_QUERY_0
 
     // Pre-populate sessionAbilityMap_
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    mgr->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    mgr->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
 
     AbilityRuntime::StartParamsBySCB params;
     bool isColdStart = false;
@@ -8181,7 +8178,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, StartUIAbility_CallerTypeForAnco_QUERY_0
 
     // Pre-populate sessionAbilityMap_
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    mgr->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    mgr->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
 
     AbilityRuntime::StartParamsBySCB params;
     bool isColdStart = false;
@@ -8812,7 +8809,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, CalcHideNativeWindow_0004, TestSize.Leve
     auto mgr = std::make_shared<UIAbilityLifecycleManager>();
     AppExecFwk::AbilityInfo abilityInfo;
     auto abilityRecord = InitAbilityRecord();
-    mgr->sessionAbilityMap_[1] = abilityRecord;
+    mgr->AddSessionRecord(1, abilityRecord);
 
     EXPECT_EQ(abilityRecord->GetNativeState(), AbilityNativeState::NONE);
     EXPECT_FALSE(mgr->CalcHideNativeWindow(1, abilityInfo));
@@ -8829,7 +8826,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, CalcHideNativeWindow_0005, TestSize.Leve
     AppExecFwk::AbilityInfo abilityInfo;
     auto abilityRecord = InitAbilityRecord();
     abilityRecord->SetNativeState(AbilityNativeState::NORMAL);
-    mgr->sessionAbilityMap_[1] = abilityRecord;
+    mgr->AddSessionRecord(1, abilityRecord);
 
     EXPECT_FALSE(mgr->CalcHideNativeWindow(1, abilityInfo));
 }
@@ -8845,7 +8842,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, CalcHideNativeWindow_0006, TestSize.Leve
     AppExecFwk::AbilityInfo abilityInfo;
     auto abilityRecord = InitAbilityRecord();
     abilityRecord->SetNativeState(AbilityNativeState::INIT);
-    mgr->sessionAbilityMap_[1] = abilityRecord;
+    mgr->AddSessionRecord(1, abilityRecord);
 
     EXPECT_TRUE(mgr->CalcHideNativeWindow(1, abilityInfo));
 }
@@ -8861,7 +8858,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, CalcHideNativeWindow_0007, TestSize.Leve
     AppExecFwk::AbilityInfo abilityInfo;
     auto abilityRecord = InitAbilityRecord();
     abilityRecord->SetNativeState(AbilityNativeState::ATTACHED);
-    mgr->sessionAbilityMap_[1] = abilityRecord;
+    mgr->AddSessionRecord(1, abilityRecord);
 
     EXPECT_TRUE(mgr->CalcHideNativeWindow(1, abilityInfo));
 }
@@ -8877,7 +8874,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, CalcHideNativeWindow_0008, TestSize.Leve
     AppExecFwk::AbilityInfo abilityInfo;
     auto abilityRecord = InitAbilityRecord();
     abilityRecord->SetNativeState(AbilityNativeState::CREATED);
-    mgr->sessionAbilityMap_[1] = abilityRecord;
+    mgr->AddSessionRecord(1, abilityRecord);
 
     EXPECT_TRUE(mgr->CalcHideNativeWindow(1, abilityInfo));
 }
@@ -8893,7 +8890,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, CalcHideNativeWindow_0009, TestSize.Leve
     AppExecFwk::AbilityInfo abilityInfo;
     auto abilityRecord = InitAbilityRecord();
     abilityRecord->SetNativeState(AbilityNativeState::ON_FOREGROUND);
-    mgr->sessionAbilityMap_[1] = abilityRecord;
+    mgr->AddSessionRecord(1, abilityRecord);
 
     EXPECT_TRUE(mgr->CalcHideNativeWindow(1, abilityInfo));
 }
@@ -8907,7 +8904,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, CalcHideNativeWindow_0010, TestSize.Leve
 {
     auto mgr = std::make_shared<UIAbilityLifecycleManager>();
     AppExecFwk::AbilityInfo abilityInfo;
-    mgr->sessionAbilityMap_[1] = nullptr;
+    mgr->AddSessionRecord(1, nullptr);
 
     EXPECT_FALSE(mgr->CalcHideNativeWindow(1, abilityInfo));
 }
@@ -9183,7 +9180,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, StartUIAbility_WithRequestId_0600, TestS
 
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    mgr->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    mgr->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
 
     AbilityRuntime::StartParamsBySCB params;
     bool isColdStart = false;
@@ -9221,7 +9218,7 @@ HWTEST_F(UIAbilityLifecycleManagerTest, StartUIAbility_WithRequestId_0700, TestS
 
     abilityRequest.sessionInfo = sessionInfo;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    mgr->sessionAbilityMap_.emplace(sessionInfo->persistentId, abilityRecord);
+    mgr->AddSessionRecord(sessionInfo->persistentId, abilityRecord);
 
     AbilityRuntime::StartParamsBySCB params;
     bool isColdStart = false;
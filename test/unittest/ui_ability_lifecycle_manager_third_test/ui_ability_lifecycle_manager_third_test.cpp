@@ -612,7 +612,6 @@ HWTEST_F(UIAbilityLifecycleManagerThirdTest, GetPersistentIdByAbilityRequest_003
     EXPECT_NE(uiAbilityLifecycleManager, nullptr);
     AbilityRequest abilityRequest;
     abilityRequest.collaboratorType = CollaboratorType::OTHERS_TYPE;
-    uiAbilityLifecycleManager->sessionAbilityMap_.clear();
     bool reuse = false;
     EXPECT_EQ(uiAbilityLifecycleManager->GetPersistentIdByAbilityRequest(abilityRequest, reuse), 0);
 }
@@ -658,7 +657,7 @@ HWTEST_F(UIAbilityLifecycleManagerThirdTest, OnStartSpecifiedFailed_003, TestSiz
 
     auto abilityRecord = std::make_shared<UIAbilityRecord>(
         abilityRequest.want, abilityRequest.abilityInfo, abilityRequest.appInfo, abilityRequest.requestCode);
-    uiAbilityLifecycleManager->sessionAbilityMap_.emplace(specifiedRequest->persistentId, abilityRecord);
+    uiAbilityLifecycleManager->AddSessionRecord(specifiedRequest->persistentId, abilityRecord);
 
     uiAbilityLifecycleManager->OnStartSpecifiedFailed(requestId);
     EXPECT_FALSE(list.empty());
@@ -983,9 +982,7 @@ HWTEST_F(UIAbilityLifecycleManagerThirdTest, MoveMissionToFront_001, TestSize.Le
         abilityRequest.want, abilityRequest.abilityInfo, abilityRequest.appInfo, abilityRequest.requestCode);
     abilityRecord->sessionInfo_ = sptr<AAFwk::SessionInfo>::MakeSptr();
 
-    uiAbilityLifecycleManager->sessionAbilityMap_ = {
-        {sessionId, abilityRecord}
-    };
+    uiAbilityLifecycleManager->AddSessionRecord(sessionId, abilityRecord);
 
     uiAbilityLifecycleManager->MoveMissionToFront(sessionId, startOptions);
     
@@ -1017,9 +1014,7 @@ HWTEST_F(UIAbilityLifecycleManagerThirdTest, MoveMissionToFront_002, TestSize.Le
         abilityRequest.want, abilityRequest.abilityInfo, abilityRequest.appInfo, abilityRequest.requestCode);
     abilityRecord->sessionInfo_ = sptr<AAFwk::SessionInfo>::MakeSptr();
 
-    uiAbilityLifecycleManager->sessionAbilityMap_ = {
-        {sessionId, abilityRecord}
-    };
+    uiAbilityLifecycleManager->AddSessionRecord(sessionId, abilityRecord);
 
     uiAbilityLifecycleManager->MoveMissionToFront(sessionId, nullptr);
     
@@ -1056,9 +1051,7 @@ HWTEST_F(UIAbilityLifecycleManagerThirdTest, MoveMissionToFront_003, TestSize.Le
     abilityRecord->sessionInfo_ = sptr<AAFwk::SessionInfo>::MakeSptr();
     abilityRecord->sessionInfo_->want.RemoveParam(Want::PARAM_RESV_DISPLAY_ID);
 
-    uiAbilityLifecycleManager->sessionAbilityMap_ = {
-        {sessionId, abilityRecord}
-    };
+    uiAbilityLifecycleManager->AddSessionRecord(sessionId, abilityRecord);
 
     uiAbilityLifecycleManager->MoveMissionToFront(sessionId, startOptions);
     
@@ -1095,9 +1088,7 @@ HWTEST_F(UIAbilityLifecycleManagerThirdTest, MoveMissionToFront_004, TestSize.Le
     abilityRecord->sessionInfo_ = sptr<AAFwk::SessionInfo>::MakeSptr();
     abilityRecord->sessionInfo_->want.RemoveParam(Want::PARAM_RESV_DISPLAY_ID);
 
-    uiAbilityLifecycleManager->sessionAbilityMap_ = {
-        {sessionId, abilityRecord}
-    };
+    uiAbilityLifecycleManager->AddSessionRecord(sessionId, abilityRecord);
 
     uiAbilityLifecycleManager->MoveMissionToFront(sessionId, startOptions);
     
@@ -1170,9 +1161,7 @@ HWTEST_F(UIAbilityLifecycleManagerThirdTest, UpdateSessionInfoBySCB_002, TestSiz
     auto abilityRecord = std::make_shared<UIAbilityRecord>(
         abilityRequest.want, abilityRequest.abilityInfo, abilityRequest.appInfo, abilityRequest.requestCode);
     abilityRecord->sessionInfo_ = sptr<AAFwk::SessionInfo>::MakeSptr();
-    uiAbilityLifecycleManager->sessionAbilityMap_ = {
-        {1, abilityRecord}
-    };
+    uiAbilityLifecycleManager->AddSessionRecord(1, abilityRecord);
 
     auto ret = uiAbilityLifecycleManager->UpdateSessionInfoBySCB(sessionInfos, sessionIds);
     EXPECT_EQ(ret, ERR_OK);
@@ -1266,7 +1255,6 @@ HWTEST_F(UIAbilityLifecycleManagerThirdTest, HandleColdAcceptWantDone_001, TestS
 
     auto specifiedRequestPtr = std::make_shared<SpecifiedRequest>(requestId1, abilityRequest);
 
-    uiAbilityLifecycleManager->sessionAbilityMap_.clear();
 
     auto ret = uiAbilityLifecycleManager->HandleColdAcceptWantDone(want, "", *specifiedRequestPtr);
 
@@ -1291,9 +1279,7 @@ HWTEST_F(UIAbilityLifecycleManagerThirdTest, HandleColdAcceptWantDone_002, TestS
     auto specifiedRequestPtr = std::make_shared<SpecifiedRequest>(requestId1, abilityRequest);
     specifiedRequestPtr->persistentId = 1;
 
-    uiAbilityLifecycleManager->sessionAbilityMap_ = {
-        {1, nullptr}
-    };
+    uiAbilityLifecycleManager->AddSessionRecord(1, nullptr);
 
     auto ret = uiAbilityLifecycleManager->HandleColdAcceptWantDone(want, "", *specifiedRequestPtr);
 
@@ -1321,9 +1307,7 @@ HWTEST_F(UIAbilityLifecycleManagerThirdTest, HandleColdAcceptWantDone_003, TestS
     auto specifiedRequestPtr = std::make_shared<SpecifiedRequest>(requestId1, abilityRequest);
     specifiedRequestPtr->persistentId = 1;
 
-    uiAbilityLifecycleManager->sessionAbilityMap_ = {
-        {1, abilityRecord}
-    };
+    uiAbilityLifecycleManager->AddSessionRecord(1, abilityRecord);
 
     auto ret = uiAbilityLifecycleManager->HandleColdAcceptWantDone(want, "", *specifiedRequestPtr);
 
@@ -1351,9 +1335,7 @@ HWTEST_F(UIAbilityLifecycleManagerThirdTest, HandleColdAcceptWantDone_004, TestS
     auto specifiedRequestPtr = std::make_shared<SpecifiedRequest>(requestId1, abilityRequest);
     specifiedRequestPtr->persistentId = 1;
 
-    uiAbilityLifecycleManager->sessionAbilityMap_ = {
-        {1, abilityRecord}
-    };
+    uiAbilityLifecycleManager->AddSessionRecord(1, abilityRecord);
 
     auto ret = uiAbilityLifecycleManager->HandleColdAcceptWantDone(want, "", *specifiedRequestPtr);
 
@@ -1521,15 +1503,15 @@ HWTEST_F(UIAbilityLifecycleManagerThirdTest, HandleRestartUIAbility_0100, TestSi
     sessionInfo->callerSession = session2->AsObject();
     EXPECT_FALSE(mgr->HandleRestartUIAbility(sessionInfo));
 
-    mgr->sessionAbilityMap_.emplace(0, nullptr);
+    mgr->AddSessionRecord(0, nullptr);
     AbilityRequest abilityRequest;
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    mgr->sessionAbilityMap_.emplace(1, abilityRecord);
+    mgr->AddSessionRecord(1, abilityRecord);
     auto sessionInfo2 = sptr<SessionInfo>::MakeSptr();
     sessionInfo2->sessionToken = session2->AsObject();
     abilityRequest.sessionInfo = sessionInfo2;
     auto abilityRecord2 = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    mgr->sessionAbilityMap_.emplace(2, abilityRecord2);
+    mgr->AddSessionRecord(2, abilityRecord2);
     EXPECT_FALSE(mgr->HandleRestartUIAbility(sessionInfo));
 
     sessionInfo->callerSession = sessionInfo->sessionToken;
@@ -1547,7 +1529,7 @@ HWTEST_F(UIAbilityLifecycleManagerThirdTest, SignRestartProcess_001, TestSize.Le
 {
     auto mgr = std::make_unique<UIAbilityLifecycleManager>();
     auto pid = 100;
-    mgr->sessionAbilityMap_.emplace(0, nullptr);
+    mgr->AddSessionRecord(0, nullptr);
     mgr->SignRestartProcess(pid);
     EXPECT_FALSE(mgr->sessionAbilityMap_.empty());
 
@@ -1555,11 +1537,12 @@ HWTEST_F(UIAbilityLifecycleManagerThirdTest, SignRestartProcess_001, TestSize.Le
     abilityRequest.appInfo.bundleName = "com.example.unittest";
     abilityRequest.abilityInfo.name = "MainAbility";
     auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
-    mgr->sessionAbilityMap_.emplace(pid, abilityRecord);
+    mgr->AddSessionRecord(pid, abilityRecord);
     mgr->SignRestartProcess(pid);
     EXPECT_FALSE(abilityRecord->GetRestartAppFlag());
 
     abilityRecord->SetPid(pid);
+    mgr->UpdateSessionPid(abilityRecord->GetToken()->AsObject(), pid);
     mgr->SignRestartProcess(pid);
     EXPECT_TRUE(abilityRecord->GetRestartAppFlag());
 }
@@ -1934,5 +1917,71 @@ HWTEST_F(UIAbilityLifecycleManagerThirdTest, SubmitSpecifiedFailTask_002, TestSi
     usleep(TIMEOUT_VALUE);
     EXPECT_EQ(mgr->hookSpecifiedMap_.size(), 0);
 }
+
+/**
+ * @tc.name: UIAbilityLifecycleManager_SessionIndex_001
+ * @tc.desc: records added and erased through the manager are found by token, key and pid
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIAbilityLifecycleManagerThirdTest, SessionIndex_001, TestSize.Level1)
+{
+    auto mgr = std::make_shared<UIAbilityLifecycleManager>();
+    AbilityRequest abilityRequest;
+    abilityRequest.abilityInfo.bundleName = "com.example.unittest";
+    abilityRequest.abilityInfo.moduleName = "entry";
+    abilityRequest.abilityInfo.name = "MainAbility";
+    abilityRequest.abilityInfo.launchMode = AppExecFwk::LaunchMode::SINGLETON;
+    auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
+    auto otherRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
+    mgr->AddSessionRecord(1, abilityRecord);
+
+    auto token = abilityRecord->GetToken()->AsObject();
+    EXPECT_EQ(mgr->GetAbilityRecordByToken(token), abilityRecord);
+    EXPECT_FALSE(mgr->IsContainsAbilityInner(otherRecord->GetToken()->AsObject()));
+    EXPECT_EQ(mgr->FindRecordFromSessionMap(abilityRequest), abilityRecord);
+    bool reuse = false;
+    EXPECT_EQ(mgr->GetPersistentIdByAbilityRequest(abilityRequest, reuse), 1);
+
+    abilityRecord->SetPid(100);
+    mgr->UpdateSessionPid(token, 100);
+    EXPECT_EQ(mgr->GetSessionIdsByPid(100), std::vector<int32_t>{ 1 });
+
+    mgr->AddSessionRecord(1, otherRecord);
+    EXPECT_EQ(mgr->GetAbilityRecordByToken(token), nullptr);
+    EXPECT_TRUE(mgr->GetSessionIdsByPid(100).empty());
+    EXPECT_EQ(mgr->FindRecordFromSessionMap(abilityRequest), otherRecord);
+
+    mgr->EraseAbilityRecord(otherRecord);
+    EXPECT_TRUE(mgr->sessionAbilityMap_.empty());
+    EXPECT_TRUE(mgr->sessionIndexEntries_.empty());
+    EXPECT_TRUE(mgr->tokenIndex_.empty());
+    EXPECT_TRUE(mgr->sessionKeyIndex_.empty());
+    EXPECT_EQ(mgr->FindRecordFromSessionMap(abilityRequest), nullptr);
+}
+
+/**
+ * @tc.name: UIAbilityLifecycleManager_SessionIndex_002
+ * @tc.desc: replacing the record of a session moves its token in the index, null records are indexed by id
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIAbilityLifecycleManagerThirdTest, SessionIndex_002, TestSize.Level1)
+{
+    auto mgr = std::make_shared<UIAbilityLifecycleManager>();
+    AbilityRequest abilityRequest;
+    abilityRequest.abilityInfo.bundleName = "com.example.unittest";
+    auto abilityRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
+    auto otherRecord = UIAbilityRecord::CreateAbilityRecord(abilityRequest);
+    abilityRecord->SetPid(100);
+    mgr->AddSessionRecord(1, abilityRecord);
+    mgr->AddSessionRecord(2, nullptr);
+
+    EXPECT_EQ(mgr->GetSessionIdByAbilityToken(abilityRecord->GetToken()->AsObject()), 1);
+    EXPECT_EQ(mgr->GetSessionIdsByPid(100), std::vector<int32_t>{ 1 });
+    EXPECT_EQ(mgr->sessionIndexEntries_.size(), 2);
+
+    mgr->AddSessionRecord(1, otherRecord);
+    EXPECT_EQ(mgr->GetAbilityRecordByToken(abilityRecord->GetToken()->AsObject()), nullptr);
+    EXPECT_EQ(mgr->GetAbilityRecordByToken(otherRecord->GetToken()->AsObject()), otherRecord);
+}
 }  // namespace AAFwk
 }  // namespace OHOS
\ No newline at end of file
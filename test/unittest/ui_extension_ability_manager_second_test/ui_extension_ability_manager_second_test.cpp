@@ -845,7 +845,7 @@ HWTEST_F(UIExtensionAbilityManagerSecondTest, AttachAbilityThreadInner_005, Test
     element.SetModuleName(abilityRequest.abilityInfo.moduleName);
     element.SetAbilityName(abilityRequest.abilityInfo.name);
     std::string serviceKey = element.GetURI();
-    connectManager->serviceMap_[serviceKey] = abilityRecord;
+    connectManager->AddToServiceMap(serviceKey, abilityRecord);
 
     sptr<IAbilityScheduler> scheduler = sptr<IAbilityScheduler>(new AbilityScheduler());
     sptr<IRemoteObject> token = abilityRecord->GetToken();
@@ -1162,7 +1162,7 @@ HWTEST_F(UIExtensionAbilityManagerSecondTest, UpdateUIExtensionInfo_001, TestSiz
     element.SetModuleName(abilityRequest.abilityInfo.moduleName);
     element.SetAbilityName(abilityRequest.abilityInfo.name);
     std::string serviceKey = element.GetURI();
-    connectManager->serviceMap_[serviceKey] = abilityRecord;
+    connectManager->AddToServiceMap(serviceKey, abilityRecord);
 
     int32_t hostPid = 1234;
 
@@ -1200,7 +1200,7 @@ HWTEST_F(UIExtensionAbilityManagerSecondTest, TerminateAbilityInner_001, TestSiz
     element.SetModuleName(abilityRequest.abilityInfo.moduleName);
     element.SetAbilityName(abilityRequest.abilityInfo.name);
     std::string serviceKey = element.GetURI();
-    connectManager->serviceMap_[serviceKey] = abilityRecord;
+    connectManager->AddToServiceMap(serviceKey, abilityRecord);
 
     sptr<IRemoteObject> token = abilityRecord->GetToken();
 
@@ -1576,7 +1576,7 @@ HWTEST_F(UIExtensionAbilityManagerSecondTest, TerminateAbilityInner_003, TestSiz
 
     // Add record to serviceMap (simulating a normal record)
     std::string serviceKey = "com.example.uiextension#MainUIExtension#entry";
-    connectManager->serviceMap_[serviceKey] = abilityRecord;
+    connectManager->AddToServiceMap(serviceKey, abilityRecord);
 
     auto ret = connectManager->TerminateAbilityInner(token);
     EXPECT_EQ(ret, ERR_OK);
@@ -1607,7 +1607,7 @@ HWTEST_F(UIExtensionAbilityManagerSecondTest, TerminateAbilityInner_002, TestSiz
     auto callback = new AbilityConnectCallback();
     abilityRecord->connRecordList_.push_back(
         std::make_shared<ConnectionRecord>(token, abilityRecord, callback, nullptr));
-    connectManager->serviceMap_["test"] = abilityRecord;
+    connectManager->AddToServiceMap("test", abilityRecord);
 
     auto ret = connectManager->TerminateAbilityInner(token);
     EXPECT_EQ(ret, ERR_OK); // Should not actually terminate because of connections
@@ -1674,7 +1674,7 @@ HWTEST_F(UIExtensionAbilityManagerSecondTest, HandleExtensionAbilityRemove_002,
     element.SetModuleName(abilityRequest.abilityInfo.moduleName);
     element.SetAbilityName(abilityRequest.abilityInfo.name);
     std::string serviceKey = element.GetURI();
-    connectManager->serviceMap_[serviceKey] = abilityRecord;
+    connectManager->AddToServiceMap(serviceKey, abilityRecord);
 
     bool result = connectManager->HandleExtensionAbilityRemove(abilityRecord);
     EXPECT_TRUE(result);
@@ -1741,7 +1741,7 @@ HWTEST_F(UIExtensionAbilityManagerSecondTest, CleanupConnectionAndTerminateIfNee
     element.SetModuleName(abilityRequest.abilityInfo.moduleName);
     element.SetAbilityName(abilityRequest.abilityInfo.name);
     std::string serviceKey = element.GetURI();
-    connectManager->serviceMap_[serviceKey] = abilityRecord;
+    connectManager->AddToServiceMap(serviceKey, abilityRecord);
 
     int32_t result = connectManager->CleanupConnectionAndTerminateIfNeeded(abilityRecord);
     EXPECT_EQ(result, ERR_OK);
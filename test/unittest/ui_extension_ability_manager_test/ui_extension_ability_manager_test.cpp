@@ -816,13 +816,13 @@ HWTEST_F(UIExtensionAbilityManagerTest, AAFwk_AbilityMS_PauseExtensions_001, Tes
     ASSERT_NE(connectManager, nullptr);
     std::shared_ptr<BaseExtensionRecord> abilityRecord1 = serviceRecord_;
     abilityRecord1->abilityInfo_.type = AbilityType::PAGE;
-    connectManager->serviceMap_.emplace("first", abilityRecord1);
+    connectManager->AddToServiceMap("first", abilityRecord1);
     std::shared_ptr<BaseExtensionRecord> abilityRecord2 = BaseExtensionRecord::CreateBaseExtensionRecord(
         abilityRequest_);
     abilityRecord2->abilityInfo_.type = AbilityType::EXTENSION;
     abilityRecord2->abilityInfo_.name = AbilityConfig::LAUNCHER_ABILITY_NAME;
     abilityRecord2->abilityInfo_.bundleName = AbilityConfig::LAUNCHER_BUNDLE_NAME;
-    connectManager->serviceMap_.emplace("second", abilityRecord2);
+    connectManager->AddToServiceMap("second", abilityRecord2);
     connectManager->PauseExtensions();
 }
 
@@ -839,11 +839,11 @@ HWTEST_F(UIExtensionAbilityManagerTest, AAFwk_AbilityMS_SignRestartAppFlag_001,
     std::string bundleName = "testBundleName";
     std::shared_ptr<BaseExtensionRecord> abilityRecord1 = serviceRecord_;
     abilityRecord1->abilityInfo_.bundleName = bundleName;
-    connectManager->serviceMap_.emplace("first", abilityRecord1);
+    connectManager->AddToServiceMap("first", abilityRecord1);
     std::shared_ptr<BaseExtensionRecord> abilityRecord2 = BaseExtensionRecord::CreateBaseExtensionRecord(
         abilityRequest_);
     abilityRecord2->abilityInfo_.bundleName = "errTestBundleName";
-    connectManager->serviceMap_.emplace("second", abilityRecord2);
+    connectManager->AddToServiceMap("second", abilityRecord2);
     int32_t uid = 100;
     connectManager->SignRestartAppFlag(uid, "");
 }
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#define private public
+#include "uri_grant_store.h"
+#undef private
+
+using namespace testing::ext;
+namespace OHOS {
+namespace AAFwk {
+namespace {
+constexpr uint32_t FLAG_READ = 1;
+constexpr uint32_t FLAG_WRITE = 2;
+}
+
+class UriGrantStoreTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+};
+
+/*
+ * Feature: UriGrantStore
+ * Function: Add/Verify
+ * SubFunction: NA
+ * FunctionPoints: Records of the same token pair are merged, write grant also allows read
+ */
+HWTEST_F(UriGrantStoreTest, UriGrantStore_Verify_001, TestSize.Level1)
+{
+    UriGrantStore store;
+    std::string uri = "file://docs/storage/Users/currentUser/a.txt?networkid=1001";
+    store.Add(uri, FLAG_READ, 1, 2);
+    EXPECT_TRUE(store.Verify(uri, FLAG_READ, 2));
+    EXPECT_FALSE(store.Verify(uri, FLAG_WRITE, 2));
+    EXPECT_FALSE(store.Verify(uri, FLAG_READ, 1));
+
+    store.Add(uri, FLAG_WRITE, 1, 2);
+    EXPECT_EQ(store.Size(), 1);
+    EXPECT_TRUE(store.Verify(uri, FLAG_WRITE, 2));
+    EXPECT_TRUE(store.Verify(uri, FLAG_READ, 2));
+}
+
+/*
+ * Feature: UriGrantStore
+ * Function: VerifySubDir
+ * SubFunction: NA
+ * FunctionPoints: A grant of a parent directory covers uris below it with the same network id
+ */
+HWTEST_F(UriGrantStoreTest, UriGrantStore_VerifySubDir_001, TestSize.Level1)
+{
+    UriGrantStore store;
+    store.Add("file://docs/storage/Users/currentUser/dir?networkid=1001", FLAG_READ, 1, 2);
+    EXPECT_TRUE(store.Verify("file://docs/storage/Users/currentUser/dir/sub/a.txt?networkid=1001", FLAG_READ, 2));
+    EXPECT_FALSE(store.Verify("file://docs/storage/Users/currentUser/dir/a.txt?networkid=1002", FLAG_READ, 2));
+    EXPECT_FALSE(store.Verify("file://docs/storage/Users/currentUser/dir2/a.txt?networkid=1001", FLAG_READ, 2));
+    EXPECT_FALSE(store.Verify("file://docs/storage/Users/currentUser/dir/a.txt", FLAG_READ, 2));
+
+    // only the shallowest granted parent is checked
+    store.Add("file://docs/storage/Users/currentUser?networkid=1001", FLAG_READ, 1, 3);
+    EXPECT_FALSE(store.Verify("file://docs/storage/Users/currentUser/dir/sub/a.txt?networkid=1001", FLAG_READ, 2));
+    EXPECT_TRUE(store.Verify("file://docs/storage/Users/currentUser/dir/sub/a.txt?networkid=1001", FLAG_READ, 3));
+}
+
+/*
+ * Feature: UriGrantStore
+ * Function: VerifyBatch
+ * SubFunction: NA
+ * FunctionPoints: Batch result matches single verify for every uri
+ */
+HWTEST_F(UriGrantStoreTest, UriGrantStore_VerifyBatch_001, TestSize.Level1)
+{
+    UriGrantStore store;
+    std::vector<std::string> uris;
+    for (int32_t i = 0; i < 100; i++) {
+        uris.emplace_back("file://docs/storage/Users/currentUser/" + std::to_string(i) + ".jpg?networkid=1001");
+        if (i % 2 == 0) {
+            store.Add(uris.back(), FLAG_READ, 1, 2);
+        }
+    }
+    auto result = store.VerifyBatch(uris, FLAG_READ, 2);
+    ASSERT_EQ(result.size(), uris.size());
+    for (size_t i = 0; i < uris.size(); i++) {
+        EXPECT_EQ(result[i], i % 2 == 0);
+        EXPECT_EQ(result[i], store.Verify(uris[i], FLAG_READ, 2));
+    }
+}
+
+/*
+ * Feature: UriGrantStore
+ * Function: RevokeByTarget
+ * SubFunction: NA
+ * FunctionPoints: Only records granted to the token are removed and the token index is cleaned
+ */
+HWTEST_F(UriGrantStoreTest, UriGrantStore_RevokeByTarget_001, TestSize.Level1)
+{
+    UriGrantStore store;
+    std::string uri1 = "file://docs/a.txt?networkid=1001";
+    std::string uri2 = "file://docs/b.txt?networkid=1001";
+    store.Add(uri1, FLAG_READ, 1, 2);
+    store.Add(uri1, FLAG_READ, 1, 3);
+    store.Add(uri2, FLAG_READ, 1, 2);
+
+    std::vector<std::string> uriList;
+    EXPECT_EQ(store.RevokeByTarget(2, uriList), 2);
+    EXPECT_EQ(uriList.size(), 2);
+    EXPECT_TRUE(store.Contains(uri1));
+    EXPECT_FALSE(store.Contains(uri2));
+    EXPECT_TRUE(store.Verify(uri1, FLAG_READ, 3));
+    EXPECT_FALSE(store.Verify(uri1, FLAG_READ, 2));
+
+    uriList.clear();
+    EXPECT_EQ(store.RevokeByTarget(2, uriList), 0);
+    EXPECT_TRUE(uriList.empty());
+    EXPECT_EQ(store.RevokeByTarget(3, uriList), 1);
+    EXPECT_EQ(store.Size(), 0);
+    for (const auto &shard : store.shards_) {
+        EXPECT_TRUE(shard.tokenIndex.empty());
+        EXPECT_TRUE(shard.authorityIndex.empty());
+    }
+}
+
+/*
+ * Feature: UriGrantStore
+ * Function: RevokeAll/RevokeOne
+ * SubFunction: NA
+ * FunctionPoints: Uris of the authority and records of the token are removed
+ */
+HWTEST_F(UriGrantStoreTest, UriGrantStore_RevokeAll_001, TestSize.Level1)
+{
+    UriGrantStore store;
+    std::string ownUri = "file://com.example.a/data/a.txt";
+    std::string fromUri = "file://docs/a.txt?networkid=1001";
+    std::string otherUri = "file://docs/b.txt?networkid=1001";
+    store.Add(ownUri, FLAG_READ, 5, 6);
+    store.Add(fromUri, FLAG_READ, 1, 2);
+    store.Add(otherUri, FLAG_READ, 3, 4);
+
+    std::map<uint32_t, std::vector<std::string>> uriLists;
+    store.RevokeAll(1, "com.example.a", uriLists);
+    EXPECT_EQ(uriLists.size(), 2);
+    EXPECT_EQ(uriLists[6].front(), ownUri);
+    EXPECT_EQ(uriLists[2].front(), fromUri);
+    EXPECT_FALSE(store.Contains(ownUri));
+    EXPECT_FALSE(store.Contains(fromUri));
+    EXPECT_TRUE(store.Contains(otherUri));
+
+    std::vector<std::string> uriList;
+    EXPECT_FALSE(store.RevokeOne(fromUri, 1, 2, false, uriList));
+    EXPECT_TRUE(store.RevokeOne(otherUri, 1, 4, false, uriList));
+    EXPECT_TRUE(uriList.empty());
+    EXPECT_TRUE(store.RevokeOne(otherUri, 1, 4, true, uriList));
+    EXPECT_EQ(uriList.size(), 1);
+    EXPECT_EQ(store.Size(), 0);
+}
+
+/*
+ * Feature: UriGrantStore
+ * Function: VerifyBatch/RevokeByTarget
+ * SubFunction: NA
+ * FunctionPoints: Grants of many targets spread over the shards
+ */
+HWTEST_F(UriGrantStoreTest, UriGrantStore_RevokeByTarget_002, TestSize.Level1)
+{
+    constexpr int32_t uriCount = 2000;
+    constexpr uint32_t targetTokenCount = 100;
+    UriGrantStore store;
+    std::vector<std::string> uris;
+    for (int32_t i = 0; i < uriCount; i++) {
+        uris.emplace_back("file://docs/storage/Users/currentUser/Photos/" + std::to_string(i) +
+            ".jpg?networkid=1001");
+        store.Add(uris.back(), FLAG_READ, 1, 2 + i % targetTokenCount);
+    }
+    std::vector<std::string> batch;
+    for (int32_t i = 0; i < uriCount; i += targetTokenCount) {
+        batch.push_back(uris[i]);
+    }
+    auto result = store.VerifyBatch(batch, FLAG_READ, 2);
+    EXPECT_EQ(std::count(result.begin(), result.end(), true), static_cast<int64_t>(batch.size()));
+    result = store.VerifyBatch(batch, FLAG_READ, 3);
+    EXPECT_EQ(std::count(result.begin(), result.end(), true), 0);
+
+    std::vector<std::string> uriList;
+    EXPECT_EQ(store.RevokeByTarget(2, uriList), static_cast<int32_t>(batch.size()));
+    std::sort(uriList.begin(), uriList.end());
+    std::sort(batch.begin(), batch.end());
+    EXPECT_EQ(uriList, batch);
+    EXPECT_EQ(store.Size(), static_cast<size_t>(uriCount) - batch.size());
+    EXPECT_TRUE(store.Verify(uris[1], FLAG_READ, 3));
+}
+}  // namespace AAFwk
+}  // namespace OHOS
@@ -362,9 +362,8 @@ HWTEST_F(UriPermissionImplTest, Upms_GrantUriPermission_013, TestSize.Level1)
     uint32_t targetTokenId = 3;
     std::string targetBundleName = "name2";
     GrantInfo info = { tmpFlag, fromTokenId, targetTokenId };
-    std::list<GrantInfo> infoList = { info };
     auto uriStr = "file://com.example.test/data/storage/el2/base/haps/entry/files/test_A.txt";
-    upms->uriMap_.emplace(uriStr, infoList);
+    upms->grantStore_.Add(uriStr, info.flag, info.fromTokenId, info.targetTokenId);
     std::vector<std::string> uriStrVec = { uriStr };
 
     UriPermissionRawData rawData;
@@ -397,9 +396,8 @@ HWTEST_F(UriPermissionImplTest, Upms_GrantUriPermission_014, TestSize.Level1)
     uint32_t targetTokenId = 3;
     std::string targetBundleName = "name2";
     GrantInfo info = { tmpFlag, fromTokenId, targetTokenId };
-    std::list<GrantInfo> infoList = { info };
     auto uriStr = "file://com.example.test/data/storage/el2/base/haps/entry/files/test_A.txt";
-    upms->uriMap_.emplace(uriStr, infoList);
+    upms->grantStore_.Add(uriStr, info.flag, info.fromTokenId, info.targetTokenId);
     std::vector<std::string> uriStrVec = { uriStr };
 
     UriPermissionRawData rawData;
@@ -433,9 +431,8 @@ HWTEST_F(UriPermissionImplTest, Upms_GrantUriPermission_015, TestSize.Level1)
     uint32_t targetTokenId = 3;
     std::string targetBundleName = "name2";
     GrantInfo info = { tmpFlag, fromTokenId, targetTokenId };
-    std::list<GrantInfo> infoList = { info };
     auto uriStr = "file://com.example.test/data/storage/el2/base/haps/entry/files/test_A.txt";
-    upms->uriMap_.emplace(uriStr, infoList);
+    upms->grantStore_.Add(uriStr, info.flag, info.fromTokenId, info.targetTokenId);
     std::vector<std::string> uriStrVec = { uriStr };
 
     UriPermissionRawData rawData;
@@ -726,10 +723,10 @@ HWTEST_F(UriPermissionImplTest, UPMS_RevokeMapUriPermission_001, TestSize.Level1
     auto targetTokenId = 1002;
     std::string uri = "file://docs/DestTop/Text/test_001.txt";
     upms->AddTempUriPermission(uri, 1, callerTokenId, targetTokenId);
-    bool recordExists = (upms->uriMap_.find(uri) != upms->uriMap_.end());
+    bool recordExists = (upms->grantStore_.Contains(uri));
     EXPECT_EQ(recordExists, true);
     upms->RevokeMapUriPermission(targetTokenId);
-    recordExists = (upms->uriMap_.find(uri) != upms->uriMap_.end());
+    recordExists = (upms->grantStore_.Contains(uri));
     EXPECT_EQ(recordExists, false);
 }
 
@@ -748,10 +745,10 @@ HWTEST_F(UriPermissionImplTest, UPMS_RevokeMapUriPermission_002, TestSize.Level1
     auto targetTokenId1 = 1003;
     std::string uri = "file://docs/DestTop/Text/test_001.txt";
     upms->AddTempUriPermission(uri, 1, callerTokenId, targetTokenId);
-    bool recordExists = (upms->uriMap_.find(uri) != upms->uriMap_.end());
+    bool recordExists = (upms->grantStore_.Contains(uri));
     EXPECT_EQ(recordExists, true);
     upms->RevokeMapUriPermission(targetTokenId1);
-    recordExists = (upms->uriMap_.find(uri) != upms->uriMap_.end());
+    recordExists = (upms->grantStore_.Contains(uri));
     EXPECT_EQ(recordExists, true);
 }
 
@@ -791,7 +788,7 @@ HWTEST_F(UriPermissionImplTest, Upms_VerifyUriPermission_001, TestSize.Level1)
     EXPECT_EQ(funcResult, false);
     upms->VerifyUriPermission(Uri(uri), flagReadWrite, targetTokenId, funcResult);
     EXPECT_EQ(funcResult, false);
-    upms->uriMap_.clear();
+    upms->grantStore_.Clear();
 
     // write
     upms->AddTempUriPermission(uri, flagWrite, callerTokenId, targetTokenId);
@@ -801,7 +798,7 @@ HWTEST_F(UriPermissionImplTest, Upms_VerifyUriPermission_001, TestSize.Level1)
     EXPECT_EQ(funcResult, true);
     upms->VerifyUriPermission(Uri(uri), flagReadWrite, targetTokenId, funcResult);
     EXPECT_EQ(funcResult, true);
-    upms->uriMap_.clear();
+    upms->grantStore_.Clear();
 
     // flagReadWrite
     upms->AddTempUriPermission(uri, flagReadWrite, callerTokenId, targetTokenId);
@@ -811,7 +808,7 @@ HWTEST_F(UriPermissionImplTest, Upms_VerifyUriPermission_001, TestSize.Level1)
     EXPECT_EQ(funcResult, true);
     upms->VerifyUriPermission(Uri(uri), flagReadWrite, targetTokenId, funcResult);
     EXPECT_EQ(funcResult, true);
-    upms->uriMap_.clear();
+    upms->grantStore_.Clear();
     
     // no permission record
     upms->AddTempUriPermission(uri, flagReadWrite, callerTokenId, targetTokenId);
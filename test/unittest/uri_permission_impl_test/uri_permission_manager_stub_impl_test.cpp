@@ -145,53 +145,6 @@ HWTEST_F(UriPermissionManagerStubImplTest, Upmsi_VerifyUriPermission_003, TestSi
     EXPECT_EQ(result, ERR_OK);
 }
 
-/*
- * Feature: UriPermissionManagerService
- * Function: VerifySubDirUriPermission
- * SubFunction: NA
- * FunctionPoints: UriPermissionManagerService VerifySubDirUriPermission
- */
-HWTEST_F(UriPermissionManagerStubImplTest, Upmsi_VerifySubDirUriPermission_001, TestSize.Level1)
-{
-    auto upmsi = std::make_shared<UriPermissionManagerStubImpl>();
-    upmsi->uriMap_.clear();
-    std::string uriStr = "?networkid=";
-    uint32_t newFlag = 1;
-    uint32_t tokenId = 1;
-    auto result = upmsi->VerifySubDirUriPermission(uriStr, newFlag, tokenId);
-    EXPECT_FALSE(result);
-}
-
-/*
- * Feature: UriPermissionManagerService
- * Function: IsDistributedSubDirUri
- * SubFunction: NA
- * FunctionPoints: UriPermissionManagerService IsDistributedSubDirUri
- */
-HWTEST_F(UriPermissionManagerStubImplTest, Upmsi_IsDistributedSubDirUri_001, TestSize.Level1)
-{
-    auto upmsi = std::make_shared<UriPermissionManagerStubImpl>();
-    std::string inputUri = "";
-    std::string cachedUri = "";
-    auto result = upmsi->IsDistributedSubDirUri(inputUri, cachedUri);
-    EXPECT_FALSE(result);
-}
-
-/*
- * Feature: UriPermissionManagerService
- * Function: IsDistributedSubDirUri
- * SubFunction: NA
- * FunctionPoints: UriPermissionManagerService IsDistributedSubDirUri
- */
-HWTEST_F(UriPermissionManagerStubImplTest, Upmsi_IsDistributedSubDirUri_002, TestSize.Level1)
-{
-    auto upmsi = std::make_shared<UriPermissionManagerStubImpl>();
-    std::string inputUri = "file://home/user/shared_folder?networkid=12345";
-    std::string cachedUri = "file://home/user?networkid=12345";
-    auto result = upmsi->IsDistributedSubDirUri(inputUri, cachedUri);
-    EXPECT_TRUE(result);
-}
-
 /*
  * Feature: UriPermissionManagerService
  * Function: GrantUriPermission
@@ -362,7 +315,7 @@ HWTEST_F(UriPermissionManagerStubImplTest, Upmsi_AddTempUriPermission_001, TestS
     TokenId fromTokenId = 1;
     TokenId targetTokenId = 1;
     GrantInfo info = { flag, fromTokenId, targetTokenId };
-    upmsi->uriMap_.insert({ uri, { info } });
+    upmsi->grantStore_.Add(uri, info.flag, info.fromTokenId, info.targetTokenId);
     auto result = upmsi->AddTempUriPermission(uri, flag, fromTokenId, targetTokenId);
     EXPECT_EQ(result, ERR_OK);
 }
@@ -381,7 +334,7 @@ HWTEST_F(UriPermissionManagerStubImplTest, Upmsi_AddTempUriPermission_002, TestS
     TokenId fromTokenId = 1;
     TokenId targetTokenId = 1;
     GrantInfo info = { 0, 0, 0 };
-    upmsi->uriMap_.insert({ uri, { info } });
+    upmsi->grantStore_.Add(uri, info.flag, info.fromTokenId, info.targetTokenId);
     auto result = upmsi->AddTempUriPermission(uri, flag, fromTokenId, targetTokenId);
     EXPECT_EQ(result, ERR_OK);
 }
@@ -628,7 +581,7 @@ HWTEST_F(UriPermissionManagerStubImplTest, Upmsi_RevokeAllMapUriPermissions_001,
     auto upmsi = std::make_shared<UriPermissionManagerStubImpl>();
     MyFlag::bundleName_ = "callerAuthority";
     GrantInfo info = { 1, 1, 1 };
-    upmsi->uriMap_.insert({ "uri://callerAuthority", { info } });
+    upmsi->grantStore_.Add("uri://callerAuthority", info.flag, info.fromTokenId, info.targetTokenId);
     uint32_t tokenId = 1;
     auto result = upmsi->RevokeAllMapUriPermissions(tokenId);
     EXPECT_EQ(result, 0);
@@ -645,10 +598,10 @@ HWTEST_F(UriPermissionManagerStubImplTest, Upmsi_RevokeAllMapUriPermissions_002,
     auto upmsi = std::make_shared<UriPermissionManagerStubImpl>();
     MyFlag::bundleName_ = "bundleName";
     GrantInfo info = { 1, 1, 1 };
-    upmsi->uriMap_.insert({ "uri://callerAuthority", { info } });
+    upmsi->grantStore_.Add("uri://callerAuthority", info.flag, info.fromTokenId, info.targetTokenId);
     uint32_t tokenId = 1;
     auto result = upmsi->RevokeAllMapUriPermissions(tokenId);
-    EXPECT_EQ(upmsi->uriMap_.size(), 0);
+    EXPECT_EQ(upmsi->grantStore_.Size(), 0);
     EXPECT_EQ(result, 0);
 }
 
@@ -682,7 +635,7 @@ HWTEST_F(UriPermissionManagerStubImplTest, Upmsi_RevokeUriPermissionManually_001
 HWTEST_F(UriPermissionManagerStubImplTest, Upmsi_RevokeUriPermissionManuallyInner_001, TestSize.Level1)
 {
     auto upmsi = std::make_shared<UriPermissionManagerStubImpl>();
-    upmsi->uriMap_.clear();
+    upmsi->grantStore_.Clear();
     Uri uri("uri://content");
     uint32_t targetTokenId = 1;
     MyFlag::isDocsCloudUri_ = true;
@@ -699,7 +652,7 @@ HWTEST_F(UriPermissionManagerStubImplTest, Upmsi_RevokeUriPermissionManuallyInne
 HWTEST_F(UriPermissionManagerStubImplTest, Upmsi_RevokeUriPermissionManuallyInner_002, TestSize.Level1)
 {
     auto upmsi = std::make_shared<UriPermissionManagerStubImpl>();
-    upmsi->uriMap_.clear();
+    upmsi->grantStore_.Clear();
     MockMediaPermFeature::revokeRet = -1; // media revoke fails (returns -1)
     Uri uri("uri://media");
     uint32_t targetTokenId = 1;
@@ -720,7 +673,7 @@ HWTEST_F(UriPermissionManagerStubImplTest, Upmsi_RevokeMapUriPermissionManually_
     uint32_t callerTokenId = 1;
     uint32_t targetTokenId = 1;
     Uri uri("uri");
-    upmsi->uriMap_.clear();
+    upmsi->grantStore_.Clear();
     auto result = upmsi->RevokeMapUriPermissionManually(callerTokenId, targetTokenId, uri);
     EXPECT_EQ(result, ERR_OK);
 }
@@ -738,10 +691,10 @@ HWTEST_F(UriPermissionManagerStubImplTest, Upmsi_RevokeMapUriPermissionManually_
     uint32_t targetTokenId = 1;
     Uri uri("uri");
     GrantInfo info = { 1, 1, 1 };
-    upmsi->uriMap_.clear();
-    upmsi->uriMap_.insert({ uri.ToString(), { info } });
+    upmsi->grantStore_.Clear();
+    upmsi->grantStore_.Add(uri.ToString(), info.flag, info.fromTokenId, info.targetTokenId);
     auto result = upmsi->RevokeMapUriPermissionManually(callerTokenId, targetTokenId, uri);
-    EXPECT_EQ(upmsi->uriMap_.size(), 0);
+    EXPECT_EQ(upmsi->grantStore_.Size(), 0);
     EXPECT_EQ(result, ERR_OK);
 }
 